@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_bitreversal2_host.c    
+*    
+* Description:  C version of arm_bitreversal2.S for host builds of the library.    
+*    
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*    
+ * The table holds pairs of byte offsets of the 32-bit complex values to swap.    
+ */
+void arm_bitreversal_32(
+  uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint32_t i, a, b, tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 2;
+    b = pBitRevTab[i + 1u] >> 2;
+
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    tmp = pSrc[a + 1u];
+    pSrc[a + 1u] = pSrc[b + 1u];
+    pSrc[b + 1u] = tmp;
+  }
+}
+
+/*    
+ * Same table as for 32-bit values, halved for the 16-bit complex values.    
+ */
+void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint32_t *pSrc32 = (uint32_t *) pSrc;
+  uint32_t i, a, b, tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 3;
+    b = pBitRevTab[i + 1u] >> 3;
+
+    tmp = pSrc32[a];
+    pSrc32[a] = pSrc32[b];
+    pSrc32[b] = tmp;
+  }
+}
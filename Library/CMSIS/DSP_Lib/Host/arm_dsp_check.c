@@ -0,0 +1,2898 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_dsp_check.c
+*
+* Description:  Host accuracy and throughput check of the DSP library.
+*               Functions of every group are run on random inputs and
+*               compared with double-precision references computed
+*               from the same quantized inputs. For each block size the
+*               SNR, the maximum absolute error and the time per call
+*               are printed, one line per function and size:
+*
+*               group function type size snr_db max_err ns_call ns_sample status
+*
+*               The status is FAIL when the SNR is below the limit of
+*               the function. With -b, the output of an earlier run is
+*               the baseline: LOSS flags an SNR more than 1 dB below it
+*               and SLOW a time per sample more than -s percent above it.
+*               The exit code is 1 if any line is not "ok".
+*
+*               Usage: arm_dsp_check [-q] [-t seconds] [-b baseline] [-s percent] [pattern...]
+*                 -q          accuracy only, no timing
+*                 -t seconds  minimum timing per function and size, default 0.02
+*                 pattern     only the functions or groups containing one of the patterns
+*
+*               Build and run with "make check" in this directory.
+*
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#define MAX_SIZE        1024
+#define BUF_LEN         (4 * MAX_SIZE + 64)
+#define MAX_BASELINE    1024
+
+/* PI of arm_math.h is single precision */
+#define PI_D            3.14159265358979323846
+
+/* FIR filters */
+#define FIR_TAPS        32
+#define DECIMATE_M      4
+#define INTERPOLATE_L   4
+
+/* Partition length of the FFT FIR filters, the smallest block size */
+#define FIR_FFT_PART    16
+
+/* Second input of the convolutions and correlations */
+#define CONV_LEN        32
+
+/* Biquad cascades, postShift of the fixed-point versions */
+#define BIQUAD_STAGES   2
+#define BIQUAD_SHIFT    1
+#define INTERLEAVED_CHANS 5
+
+/* Arbitrary ratio resampler from 44.1 kHz to 48 kHz, step in 8.24 format */
+#define RESAMPLE_L      16
+#define RESAMPLE_PHASE_LEN 8
+#define RESAMPLE_STEP   15414067u
+
+/* Adaptive, lattice and sparse FIR filters */
+#define LMS_MU          0.5
+#define LMS_NORM_MU     0.5
+#define LATTICE_STAGES  8
+#define SPARSE_TAPS     8
+#define SPARSE_MAX_DELAY 63
+
+/* Goertzel filter bank and sliding DFT */
+#define NUM_BINS        8
+#define SDFT_LEN        64
+
+typedef enum
+{
+  T_F32,
+  T_F64,
+  T_Q31,
+  T_Q15,
+  T_Q7,
+  T_Q63
+} check_type;
+
+static const char *typeNames[] = {"f32", "f64", "q31", "q15", "q7", "q63"};
+
+typedef struct
+{
+  const char *group;
+  const char *name;
+  check_type inType;
+  check_type outType;
+  int outFrac;                     /* Fractional bits of fixed-point outputs, 0 for the input format */
+  const uint16_t *sizes;           /* Zero terminated */
+  double lo, hi;                   /* Range of the random inputs */
+  double minSnr;                   /* Lowest SNR that passes, in dB */
+  void (*prep)(uint32_t n);        /* Optional, initializes the instance and may adjust the inputs */
+  uint32_t (*ref)(uint32_t n);     /* Writes the reference to refD, returns the number of outputs */
+  void (*run)(uint32_t n);         /* Calls the function under test */
+} check_case;
+
+typedef struct
+{
+  char name[48];
+  uint32_t size;
+  double snr;
+  double nsSample;
+} baseline_entry;
+
+static const uint16_t vecSizes[] = {16, 64, 256, 1024, 0};
+static const uint16_t fftSizes[] = {64, 256, 1024, 0};
+static const uint16_t fftLenSizes[] = {256, 512, 1024, 0};
+static const uint16_t dctSizes[] = {128, 512, 0};
+static const uint16_t matSizes[] = {4, 8, 16, 32, 0};
+
+/* Inputs, quantized to the input type of the function, and their exact values */
+static float32_t xf32[BUF_LEN], yf32[BUF_LEN], of32[BUF_LEN];
+static float64_t xf64[BUF_LEN], yf64[BUF_LEN], of64[BUF_LEN];
+static q31_t xq31[BUF_LEN], yq31[BUF_LEN], oq31[BUF_LEN];
+static q15_t xq15[BUF_LEN], yq15[BUF_LEN], oq15[BUF_LEN];
+static q7_t xq7[BUF_LEN], yq7[BUF_LEN], oq7[BUF_LEN];
+static q63_t oq63[BUF_LEN];
+static double xD[BUF_LEN], yD[BUF_LEN], refD[BUF_LEN];
+
+/* Work buffers of the functions that modify their input */
+static float32_t wf32[BUF_LEN];
+static float64_t wf64[BUF_LEN];
+static q31_t wq31[BUF_LEN];
+static q15_t wq15[BUF_LEN], scratch1Q15[BUF_LEN], scratch2Q15[BUF_LEN];
+static q7_t wq7[BUF_LEN];
+
+static check_type inType;
+static double outScale;
+static double minSeconds = 0.02;
+static uint32_t rngState;
+
+static baseline_entry baseline[MAX_BASELINE];
+static uint32_t numBaseline;
+
+/* ----------------------------------------------------------------------
+ * Inputs
+ * ------------------------------------------------------------------- */
+
+/* Own generator, so the inputs do not depend on the C library */
+static double uniform(double lo, double hi)
+{
+  rngState = rngState * 1664525u + 1013904223u;
+  return lo + (hi - lo) * (rngState / 4294967296.0);
+}
+
+static q63_t round_sat(double v, double lim)
+{
+  v = floor(v + 0.5);
+  v = (v > lim - 1) ? lim - 1 : v;
+  v = (v < -lim) ? -lim : v;
+  return (q63_t) v;
+}
+
+static q31_t to_q31(double v) { return (q31_t) round_sat(v * 2147483648.0, 2147483648.0); }
+static q15_t to_q15(double v) { return (q15_t) round_sat(v * 32768.0, 32768.0); }
+static q7_t to_q7(double v) { return (q7_t) round_sat(v * 128.0, 128.0); }
+
+/* Quantizes v to the input type, stores it at index i of x or y and returns the exact value */
+static double set_input(int isY, uint32_t i, double v)
+{
+  switch (inType)
+  {
+  case T_F32:
+    (isY ? yf32 : xf32)[i] = (float32_t) v;
+    v = (isY ? yf32 : xf32)[i];
+    break;
+  case T_F64:
+    (isY ? yf64 : xf64)[i] = v;
+    break;
+  case T_Q31:
+    (isY ? yq31 : xq31)[i] = to_q31(v);
+    v = (isY ? yq31 : xq31)[i] / 2147483648.0;
+    break;
+  case T_Q15:
+    (isY ? yq15 : xq15)[i] = to_q15(v);
+    v = (isY ? yq15 : xq15)[i] / 32768.0;
+    break;
+  default:
+    (isY ? yq7 : xq7)[i] = to_q7(v);
+    v = (isY ? yq7 : xq7)[i] / 128.0;
+    break;
+  }
+  (isY ? yD : xD)[i] = v;
+  return v;
+}
+
+static void fill_inputs(const check_case * c, uint32_t n)
+{
+  uint32_t i;
+
+  rngState = n;
+  for (i = 0; i < BUF_LEN; i++)
+  {
+    set_input(0, i, uniform(c->lo, c->hi));
+    set_input(1, i, uniform(c->lo, c->hi));
+  }
+}
+
+static double out_value(check_type t, uint32_t i)
+{
+  switch (t)
+  {
+  case T_F32:
+    return of32[i];
+  case T_F64:
+    return of64[i];
+  case T_Q31:
+    return oq31[i] * outScale;
+  case T_Q15:
+    return oq15[i] * outScale;
+  case T_Q7:
+    return oq7[i] * outScale;
+  default:
+    return (double) oq63[i] * outScale;
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Basic math
+ * ------------------------------------------------------------------- */
+
+#define RUN_XO(fn, t)  static void run_##fn##_##t(uint32_t n) { arm_##fn##_##t(x##t, o##t, n); }
+#define RUN_XYO(fn, t) static void run_##fn##_##t(uint32_t n) { arm_##fn##_##t(x##t, y##t, o##t, n); }
+
+static uint32_t ref_add(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = xD[i] + yD[i]; return n; }
+static uint32_t ref_sub(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = xD[i] - yD[i]; return n; }
+static uint32_t ref_mult(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = xD[i] * yD[i]; return n; }
+static uint32_t ref_negate(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = -xD[i]; return n; }
+static uint32_t ref_abs(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = fabs(xD[i]); return n; }
+static uint32_t ref_scale(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = 0.75 * xD[i]; return n; }
+static uint32_t ref_offset(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = xD[i] + 0.25; return n; }
+static uint32_t ref_shift(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = 2 * xD[i]; return n; }
+static uint32_t ref_copy(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = xD[i]; return n; }
+
+static uint32_t ref_dot_prod(uint32_t n)
+{
+  uint32_t i;
+
+  refD[0] = 0;
+  for (i = 0; i < n; i++)
+  {
+    refD[0] += xD[i] * yD[i];
+  }
+  return 1;
+}
+
+RUN_XYO(add, f32) RUN_XYO(add, q31) RUN_XYO(add, q15) RUN_XYO(add, q7)
+RUN_XYO(sub, f32) RUN_XYO(sub, q31) RUN_XYO(sub, q15) RUN_XYO(sub, q7)
+RUN_XYO(mult, f32) RUN_XYO(mult, q31) RUN_XYO(mult, q15) RUN_XYO(mult, q7)
+RUN_XO(negate, f32) RUN_XO(negate, q31) RUN_XO(negate, q15) RUN_XO(negate, q7)
+RUN_XO(abs, f32) RUN_XO(abs, q31) RUN_XO(abs, q15) RUN_XO(abs, q7)
+
+static void run_scale_f32(uint32_t n) { arm_scale_f32(xf32, 0.75f, of32, n); }
+static void run_scale_q31(uint32_t n) { arm_scale_q31(xq31, 0x60000000, 0, oq31, n); }
+static void run_scale_q15(uint32_t n) { arm_scale_q15(xq15, 0x6000, 0, oq15, n); }
+static void run_scale_q7(uint32_t n) { arm_scale_q7(xq7, 0x60, 0, oq7, n); }
+static void run_offset_f32(uint32_t n) { arm_offset_f32(xf32, 0.25f, of32, n); }
+static void run_offset_q31(uint32_t n) { arm_offset_q31(xq31, 0x20000000, oq31, n); }
+static void run_offset_q15(uint32_t n) { arm_offset_q15(xq15, 0x2000, oq15, n); }
+static void run_offset_q7(uint32_t n) { arm_offset_q7(xq7, 0x20, oq7, n); }
+static void run_shift_q31(uint32_t n) { arm_shift_q31(xq31, 1, oq31, n); }
+static void run_shift_q15(uint32_t n) { arm_shift_q15(xq15, 1, oq15, n); }
+static void run_shift_q7(uint32_t n) { arm_shift_q7(xq7, 1, oq7, n); }
+static void run_dot_prod_f32(uint32_t n) { arm_dot_prod_f32(xf32, yf32, n, &of32[0]); }
+static void run_dot_prod_q31(uint32_t n) { arm_dot_prod_q31(xq31, yq31, n, &oq63[0]); }
+static void run_dot_prod_q15(uint32_t n) { arm_dot_prod_q15(xq15, yq15, n, &oq63[0]); }
+static void run_dot_prod_q7(uint32_t n) { arm_dot_prod_q7(xq7, yq7, n, &oq31[0]); }
+
+/* ----------------------------------------------------------------------
+ * Complex math, n complex samples
+ * ------------------------------------------------------------------- */
+
+static uint32_t ref_cmplx_conj(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[2 * i];
+    refD[2 * i + 1] = -xD[2 * i + 1];
+  }
+  return 2 * n;
+}
+
+static uint32_t ref_cmplx_dot_prod(uint32_t n)
+{
+  uint32_t i;
+
+  refD[0] = refD[1] = 0;
+  for (i = 0; i < n; i++)
+  {
+    refD[0] += xD[2 * i] * yD[2 * i] - xD[2 * i + 1] * yD[2 * i + 1];
+    refD[1] += xD[2 * i] * yD[2 * i + 1] + xD[2 * i + 1] * yD[2 * i];
+  }
+  return 2;
+}
+
+static uint32_t ref_cmplx_mag(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = sqrt(xD[2 * i] * xD[2 * i] + xD[2 * i + 1] * xD[2 * i + 1]);
+  }
+  return n;
+}
+
+static uint32_t ref_cmplx_mag_squared(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = xD[2 * i] * xD[2 * i] + xD[2 * i + 1] * xD[2 * i + 1];
+  }
+  return n;
+}
+
+static uint32_t ref_cmplx_mult_cmplx(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[2 * i] * yD[2 * i] - xD[2 * i + 1] * yD[2 * i + 1];
+    refD[2 * i + 1] = xD[2 * i] * yD[2 * i + 1] + xD[2 * i + 1] * yD[2 * i];
+  }
+  return 2 * n;
+}
+
+static uint32_t ref_cmplx_mult_real(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[2 * i] * yD[i];
+    refD[2 * i + 1] = xD[2 * i + 1] * yD[i];
+  }
+  return 2 * n;
+}
+
+RUN_XO(cmplx_conj, f32) RUN_XO(cmplx_conj, q31) RUN_XO(cmplx_conj, q15)
+RUN_XO(cmplx_mag, f32) RUN_XO(cmplx_mag, q31) RUN_XO(cmplx_mag, q15)
+RUN_XO(cmplx_mag_squared, f32) RUN_XO(cmplx_mag_squared, q31) RUN_XO(cmplx_mag_squared, q15)
+RUN_XYO(cmplx_mult_cmplx, f32) RUN_XYO(cmplx_mult_cmplx, q31) RUN_XYO(cmplx_mult_cmplx, q15)
+RUN_XYO(cmplx_mult_real, f32) RUN_XYO(cmplx_mult_real, q31) RUN_XYO(cmplx_mult_real, q15)
+
+static void run_cmplx_dot_prod_f32(uint32_t n) { arm_cmplx_dot_prod_f32(xf32, yf32, n, &of32[0], &of32[1]); }
+static void run_cmplx_dot_prod_q31(uint32_t n) { arm_cmplx_dot_prod_q31(xq31, yq31, n, &oq63[0], &oq63[1]); }
+static void run_cmplx_dot_prod_q15(uint32_t n) { arm_cmplx_dot_prod_q15(xq15, yq15, n, &oq31[0], &oq31[1]); }
+
+/* ----------------------------------------------------------------------
+ * Controller
+ * ------------------------------------------------------------------- */
+
+#define PID_KP          0.5
+#define PID_KI          0.01
+#define PID_KD          0.05
+
+/* Park transform angle */
+#define PARK_SIN        0.6
+#define PARK_COS        0.8
+
+static arm_pid_instance_f32 pidF32;
+static arm_pid_instance_q31 pidQ31;
+static arm_pid_instance_q15 pidQ15;
+static double pidKp, pidKi, pidKd;
+static double parkSin, parkCos;
+
+static void prep_pid_f32(uint32_t n)
+{
+  pidF32.Kp = PID_KP;
+  pidF32.Ki = PID_KI;
+  pidF32.Kd = PID_KD;
+  arm_pid_init_f32(&pidF32, 1);
+  pidKp = pidF32.Kp;
+  pidKi = pidF32.Ki;
+  pidKd = pidF32.Kd;
+}
+
+static void prep_pid_q31(uint32_t n)
+{
+  pidQ31.Kp = to_q31(PID_KP);
+  pidQ31.Ki = to_q31(PID_KI);
+  pidQ31.Kd = to_q31(PID_KD);
+  arm_pid_init_q31(&pidQ31, 1);
+  pidKp = pidQ31.Kp / 2147483648.0;
+  pidKi = pidQ31.Ki / 2147483648.0;
+  pidKd = pidQ31.Kd / 2147483648.0;
+}
+
+static void prep_pid_q15(uint32_t n)
+{
+  pidQ15.Kp = to_q15(PID_KP);
+  pidQ15.Ki = to_q15(PID_KI);
+  pidQ15.Kd = to_q15(PID_KD);
+  arm_pid_init_q15(&pidQ15, 1);
+  pidKp = pidQ15.Kp / 32768.0;
+  pidKi = pidQ15.Ki / 32768.0;
+  pidKd = pidQ15.Kd / 32768.0;
+}
+
+static uint32_t ref_pid(uint32_t n)
+{
+  double a0 = pidKp + pidKi + pidKd, a1 = -pidKp - 2 * pidKd, a2 = pidKd;
+  double y = 0, x1 = 0, x2 = 0;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    y += a0 * xD[i] + a1 * x1 + a2 * x2;
+    x2 = x1;
+    x1 = xD[i];
+    refD[i] = y;
+  }
+  return n;
+}
+
+static void run_pid_f32(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) of32[i] = arm_pid_f32(&pidF32, xf32[i]); }
+static void run_pid_q31(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) oq31[i] = arm_pid_q31(&pidQ31, xq31[i]); }
+static void run_pid_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) oq15[i] = arm_pid_q15(&pidQ15, xq15[i]); }
+
+/* Angle in degrees for f32, in [-1 1) for [-180 180) degrees for q31 */
+static uint32_t ref_sin_cos(uint32_t n)
+{
+  double scale = (inType == T_F32) ? PI_D / 180 : PI_D;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = sin(xD[i] * scale);
+    refD[2 * i + 1] = cos(xD[i] * scale);
+  }
+  return 2 * n;
+}
+
+static void run_sin_cos_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_sin_cos_f32(xf32[i], &of32[2 * i], &of32[2 * i + 1]);
+  }
+}
+
+static void run_sin_cos_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_sin_cos_q31(xq31[i], &oq31[2 * i], &oq31[2 * i + 1]);
+  }
+}
+
+static void prep_park(uint32_t n)
+{
+  parkSin = (inType == T_F32) ? (float32_t) PARK_SIN : to_q31(PARK_SIN) / 2147483648.0;
+  parkCos = (inType == T_F32) ? (float32_t) PARK_COS : to_q31(PARK_COS) / 2147483648.0;
+}
+
+static uint32_t ref_clarke(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[i];
+    refD[2 * i + 1] = (xD[i] + 2 * yD[i]) / sqrt(3.0);
+  }
+  return 2 * n;
+}
+
+static uint32_t ref_inv_clarke(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[i];
+    refD[2 * i + 1] = -0.5 * xD[i] + sqrt(3.0) / 2 * yD[i];
+  }
+  return 2 * n;
+}
+
+static uint32_t ref_park(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[i] * parkCos + yD[i] * parkSin;
+    refD[2 * i + 1] = -xD[i] * parkSin + yD[i] * parkCos;
+  }
+  return 2 * n;
+}
+
+static uint32_t ref_inv_park(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[2 * i] = xD[i] * parkCos - yD[i] * parkSin;
+    refD[2 * i + 1] = xD[i] * parkSin + yD[i] * parkCos;
+  }
+  return 2 * n;
+}
+
+static void run_clarke_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_clarke_f32(xf32[i], yf32[i], &of32[2 * i], &of32[2 * i + 1]);
+  }
+}
+
+static void run_clarke_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_clarke_q31(xq31[i], yq31[i], &oq31[2 * i], &oq31[2 * i + 1]);
+  }
+}
+
+static void run_inv_clarke_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_inv_clarke_f32(xf32[i], yf32[i], &of32[2 * i], &of32[2 * i + 1]);
+  }
+}
+
+static void run_inv_clarke_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_inv_clarke_q31(xq31[i], yq31[i], &oq31[2 * i], &oq31[2 * i + 1]);
+  }
+}
+
+static void run_park_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_park_f32(xf32[i], yf32[i], &of32[2 * i], &of32[2 * i + 1], PARK_SIN, PARK_COS);
+  }
+}
+
+static void run_park_q31(uint32_t n)
+{
+  q31_t sinVal = to_q31(PARK_SIN), cosVal = to_q31(PARK_COS);
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_park_q31(xq31[i], yq31[i], &oq31[2 * i], &oq31[2 * i + 1], sinVal, cosVal);
+  }
+}
+
+static void run_inv_park_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_inv_park_f32(xf32[i], yf32[i], &of32[2 * i], &of32[2 * i + 1], PARK_SIN, PARK_COS);
+  }
+}
+
+static void run_inv_park_q31(uint32_t n)
+{
+  q31_t sinVal = to_q31(PARK_SIN), cosVal = to_q31(PARK_COS);
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    arm_inv_park_q31(xq31[i], yq31[i], &oq31[2 * i], &oq31[2 * i + 1], sinVal, cosVal);
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Fast math
+ * ------------------------------------------------------------------- */
+
+/* Radians for f32, units of 2*pi for the fixed-point types */
+static uint32_t ref_sin(uint32_t n)
+{
+  double scale = (inType == T_F32) ? 1 : 2 * PI_D;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = sin(xD[i] * scale);
+  }
+  return n;
+}
+
+static uint32_t ref_cos(uint32_t n)
+{
+  double scale = (inType == T_F32) ? 1 : 2 * PI_D;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = cos(xD[i] * scale);
+  }
+  return n;
+}
+
+/* Radians for f32, units of pi for the fixed-point types */
+static uint32_t ref_atan2(uint32_t n)
+{
+  double scale = (inType == T_F32) ? 1 : 1 / PI_D;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = atan2(xD[i], yD[i]) * scale;
+  }
+  return n;
+}
+
+static uint32_t ref_sqrt(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = sqrt(xD[i]); return n; }
+static uint32_t ref_exp(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = exp(xD[i]); return n; }
+static uint32_t ref_log(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) refD[i] = log(xD[i]); return n; }
+
+static void run_sin_f32(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) of32[i] = arm_sin_f32(xf32[i]); }
+static void run_sin_q31(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) oq31[i] = arm_sin_q31(xq31[i]); }
+static void run_sin_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) oq15[i] = arm_sin_q15(xq15[i]); }
+static void run_cos_f32(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) of32[i] = arm_cos_f32(xf32[i]); }
+static void run_cos_q31(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) oq31[i] = arm_cos_q31(xq31[i]); }
+static void run_cos_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) oq15[i] = arm_cos_q15(xq15[i]); }
+static void run_sqrt_f32(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) arm_sqrt_f32(xf32[i], &of32[i]); }
+static void run_sqrt_q31(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) arm_sqrt_q31(xq31[i], &oq31[i]); }
+static void run_sqrt_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) arm_sqrt_q15(xq15[i], &oq15[i]); }
+
+RUN_XO(vsin, f32) RUN_XO(vsin, q31) RUN_XO(vsin, q15)
+RUN_XO(vcos, f32) RUN_XO(vcos, q31) RUN_XO(vcos, q15)
+RUN_XYO(vatan2, f32) RUN_XYO(vatan2, q31) RUN_XYO(vatan2, q15)
+RUN_XO(vexp, f32) RUN_XO(vlog, f32) RUN_XO(vsqrt, f32)
+
+/* ----------------------------------------------------------------------
+ * Filtering
+ * ------------------------------------------------------------------- */
+
+/* Impulse response b[k] of the FIR filters and the exact biquad coefficients */
+static double firD[FIR_TAPS];
+static double biquadD[BIQUAD_STAGES][5];
+
+/* Coefficients in the order of the library, time reversed for the FIR filters.
+   The longest are the RESAMPLE_L * RESAMPLE_PHASE_LEN of the resampler. */
+static float32_t coeffF32[FIR_TAPS * 4];
+static float64_t coeffF64[FIR_TAPS * 4];
+static q31_t coeffQ31[FIR_TAPS * 4];
+static q15_t coeffQ15[FIR_TAPS * 4];
+static q7_t coeffQ7[FIR_TAPS * 4];
+
+static float32_t stateF32[BUF_LEN];
+static float64_t stateF64[BUF_LEN];
+static q31_t stateQ31[BUF_LEN];
+static q15_t stateQ15[BUF_LEN];
+static q7_t stateQ7[BUF_LEN];
+static q63_t stateQ63[BUF_LEN];
+
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_instance_q15 firQ15;
+static arm_fir_instance_q7 firQ7;
+static arm_fir_decimate_instance_f32 decF32;
+static arm_fir_decimate_instance_q31 decQ31;
+static arm_fir_decimate_instance_q15 decQ15;
+static arm_fir_interpolate_instance_f32 intF32;
+static arm_fir_interpolate_instance_q31 intQ31;
+static arm_fir_interpolate_instance_q15 intQ15;
+static arm_fir_fft_instance_f32 firFftF32;
+static arm_fir_fft_instance_q31 firFftQ31;
+static float32_t spectraF32[4 * FIR_TAPS];
+static q31_t spectraQ31[4 * FIR_TAPS];
+static arm_biquad_casd_df1_inst_f32 df1F32;
+static arm_biquad_casd_df1_inst_q31 df1Q31;
+static arm_biquad_casd_df1_inst_q15 df1Q15;
+static arm_biquad_cas_df1_32x64_ins_q31 df1Q31x64;
+static arm_biquad_cascade_df2T_instance_f32 df2TF32;
+static arm_biquad_cascade_df2T_instance_f64 df2TF64;
+
+/* Hamming windowed low-pass at 0.1 fs, tilted so that a reversed filter is detected */
+static void design_fir(void)
+{
+  double x, sum = 0;
+  int k;
+
+  for (k = 0; k < FIR_TAPS; k++)
+  {
+    x = k - (FIR_TAPS - 1) / 2.0;
+    firD[k] = (x == 0) ? 0.2 : sin(0.2 * PI_D * x) / (PI_D * x);
+    firD[k] *= (0.54 - 0.46 * cos(2 * PI_D * k / (FIR_TAPS - 1))) * (1 + 0.5 * k / FIR_TAPS);
+    sum += firD[k];
+  }
+  for (k = 0; k < FIR_TAPS; k++)
+  {
+    firD[k] *= 0.9 / sum;
+  }
+}
+
+/* Quantizes the FIR coefficients to the input type, in time reversed order */
+static void prep_fir_coeffs(void)
+{
+  int k;
+
+  design_fir();
+  for (k = 0; k < FIR_TAPS; k++)
+  {
+    switch (inType)
+    {
+    case T_F32:
+      coeffF32[FIR_TAPS - 1 - k] = (float32_t) firD[k];
+      firD[k] = coeffF32[FIR_TAPS - 1 - k];
+      break;
+    case T_Q31:
+      coeffQ31[FIR_TAPS - 1 - k] = to_q31(firD[k]);
+      firD[k] = coeffQ31[FIR_TAPS - 1 - k] / 2147483648.0;
+      break;
+    case T_Q15:
+      coeffQ15[FIR_TAPS - 1 - k] = to_q15(firD[k]);
+      firD[k] = coeffQ15[FIR_TAPS - 1 - k] / 32768.0;
+      break;
+    default:
+      coeffQ7[FIR_TAPS - 1 - k] = to_q7(firD[k]);
+      firD[k] = coeffQ7[FIR_TAPS - 1 - k] / 128.0;
+      break;
+    }
+  }
+}
+
+/* Quantizes coefficient k to the input type and returns its exact value */
+static double set_coeff(uint32_t k, double v)
+{
+  switch (inType)
+  {
+  case T_F32:
+    coeffF32[k] = (float32_t) v;
+    return coeffF32[k];
+  case T_Q31:
+    coeffQ31[k] = to_q31(v);
+    return coeffQ31[k] / 2147483648.0;
+  case T_Q15:
+    coeffQ15[k] = to_q15(v);
+    return coeffQ15[k] / 32768.0;
+  default:
+    coeffQ7[k] = to_q7(v);
+    return coeffQ7[k] / 128.0;
+  }
+}
+
+static void prep_fir(uint32_t n)
+{
+  prep_fir_coeffs();
+  arm_fir_init_f32(&firF32, FIR_TAPS, coeffF32, stateF32, n);
+  arm_fir_init_q31(&firQ31, FIR_TAPS, coeffQ31, stateQ31, n);
+  arm_fir_init_q15(&firQ15, FIR_TAPS, coeffQ15, stateQ15, n);
+  arm_fir_init_q7(&firQ7, FIR_TAPS, coeffQ7, stateQ7, n);
+}
+
+static void prep_fir_decimate(uint32_t n)
+{
+  prep_fir_coeffs();
+  arm_fir_decimate_init_f32(&decF32, FIR_TAPS, DECIMATE_M, coeffF32, stateF32, n);
+  arm_fir_decimate_init_q31(&decQ31, FIR_TAPS, DECIMATE_M, coeffQ31, stateQ31, n);
+  arm_fir_decimate_init_q15(&decQ15, FIR_TAPS, DECIMATE_M, coeffQ15, stateQ15, n);
+}
+
+static void prep_fir_interpolate(uint32_t n)
+{
+  prep_fir_coeffs();
+  arm_fir_interpolate_init_f32(&intF32, INTERPOLATE_L, FIR_TAPS, coeffF32, stateF32, n);
+  arm_fir_interpolate_init_q31(&intQ31, INTERPOLATE_L, FIR_TAPS, coeffQ31, stateQ31, n);
+  arm_fir_interpolate_init_q15(&intQ15, INTERPOLATE_L, FIR_TAPS, coeffQ15, stateQ15, n);
+}
+
+static void prep_fir_fft(uint32_t n)
+{
+  prep_fir_coeffs();
+  arm_fir_fft_init_f32(&firFftF32, FIR_TAPS, coeffF32, spectraF32, stateF32, FIR_FFT_PART);
+  arm_fir_fft_init_q31(&firFftQ31, FIR_TAPS, coeffQ31, spectraQ31, stateQ31, FIR_FFT_PART);
+}
+
+static uint32_t ref_fir(uint32_t n)
+{
+  uint32_t i, k;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = 0;
+    for (k = 0; (k < FIR_TAPS) && (k <= i); k++)
+    {
+      refD[i] += firD[k] * xD[i - k];
+    }
+  }
+  return n;
+}
+
+static uint32_t ref_fir_decimate(uint32_t n)
+{
+  uint32_t i, k;
+
+  for (i = 0; i < n / DECIMATE_M; i++)
+  {
+    refD[i] = 0;
+    for (k = 0; (k < FIR_TAPS) && (k <= i * DECIMATE_M); k++)
+    {
+      refD[i] += firD[k] * xD[i * DECIMATE_M - k];
+    }
+  }
+  return n / DECIMATE_M;
+}
+
+static uint32_t ref_fir_interpolate(uint32_t n)
+{
+  uint32_t i, j, k;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < INTERPOLATE_L; j++)
+    {
+      refD[i * INTERPOLATE_L + j] = 0;
+      for (k = 0; (k < FIR_TAPS / INTERPOLATE_L) && (k <= i); k++)
+      {
+        refD[i * INTERPOLATE_L + j] += firD[k * INTERPOLATE_L + j] * xD[i - k];
+      }
+    }
+  }
+  return n * INTERPOLATE_L;
+}
+
+static void run_fir_f32(uint32_t n) { arm_fir_f32(&firF32, xf32, of32, n); }
+static void run_fir_q31(uint32_t n) { arm_fir_q31(&firQ31, xq31, oq31, n); }
+static void run_fir_q15(uint32_t n) { arm_fir_q15(&firQ15, xq15, oq15, n); }
+static void run_fir_q7(uint32_t n) { arm_fir_q7(&firQ7, xq7, oq7, n); }
+static void run_fir_fast_q31(uint32_t n) { arm_fir_fast_q31(&firQ31, xq31, oq31, n); }
+static void run_fir_fast_q15(uint32_t n) { arm_fir_fast_q15(&firQ15, xq15, oq15, n); }
+static void run_fir_decimate_f32(uint32_t n) { arm_fir_decimate_f32(&decF32, xf32, of32, n); }
+static void run_fir_decimate_q31(uint32_t n) { arm_fir_decimate_q31(&decQ31, xq31, oq31, n); }
+static void run_fir_decimate_q15(uint32_t n) { arm_fir_decimate_q15(&decQ15, xq15, oq15, n); }
+static void run_fir_decimate_fast_q31(uint32_t n) { arm_fir_decimate_fast_q31(&decQ31, xq31, oq31, n); }
+static void run_fir_decimate_fast_q15(uint32_t n) { arm_fir_decimate_fast_q15(&decQ15, xq15, oq15, n); }
+static void run_fir_interpolate_f32(uint32_t n) { arm_fir_interpolate_f32(&intF32, xf32, of32, n); }
+static void run_fir_interpolate_q31(uint32_t n) { arm_fir_interpolate_q31(&intQ31, xq31, oq31, n); }
+static void run_fir_interpolate_q15(uint32_t n) { arm_fir_interpolate_q15(&intQ15, xq15, oq15, n); }
+static void run_fir_fft_f32(uint32_t n) { arm_fir_fft_f32(&firFftF32, xf32, of32, n); }
+static void run_fir_fft_q31(uint32_t n) { arm_fir_fft_q31(&firFftQ31, xq31, oq31, n); }
+
+/* Resampler, prototype filter b[k] at RESAMPLE_L times the input rate */
+static double resampleD[RESAMPLE_L * RESAMPLE_PHASE_LEN];
+static arm_resample_instance_f32 resF32;
+static arm_resample_instance_q31 resQ31;
+static arm_resample_instance_q15 resQ15;
+
+/* Hamming windowed low-pass at 0.4 of the input rate, gain 0.9 * RESAMPLE_L at DC */
+static void prep_resample(uint32_t n)
+{
+  uint32_t taps = RESAMPLE_L * RESAMPLE_PHASE_LEN;
+  double x, sum = 0;
+  uint32_t k;
+
+  for (k = 0; k < taps; k++)
+  {
+    x = (k - (taps - 1) / 2.0) / RESAMPLE_L;
+    resampleD[k] = (x == 0) ? 0.8 : sin(0.8 * PI_D * x) / (PI_D * x);
+    resampleD[k] *= 0.54 - 0.46 * cos(2 * PI_D * k / (taps - 1));
+    sum += resampleD[k];
+  }
+  for (k = 0; k < taps; k++)
+  {
+    resampleD[k] = set_coeff(taps - 1 - k, resampleD[k] * 0.9 * RESAMPLE_L / sum);
+  }
+  arm_resample_init_f32(&resF32, RESAMPLE_L, taps, coeffF32, stateF32, RESAMPLE_STEP, n);
+  arm_resample_init_q31(&resQ31, RESAMPLE_L, taps, coeffQ31, stateQ31, RESAMPLE_STEP, n);
+  arm_resample_init_q15(&resQ15, RESAMPLE_L, taps, coeffQ15, stateQ15, RESAMPLE_STEP, n);
+}
+
+/* Both phases around each output position, interpolated linearly */
+static uint32_t ref_resample(uint32_t n)
+{
+  uint64_t t;
+  uint32_t i, k, m = 0, pos, phase;
+  double y0, y1, mu;
+
+  for (t = 0; (t >> 24) < n; t += RESAMPLE_STEP)
+  {
+    i = (uint32_t) (t >> 24);
+    pos = (uint32_t) (t & 0xFFFFFF) * RESAMPLE_L;
+    phase = pos >> 24;
+    mu = (pos & 0xFFFFFF) / 16777216.0;
+    y0 = y1 = 0;
+    for (k = 0; (k < RESAMPLE_PHASE_LEN) && (k <= i); k++)
+    {
+      y0 += resampleD[phase + k * RESAMPLE_L] * xD[i - k];
+      if (phase + 1 + k * RESAMPLE_L < RESAMPLE_L * RESAMPLE_PHASE_LEN)
+      {
+        y1 += resampleD[phase + 1 + k * RESAMPLE_L] * xD[i - k];
+      }
+    }
+    refD[m++] = y0 + (y1 - y0) * mu;
+  }
+  return m;
+}
+
+static void run_resample_f32(uint32_t n) { arm_resample_f32(&resF32, xf32, of32, n); }
+static void run_resample_q31(uint32_t n) { arm_resample_q31(&resQ31, xq31, oq31, n); }
+static void run_resample_q15(uint32_t n) { arm_resample_q15(&resQ15, xq15, oq15, n); }
+
+/* Two Butterworth low-pass sections at 0.1 fs, Q of 0.54 and 1.31 */
+static void design_biquad(void)
+{
+  static const double q[BIQUAD_STAGES] = {0.5412, 1.3066};
+  double w = 2 * PI_D * 0.1, alpha, a0;
+  int s;
+
+  for (s = 0; s < BIQUAD_STAGES; s++)
+  {
+    alpha = sin(w) / (2 * q[s]);
+    a0 = 1 + alpha;
+    biquadD[s][0] = (1 - cos(w)) / 2 / a0;
+    biquadD[s][1] = (1 - cos(w)) / a0;
+    biquadD[s][2] = (1 - cos(w)) / 2 / a0;
+    /* The library adds the feedback terms */
+    biquadD[s][3] = 2 * cos(w) / a0;
+    biquadD[s][4] = -(1 - alpha) / a0;
+  }
+}
+
+/* Quantizes the biquad coefficients, scaled by 2^-BIQUAD_SHIFT for the fixed-point types */
+static void prep_biquad(uint32_t n)
+{
+  double scale = (inType == T_F32 || inType == T_F64) ? 1 : 1.0 / (1 << BIQUAD_SHIFT);
+  int s, k;
+
+  design_biquad();
+  for (s = 0; s < BIQUAD_STAGES; s++)
+  {
+    for (k = 0; k < 5; k++)
+    {
+      coeffF32[5 * s + k] = (float32_t) biquadD[s][k];
+      coeffF64[5 * s + k] = biquadD[s][k];
+      coeffQ31[5 * s + k] = to_q31(biquadD[s][k] * scale);
+      /* q15 coefficients are {b0, 0, b1, b2, a1, a2} */
+      coeffQ15[6 * s + k + (k > 0)] = to_q15(biquadD[s][k] * scale);
+      switch (inType)
+      {
+      case T_F32:
+        biquadD[s][k] = coeffF32[5 * s + k];
+        break;
+      case T_Q31:
+        biquadD[s][k] = coeffQ31[5 * s + k] / scale / 2147483648.0;
+        break;
+      case T_Q15:
+        biquadD[s][k] = coeffQ15[6 * s + k + (k > 0)] / scale / 32768.0;
+        break;
+      default:
+        break;
+      }
+    }
+    coeffQ15[6 * s + 1] = 0;
+  }
+  arm_biquad_cascade_df1_init_f32(&df1F32, BIQUAD_STAGES, coeffF32, stateF32);
+  arm_biquad_cascade_df1_init_q31(&df1Q31, BIQUAD_STAGES, coeffQ31, stateQ31, BIQUAD_SHIFT);
+  arm_biquad_cascade_df1_init_q15(&df1Q15, BIQUAD_STAGES, coeffQ15, stateQ15, BIQUAD_SHIFT);
+  arm_biquad_cas_df1_32x64_init_q31(&df1Q31x64, BIQUAD_STAGES, coeffQ31, stateQ63, BIQUAD_SHIFT);
+  arm_biquad_cascade_df2T_init_f32(&df2TF32, BIQUAD_STAGES, coeffF32, stateF32);
+  arm_biquad_cascade_df2T_init_f64(&df2TF64, BIQUAD_STAGES, coeffF64, stateF64);
+}
+
+static uint32_t ref_biquad(uint32_t n)
+{
+  double x1[BIQUAD_STAGES] = {0}, x2[BIQUAD_STAGES] = {0};
+  double y1[BIQUAD_STAGES] = {0}, y2[BIQUAD_STAGES] = {0};
+  double x, y;
+  uint32_t i, s;
+
+  for (i = 0; i < n; i++)
+  {
+    x = xD[i];
+    for (s = 0; s < BIQUAD_STAGES; s++)
+    {
+      y = biquadD[s][0] * x + biquadD[s][1] * x1[s] + biquadD[s][2] * x2[s] +
+          biquadD[s][3] * y1[s] + biquadD[s][4] * y2[s];
+      x2[s] = x1[s];
+      x1[s] = x;
+      y2[s] = y1[s];
+      y1[s] = y;
+      x = y;
+    }
+    refD[i] = x;
+  }
+  return n;
+}
+
+static void run_biquad_cascade_df1_f32(uint32_t n) { arm_biquad_cascade_df1_f32(&df1F32, xf32, of32, n); }
+static void run_biquad_cascade_df1_q31(uint32_t n) { arm_biquad_cascade_df1_q31(&df1Q31, xq31, oq31, n); }
+static void run_biquad_cascade_df1_q15(uint32_t n) { arm_biquad_cascade_df1_q15(&df1Q15, xq15, oq15, n); }
+static void run_biquad_cascade_df1_fast_q31(uint32_t n) { arm_biquad_cascade_df1_fast_q31(&df1Q31, xq31, oq31, n); }
+static void run_biquad_cascade_df1_fast_q15(uint32_t n) { arm_biquad_cascade_df1_fast_q15(&df1Q15, xq15, oq15, n); }
+static void run_biquad_cas_df1_32x64_q31(uint32_t n) { arm_biquad_cas_df1_32x64_q31(&df1Q31x64, xq31, oq31, n); }
+static void run_biquad_cascade_df2T_f32(uint32_t n) { arm_biquad_cascade_df2T_f32(&df2TF32, xf32, of32, n); }
+static void run_biquad_cascade_df2T_f64(uint32_t n) { arm_biquad_cascade_df2T_f64(&df2TF64, xf64, of64, n); }
+
+/* Interleaved filters: the n values are n / INTERLEAVED_CHANS frames */
+static arm_fir_interleaved_instance_f32 firIlvF32;
+static arm_fir_interleaved_instance_q31 firIlvQ31;
+static arm_fir_interleaved_instance_q15 firIlvQ15;
+static arm_biquad_cascade_interleaved_df2T_instance_f32 biquadIlvF32;
+static arm_biquad_cascade_interleaved_df1_instance_q31 biquadIlvQ31;
+static arm_biquad_cascade_interleaved_df1_instance_q15 biquadIlvQ15;
+static arm_biquad_cascade_stereo_df2T_instance_f32 biquadStereoF32;
+
+static void prep_fir_interleaved(uint32_t n)
+{
+  uint32_t frames = n / INTERLEAVED_CHANS;
+
+  prep_fir_coeffs();
+  arm_fir_interleaved_init_f32(&firIlvF32, FIR_TAPS, INTERLEAVED_CHANS, coeffF32, stateF32, frames);
+  arm_fir_interleaved_init_q31(&firIlvQ31, FIR_TAPS, INTERLEAVED_CHANS, coeffQ31, stateQ31, frames);
+  arm_fir_interleaved_init_q15(&firIlvQ15, FIR_TAPS, INTERLEAVED_CHANS, coeffQ15, stateQ15, frames);
+}
+
+static void prep_biquad_interleaved(uint32_t n)
+{
+  prep_biquad(n);
+  arm_biquad_cascade_interleaved_df2T_init_f32(&biquadIlvF32, BIQUAD_STAGES, INTERLEAVED_CHANS, coeffF32, stateF32);
+  arm_biquad_cascade_interleaved_df1_init_q31(&biquadIlvQ31, BIQUAD_STAGES, INTERLEAVED_CHANS, coeffQ31, stateQ31, BIQUAD_SHIFT);
+  arm_biquad_cascade_interleaved_df1_init_q15(&biquadIlvQ15, BIQUAD_STAGES, INTERLEAVED_CHANS, coeffQ15, stateQ15, BIQUAD_SHIFT);
+  arm_biquad_cascade_stereo_df2T_init_f32(&biquadStereoF32, BIQUAD_STAGES, coeffF32, stateF32);
+}
+
+/* Each channel filtered alone, with the stride of the frames */
+static uint32_t ref_fir_interleaved(uint32_t n)
+{
+  uint32_t frames = n / INTERLEAVED_CHANS;
+  uint32_t c, i, k;
+
+  for (c = 0; c < INTERLEAVED_CHANS; c++)
+  {
+    for (i = 0; i < frames; i++)
+    {
+      refD[i * INTERLEAVED_CHANS + c] = 0;
+      for (k = 0; (k < FIR_TAPS) && (k <= i); k++)
+      {
+        refD[i * INTERLEAVED_CHANS + c] += firD[k] * xD[(i - k) * INTERLEAVED_CHANS + c];
+      }
+    }
+  }
+  return frames * INTERLEAVED_CHANS;
+}
+
+static uint32_t ref_biquad_chans(uint32_t n, uint32_t chans)
+{
+  uint32_t frames = n / chans;
+  uint32_t c, i, s;
+  double x1[BIQUAD_STAGES], x2[BIQUAD_STAGES], y1[BIQUAD_STAGES], y2[BIQUAD_STAGES];
+  double x, y;
+
+  for (c = 0; c < chans; c++)
+  {
+    for (s = 0; s < BIQUAD_STAGES; s++)
+    {
+      x1[s] = x2[s] = y1[s] = y2[s] = 0;
+    }
+    for (i = 0; i < frames; i++)
+    {
+      x = xD[i * chans + c];
+      for (s = 0; s < BIQUAD_STAGES; s++)
+      {
+        y = biquadD[s][0] * x + biquadD[s][1] * x1[s] + biquadD[s][2] * x2[s] +
+            biquadD[s][3] * y1[s] + biquadD[s][4] * y2[s];
+        x2[s] = x1[s];
+        x1[s] = x;
+        y2[s] = y1[s];
+        y1[s] = y;
+        x = y;
+      }
+      refD[i * chans + c] = x;
+    }
+  }
+  return frames * chans;
+}
+
+static uint32_t ref_biquad_interleaved(uint32_t n) { return ref_biquad_chans(n, INTERLEAVED_CHANS); }
+static uint32_t ref_biquad_stereo(uint32_t n) { return ref_biquad_chans(n, 2); }
+
+static void run_fir_interleaved_f32(uint32_t n) { arm_fir_interleaved_f32(&firIlvF32, xf32, of32, n / INTERLEAVED_CHANS); }
+static void run_fir_interleaved_q31(uint32_t n) { arm_fir_interleaved_q31(&firIlvQ31, xq31, oq31, n / INTERLEAVED_CHANS); }
+static void run_fir_interleaved_q15(uint32_t n) { arm_fir_interleaved_q15(&firIlvQ15, xq15, oq15, n / INTERLEAVED_CHANS); }
+static void run_biquad_cascade_interleaved_df2T_f32(uint32_t n) { arm_biquad_cascade_interleaved_df2T_f32(&biquadIlvF32, xf32, of32, n / INTERLEAVED_CHANS); }
+static void run_biquad_cascade_interleaved_df1_q31(uint32_t n) { arm_biquad_cascade_interleaved_df1_q31(&biquadIlvQ31, xq31, oq31, n / INTERLEAVED_CHANS); }
+static void run_biquad_cascade_interleaved_df1_q15(uint32_t n) { arm_biquad_cascade_interleaved_df1_q15(&biquadIlvQ15, xq15, oq15, n / INTERLEAVED_CHANS); }
+static void run_biquad_cascade_stereo_df2T_f32(uint32_t n) { arm_biquad_cascade_stereo_df2T_f32(&biquadStereoF32, xf32, of32, n / 2); }
+
+/* Convolution and correlation with the first CONV_LEN samples of y */
+static uint32_t ref_conv(uint32_t n)
+{
+  uint32_t i, k;
+
+  for (i = 0; i < n + CONV_LEN - 1; i++)
+  {
+    refD[i] = 0;
+    for (k = 0; k < CONV_LEN; k++)
+    {
+      if ((k <= i) && (i - k < n))
+      {
+        refD[i] += yD[k] * xD[i - k];
+      }
+    }
+  }
+  return n + CONV_LEN - 1;
+}
+
+/* Both inputs are zero padded to the longer length L, the lag of output i is i - (L - 1) */
+static uint32_t ref_correlate(uint32_t n)
+{
+  int32_t len = (n > CONV_LEN) ? n : CONV_LEN;
+  int32_t i, k, lag;
+
+  for (i = 0; i < 2 * len - 1; i++)
+  {
+    refD[i] = 0;
+    lag = i - (len - 1);
+    for (k = 0; k < CONV_LEN; k++)
+    {
+      if ((k + lag >= 0) && (k + lag < (int32_t) n))
+      {
+        refD[i] += xD[k + lag] * yD[k];
+      }
+    }
+  }
+  return 2 * len - 1;
+}
+
+/* Outputs n / 4 to n / 4 + n / 2 - 1 of the convolution, the ones below are not written */
+static uint32_t ref_conv_partial(uint32_t n)
+{
+  uint32_t i;
+
+  ref_conv(n);
+  for (i = 0; i < n / 4; i++)
+  {
+    refD[i] = 0;
+  }
+  return n / 4 + n / 2;
+}
+
+static void prep_clear(uint32_t n)
+{
+  /* The output is accumulated or only partly written by some of the functions */
+  memset(of32, 0, sizeof(of32));
+  memset(oq31, 0, sizeof(oq31));
+  memset(oq15, 0, sizeof(oq15));
+  memset(oq7, 0, sizeof(oq7));
+}
+
+static void run_conv_f32(uint32_t n) { arm_conv_f32(xf32, n, yf32, CONV_LEN, of32); }
+static void run_conv_q31(uint32_t n) { arm_conv_q31(xq31, n, yq31, CONV_LEN, oq31); }
+static void run_conv_q15(uint32_t n) { arm_conv_q15(xq15, n, yq15, CONV_LEN, oq15); }
+static void run_conv_q7(uint32_t n) { arm_conv_q7(xq7, n, yq7, CONV_LEN, oq7); }
+static void run_conv_fast_q31(uint32_t n) { arm_conv_fast_q31(xq31, n, yq31, CONV_LEN, oq31); }
+static void run_conv_fast_q15(uint32_t n) { arm_conv_fast_q15(xq15, n, yq15, CONV_LEN, oq15); }
+static void run_conv_opt_q15(uint32_t n) { arm_conv_opt_q15(xq15, n, yq15, CONV_LEN, oq15, scratch1Q15, scratch2Q15); }
+static void run_conv_fast_opt_q15(uint32_t n) { arm_conv_fast_opt_q15(xq15, n, yq15, CONV_LEN, oq15, scratch1Q15, scratch2Q15); }
+static void run_conv_opt_q7(uint32_t n) { arm_conv_opt_q7(xq7, n, yq7, CONV_LEN, oq7, scratch1Q15, scratch2Q15); }
+static void run_conv_partial_f32(uint32_t n) { arm_conv_partial_f32(xf32, n, yf32, CONV_LEN, of32, n / 4, n / 2); }
+static void run_conv_partial_q31(uint32_t n) { arm_conv_partial_q31(xq31, n, yq31, CONV_LEN, oq31, n / 4, n / 2); }
+static void run_conv_partial_q15(uint32_t n) { arm_conv_partial_q15(xq15, n, yq15, CONV_LEN, oq15, n / 4, n / 2); }
+static void run_conv_partial_q7(uint32_t n) { arm_conv_partial_q7(xq7, n, yq7, CONV_LEN, oq7, n / 4, n / 2); }
+static void run_conv_partial_fast_q31(uint32_t n) { arm_conv_partial_fast_q31(xq31, n, yq31, CONV_LEN, oq31, n / 4, n / 2); }
+static void run_conv_partial_fast_q15(uint32_t n) { arm_conv_partial_fast_q15(xq15, n, yq15, CONV_LEN, oq15, n / 4, n / 2); }
+static void run_conv_partial_opt_q15(uint32_t n) { arm_conv_partial_opt_q15(xq15, n, yq15, CONV_LEN, oq15, n / 4, n / 2, scratch1Q15, scratch2Q15); }
+static void run_conv_partial_fast_opt_q15(uint32_t n) { arm_conv_partial_fast_opt_q15(xq15, n, yq15, CONV_LEN, oq15, n / 4, n / 2, scratch1Q15, scratch2Q15); }
+static void run_conv_partial_opt_q7(uint32_t n) { arm_conv_partial_opt_q7(xq7, n, yq7, CONV_LEN, oq7, n / 4, n / 2, scratch1Q15, scratch2Q15); }
+static void run_correlate_f32(uint32_t n) { arm_correlate_f32(xf32, n, yf32, CONV_LEN, of32); }
+static void run_correlate_q31(uint32_t n) { arm_correlate_q31(xq31, n, yq31, CONV_LEN, oq31); }
+static void run_correlate_q15(uint32_t n) { arm_correlate_q15(xq15, n, yq15, CONV_LEN, oq15); }
+static void run_correlate_q7(uint32_t n) { arm_correlate_q7(xq7, n, yq7, CONV_LEN, oq7); }
+static void run_correlate_fast_q31(uint32_t n) { arm_correlate_fast_q31(xq31, n, yq31, CONV_LEN, oq31); }
+static void run_correlate_fast_q15(uint32_t n) { arm_correlate_fast_q15(xq15, n, yq15, CONV_LEN, oq15); }
+static void run_correlate_opt_q15(uint32_t n) { arm_correlate_opt_q15(xq15, n, yq15, CONV_LEN, oq15, scratch1Q15); }
+static void run_correlate_fast_opt_q15(uint32_t n) { arm_correlate_fast_opt_q15(xq15, n, yq15, CONV_LEN, oq15, scratch1Q15); }
+static void run_correlate_opt_q7(uint32_t n) { arm_correlate_opt_q7(xq7, n, yq7, CONV_LEN, oq7, scratch1Q15, scratch2Q15); }
+
+/* LMS filters identify the FIR filter from its response in y, the output is the estimate */
+static arm_lms_instance_f32 lmsF32;
+static arm_lms_instance_q31 lmsQ31;
+static arm_lms_instance_q15 lmsQ15;
+static arm_lms_norm_instance_f32 lmsNormF32;
+static arm_lms_norm_instance_q31 lmsNormQ31;
+static arm_lms_norm_instance_q15 lmsNormQ15;
+static double lmsMu;
+static int lmsNorm;
+
+/* Replaces y with the response of the FIR filter to x, the coefficients start at zero */
+static void prep_lms_common(uint32_t n, double mu)
+{
+  uint32_t i, k;
+  double d;
+
+  design_fir();
+  for (i = 0; i < n; i++)
+  {
+    for (d = 0, k = 0; (k < FIR_TAPS) && (k <= i); k++)
+    {
+      d += firD[k] * xD[i - k];
+    }
+    set_input(1, i, d);
+  }
+  memset(coeffF32, 0, sizeof(coeffF32));
+  memset(coeffQ31, 0, sizeof(coeffQ31));
+  memset(coeffQ15, 0, sizeof(coeffQ15));
+  switch (inType)
+  {
+  case T_F32:
+    lmsMu = (float32_t) mu;
+    break;
+  case T_Q31:
+    lmsMu = to_q31(mu) / 2147483648.0;
+    break;
+  default:
+    lmsMu = to_q15(mu) / 32768.0;
+    break;
+  }
+}
+
+static void prep_lms(uint32_t n)
+{
+  prep_lms_common(n, LMS_MU);
+  lmsNorm = 0;
+  arm_lms_init_f32(&lmsF32, FIR_TAPS, coeffF32, stateF32, LMS_MU, n);
+  arm_lms_init_q31(&lmsQ31, FIR_TAPS, coeffQ31, stateQ31, to_q31(LMS_MU), n, 0);
+  arm_lms_init_q15(&lmsQ15, FIR_TAPS, coeffQ15, stateQ15, to_q15(LMS_MU), n, 0);
+}
+
+static void prep_lms_norm(uint32_t n)
+{
+  prep_lms_common(n, LMS_NORM_MU);
+  lmsNorm = 1;
+  arm_lms_norm_init_f32(&lmsNormF32, FIR_TAPS, coeffF32, stateF32, LMS_NORM_MU, n);
+  arm_lms_norm_init_q31(&lmsNormQ31, FIR_TAPS, coeffQ31, stateQ31, to_q31(LMS_NORM_MU), n, 0);
+  arm_lms_norm_init_q15(&lmsNormQ15, FIR_TAPS, coeffQ15, stateQ15, to_q15(LMS_NORM_MU), n, 0);
+}
+
+/* w[k] multiplies x[i - k], the normalized filter divides the step by the energy of the taps */
+static uint32_t ref_lms(uint32_t n)
+{
+  double w[FIR_TAPS] = {0};
+  double y, e, energy;
+  uint32_t i, k;
+
+  for (i = 0; i < n; i++)
+  {
+    y = energy = 0;
+    for (k = 0; (k < FIR_TAPS) && (k <= i); k++)
+    {
+      y += w[k] * xD[i - k];
+      energy += xD[i - k] * xD[i - k];
+    }
+    e = lmsMu * (yD[i] - y);
+    if (lmsNorm)
+    {
+      e = (energy > 0) ? e / energy : 0;
+    }
+    for (k = 0; (k < FIR_TAPS) && (k <= i); k++)
+    {
+      w[k] += e * xD[i - k];
+    }
+    refD[i] = y;
+  }
+  return n;
+}
+
+static void run_lms_f32(uint32_t n) { arm_lms_f32(&lmsF32, xf32, yf32, of32, wf32, n); }
+static void run_lms_q31(uint32_t n) { arm_lms_q31(&lmsQ31, xq31, yq31, oq31, wq31, n); }
+static void run_lms_q15(uint32_t n) { arm_lms_q15(&lmsQ15, xq15, yq15, oq15, wq15, n); }
+static void run_lms_norm_f32(uint32_t n) { arm_lms_norm_f32(&lmsNormF32, xf32, yf32, of32, wf32, n); }
+static void run_lms_norm_q31(uint32_t n) { arm_lms_norm_q31(&lmsNormQ31, xq31, yq31, oq31, wq31, n); }
+static void run_lms_norm_q15(uint32_t n) { arm_lms_norm_q15(&lmsNormQ15, xq15, yq15, oq15, wq15, n); }
+
+/* Lattice filters, reflection coefficients k[m] = 0.5 * (-0.6)^m and ladder coefficients v[m] = 0.3 * 0.8^m */
+static double latticeK[LATTICE_STAGES], latticeV[LATTICE_STAGES + 1];
+static arm_fir_lattice_instance_f32 firLatF32;
+static arm_fir_lattice_instance_q31 firLatQ31;
+static arm_fir_lattice_instance_q15 firLatQ15;
+static arm_iir_lattice_instance_f32 iirLatF32;
+static arm_iir_lattice_instance_q31 iirLatQ31;
+static arm_iir_lattice_instance_q15 iirLatQ15;
+
+/* {k1, k2, ... kM} */
+static void prep_fir_lattice(uint32_t n)
+{
+  uint32_t m;
+
+  for (m = 0; m < LATTICE_STAGES; m++)
+  {
+    latticeK[m] = set_coeff(m, 0.5 * pow(-0.6, m));
+  }
+  arm_fir_lattice_init_f32(&firLatF32, LATTICE_STAGES, coeffF32, stateF32);
+  arm_fir_lattice_init_q31(&firLatQ31, LATTICE_STAGES, coeffQ31, stateQ31);
+  arm_fir_lattice_init_q15(&firLatQ15, LATTICE_STAGES, coeffQ15, stateQ15);
+}
+
+/* {kM, ... k1} followed by {vM, ... v0} */
+static void prep_iir_lattice(uint32_t n)
+{
+  uint32_t m;
+
+  for (m = 0; m < LATTICE_STAGES; m++)
+  {
+    latticeK[m] = set_coeff(LATTICE_STAGES - 1 - m, 0.5 * pow(-0.6, m));
+  }
+  for (m = 0; m <= LATTICE_STAGES; m++)
+  {
+    latticeV[m] = set_coeff(2 * LATTICE_STAGES - m, 0.3 * pow(0.8, m));
+  }
+  arm_iir_lattice_init_f32(&iirLatF32, LATTICE_STAGES, coeffF32, coeffF32 + LATTICE_STAGES, stateF32, n);
+  arm_iir_lattice_init_q31(&iirLatQ31, LATTICE_STAGES, coeffQ31, coeffQ31 + LATTICE_STAGES, stateQ31, n);
+  arm_iir_lattice_init_q15(&iirLatQ15, LATTICE_STAGES, coeffQ15, coeffQ15 + LATTICE_STAGES, stateQ15, n);
+}
+
+/* g[m] holds g_m[i - 1] of the difference equations of the library */
+static uint32_t ref_fir_lattice(uint32_t n)
+{
+  double g[LATTICE_STAGES] = {0};
+  double f, gm, fNext, gNext;
+  uint32_t i, m;
+
+  for (i = 0; i < n; i++)
+  {
+    f = gm = xD[i];
+    for (m = 0; m < LATTICE_STAGES; m++)
+    {
+      fNext = f + latticeK[m] * g[m];
+      gNext = latticeK[m] * f + g[m];
+      g[m] = gm;
+      f = fNext;
+      gm = gNext;
+    }
+    refD[i] = f;
+  }
+  return n;
+}
+
+static uint32_t ref_iir_lattice(uint32_t n)
+{
+  double g[LATTICE_STAGES + 1] = {0};
+  double f;
+  uint32_t i, m;
+
+  for (i = 0; i < n; i++)
+  {
+    f = xD[i];
+    for (m = LATTICE_STAGES; m > 0; m--)
+    {
+      f -= latticeK[m - 1] * g[m - 1];
+      g[m] = latticeK[m - 1] * f + g[m - 1];
+    }
+    g[0] = f;
+    for (refD[i] = 0, m = 0; m <= LATTICE_STAGES; m++)
+    {
+      refD[i] += latticeV[m] * g[m];
+    }
+  }
+  return n;
+}
+
+static void run_fir_lattice_f32(uint32_t n) { arm_fir_lattice_f32(&firLatF32, xf32, of32, n); }
+static void run_fir_lattice_q31(uint32_t n) { arm_fir_lattice_q31(&firLatQ31, xq31, oq31, n); }
+static void run_fir_lattice_q15(uint32_t n) { arm_fir_lattice_q15(&firLatQ15, xq15, oq15, n); }
+static void run_iir_lattice_f32(uint32_t n) { arm_iir_lattice_f32(&iirLatF32, xf32, of32, n); }
+static void run_iir_lattice_q31(uint32_t n) { arm_iir_lattice_q31(&iirLatQ31, xq31, oq31, n); }
+static void run_iir_lattice_q15(uint32_t n) { arm_iir_lattice_q15(&iirLatQ15, xq15, oq15, n); }
+
+/* Sparse FIR filters, taps of alternating sign at delays up to SPARSE_MAX_DELAY */
+static int32_t sparseDelay[SPARSE_TAPS] = {0, 3, 7, 12, 20, 31, 45, SPARSE_MAX_DELAY};
+static double sparseD[SPARSE_TAPS];
+static arm_fir_sparse_instance_f32 sparseF32;
+static arm_fir_sparse_instance_q31 sparseQ31;
+static arm_fir_sparse_instance_q15 sparseQ15;
+static arm_fir_sparse_instance_q7 sparseQ7;
+
+static void prep_fir_sparse(uint32_t n)
+{
+  static const double taps[SPARSE_TAPS] = {0.5, -0.3, 0.25, -0.2, 0.15, -0.1, 0.08, -0.05};
+  uint32_t k;
+
+  for (k = 0; k < SPARSE_TAPS; k++)
+  {
+    sparseD[k] = set_coeff(k, taps[k]);
+  }
+  arm_fir_sparse_init_f32(&sparseF32, SPARSE_TAPS, coeffF32, stateF32, sparseDelay, SPARSE_MAX_DELAY, n);
+  arm_fir_sparse_init_q31(&sparseQ31, SPARSE_TAPS, coeffQ31, stateQ31, sparseDelay, SPARSE_MAX_DELAY, n);
+  arm_fir_sparse_init_q15(&sparseQ15, SPARSE_TAPS, coeffQ15, stateQ15, sparseDelay, SPARSE_MAX_DELAY, n);
+  arm_fir_sparse_init_q7(&sparseQ7, SPARSE_TAPS, coeffQ7, stateQ7, sparseDelay, SPARSE_MAX_DELAY, n);
+}
+
+static uint32_t ref_fir_sparse(uint32_t n)
+{
+  uint32_t i, k;
+
+  for (i = 0; i < n; i++)
+  {
+    refD[i] = 0;
+    for (k = 0; (k < SPARSE_TAPS) && ((uint32_t) sparseDelay[k] <= i); k++)
+    {
+      refD[i] += sparseD[k] * xD[i - sparseDelay[k]];
+    }
+  }
+  return n;
+}
+
+static void run_fir_sparse_f32(uint32_t n) { arm_fir_sparse_f32(&sparseF32, xf32, of32, wf32, n); }
+static void run_fir_sparse_q31(uint32_t n) { arm_fir_sparse_q31(&sparseQ31, xq31, oq31, wq31, n); }
+static void run_fir_sparse_q15(uint32_t n) { arm_fir_sparse_q15(&sparseQ15, xq15, oq15, wq15, wq31, n); }
+static void run_fir_sparse_q7(uint32_t n) { arm_fir_sparse_q7(&sparseQ7, xq7, oq7, wq7, wq31, n); }
+
+/* Kalman filter of a constant velocity model in two dimensions, n measurements of the
+   position in x, the state after each update in the output */
+#define KAL_N           4
+#define KAL_M           2
+
+static arm_kalman_instance_f32 kalF32;
+static float32_t kalX[KAL_N], kalP[KAL_N * KAL_N];
+static float32_t kalWork[KAL_N * KAL_N + KAL_M * KAL_N + KAL_M * KAL_M + KAL_M];
+static float32_t kalF[KAL_N * KAL_N] = {1, 0, 1, 0,  0, 1, 0, 1,  0, 0, 1, 0,  0, 0, 0, 1};
+static float32_t kalQ[KAL_N * KAL_N] = {0.01f, 0, 0, 0,  0, 0.01f, 0, 0,  0, 0, 0.01f, 0,  0, 0, 0, 0.01f};
+static float32_t kalH[KAL_M * KAL_N] = {1, 0, 0, 0,  0, 1, 0, 0};
+static float32_t kalR[KAL_M * KAL_M] = {0.1f, 0,  0, 0.1f};
+
+static void prep_kalman(uint32_t n)
+{
+  arm_kalman_init_f32(&kalF32, KAL_N, KAL_M, kalX, kalP, kalF, kalQ, kalH, kalR, kalWork);
+}
+
+/* Textbook form, K = P * H' * inv(S) with the inverse of the 2 x 2 S */
+static uint32_t ref_kalman(uint32_t n)
+{
+  double x[KAL_N], p[KAL_N * KAL_N], t[KAL_N * KAL_N], k[KAL_N * KAL_M];
+  double y[KAL_M], s[KAL_M * KAL_M], si[KAL_M * KAL_M], det;
+  uint32_t step, i, j, l;
+
+  memset(x, 0, sizeof(x));
+  for (i = 0; i < KAL_N * KAL_N; i++)
+  {
+    p[i] = (i % (KAL_N + 1) == 0) ? 1 : 0;
+  }
+  for (step = 0; step < n; step++)
+  {
+    /* x = F * x, P = F * P * F' + Q */
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (t[i] = 0, l = 0; l < KAL_N; l++)
+      {
+        t[i] += kalF[i * KAL_N + l] * x[l];
+      }
+    }
+    memcpy(x, t, sizeof(x));
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (j = 0; j < KAL_N; j++)
+      {
+        for (t[i * KAL_N + j] = 0, l = 0; l < KAL_N; l++)
+        {
+          t[i * KAL_N + j] += kalF[i * KAL_N + l] * p[l * KAL_N + j];
+        }
+      }
+    }
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (j = 0; j < KAL_N; j++)
+      {
+        for (p[i * KAL_N + j] = kalQ[i * KAL_N + j], l = 0; l < KAL_N; l++)
+        {
+          p[i * KAL_N + j] += t[i * KAL_N + l] * kalF[j * KAL_N + l];
+        }
+      }
+    }
+
+    /* y = z - H * x, S = H * P * H' + R, K = P * H' * inv(S) */
+    for (i = 0; i < KAL_M; i++)
+    {
+      for (y[i] = xD[step * KAL_M + i], l = 0; l < KAL_N; l++)
+      {
+        y[i] -= kalH[i * KAL_N + l] * x[l];
+      }
+    }
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (j = 0; j < KAL_M; j++)
+      {
+        for (t[i * KAL_M + j] = 0, l = 0; l < KAL_N; l++)
+        {
+          t[i * KAL_M + j] += p[i * KAL_N + l] * kalH[j * KAL_N + l];
+        }
+      }
+    }
+    for (i = 0; i < KAL_M; i++)
+    {
+      for (j = 0; j < KAL_M; j++)
+      {
+        for (s[i * KAL_M + j] = kalR[i * KAL_M + j], l = 0; l < KAL_N; l++)
+        {
+          s[i * KAL_M + j] += kalH[i * KAL_N + l] * t[l * KAL_M + j];
+        }
+      }
+    }
+    det = s[0] * s[3] - s[1] * s[2];
+    si[0] = s[3] / det;
+    si[1] = -s[1] / det;
+    si[2] = -s[2] / det;
+    si[3] = s[0] / det;
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (j = 0; j < KAL_M; j++)
+      {
+        for (k[i * KAL_M + j] = 0, l = 0; l < KAL_M; l++)
+        {
+          k[i * KAL_M + j] += t[i * KAL_M + l] * si[l * KAL_M + j];
+        }
+      }
+    }
+
+    /* x = x + K * y, P = P - K * H * P, with H * P = (P * H')' */
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (l = 0; l < KAL_M; l++)
+      {
+        x[i] += k[i * KAL_M + l] * y[l];
+      }
+    }
+    for (i = 0; i < KAL_N; i++)
+    {
+      for (j = 0; j < KAL_N; j++)
+      {
+        for (l = 0; l < KAL_M; l++)
+        {
+          p[i * KAL_N + j] -= k[i * KAL_M + l] * t[j * KAL_M + l];
+        }
+      }
+    }
+    memcpy(refD + step * KAL_N, x, sizeof(x));
+  }
+  return n * KAL_N;
+}
+
+static void run_kalman_f32(uint32_t n)
+{
+  uint32_t step;
+
+  arm_fill_f32(0, kalX, KAL_N);
+  arm_fill_f32(0, kalP, KAL_N * KAL_N);
+  kalP[0] = kalP[5] = kalP[10] = kalP[15] = 1;
+  for (step = 0; step < n; step++)
+  {
+    arm_kalman_predict_f32(&kalF32);
+    arm_kalman_update_f32(&kalF32, xf32 + step * KAL_M);
+    arm_copy_f32(kalX, of32 + step * KAL_N, KAL_N);
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Matrix, n x n matrices in x and y
+ * ------------------------------------------------------------------- */
+
+static arm_matrix_instance_f32 matAF32, matBF32, matCF32;
+static arm_matrix_instance_f64 matAF64, matCF64;
+static arm_matrix_instance_q31 matAQ31, matBQ31, matCQ31;
+static arm_matrix_instance_q15 matAQ15, matBQ15, matCQ15;
+
+static void prep_mat(uint32_t n)
+{
+  arm_mat_init_f32(&matAF32, n, n, xf32);
+  arm_mat_init_f32(&matBF32, n, n, yf32);
+  arm_mat_init_f32(&matCF32, n, n, of32);
+  arm_mat_init_q31(&matAQ31, n, n, xq31);
+  arm_mat_init_q31(&matBQ31, n, n, yq31);
+  arm_mat_init_q31(&matCQ31, n, n, oq31);
+  arm_mat_init_q15(&matAQ15, n, n, xq15);
+  arm_mat_init_q15(&matBQ15, n, n, yq15);
+  arm_mat_init_q15(&matCQ15, n, n, oq15);
+}
+
+/* Diagonally dominant, so that the inverse is well conditioned */
+static void prep_mat_inverse(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    set_input(0, i * n + i, xD[i * n + i] + 1);
+  }
+  matAF32.numRows = matAF32.numCols = matCF32.numRows = matCF32.numCols = n;
+  matAF32.pData = wf32;
+  matCF32.pData = of32;
+  matAF64.numRows = matAF64.numCols = matCF64.numRows = matCF64.numCols = n;
+  matAF64.pData = wf64;
+  matCF64.pData = of64;
+}
+
+static uint32_t ref_mat_scale(uint32_t n) { return ref_scale(n * n); }
+
+static uint32_t ref_mat_trans(uint32_t n)
+{
+  uint32_t i, j;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      refD[j * n + i] = xD[i * n + j];
+    }
+  }
+  return n * n;
+}
+
+static uint32_t ref_mat_mult(uint32_t n)
+{
+  uint32_t i, j, k;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      refD[i * n + j] = 0;
+      for (k = 0; k < n; k++)
+      {
+        refD[i * n + j] += xD[i * n + k] * yD[k * n + j];
+      }
+    }
+  }
+  return n * n;
+}
+
+static uint32_t ref_mat_cmplx_mult(uint32_t n)
+{
+  uint32_t i, j, k;
+  double re, im;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      re = im = 0;
+      for (k = 0; k < n; k++)
+      {
+        re += xD[2 * (i * n + k)] * yD[2 * (k * n + j)] - xD[2 * (i * n + k) + 1] * yD[2 * (k * n + j) + 1];
+        im += xD[2 * (i * n + k)] * yD[2 * (k * n + j) + 1] + xD[2 * (i * n + k) + 1] * yD[2 * (k * n + j)];
+      }
+      refD[2 * (i * n + j)] = re;
+      refD[2 * (i * n + j) + 1] = im;
+    }
+  }
+  return 2 * n * n;
+}
+
+/* Gauss-Jordan elimination with partial pivoting */
+static uint32_t ref_mat_inverse(uint32_t n)
+{
+  static double a[MAX_SIZE];
+  uint32_t i, j, k, p;
+  double t;
+
+  for (i = 0; i < n * n; i++)
+  {
+    a[i] = xD[i];
+    refD[i] = (i % (n + 1) == 0) ? 1 : 0;
+  }
+  for (k = 0; k < n; k++)
+  {
+    for (p = k, i = k + 1; i < n; i++)
+    {
+      p = (fabs(a[i * n + k]) > fabs(a[p * n + k])) ? i : p;
+    }
+    for (j = 0; j < n; j++)
+    {
+      t = a[k * n + j]; a[k * n + j] = a[p * n + j]; a[p * n + j] = t;
+      t = refD[k * n + j]; refD[k * n + j] = refD[p * n + j]; refD[p * n + j] = t;
+    }
+    t = a[k * n + k];
+    for (j = 0; j < n; j++)
+    {
+      a[k * n + j] /= t;
+      refD[k * n + j] /= t;
+    }
+    for (i = 0; i < n; i++)
+    {
+      if (i != k)
+      {
+        t = a[i * n + k];
+        for (j = 0; j < n; j++)
+        {
+          a[i * n + j] -= t * a[k * n + j];
+          refD[i * n + j] -= t * refD[k * n + j];
+        }
+      }
+    }
+  }
+  return n * n;
+}
+
+static void run_mat_add_f32(uint32_t n) { arm_mat_add_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_add_q31(uint32_t n) { arm_mat_add_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_add_q15(uint32_t n) { arm_mat_add_q15(&matAQ15, &matBQ15, &matCQ15); }
+static void run_mat_sub_f32(uint32_t n) { arm_mat_sub_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_sub_q31(uint32_t n) { arm_mat_sub_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_sub_q15(uint32_t n) { arm_mat_sub_q15(&matAQ15, &matBQ15, &matCQ15); }
+static void run_mat_scale_f32(uint32_t n) { arm_mat_scale_f32(&matAF32, 0.75f, &matCF32); }
+static void run_mat_scale_q31(uint32_t n) { arm_mat_scale_q31(&matAQ31, 0x60000000, 0, &matCQ31); }
+static void run_mat_scale_q15(uint32_t n) { arm_mat_scale_q15(&matAQ15, 0x6000, 0, &matCQ15); }
+static void run_mat_trans_f32(uint32_t n) { arm_mat_trans_f32(&matAF32, &matCF32); }
+static void run_mat_trans_q31(uint32_t n) { arm_mat_trans_q31(&matAQ31, &matCQ31); }
+static void run_mat_trans_q15(uint32_t n) { arm_mat_trans_q15(&matAQ15, &matCQ15); }
+static void run_mat_mult_f32(uint32_t n) { arm_mat_mult_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_mult_q31(uint32_t n) { arm_mat_mult_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_mult_q15(uint32_t n) { arm_mat_mult_q15(&matAQ15, &matBQ15, &matCQ15, scratch1Q15); }
+static void run_mat_mult_fast_q31(uint32_t n) { arm_mat_mult_fast_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_mult_fast_q15(uint32_t n) { arm_mat_mult_fast_q15(&matAQ15, &matBQ15, &matCQ15, scratch1Q15); }
+static void run_mat_cmplx_mult_f32(uint32_t n) { arm_mat_cmplx_mult_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_cmplx_mult_q31(uint32_t n) { arm_mat_cmplx_mult_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_cmplx_mult_q15(uint32_t n) { arm_mat_cmplx_mult_q15(&matAQ15, &matBQ15, &matCQ15, scratch1Q15); }
+
+/* The inverse destroys its input, so each call starts from a copy */
+static void run_mat_inverse_f32(uint32_t n)
+{
+  arm_copy_f32(xf32, wf32, n * n);
+  arm_mat_inverse_f32(&matAF32, &matCF32);
+}
+
+static void run_mat_inverse_f64(uint32_t n)
+{
+  memcpy(wf64, xf64, n * n * sizeof(float64_t));
+  arm_mat_inverse_f64(&matAF64, &matCF64);
+}
+
+/* Symmetric positive definite, A = G * G' / (4 * n) + I / 2 with G in y */
+static void prep_mat_spd(uint32_t n)
+{
+  uint32_t i, j, k;
+  double a;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j <= i; j++)
+    {
+      a = (i == j) ? 0.5 : 0;
+      for (k = 0; k < n; k++)
+      {
+        a += yD[i * n + k] * yD[j * n + k] / (4 * n);
+      }
+      set_input(0, i * n + j, a);
+      set_input(0, j * n + i, a);
+    }
+  }
+  prep_mat(n);
+}
+
+/* Diagonal near 0.75 and rows of the off-diagonal parts summing to less than 0.25 */
+static void prep_mat_tri(uint32_t n)
+{
+  uint32_t i, j;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      set_input(0, i * n + j, (i == j) ? 0.75 + xD[i * n + j] : xD[i * n + j] / n);
+    }
+  }
+  prep_mat(n);
+}
+
+/* Columns of norm below 0.5, Q in o and R after it */
+static void prep_mat_qr(uint32_t n)
+{
+  uint32_t i, j;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      set_input(0, i * n + j, (xD[i * n + j] + (i == j)) * 0.5 / sqrt(n));
+    }
+  }
+  prep_mat(n);
+  matBF32.pData = of32 + n * n;
+  matBQ31.pData = oq31 + n * n;
+}
+
+static uint32_t ref_mat_cholesky(uint32_t n)
+{
+  uint32_t i, j, k;
+  double sum;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      sum = (j <= i) ? xD[i * n + j] : 0;
+      for (k = 0; (j <= i) && (k < j); k++)
+      {
+        sum -= refD[i * n + k] * refD[j * n + k];
+      }
+      refD[i * n + j] = (j < i) ? sum / refD[j * n + j] : (j == i) ? sqrt(sum) : 0;
+    }
+  }
+  return n * n;
+}
+
+/* L, then the n values of D */
+static uint32_t ref_mat_ldlt(uint32_t n)
+{
+  double *d = refD + n * n;
+  uint32_t i, j, k;
+  double sum;
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      sum = (j <= i) ? xD[i * n + j] : 0;
+      for (k = 0; (j <= i) && (k < j); k++)
+      {
+        sum -= refD[i * n + k] * d[k] * refD[j * n + k];
+      }
+      if (j == i)
+      {
+        d[i] = sum;
+      }
+      refD[i * n + j] = (j < i) ? sum / d[j] : (j == i) ? 1 : 0;
+    }
+  }
+  return n * n + n;
+}
+
+static uint32_t ref_mat_solve_lower(uint32_t n)
+{
+  uint32_t i, j, k;
+
+  for (j = 0; j < n; j++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      refD[i * n + j] = yD[i * n + j];
+      for (k = 0; k < i; k++)
+      {
+        refD[i * n + j] -= xD[i * n + k] * refD[k * n + j];
+      }
+      refD[i * n + j] /= xD[i * n + i];
+    }
+  }
+  return n * n;
+}
+
+static uint32_t ref_mat_solve_upper(uint32_t n)
+{
+  uint32_t i, j, k;
+
+  for (j = 0; j < n; j++)
+  {
+    for (i = n; i-- > 0; )
+    {
+      refD[i * n + j] = yD[i * n + j];
+      for (k = i + 1; k < n; k++)
+      {
+        refD[i * n + j] -= xD[i * n + k] * refD[k * n + j];
+      }
+      refD[i * n + j] /= xD[i * n + i];
+    }
+  }
+  return n * n;
+}
+
+/* Modified Gram-Schmidt, Q then R, the diagonal of R is positive */
+static uint32_t ref_mat_qr(uint32_t n)
+{
+  static double v[MAX_SIZE];
+  double *q = refD, *r = refD + n * n;
+  uint32_t i, j, k;
+  double t;
+
+  memcpy(v, xD, n * n * sizeof(double));
+  memset(r, 0, n * n * sizeof(double));
+  for (k = 0; k < n; k++)
+  {
+    for (t = 0, i = 0; i < n; i++)
+    {
+      t += v[i * n + k] * v[i * n + k];
+    }
+    r[k * n + k] = sqrt(t);
+    for (i = 0; i < n; i++)
+    {
+      q[i * n + k] = v[i * n + k] / r[k * n + k];
+    }
+    for (j = k + 1; j < n; j++)
+    {
+      for (t = 0, i = 0; i < n; i++)
+      {
+        t += q[i * n + k] * v[i * n + j];
+      }
+      r[k * n + j] = t;
+      for (i = 0; i < n; i++)
+      {
+        v[i * n + j] -= t * q[i * n + k];
+      }
+    }
+  }
+  return 2 * n * n;
+}
+
+static void run_mat_cholesky_f32(uint32_t n) { arm_mat_cholesky_f32(&matAF32, &matCF32); }
+static void run_mat_cholesky_q31(uint32_t n) { arm_mat_cholesky_q31(&matAQ31, &matCQ31); }
+static void run_mat_ldlt_f32(uint32_t n) { arm_mat_ldlt_f32(&matAF32, &matCF32, of32 + n * n); }
+static void run_mat_solve_lower_triangular_f32(uint32_t n) { arm_mat_solve_lower_triangular_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_solve_lower_triangular_q31(uint32_t n) { arm_mat_solve_lower_triangular_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_solve_upper_triangular_f32(uint32_t n) { arm_mat_solve_upper_triangular_f32(&matAF32, &matBF32, &matCF32); }
+static void run_mat_solve_upper_triangular_q31(uint32_t n) { arm_mat_solve_upper_triangular_q31(&matAQ31, &matBQ31, &matCQ31); }
+static void run_mat_qr_f32(uint32_t n) { arm_mat_qr_f32(&matAF32, &matCF32, &matBF32); }
+static void run_mat_qr_q31(uint32_t n) { arm_mat_qr_q31(&matAQ31, &matCQ31, &matBQ31); }
+
+/* ----------------------------------------------------------------------
+ * Statistics, the index outputs of min and max are not checked
+ * ------------------------------------------------------------------- */
+
+static uint32_t ref_max(uint32_t n) { uint32_t i; refD[0] = xD[0]; for (i = 1; i < n; i++) refD[0] = (xD[i] > refD[0]) ? xD[i] : refD[0]; return 1; }
+static uint32_t ref_min(uint32_t n) { uint32_t i; refD[0] = xD[0]; for (i = 1; i < n; i++) refD[0] = (xD[i] < refD[0]) ? xD[i] : refD[0]; return 1; }
+static uint32_t ref_mean(uint32_t n) { uint32_t i; refD[0] = 0; for (i = 0; i < n; i++) refD[0] += xD[i] / n; return 1; }
+static uint32_t ref_power(uint32_t n) { uint32_t i; refD[0] = 0; for (i = 0; i < n; i++) refD[0] += xD[i] * xD[i]; return 1; }
+static uint32_t ref_rms(uint32_t n) { ref_power(n); refD[0] = sqrt(refD[0] / n); return 1; }
+
+/* Sample variance, divided by n - 1 */
+static uint32_t ref_var(uint32_t n)
+{
+  uint32_t i;
+  double mean, sum = 0;
+
+  ref_mean(n);
+  mean = refD[0];
+  for (i = 0; i < n; i++)
+  {
+    sum += (xD[i] - mean) * (xD[i] - mean);
+  }
+  refD[0] = sum / (n - 1);
+  return 1;
+}
+
+static uint32_t ref_std(uint32_t n) { ref_var(n); refD[0] = sqrt(refD[0]); return 1; }
+
+#define RUN_STAT(fn, t)  static void run_##fn##_##t(uint32_t n) { arm_##fn##_##t(x##t, n, &o##t[0]); }
+#define RUN_INDEX(fn, t) static void run_##fn##_##t(uint32_t n) { uint32_t index; arm_##fn##_##t(x##t, n, &o##t[0], &index); }
+
+RUN_INDEX(max, f32) RUN_INDEX(max, q31) RUN_INDEX(max, q15) RUN_INDEX(max, q7)
+RUN_INDEX(min, f32) RUN_INDEX(min, q31) RUN_INDEX(min, q15) RUN_INDEX(min, q7)
+RUN_STAT(mean, f32) RUN_STAT(mean, q31) RUN_STAT(mean, q15) RUN_STAT(mean, q7)
+RUN_STAT(rms, f32) RUN_STAT(rms, q31) RUN_STAT(rms, q15)
+RUN_STAT(var, f32) RUN_STAT(var, q31) RUN_STAT(var, q15)
+RUN_STAT(std, f32) RUN_STAT(std, q31) RUN_STAT(std, q15)
+
+static void run_power_f32(uint32_t n) { arm_power_f32(xf32, n, &of32[0]); }
+static void run_power_q31(uint32_t n) { arm_power_q31(xq31, n, &oq63[0]); }
+static void run_power_q15(uint32_t n) { arm_power_q15(xq15, n, &oq63[0]); }
+static void run_power_q7(uint32_t n) { arm_power_q7(xq7, n, &oq31[0]); }
+
+/* Streaming statistics, the window of the sliding estimators */
+#define STAT_WINDOW     32
+
+static arm_welford_instance_f32 welfordF32;
+static arm_moving_rms_instance_q31 movingRmsQ31;
+static arm_sliding_minmax_instance_f32 minmaxF32;
+static arm_sliding_minmax_instance_q31 minmaxQ31;
+static arm_p2_quantile_instance_f32 p2F32[3];
+static q31_t movingRmsStateQ31[STAT_WINDOW];
+static float32_t minmaxValF32[2 * STAT_WINDOW];
+static q31_t minmaxValQ31[2 * STAT_WINDOW];
+static uint32_t minmaxPos[2 * STAT_WINDOW];
+static const double p2Quantiles[3] = {0.1, 0.5, 0.9};
+
+/* Mean and variance */
+static uint32_t ref_welford(uint32_t n)
+{
+  ref_var(n);
+  refD[1] = refD[0];
+  ref_mean(n);
+  return 2;
+}
+
+/* RMS of the last STAT_WINDOW samples, of the samples so far until the window is full */
+static uint32_t ref_moving_rms(uint32_t n)
+{
+  uint32_t i, k, len;
+  double sum;
+
+  for (i = 0; i < n; i++)
+  {
+    len = (i + 1 < STAT_WINDOW) ? i + 1 : STAT_WINDOW;
+    for (sum = 0, k = 0; k < len; k++)
+    {
+      sum += xD[i - k] * xD[i - k];
+    }
+    refD[i] = sqrt(sum / len);
+  }
+  return n;
+}
+
+/* Minimum of each window, then maximum of each window */
+static uint32_t ref_sliding_minmax(uint32_t n)
+{
+  uint32_t i, k, len;
+
+  for (i = 0; i < n; i++)
+  {
+    len = (i + 1 < STAT_WINDOW) ? i + 1 : STAT_WINDOW;
+    refD[i] = refD[n + i] = xD[i];
+    for (k = 1; k < len; k++)
+    {
+      refD[i] = (xD[i - k] < refD[i]) ? xD[i - k] : refD[i];
+      refD[n + i] = (xD[i - k] > refD[n + i]) ? xD[i - k] : refD[n + i];
+    }
+  }
+  return 2 * n;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+  double d = *(const double *) a - *(const double *) b;
+
+  return (d > 0) - (d < 0);
+}
+
+/* Quantiles of the samples, interpolated between the two nearest ranks */
+static uint32_t ref_p2_quantile(uint32_t n)
+{
+  static double sorted[BUF_LEN];
+  uint32_t k, i;
+  double pos;
+
+  memcpy(sorted, xD, n * sizeof(double));
+  qsort(sorted, n, sizeof(double), compare_double);
+  for (k = 0; k < 3; k++)
+  {
+    pos = p2Quantiles[k] * (n - 1);
+    i = (uint32_t) pos;
+    refD[k] = (i + 1 < n) ? sorted[i] + (pos - i) * (sorted[i + 1] - sorted[i]) : sorted[i];
+  }
+  return 3;
+}
+
+/* Blocks of 1, 7 and the rest of the samples, so that the blocks are merged */
+static void run_welford_f32(uint32_t n)
+{
+  arm_welford_init_f32(&welfordF32);
+  arm_welford_f32(&welfordF32, xf32, 1, &of32[0], &of32[1]);
+  arm_welford_f32(&welfordF32, xf32 + 1, 7, &of32[0], &of32[1]);
+  arm_welford_f32(&welfordF32, xf32 + 8, n - 8, &of32[0], &of32[1]);
+}
+
+static void run_moving_rms_q31(uint32_t n)
+{
+  arm_moving_rms_init_q31(&movingRmsQ31, STAT_WINDOW, movingRmsStateQ31);
+  arm_moving_rms_q31(&movingRmsQ31, xq31, oq31, n);
+}
+
+static void run_sliding_minmax_f32(uint32_t n)
+{
+  arm_sliding_minmax_init_f32(&minmaxF32, STAT_WINDOW, minmaxValF32, minmaxPos);
+  arm_sliding_minmax_f32(&minmaxF32, xf32, of32, of32 + n, n);
+}
+
+static void run_sliding_minmax_q31(uint32_t n)
+{
+  arm_sliding_minmax_init_q31(&minmaxQ31, STAT_WINDOW, minmaxValQ31, minmaxPos);
+  arm_sliding_minmax_q31(&minmaxQ31, xq31, oq31, oq31 + n, n);
+}
+
+static void run_p2_quantile_f32(uint32_t n)
+{
+  uint32_t k;
+
+  for (k = 0; k < 3; k++)
+  {
+    arm_p2_quantile_init_f32(&p2F32[k], (float32_t) p2Quantiles[k]);
+    arm_p2_quantile_f32(&p2F32[k], xf32, n, &of32[k]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Support
+ * ------------------------------------------------------------------- */
+
+RUN_XO(copy, f32) RUN_XO(copy, q31) RUN_XO(copy, q15) RUN_XO(copy, q7)
+
+static void run_float_to_q31(uint32_t n) { arm_float_to_q31(xf32, oq31, n); }
+static void run_float_to_q15(uint32_t n) { arm_float_to_q15(xf32, oq15, n); }
+static void run_float_to_q7(uint32_t n) { arm_float_to_q7(xf32, oq7, n); }
+static void run_q31_to_float(uint32_t n) { arm_q31_to_float(xq31, of32, n); }
+static void run_q31_to_q15(uint32_t n) { arm_q31_to_q15(xq31, oq15, n); }
+static void run_q31_to_q7(uint32_t n) { arm_q31_to_q7(xq31, oq7, n); }
+static void run_q15_to_float(uint32_t n) { arm_q15_to_float(xq15, of32, n); }
+static void run_q15_to_q31(uint32_t n) { arm_q15_to_q31(xq15, oq31, n); }
+static void run_q15_to_q7(uint32_t n) { arm_q15_to_q7(xq15, oq7, n); }
+static void run_q7_to_float(uint32_t n) { arm_q7_to_float(xq7, of32, n); }
+static void run_q7_to_q31(uint32_t n) { arm_q7_to_q31(xq7, oq31, n); }
+static void run_q7_to_q15(uint32_t n) { arm_q7_to_q15(xq7, oq15, n); }
+
+/* ----------------------------------------------------------------------
+ * Transforms
+ * ------------------------------------------------------------------- */
+
+static const arm_cfft_instance_f32 *cfftF32;
+static const arm_cfft_instance_q31 *cfftQ31;
+static const arm_cfft_instance_q15 *cfftQ15;
+static arm_cfft_radix4_instance_f32 radix4F32;
+static arm_cfft_radix4_instance_q31 radix4Q31;
+static arm_cfft_radix4_instance_q15 radix4Q15;
+static arm_rfft_fast_instance_f32 rfftFastF32;
+static arm_rfft_instance_f32 rfftF32;
+static arm_rfft_instance_q31 rfftQ31;
+static arm_rfft_instance_q15 rfftQ15;
+static void (*cfftLenF32)(float32_t *p, float32_t *pScratch, uint8_t ifftFlag);
+static void (*rfftLenF32)(float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+static arm_dct4_instance_f32 dct4F32;
+static arm_dct4_instance_q31 dct4Q31;
+static arm_dct4_instance_q15 dct4Q15;
+static arm_goertzel_instance_f32 goertzelF32;
+static arm_goertzel_instance_q31 goertzelQ31;
+static arm_sdft_instance_f32 sdftF32;
+static arm_sdft_instance_q31 sdftQ31;
+static float32_t binCoeffF32[2 * NUM_BINS], binStateF32[2 * NUM_BINS];
+static q31_t binCoeffQ31[2 * NUM_BINS], binStateQ31[2 * NUM_BINS];
+
+/* Goertzel bin frequencies, normalized by the sample rate */
+static const double goertzelFreqs[NUM_BINS] = {0.01, 0.05, 0.0625, 0.1, 0.15, 0.25, 0.33, 0.45};
+static uint16_t sdftBins[NUM_BINS] = {0, 1, 3, 5, 8, 13, 21, 31};
+static double sdftDamping;
+
+/* log2 of a power of 2 */
+static uint32_t log2_pow2(uint32_t n)
+{
+  uint32_t l = 0;
+
+  while ((1u << l) < n)
+  {
+    l++;
+  }
+  return l;
+}
+
+static uint32_t ref_cfft(uint32_t n)
+{
+  uint32_t i, k;
+  double re, im;
+
+  for (k = 0; k < n; k++)
+  {
+    re = im = 0;
+    for (i = 0; i < n; i++)
+    {
+      double w = -2 * PI_D * ((i * k) % n) / n;
+      re += xD[2 * i] * cos(w) - xD[2 * i + 1] * sin(w);
+      im += xD[2 * i] * sin(w) + xD[2 * i + 1] * cos(w);
+    }
+    refD[2 * k] = re;
+    refD[2 * k + 1] = im;
+  }
+  return 2 * n;
+}
+
+/* Spectrum of a real input, bins 0 to n/2 */
+static void real_dft(uint32_t n, double *pDst)
+{
+  uint32_t i, k;
+
+  for (k = 0; k <= n / 2; k++)
+  {
+    pDst[2 * k] = pDst[2 * k + 1] = 0;
+    for (i = 0; i < n; i++)
+    {
+      double w = -2 * PI_D * ((i * k) % n) / n;
+      pDst[2 * k] += xD[i] * cos(w);
+      pDst[2 * k + 1] += xD[i] * sin(w);
+    }
+  }
+}
+
+/* rfft_fast packs the real Nyquist bin in the imaginary part of bin 0 */
+static uint32_t ref_rfft_fast(uint32_t n)
+{
+  real_dft(n, refD);
+  refD[1] = refD[n];
+  return n;
+}
+
+static uint32_t ref_rfft(uint32_t n)
+{
+  real_dft(n, refD);
+  return n + 2;
+}
+
+static uint32_t ref_dct4(uint32_t n)
+{
+  uint32_t i, k;
+
+  for (k = 0; k < n; k++)
+  {
+    refD[k] = 0;
+    for (i = 0; i < n; i++)
+    {
+      refD[k] += xD[i] * cos(PI_D / n * (i + 0.5) * (k + 0.5));
+    }
+    refD[k] *= sqrt(2.0 / n);
+  }
+  return n;
+}
+
+/* The fixed-point outputs are scaled down by the length of the transform */
+static void prep_cfft(uint32_t n)
+{
+  switch (n)
+  {
+  case 64:
+    cfftF32 = &arm_cfft_sR_f32_len64;
+    cfftQ31 = &arm_cfft_sR_q31_len64;
+    cfftQ15 = &arm_cfft_sR_q15_len64;
+    break;
+  case 256:
+    cfftF32 = &arm_cfft_sR_f32_len256;
+    cfftQ31 = &arm_cfft_sR_q31_len256;
+    cfftQ15 = &arm_cfft_sR_q15_len256;
+    break;
+  default:
+    cfftF32 = &arm_cfft_sR_f32_len1024;
+    cfftQ31 = &arm_cfft_sR_q31_len1024;
+    cfftQ15 = &arm_cfft_sR_q15_len1024;
+    break;
+  }
+  arm_cfft_radix4_init_f32(&radix4F32, n, 0, 1);
+  arm_cfft_radix4_init_q31(&radix4Q31, n, 0, 1);
+  arm_cfft_radix4_init_q15(&radix4Q15, n, 0, 1);
+  outScale *= n;
+}
+
+/* The fixed-length FFTs written by arm_fft_gen */
+static void prep_fft_len(uint32_t n)
+{
+  switch (n)
+  {
+  case 256:
+    cfftLenF32 = arm_cfft_len256_f32;
+    rfftLenF32 = arm_rfft_fast_len256_f32;
+    break;
+  case 512:
+    cfftLenF32 = arm_cfft_len512_f32;
+    rfftLenF32 = arm_rfft_fast_len512_f32;
+    break;
+  default:
+    cfftLenF32 = arm_cfft_len1024_f32;
+    rfftLenF32 = arm_rfft_fast_len1024_f32;
+    break;
+  }
+}
+
+static void prep_rfft(uint32_t n)
+{
+  arm_rfft_fast_init_f32(&rfftFastF32, n);
+  arm_rfft_init_q31(&rfftQ31, n, 0, 1);
+  arm_rfft_init_q15(&rfftQ15, n, 0, 1);
+  outScale *= n;
+}
+
+/* The fixed-point outputs are scaled down by the length of the transform.
+   Their inputs must leave one bit of headroom, so the range is halved. */
+static void prep_dct4(uint32_t n)
+{
+  arm_dct4_init_f32(&dct4F32, &rfftF32, &radix4F32, n, n / 2, (float32_t) sqrt(2.0 / n));
+  arm_dct4_init_q31(&dct4Q31, &rfftQ31, &radix4Q31, n, n / 2, to_q31(sqrt(2.0 / n)));
+  arm_dct4_init_q15(&dct4Q15, &rfftQ15, &radix4Q15, n, n / 2, to_q15(sqrt(2.0 / n)));
+  outScale *= n;
+}
+
+static void prep_goertzel(uint32_t n)
+{
+  float32_t freqsF32[NUM_BINS];
+  q31_t freqsQ31[NUM_BINS];
+  uint32_t k;
+
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    freqsF32[k] = (float32_t) goertzelFreqs[k];
+    freqsQ31[k] = to_q31(goertzelFreqs[k]);
+  }
+  arm_goertzel_init_f32(&goertzelF32, NUM_BINS, n, freqsF32, binCoeffF32, binStateF32);
+  arm_goertzel_init_q31(&goertzelQ31, NUM_BINS, n, freqsQ31, binCoeffQ31, binStateQ31);
+  outScale *= 1u << (2 * log2_pow2(n));
+}
+
+/* Power of each bin over the whole block */
+static uint32_t ref_goertzel(uint32_t n)
+{
+  uint32_t i, k;
+  double re, im, w;
+
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    w = 2 * PI_D * ((inType == T_F32) ? (float32_t) goertzelFreqs[k] : to_q31(goertzelFreqs[k]) / 2147483648.0);
+    re = im = 0;
+    for (i = 0; i < n; i++)
+    {
+      re += xD[i] * cos(w * i);
+      im -= xD[i] * sin(w * i);
+    }
+    refD[k] = re * re + im * im;
+  }
+  return NUM_BINS;
+}
+
+/* The q31 version scales the input down by the window length */
+static void prep_sdft(uint32_t n)
+{
+  arm_sdft_init_f32(&sdftF32, NUM_BINS, SDFT_LEN, sdftBins, 0.999999f, binCoeffF32, stateF32, binStateF32);
+  arm_sdft_init_q31(&sdftQ31, NUM_BINS, SDFT_LEN, sdftBins, 0x7FFFF79D, binCoeffQ31, stateQ31, binStateQ31);
+  sdftDamping = (inType == T_F32) ? (float32_t) 0.999999f : 0x7FFFF79D / 2147483648.0;
+  outScale *= SDFT_LEN;
+}
+
+/* Bins after the last sample, the sample m samples old is weighted by r^m */
+static uint32_t ref_sdft(uint32_t n)
+{
+  uint32_t k, m;
+  double re, im, w, r;
+
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    re = im = 0;
+    r = 1;
+    for (m = 0; (m < SDFT_LEN) && (m < n); m++)
+    {
+      w = 2 * PI_D * (((m + 1) * sdftBins[k]) % SDFT_LEN) / SDFT_LEN;
+      re += r * xD[n - 1 - m] * cos(w);
+      im += r * xD[n - 1 - m] * sin(w);
+      r *= sdftDamping;
+    }
+    refD[2 * k] = re;
+    refD[2 * k + 1] = im;
+  }
+  return 2 * NUM_BINS;
+}
+
+/* The in-place transforms start from a copy of the input */
+static void run_cfft_f32(uint32_t n) { arm_copy_f32(xf32, of32, 2 * n); arm_cfft_f32(cfftF32, of32, 0, 1); }
+static void run_cfft_q31(uint32_t n) { arm_copy_q31(xq31, oq31, 2 * n); arm_cfft_q31(cfftQ31, oq31, 0, 1); }
+static void run_cfft_q15(uint32_t n) { arm_copy_q15(xq15, oq15, 2 * n); arm_cfft_q15(cfftQ15, oq15, 0, 1); }
+static void run_cfft_radix4_f32(uint32_t n) { arm_copy_f32(xf32, of32, 2 * n); arm_cfft_radix4_f32(&radix4F32, of32); }
+static void run_cfft_radix4_q31(uint32_t n) { arm_copy_q31(xq31, oq31, 2 * n); arm_cfft_radix4_q31(&radix4Q31, oq31); }
+static void run_cfft_radix4_q15(uint32_t n) { arm_copy_q15(xq15, oq15, 2 * n); arm_cfft_radix4_q15(&radix4Q15, oq15); }
+static void run_rfft_fast_f32(uint32_t n) { arm_copy_f32(xf32, wf32, n); arm_rfft_fast_f32(&rfftFastF32, wf32, of32, 0); }
+static void run_cfft_len_f32(uint32_t n) { arm_copy_f32(xf32, of32, 2 * n); cfftLenF32(of32, wf32, 0); }
+static void run_rfft_fast_len_f32(uint32_t n) { arm_copy_f32(xf32, wf32, n); rfftLenF32(wf32, of32, 0); }
+static void run_rfft_q31(uint32_t n) { arm_copy_q31(xq31, wq31, n); arm_rfft_q31(&rfftQ31, wq31, oq31); }
+static void run_rfft_q15(uint32_t n) { arm_copy_q15(xq15, wq15, n); arm_rfft_q15(&rfftQ15, wq15, oq15); }
+static void run_dct4_f32(uint32_t n) { arm_copy_f32(xf32, of32, n); arm_dct4_f32(&dct4F32, wf32, of32); }
+static void run_dct4_q31(uint32_t n) { arm_copy_q31(xq31, oq31, n); arm_dct4_q31(&dct4Q31, wq31, oq31); }
+static void run_dct4_q15(uint32_t n) { arm_copy_q15(xq15, oq15, n); arm_dct4_q15(&dct4Q15, wq15, oq15); }
+static void run_goertzel_f32(uint32_t n) { arm_goertzel_f32(&goertzelF32, xf32, of32, n); }
+static void run_goertzel_q31(uint32_t n) { arm_goertzel_q31(&goertzelQ31, xq31, oq31, n); }
+static void run_sdft_f32(uint32_t n) { arm_sdft_f32(&sdftF32, xf32, NULL, n); arm_copy_f32(binStateF32, of32, 2 * NUM_BINS); }
+static void run_sdft_q31(uint32_t n) { arm_sdft_q31(&sdftQ31, xq31, NULL, n); arm_copy_q31(binStateQ31, oq31, 2 * NUM_BINS); }
+
+/* ----------------------------------------------------------------------
+ * Cases
+ * ------------------------------------------------------------------- */
+
+#define CASE(group, fn, t, in, out, frac, sizes, lo, hi, snr, prep, ref) \
+  { group, "arm_" #fn "_" #t, in, out, frac, sizes, lo, hi, snr, prep, ref, run_##fn##_##t }
+
+/* Same input and output type, vector sizes and inputs in [-0.5 0.5) */
+#define VEC(group, fn, t, T, snr, ref) CASE(group, fn, t, T, T, 0, vecSizes, -0.5, 0.5, snr, NULL, ref)
+
+#define CONVERT(from, to, IN, OUT, snr) \
+  { "support", "arm_" #from "_to_" #to, IN, OUT, 0, vecSizes, -0.99, 0.99, snr, NULL, ref_copy, run_##from##_to_##to }
+
+static const check_case cases[] =
+{
+  VEC("basic", add, f32, T_F32, 140, ref_add),
+  VEC("basic", add, q31, T_Q31, 200, ref_add),
+  VEC("basic", add, q15, T_Q15, 200, ref_add),
+  VEC("basic", add, q7, T_Q7, 200, ref_add),
+  VEC("basic", sub, f32, T_F32, 140, ref_sub),
+  VEC("basic", sub, q31, T_Q31, 200, ref_sub),
+  VEC("basic", sub, q15, T_Q15, 200, ref_sub),
+  VEC("basic", sub, q7, T_Q7, 200, ref_sub),
+  VEC("basic", mult, f32, T_F32, 145, ref_mult),
+  VEC("basic", mult, q31, T_Q31, 160, ref_mult),
+  VEC("basic", mult, q15, T_Q15, 65, ref_mult),
+  VEC("basic", mult, q7, T_Q7, 15, ref_mult),
+  VEC("basic", negate, f32, T_F32, 200, ref_negate),
+  VEC("basic", negate, q31, T_Q31, 200, ref_negate),
+  VEC("basic", negate, q15, T_Q15, 200, ref_negate),
+  VEC("basic", negate, q7, T_Q7, 200, ref_negate),
+  VEC("basic", abs, f32, T_F32, 200, ref_abs),
+  VEC("basic", abs, q31, T_Q31, 200, ref_abs),
+  VEC("basic", abs, q15, T_Q15, 200, ref_abs),
+  VEC("basic", abs, q7, T_Q7, 200, ref_abs),
+  VEC("basic", scale, f32, T_F32, 140, ref_scale),
+  VEC("basic", scale, q31, T_Q31, 165, ref_scale),
+  VEC("basic", scale, q15, T_Q15, 75, ref_scale),
+  VEC("basic", scale, q7, T_Q7, 25, ref_scale),
+  VEC("basic", offset, f32, T_F32, 140, ref_offset),
+  VEC("basic", offset, q31, T_Q31, 200, ref_offset),
+  VEC("basic", offset, q15, T_Q15, 200, ref_offset),
+  VEC("basic", offset, q7, T_Q7, 200, ref_offset),
+  VEC("basic", shift, q31, T_Q31, 200, ref_shift),
+  VEC("basic", shift, q15, T_Q15, 200, ref_shift),
+  VEC("basic", shift, q7, T_Q7, 45, ref_shift),
+  VEC("basic", dot_prod, f32, T_F32, 120, ref_dot_prod),
+  CASE("basic", dot_prod, q31, T_Q31, T_Q63, 48, vecSizes, -0.5, 0.5, 230, NULL, ref_dot_prod),
+  CASE("basic", dot_prod, q15, T_Q15, T_Q63, 30, vecSizes, -0.5, 0.5, 200, NULL, ref_dot_prod),
+  CASE("basic", dot_prod, q7, T_Q7, T_Q31, 14, vecSizes, -0.5, 0.5, 200, NULL, ref_dot_prod),
+
+  VEC("complex", cmplx_conj, f32, T_F32, 200, ref_cmplx_conj),
+  VEC("complex", cmplx_conj, q31, T_Q31, 200, ref_cmplx_conj),
+  VEC("complex", cmplx_conj, q15, T_Q15, 200, ref_cmplx_conj),
+  VEC("complex", cmplx_dot_prod, f32, T_F32, 110, ref_cmplx_dot_prod),
+  CASE("complex", cmplx_dot_prod, q31, T_Q31, T_Q63, 48, vecSizes, -0.5, 0.5, 230, NULL, ref_cmplx_dot_prod),
+  CASE("complex", cmplx_dot_prod, q15, T_Q15, T_Q31, 24, vecSizes, -0.5, 0.5, 125, NULL, ref_cmplx_dot_prod),
+  VEC("complex", cmplx_mag, f32, T_F32, 140, ref_cmplx_mag),
+  CASE("complex", cmplx_mag, q31, T_Q31, T_Q31, 30, vecSizes, -0.5, 0.5, 140, NULL, ref_cmplx_mag),
+  CASE("complex", cmplx_mag, q15, T_Q15, T_Q15, 14, vecSizes, -0.5, 0.5, 55, NULL, ref_cmplx_mag),
+  VEC("complex", cmplx_mag_squared, f32, T_F32, 140, ref_cmplx_mag_squared),
+  CASE("complex", cmplx_mag_squared, q31, T_Q31, T_Q31, 29, vecSizes, -0.5, 0.5, 150, NULL, ref_cmplx_mag_squared),
+  CASE("complex", cmplx_mag_squared, q15, T_Q15, T_Q15, 13, vecSizes, -0.5, 0.5, 60, NULL, ref_cmplx_mag_squared),
+  VEC("complex", cmplx_mult_cmplx, f32, T_F32, 140, ref_cmplx_mult_cmplx),
+  CASE("complex", cmplx_mult_cmplx, q31, T_Q31, T_Q31, 29, vecSizes, -0.5, 0.5, 145, NULL, ref_cmplx_mult_cmplx),
+  CASE("complex", cmplx_mult_cmplx, q15, T_Q15, T_Q15, 13, vecSizes, -0.5, 0.5, 50, NULL, ref_cmplx_mult_cmplx),
+  VEC("complex", cmplx_mult_real, f32, T_F32, 145, ref_cmplx_mult_real),
+  VEC("complex", cmplx_mult_real, q31, T_Q31, 160, ref_cmplx_mult_real),
+  VEC("complex", cmplx_mult_real, q15, T_Q15, 65, ref_cmplx_mult_real),
+
+  CASE("controller", pid, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 110, prep_pid_f32, ref_pid),
+  CASE("controller", pid, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 115, prep_pid_q31, ref_pid),
+  CASE("controller", pid, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 15, prep_pid_q15, ref_pid),
+  CASE("controller", sin_cos, f32, T_F32, T_F32, 0, vecSizes, -180, 180, 130, NULL, ref_sin_cos),
+  CASE("controller", sin_cos, q31, T_Q31, T_Q31, 0, vecSizes, -1, 1, 65, NULL, ref_sin_cos),
+  VEC("controller", clarke, f32, T_F32, 140, ref_clarke),
+  VEC("controller", clarke, q31, T_Q31, 170, ref_clarke),
+  VEC("controller", inv_clarke, f32, T_F32, 140, ref_inv_clarke),
+  VEC("controller", inv_clarke, q31, T_Q31, 175, ref_inv_clarke),
+  CASE("controller", park, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 140, prep_park, ref_park),
+  CASE("controller", park, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 170, prep_park, ref_park),
+  CASE("controller", inv_park, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 140, prep_park, ref_inv_park),
+  CASE("controller", inv_park, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 170, prep_park, ref_inv_park),
+
+  CASE("fastmath", sin, f32, T_F32, T_F32, 0, vecSizes, -2 * PI_D, 2 * PI_D, 90, NULL, ref_sin),
+  CASE("fastmath", sin, q31, T_Q31, T_Q31, 0, vecSizes, 0, 1, 90, NULL, ref_sin),
+  CASE("fastmath", sin, q15, T_Q15, T_Q15, 0, vecSizes, 0, 1, 70, NULL, ref_sin),
+  CASE("fastmath", cos, f32, T_F32, T_F32, 0, vecSizes, -2 * PI_D, 2 * PI_D, 90, NULL, ref_cos),
+  CASE("fastmath", cos, q31, T_Q31, T_Q31, 0, vecSizes, 0, 1, 90, NULL, ref_cos),
+  CASE("fastmath", cos, q15, T_Q15, T_Q15, 0, vecSizes, 0, 1, 70, NULL, ref_cos),
+  CASE("fastmath", sqrt, f32, T_F32, T_F32, 0, vecSizes, 0, 4, 145, NULL, ref_sqrt),
+  CASE("fastmath", sqrt, q31, T_Q31, T_Q31, 0, vecSizes, 0, 1, 170, NULL, ref_sqrt),
+  CASE("fastmath", sqrt, q15, T_Q15, T_Q15, 0, vecSizes, 0, 1, 75, NULL, ref_sqrt),
+  CASE("fastmath", vsin, f32, T_F32, T_F32, 0, vecSizes, -2 * PI_D, 2 * PI_D, 140, NULL, ref_sin),
+  CASE("fastmath", vsin, q31, T_Q31, T_Q31, 0, vecSizes, -1, 1, 175, NULL, ref_sin),
+  CASE("fastmath", vsin, q15, T_Q15, T_Q15, 0, vecSizes, -1, 1, 90, NULL, ref_sin),
+  CASE("fastmath", vcos, f32, T_F32, T_F32, 0, vecSizes, -2 * PI_D, 2 * PI_D, 140, NULL, ref_cos),
+  CASE("fastmath", vcos, q31, T_Q31, T_Q31, 0, vecSizes, -1, 1, 175, NULL, ref_cos),
+  CASE("fastmath", vcos, q15, T_Q15, T_Q15, 0, vecSizes, -1, 1, 90, NULL, ref_cos),
+  CASE("fastmath", vatan2, f32, T_F32, T_F32, 0, vecSizes, -1, 1, 140, NULL, ref_atan2),
+  CASE("fastmath", vatan2, q31, T_Q31, T_Q31, 0, vecSizes, -1, 1, 160, NULL, ref_atan2),
+  CASE("fastmath", vatan2, q15, T_Q15, T_Q15, 0, vecSizes, -1, 1, 85, NULL, ref_atan2),
+  CASE("fastmath", vexp, f32, T_F32, T_F32, 0, vecSizes, -5, 5, 140, NULL, ref_exp),
+  CASE("fastmath", vlog, f32, T_F32, T_F32, 0, vecSizes, 0.01, 100, 140, NULL, ref_log),
+  CASE("fastmath", vsqrt, f32, T_F32, T_F32, 0, vecSizes, 0, 100, 140, NULL, ref_sqrt),
+
+  CASE("filtering", fir, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 130, prep_fir, ref_fir),
+  CASE("filtering", fir, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 145, prep_fir, ref_fir),
+  CASE("filtering", fir, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 50, prep_fir, ref_fir),
+  CASE("filtering", fir, q7, T_Q7, T_Q7, 0, vecSizes, -0.5, 0.5, 5, prep_fir, ref_fir),
+  CASE("filtering", fir_fast, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 140, prep_fir, ref_fir),
+  CASE("filtering", fir_fast, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 50, prep_fir, ref_fir),
+  CASE("filtering", fir_decimate, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 130, prep_fir_decimate, ref_fir_decimate),
+  CASE("filtering", fir_decimate, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 125, prep_fir_decimate, ref_fir_decimate),
+  CASE("filtering", fir_decimate, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 30, prep_fir_decimate, ref_fir_decimate),
+  CASE("filtering", fir_decimate_fast, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 100, prep_fir_decimate, ref_fir_decimate),
+  CASE("filtering", fir_decimate_fast, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 30, prep_fir_decimate, ref_fir_decimate),
+  CASE("filtering", fir_interpolate, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 135, prep_fir_interpolate, ref_fir_interpolate),
+  CASE("filtering", fir_interpolate, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 155, prep_fir_interpolate, ref_fir_interpolate),
+  CASE("filtering", fir_interpolate, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 60, prep_fir_interpolate, ref_fir_interpolate),
+  CASE("filtering", resample, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 140, prep_resample, ref_resample),
+  CASE("filtering", resample, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 165, prep_resample, ref_resample),
+  CASE("filtering", resample, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 70, prep_resample, ref_resample),
+  CASE("filtering", fir_fft, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 115, prep_fir_fft, ref_fir),
+  CASE("filtering", fir_fft, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 95, prep_fir_fft, ref_fir),
+  CASE("filtering", biquad_cascade_df1, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 125, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cascade_df1, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 145, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cascade_df1, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 50, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cascade_df1_fast, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 140, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cascade_df1_fast, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 50, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cas_df1_32x64, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 160, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cascade_df2T, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 125, prep_biquad, ref_biquad),
+  CASE("filtering", biquad_cascade_df2T, f64, T_F64, T_F64, 0, vecSizes, -0.5, 0.5, 295, prep_biquad, ref_biquad),
+  CASE("filtering", fir_interleaved, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 130, prep_fir_interleaved, ref_fir_interleaved),
+  CASE("filtering", fir_interleaved, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 115, prep_fir_interleaved, ref_fir_interleaved),
+  CASE("filtering", fir_interleaved, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 20, prep_fir_interleaved, ref_fir_interleaved),
+  CASE("filtering", biquad_cascade_interleaved_df2T, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 125, prep_biquad_interleaved, ref_biquad_interleaved),
+  CASE("filtering", biquad_cascade_interleaved_df1, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 140, prep_biquad_interleaved, ref_biquad_interleaved),
+  CASE("filtering", biquad_cascade_interleaved_df1, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 45, prep_biquad_interleaved, ref_biquad_interleaved),
+  CASE("filtering", biquad_cascade_stereo_df2T, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 125, prep_biquad_interleaved, ref_biquad_stereo),
+  CASE("filtering", conv, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 130, NULL, ref_conv),
+  CASE("filtering", conv, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 160, NULL, ref_conv),
+  CASE("filtering", conv, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, NULL, ref_conv),
+  CASE("filtering", conv, q7, T_Q7, T_Q7, 0, vecSizes, -0.25, 0.25, 15, NULL, ref_conv),
+  CASE("filtering", conv_fast, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 130, NULL, ref_conv),
+  CASE("filtering", conv_fast, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, NULL, ref_conv),
+  CASE("filtering", conv_opt, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, NULL, ref_conv),
+  CASE("filtering", conv_fast_opt, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, NULL, ref_conv),
+  CASE("filtering", conv_opt, q7, T_Q7, T_Q7, 0, vecSizes, -0.25, 0.25, 15, NULL, ref_conv),
+  CASE("filtering", conv_partial, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 135, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 160, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial, q7, T_Q7, T_Q7, 0, vecSizes, -0.25, 0.25, 20, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial_fast, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 130, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial_fast, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial_opt, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial_fast_opt, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_conv_partial),
+  CASE("filtering", conv_partial_opt, q7, T_Q7, T_Q7, 0, vecSizes, -0.25, 0.25, 20, prep_clear, ref_conv_partial),
+  CASE("filtering", correlate, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 130, prep_clear, ref_correlate),
+  CASE("filtering", correlate, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 160, prep_clear, ref_correlate),
+  CASE("filtering", correlate, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_correlate),
+  CASE("filtering", correlate, q7, T_Q7, T_Q7, 0, vecSizes, -0.25, 0.25, 15, prep_clear, ref_correlate),
+  CASE("filtering", correlate_fast, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 130, prep_clear, ref_correlate),
+  CASE("filtering", correlate_fast, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_correlate),
+  CASE("filtering", correlate_opt, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_correlate),
+  CASE("filtering", correlate_fast_opt, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 65, prep_clear, ref_correlate),
+  CASE("filtering", correlate_opt, q7, T_Q7, T_Q7, 0, vecSizes, -0.25, 0.25, 15, prep_clear, ref_correlate),
+  CASE("filtering", lms, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 130, prep_lms, ref_lms),
+  CASE("filtering", lms, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 100, prep_lms, ref_lms),
+  CASE("filtering", lms, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 10, prep_lms, ref_lms),
+  CASE("filtering", lms_norm, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 120, prep_lms_norm, ref_lms),
+  CASE("filtering", lms_norm, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 115, prep_lms_norm, ref_lms),
+  CASE("filtering", lms_norm, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 25, prep_lms_norm, ref_lms),
+  CASE("filtering", fir_lattice, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 140, prep_fir_lattice, ref_fir_lattice),
+  CASE("filtering", fir_lattice, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 145, prep_fir_lattice, ref_fir_lattice),
+  CASE("filtering", fir_lattice, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 55, prep_fir_lattice, ref_fir_lattice),
+  CASE("filtering", iir_lattice, f32, T_F32, T_F32, 0, vecSizes, -0.25, 0.25, 135, prep_iir_lattice, ref_iir_lattice),
+  CASE("filtering", iir_lattice, q31, T_Q31, T_Q31, 0, vecSizes, -0.25, 0.25, 150, prep_iir_lattice, ref_iir_lattice),
+  CASE("filtering", iir_lattice, q15, T_Q15, T_Q15, 0, vecSizes, -0.25, 0.25, 55, prep_iir_lattice, ref_iir_lattice),
+  CASE("filtering", fir_sparse, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 140, prep_fir_sparse, ref_fir_sparse),
+  CASE("filtering", fir_sparse, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 150, prep_fir_sparse, ref_fir_sparse),
+  CASE("filtering", fir_sparse, q15, T_Q15, T_Q15, 0, vecSizes, -0.5, 0.5, 70, prep_fir_sparse, ref_fir_sparse),
+  CASE("filtering", fir_sparse, q7, T_Q7, T_Q7, 0, vecSizes, -0.5, 0.5, 25, prep_fir_sparse, ref_fir_sparse),
+  CASE("filtering", kalman, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 120, prep_kalman, ref_kalman),
+
+  CASE("matrix", mat_add, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 140, prep_mat, ref_add),
+  CASE("matrix", mat_add, q31, T_Q31, T_Q31, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_add),
+  CASE("matrix", mat_add, q15, T_Q15, T_Q15, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_add),
+  CASE("matrix", mat_sub, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 140, prep_mat, ref_sub),
+  CASE("matrix", mat_sub, q31, T_Q31, T_Q31, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_sub),
+  CASE("matrix", mat_sub, q15, T_Q15, T_Q15, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_sub),
+  CASE("matrix", mat_scale, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 145, prep_mat, ref_mat_scale),
+  CASE("matrix", mat_scale, q31, T_Q31, T_Q31, 0, matSizes, -0.5, 0.5, 165, prep_mat, ref_mat_scale),
+  CASE("matrix", mat_scale, q15, T_Q15, T_Q15, 0, matSizes, -0.5, 0.5, 70, prep_mat, ref_mat_scale),
+  CASE("matrix", mat_trans, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_mat_trans),
+  CASE("matrix", mat_trans, q31, T_Q31, T_Q31, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_mat_trans),
+  CASE("matrix", mat_trans, q15, T_Q15, T_Q15, 0, matSizes, -0.5, 0.5, 200, prep_mat, ref_mat_trans),
+  CASE("matrix", mat_mult, f32, T_F32, T_F32, 0, matSizes, -0.25, 0.25, 130, prep_mat, ref_mat_mult),
+  CASE("matrix", mat_mult, q31, T_Q31, T_Q31, 0, matSizes, -0.25, 0.25, 155, prep_mat, ref_mat_mult),
+  CASE("matrix", mat_mult, q15, T_Q15, T_Q15, 0, matSizes, -0.25, 0.25, 55, prep_mat, ref_mat_mult),
+  CASE("matrix", mat_mult_fast, q31, T_Q31, T_Q31, 0, matSizes, -0.25, 0.25, 130, prep_mat, ref_mat_mult),
+  CASE("matrix", mat_mult_fast, q15, T_Q15, T_Q15, 0, matSizes, -0.25, 0.25, 55, prep_mat, ref_mat_mult),
+  CASE("matrix", mat_cmplx_mult, f32, T_F32, T_F32, 0, matSizes, -0.25, 0.25, 130, prep_mat, ref_mat_cmplx_mult),
+  CASE("matrix", mat_cmplx_mult, q31, T_Q31, T_Q31, 0, matSizes, -0.25, 0.25, 155, prep_mat, ref_mat_cmplx_mult),
+  CASE("matrix", mat_cmplx_mult, q15, T_Q15, T_Q15, 0, matSizes, -0.25, 0.25, 60, prep_mat, ref_mat_cmplx_mult),
+  CASE("matrix", mat_inverse, f32, T_F32, T_F32, 0, matSizes, -0.25, 0.25, 105, prep_mat_inverse, ref_mat_inverse),
+  CASE("matrix", mat_inverse, f64, T_F64, T_F64, 0, matSizes, -0.25, 0.25, 310, prep_mat_inverse, ref_mat_inverse),
+  CASE("matrix", mat_cholesky, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 135, prep_mat_spd, ref_mat_cholesky),
+  CASE("matrix", mat_cholesky, q31, T_Q31, T_Q31, 0, matSizes, -0.5, 0.5, 170, prep_mat_spd, ref_mat_cholesky),
+  CASE("matrix", mat_ldlt, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 135, prep_mat_spd, ref_mat_ldlt),
+  CASE("matrix", mat_solve_lower_triangular, f32, T_F32, T_F32, 0, matSizes, -0.25, 0.25, 130, prep_mat_tri, ref_mat_solve_lower),
+  CASE("matrix", mat_solve_lower_triangular, q31, T_Q31, T_Q31, 0, matSizes, -0.25, 0.25, 165, prep_mat_tri, ref_mat_solve_lower),
+  CASE("matrix", mat_solve_upper_triangular, f32, T_F32, T_F32, 0, matSizes, -0.25, 0.25, 130, prep_mat_tri, ref_mat_solve_upper),
+  CASE("matrix", mat_solve_upper_triangular, q31, T_Q31, T_Q31, 0, matSizes, -0.25, 0.25, 165, prep_mat_tri, ref_mat_solve_upper),
+  CASE("matrix", mat_qr, f32, T_F32, T_F32, 0, matSizes, -0.5, 0.5, 120, prep_mat_qr, ref_mat_qr),
+  CASE("matrix", mat_qr, q31, T_Q31, T_Q31, 0, matSizes, -0.5, 0.5, 120, prep_mat_qr, ref_mat_qr),
+
+  VEC("statistics", max, f32, T_F32, 200, ref_max),
+  VEC("statistics", max, q31, T_Q31, 200, ref_max),
+  VEC("statistics", max, q15, T_Q15, 200, ref_max),
+  VEC("statistics", max, q7, T_Q7, 200, ref_max),
+  VEC("statistics", min, f32, T_F32, 200, ref_min),
+  VEC("statistics", min, q31, T_Q31, 200, ref_min),
+  VEC("statistics", min, q15, T_Q15, 200, ref_min),
+  VEC("statistics", min, q7, T_Q7, 200, ref_min),
+  CASE("statistics", mean, f32, T_F32, T_F32, 0, vecSizes, -0.3, 0.7, 130, NULL, ref_mean),
+  CASE("statistics", mean, q31, T_Q31, T_Q31, 0, vecSizes, -0.3, 0.7, 165, NULL, ref_mean),
+  CASE("statistics", mean, q15, T_Q15, T_Q15, 0, vecSizes, -0.3, 0.7, 70, NULL, ref_mean),
+  CASE("statistics", mean, q7, T_Q7, T_Q7, 0, vecSizes, -0.3, 0.7, 25, NULL, ref_mean),
+  VEC("statistics", power, f32, T_F32, 120, ref_power),
+  CASE("statistics", power, q31, T_Q31, T_Q63, 48, vecSizes, -0.5, 0.5, 265, NULL, ref_power),
+  CASE("statistics", power, q15, T_Q15, T_Q63, 30, vecSizes, -0.5, 0.5, 200, NULL, ref_power),
+  CASE("statistics", power, q7, T_Q7, T_Q31, 14, vecSizes, -0.5, 0.5, 200, NULL, ref_power),
+  CASE("statistics", rms, f32, T_F32, T_F32, 0, vecSizes, -0.3, 0.7, 130, NULL, ref_rms),
+  CASE("statistics", rms, q31, T_Q31, T_Q31, 0, vecSizes, -0.04, 0.04, 120, NULL, ref_rms),
+  CASE("statistics", rms, q15, T_Q15, T_Q15, 0, vecSizes, -0.3, 0.7, 65, NULL, ref_rms),
+  CASE("statistics", var, f32, T_F32, T_F32, 0, vecSizes, -0.3, 0.7, 120, NULL, ref_var),
+  CASE("statistics", var, q31, T_Q31, T_Q31, 0, vecSizes, -0.3, 0.7, 145, NULL, ref_var),
+  CASE("statistics", var, q15, T_Q15, T_Q15, 0, vecSizes, -0.3, 0.7, 60, NULL, ref_var),
+  CASE("statistics", std, f32, T_F32, T_F32, 0, vecSizes, -0.3, 0.7, 125, NULL, ref_std),
+  CASE("statistics", std, q31, T_Q31, T_Q31, 0, vecSizes, -0.3, 0.7, 150, NULL, ref_std),
+  CASE("statistics", std, q15, T_Q15, T_Q15, 0, vecSizes, -0.3, 0.7, 60, NULL, ref_std),
+  CASE("statistics", welford, f32, T_F32, T_F32, 0, vecSizes, -0.3, 0.7, 130, NULL, ref_welford),
+  CASE("statistics", moving_rms, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 165, NULL, ref_moving_rms),
+  CASE("statistics", sliding_minmax, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 200, NULL, ref_sliding_minmax),
+  CASE("statistics", sliding_minmax, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 200, NULL, ref_sliding_minmax),
+  CASE("statistics", p2_quantile, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 10, NULL, ref_p2_quantile),
+
+  VEC("support", copy, f32, T_F32, 200, ref_copy),
+  VEC("support", copy, q31, T_Q31, 200, ref_copy),
+  VEC("support", copy, q15, T_Q15, 200, ref_copy),
+  VEC("support", copy, q7, T_Q7, 200, ref_copy),
+  CONVERT(float, q31, T_F32, T_Q31, 215),
+  CONVERT(float, q15, T_F32, T_Q15, 80),
+  CONVERT(float, q7, T_F32, T_Q7, 35),
+  CONVERT(q31, float, T_Q31, T_F32, 145),
+  CONVERT(q31, q15, T_Q31, T_Q15, 80),
+  CONVERT(q31, q7, T_Q31, T_Q7, 35),
+  CONVERT(q15, float, T_Q15, T_F32, 200),
+  CONVERT(q15, q31, T_Q15, T_Q31, 200),
+  CONVERT(q15, q7, T_Q15, T_Q7, 35),
+  CONVERT(q7, float, T_Q7, T_F32, 200),
+  CONVERT(q7, q31, T_Q7, T_Q31, 200),
+  CONVERT(q7, q15, T_Q7, T_Q15, 200),
+
+  CASE("transform", cfft, f32, T_F32, T_F32, 0, fftSizes, -0.5, 0.5, 130, prep_cfft, ref_cfft),
+  CASE("transform", cfft, q31, T_Q31, T_Q31, 0, fftSizes, -0.5, 0.5, 135, prep_cfft, ref_cfft),
+  CASE("transform", cfft, q15, T_Q15, T_Q15, 0, fftSizes, -0.5, 0.5, 40, prep_cfft, ref_cfft),
+  CASE("transform", cfft_radix4, f32, T_F32, T_F32, 0, fftSizes, -0.5, 0.5, 130, prep_cfft, ref_cfft),
+  CASE("transform", cfft_radix4, q31, T_Q31, T_Q31, 0, fftSizes, -0.5, 0.5, 135, prep_cfft, ref_cfft),
+  CASE("transform", cfft_radix4, q15, T_Q15, T_Q15, 0, fftSizes, -0.5, 0.5, 40, prep_cfft, ref_cfft),
+  CASE("transform", rfft_fast, f32, T_F32, T_F32, 0, fftSizes, -0.5, 0.5, 130, prep_rfft, ref_rfft_fast),
+  CASE("transform", cfft_len, f32, T_F32, T_F32, 0, fftLenSizes, -0.5, 0.5, 130, prep_fft_len, ref_cfft),
+  CASE("transform", rfft_fast_len, f32, T_F32, T_F32, 0, fftLenSizes, -0.5, 0.5, 130, prep_fft_len, ref_rfft_fast),
+  CASE("transform", rfft, q31, T_Q31, T_Q31, 0, fftSizes, -0.5, 0.5, 130, prep_rfft, ref_rfft),
+  CASE("transform", rfft, q15, T_Q15, T_Q15, 0, fftSizes, -0.5, 0.5, 35, prep_rfft, ref_rfft),
+  CASE("transform", dct4, f32, T_F32, T_F32, 0, dctSizes, -0.5, 0.5, 115, prep_dct4, ref_dct4),
+  CASE("transform", dct4, q31, T_Q31, T_Q31, 0, dctSizes, -0.25, 0.25, 110, prep_dct4, ref_dct4),
+  CASE("transform", dct4, q15, T_Q15, T_Q15, 0, dctSizes, -0.25, 0.25, 10, prep_dct4, ref_dct4),
+  CASE("transform", goertzel, f32, T_F32, T_F32, 0, fftSizes, -0.5, 0.5, 90, prep_goertzel, ref_goertzel),
+  CASE("transform", goertzel, q31, T_Q31, T_Q31, 0, fftSizes, -0.5, 0.5, 90, prep_goertzel, ref_goertzel),
+  CASE("transform", sdft, f32, T_F32, T_F32, 0, vecSizes, -0.5, 0.5, 90, prep_sdft, ref_sdft),
+  CASE("transform", sdft, q31, T_Q31, T_Q31, 0, vecSizes, -0.5, 0.5, 120, prep_sdft, ref_sdft),
+};
+
+/* ----------------------------------------------------------------------
+ * Harness
+ * ------------------------------------------------------------------- */
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Best of three runs of at least minSeconds / 3 each, in nanoseconds per call */
+static double time_ns(const check_case * c, uint32_t n)
+{
+  double t0, t, best = INFINITY;
+  uint32_t runs, batch, i, r;
+
+  for (r = 0; r < 3; r++)
+  {
+    runs = 0;
+    batch = 1;
+    t0 = seconds();
+    do
+    {
+      for (i = 0; i < batch; i++)
+      {
+        c->run(n);
+      }
+      runs += batch;
+      batch *= 2;
+    } while((t = seconds() - t0) < minSeconds / 3);
+    t = t * 1e9 / runs;
+    best = (t < best) ? t : best;
+  }
+  return best;
+}
+
+static const baseline_entry *find_baseline(const char *name, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < numBaseline; i++)
+  {
+    if ((baseline[i].size == n) && (strcmp(baseline[i].name, name) == 0))
+    {
+      return &baseline[i];
+    }
+  }
+  return NULL;
+}
+
+static int load_baseline(const char *path)
+{
+  char line[256];
+  baseline_entry *e;
+  FILE *f = fopen(path, "r");
+
+  if (f == NULL)
+  {
+    return -1;
+  }
+  while ((numBaseline < MAX_BASELINE) && (fgets(line, sizeof(line), f) != NULL))
+  {
+    e = &baseline[numBaseline];
+    /* Lines of a run without timing have no time per sample */
+    e->nsSample = 0;
+    if ((line[0] != '#') &&
+        (sscanf(line, "%*s %47s %*s %u %lf %*s %*s %lf", e->name, &e->size, &e->snr, &e->nsSample) >= 3))
+    {
+      numBaseline++;
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+static int selected(const check_case * c, int argc, char **argv)
+{
+  int i;
+
+  if (argc == 0)
+  {
+    return 1;
+  }
+  for (i = 0; i < argc; i++)
+  {
+    if ((strstr(c->name, argv[i]) != NULL) || (strstr(c->group, argv[i]) != NULL))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Runs one function at one size and prints its line, returns 1 if it is not ok */
+static int check(const check_case * c, uint32_t n, int timing, double slowPercent)
+{
+  static const int defaultFrac[] = {0, 0, 31, 15, 7, 0};
+  const baseline_entry *base;
+  const char *status = "ok";
+  double sig = 0, err = 0, maxErr = 0, e, snr, ns = 0;
+  uint32_t i, m;
+
+  inType = c->inType;
+  outScale = ldexp(1, -(c->outFrac ? c->outFrac : defaultFrac[c->outType]));
+  fill_inputs(c, n);
+  if (c->prep != NULL)
+  {
+    c->prep(n);
+  }
+  c->run(n);
+  m = c->ref(n);
+
+  for (i = 0; i < m; i++)
+  {
+    e = fabs(out_value(c->outType, i) - refD[i]);
+    /* NaN compares false, count it as the largest error */
+    maxErr = (e > maxErr || e != e) ? e : maxErr;
+    sig += refD[i] * refD[i];
+    err += e * e;
+  }
+  snr = (err > 0) ? 10 * log10(sig / err) : 999.9;
+  snr = (snr > 999.9) ? 999.9 : (snr == snr) ? snr : -999.9;
+
+  if (snr < c->minSnr)
+  {
+    status = "FAIL";
+  }
+
+  if (timing)
+  {
+    ns = time_ns(c, n);
+  }
+
+  base = find_baseline(c->name, n);
+  if ((base != NULL) && (strcmp(status, "ok") == 0))
+  {
+    if (snr < base->snr - 1)
+    {
+      status = "LOSS";
+    }
+    else if (timing && (base->nsSample > 0) && (ns / n > base->nsSample * (1 + slowPercent / 100)))
+    {
+      status = "SLOW";
+    }
+  }
+
+  if (timing)
+  {
+    printf("%-10s %-34s %-3s %5u %6.1f %10.3e %11.1f %9.3f %s\n",
+           c->group, c->name, typeNames[c->inType], n, snr, maxErr, ns, ns / n, status);
+  }
+  else
+  {
+    printf("%-10s %-34s %-3s %5u %6.1f %10.3e %11s %9s %s\n",
+           c->group, c->name, typeNames[c->inType], n, snr, maxErr, "-", "-", status);
+  }
+  fflush(stdout);
+
+  return strcmp(status, "ok") != 0;
+}
+
+int main(int argc, char **argv)
+{
+  double slowPercent = 25;
+  int timing = 1, failed = 0;
+  uint32_t i, j;
+
+  while ((argc > 1) && (argv[1][0] == '-'))
+  {
+    if (strcmp(argv[1], "-q") == 0)
+    {
+      timing = 0;
+    }
+    else if ((strcmp(argv[1], "-t") == 0) && (argc > 2))
+    {
+      minSeconds = atof(argv[2]);
+      argc--, argv++;
+    }
+    else if ((strcmp(argv[1], "-s") == 0) && (argc > 2))
+    {
+      slowPercent = atof(argv[2]);
+      argc--, argv++;
+    }
+    else if ((strcmp(argv[1], "-b") == 0) && (argc > 2))
+    {
+      if (load_baseline(argv[2]) != 0)
+      {
+        fprintf(stderr, "cannot read %s\n", argv[2]);
+        return 2;
+      }
+      argc--, argv++;
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [-q] [-t seconds] [-b baseline] [-s percent] [pattern...]\n", argv[0]);
+      return 2;
+    }
+    argc--, argv++;
+  }
+
+  printf("# group function type size snr_db max_err ns_call ns_sample status\n");
+  for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    if (selected(&cases[i], argc - 1, argv + 1))
+    {
+      for (j = 0; cases[i].sizes[j] != 0; j++)
+      {
+        failed += check(&cases[i], cases[i].sizes[j], timing, slowPercent);
+      }
+    }
+  }
+  printf("# %d failed\n", failed);
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,348 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fastmath_bench.c    
+*    
+* Description:  Host benchmark of the vector fast math functions. Each    
+*               function is compared with a double-precision reference    
+*               for its maximum error, and timed against a loop over the    
+*               scalar fast math function or the C library.    
+*    
+*               Build and run with "make bench" in this directory.    
+*    
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+
+#define BLOCK_SIZE      1024
+#define NUM_BLOCKS      256
+#define NUM_SAMPLES     (BLOCK_SIZE * NUM_BLOCKS)
+#define MIN_SECONDS     0.2
+
+/* PI of arm_math.h is single precision */
+#define PI_D            3.14159265358979323846
+
+static float32_t inA[NUM_SAMPLES], inB[NUM_SAMPLES], out[NUM_SAMPLES];
+static q31_t inAQ31[NUM_SAMPLES], inBQ31[NUM_SAMPLES], outQ31[NUM_SAMPLES];
+static q15_t inAQ15[NUM_SAMPLES], inBQ15[NUM_SAMPLES], outQ15[NUM_SAMPLES];
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double uniform(double lo, double hi)
+{
+  return lo + (hi - lo) * (rand() / (RAND_MAX + 1.0));
+}
+
+static q31_t random_q31(void)
+{
+  return (q31_t)(((uint32_t)rand() << 16) ^ (uint32_t)rand() ^ ((uint32_t)rand() << 31));
+}
+
+/* Distance to the reference in units in the last place of the reference */
+static double ulps(float32_t y, double ref)
+{
+  int e;
+
+  if(ref == 0 || isinf(ref))
+  {
+    return ((double)y == ref) ? 0 : INFINITY;
+  }
+  frexp(ref, &e);
+  if(e < -125)
+  {
+    e = -125;
+  }
+  return fabs(y - ref) / ldexp(1, e - 24);
+}
+
+/* Scalar loops, the baselines of the vector functions */
+static void loop_sin_f32(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = arm_sin_f32(*pSrc++); }
+static void loop_cos_f32(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = arm_cos_f32(*pSrc++); }
+static void loop_sinf(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = sinf(*pSrc++); }
+static void loop_cosf(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = cosf(*pSrc++); }
+static void loop_expf(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = expf(*pSrc++); }
+static void loop_logf(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = logf(*pSrc++); }
+static void loop_sqrtf(float32_t *pSrc, float32_t *pDst, uint32_t n) { while(n--) *pDst++ = sqrtf(*pSrc++); }
+static void loop_sin_q31(q31_t *pSrc, q31_t *pDst, uint32_t n) { while(n--) *pDst++ = arm_sin_q31(*pSrc++); }
+static void loop_cos_q31(q31_t *pSrc, q31_t *pDst, uint32_t n) { while(n--) *pDst++ = arm_cos_q31(*pSrc++); }
+static void loop_sin_q15(q15_t *pSrc, q15_t *pDst, uint32_t n) { while(n--) *pDst++ = arm_sin_q15(*pSrc++); }
+static void loop_cos_q15(q15_t *pSrc, q15_t *pDst, uint32_t n) { while(n--) *pDst++ = arm_cos_q15(*pSrc++); }
+
+static void loop_atan2f(float32_t *pSrcY, float32_t *pSrcX, float32_t *pDst, uint32_t n)
+{
+  while(n--)
+  {
+    *pDst++ = atan2f(*pSrcY++, *pSrcX++);
+  }
+}
+
+/* Nanoseconds per sample, over blocks of BLOCK_SIZE samples */
+#define TIME_NS(call, result)                                 \
+  do                                                          \
+  {                                                           \
+    double t0 = seconds(), t;                                 \
+    uint32_t runs = 0, b;                                     \
+    do                                                        \
+    {                                                         \
+      for (b = 0; b < NUM_BLOCKS; b++)                        \
+      {                                                       \
+        uint32_t o = b * BLOCK_SIZE;                          \
+        (void)o;                                              \
+        call;                                                 \
+      }                                                       \
+      runs++;                                                 \
+    } while((t = seconds() - t0) < MIN_SECONDS);              \
+    result = t * 1e9 / ((double)runs * NUM_SAMPLES);          \
+  } while(0)
+
+static void report(const char *name, const char *range, double err, const char *unit,
+                   double ns, const char *base, double errBase, double nsBase)
+{
+  printf("%-15s %-13s %-4s %10.3g %8.2f  %-12s %10.3g %8.2f\n", name, range, unit, err, ns, base, errBase, nsBase);
+}
+
+typedef void (*unary_f32)(float32_t *, float32_t *, uint32_t);
+
+static double max_err_f32(double (*ref)(double), int useUlps)
+{
+  double err = 0, e;
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    e = useUlps ? ulps(out[i], ref(inA[i])) : fabs(out[i] - ref(inA[i]));
+    err = (e > err) ? e : err;
+  }
+  return err;
+}
+
+static void bench_unary_f32(const char *name, const char *range, unary_f32 fn, double (*ref)(double),
+                            int useUlps, const char *base, unary_f32 fnBase)
+{
+  double err, errBase, ns, nsBase;
+
+  fn(inA, out, NUM_SAMPLES);
+  err = max_err_f32(ref, useUlps);
+  fnBase(inA, out, NUM_SAMPLES);
+  errBase = max_err_f32(ref, useUlps);
+
+  TIME_NS(fn(&inA[o], &out[o], BLOCK_SIZE), ns);
+  TIME_NS(fnBase(&inA[o], &out[o], BLOCK_SIZE), nsBase);
+  report(name, range, err, useUlps ? "ulp" : "abs", ns, base, errBase, nsBase);
+}
+
+static void fill_f32(double lo, double hi)
+{
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inA[i] = (float32_t)uniform(lo, hi);
+  }
+}
+
+/* Error in LSB of a fixed-point angle or phase, modulo a full turn */
+static double wrap_lsb(double d, double turn)
+{
+  d = fmod(d, turn);
+  d = (d > turn / 2) ? d - turn : d;
+  d = (d < -turn / 2) ? d + turn : d;
+  return fabs(d);
+}
+
+/* Error in LSB of a sine or cosine with 1 for a full turn, the scaling of both the vector and the scalar functions */
+static double max_err_sincos_q31(int isCos)
+{
+  double err = 0, e, ref;
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    ref = 2 * PI_D * inAQ31[i] / 2147483648.0;
+    ref = (isCos ? cos(ref) : sin(ref)) * 2147483648.0;
+    ref = (ref > 2147483647.0) ? 2147483647.0 : ref;
+    e = fabs(outQ31[i] - ref);
+    err = (e > err) ? e : err;
+  }
+  return err;
+}
+
+static double max_err_sincos_q15(int isCos)
+{
+  double err = 0, e, ref;
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    ref = 2 * PI_D * inAQ15[i] / 32768.0;
+    ref = (isCos ? cos(ref) : sin(ref)) * 32768.0;
+    ref = (ref > 32767.0) ? 32767.0 : ref;
+    e = fabs(outQ15[i] - ref);
+    err = (e > err) ? e : err;
+  }
+  return err;
+}
+
+static void bench_sincos_q31(int isCos)
+{
+  double err, errBase, ns, nsBase;
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inAQ31[i] = random_q31();
+  }
+  (isCos ? arm_vcos_q31 : arm_vsin_q31)(inAQ31, outQ31, NUM_SAMPLES);
+  err = max_err_sincos_q31(isCos);
+  TIME_NS((isCos ? arm_vcos_q31 : arm_vsin_q31)(&inAQ31[o], &outQ31[o], BLOCK_SIZE), ns);
+
+  /* The scalar functions take [0 1) only */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inAQ31[i] &= 0x7FFFFFFF;
+  }
+  (isCos ? loop_cos_q31 : loop_sin_q31)(inAQ31, outQ31, NUM_SAMPLES);
+  errBase = max_err_sincos_q31(isCos);
+  TIME_NS((isCos ? loop_cos_q31 : loop_sin_q31)(&inAQ31[o], &outQ31[o], BLOCK_SIZE), nsBase);
+
+  report(isCos ? "arm_vcos_q31" : "arm_vsin_q31", "[-1 1)", err, "lsb", ns,
+         isCos ? "arm_cos_q31" : "arm_sin_q31", errBase, nsBase);
+}
+
+static void bench_sincos_q15(int isCos)
+{
+  double err, errBase, ns, nsBase;
+  uint32_t i;
+
+  /* Every input, 4 times */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inAQ15[i] = (q15_t)i;
+  }
+  (isCos ? arm_vcos_q15 : arm_vsin_q15)(inAQ15, outQ15, NUM_SAMPLES);
+  err = max_err_sincos_q15(isCos);
+  TIME_NS((isCos ? arm_vcos_q15 : arm_vsin_q15)(&inAQ15[o], &outQ15[o], BLOCK_SIZE), ns);
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inAQ15[i] &= 0x7FFF;
+  }
+  (isCos ? loop_cos_q15 : loop_sin_q15)(inAQ15, outQ15, NUM_SAMPLES);
+  errBase = max_err_sincos_q15(isCos);
+  TIME_NS((isCos ? loop_cos_q15 : loop_sin_q15)(&inAQ15[o], &outQ15[o], BLOCK_SIZE), nsBase);
+
+  report(isCos ? "arm_vcos_q15" : "arm_vsin_q15", "[-1 1)", err, "lsb", ns,
+         isCos ? "arm_cos_q15" : "arm_sin_q15", errBase, nsBase);
+}
+
+static void bench_atan2(void)
+{
+  double err, errBase, e, ns, nsBase, ref;
+  uint32_t i;
+
+  /* Magnitudes over 12 decades, in every quadrant */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inA[i] = (float32_t)(uniform(-1, 1) * pow(10, uniform(-6, 6)));
+    inB[i] = (float32_t)(uniform(-1, 1) * pow(10, uniform(-6, 6)));
+  }
+  arm_vatan2_f32(inA, inB, out, NUM_SAMPLES);
+  for (i = 0, err = 0; i < NUM_SAMPLES; i++)
+  {
+    e = fabs(out[i] - atan2(inA[i], inB[i]));
+    err = (e > err) ? e : err;
+  }
+  TIME_NS(arm_vatan2_f32(&inA[o], &inB[o], &out[o], BLOCK_SIZE), ns);
+  TIME_NS(loop_atan2f(&inA[o], &inB[o], &out[o], BLOCK_SIZE), nsBase);
+  loop_atan2f(inA, inB, out, NUM_SAMPLES);
+  for (i = 0, errBase = 0; i < NUM_SAMPLES; i++)
+  {
+    e = fabs(out[i] - atan2(inA[i], inB[i]));
+    errBase = (e > errBase) ? e : errBase;
+  }
+  report("arm_vatan2_f32", "all", err, "rad", ns, "atan2f", errBase, nsBase);
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inAQ31[i] = random_q31() >> (rand() % 31);
+    inBQ31[i] = random_q31() >> (rand() % 31);
+  }
+  arm_vatan2_q31(inAQ31, inBQ31, outQ31, NUM_SAMPLES);
+  for (i = 0, err = 0; i < NUM_SAMPLES; i++)
+  {
+    ref = atan2((double)inAQ31[i], (double)inBQ31[i]) / PI_D * 2147483648.0;
+    e = wrap_lsb(outQ31[i] - ref, 4294967296.0);
+    err = (e > err) ? e : err;
+  }
+  TIME_NS(arm_vatan2_q31(&inAQ31[o], &inBQ31[o], &outQ31[o], BLOCK_SIZE), ns);
+  report("arm_vatan2_q31", "all", err, "lsb", ns, "-", 0, 0);
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inAQ15[i] = (q15_t)(random_q31() >> 16);
+    inBQ15[i] = (q15_t)(random_q31() >> 16);
+  }
+  arm_vatan2_q15(inAQ15, inBQ15, outQ15, NUM_SAMPLES);
+  for (i = 0, err = 0; i < NUM_SAMPLES; i++)
+  {
+    ref = atan2((double)inAQ15[i], (double)inBQ15[i]) / PI_D * 32768.0;
+    e = wrap_lsb(outQ15[i] - ref, 65536.0);
+    err = (e > err) ? e : err;
+  }
+  TIME_NS(arm_vatan2_q15(&inAQ15[o], &inBQ15[o], &outQ15[o], BLOCK_SIZE), ns);
+  report("arm_vatan2_q15", "all", err, "lsb", ns, "-", 0, 0);
+}
+
+int main(void)
+{
+  uint32_t i;
+
+  printf("function        range         unit        err   vec_ns  baseline       base_err  base_ns\n");
+
+  fill_f32(-2 * PI_D, 2 * PI_D);
+  bench_unary_f32("arm_vsin_f32", "[-2pi 2pi]", arm_vsin_f32, sin, 0, "arm_sin_f32", loop_sin_f32);
+  bench_unary_f32("arm_vcos_f32", "[-2pi 2pi]", arm_vcos_f32, cos, 0, "arm_cos_f32", loop_cos_f32);
+  fill_f32(-1e5, 1e5);
+  bench_unary_f32("arm_vsin_f32", "[-1e5 1e5]", arm_vsin_f32, sin, 0, "sinf", loop_sinf);
+  bench_unary_f32("arm_vcos_f32", "[-1e5 1e5]", arm_vcos_f32, cos, 0, "cosf", loop_cosf);
+
+  bench_sincos_q31(0);
+  bench_sincos_q31(1);
+  bench_sincos_q15(0);
+  bench_sincos_q15(1);
+
+  bench_atan2();
+
+  fill_f32(-87.3, 88.7);
+  bench_unary_f32("arm_vexp_f32", "[-87.3 88.7]", arm_vexp_f32, exp, 1, "expf", loop_expf);
+  fill_f32(-103, -87.3);
+  bench_unary_f32("arm_vexp_f32", "[-103 -87.3]", arm_vexp_f32, exp, 1, "expf", loop_expf);
+
+  fill_f32(0.5, 2);
+  bench_unary_f32("arm_vlog_f32", "[0.5 2]", arm_vlog_f32, log, 0, "logf", loop_logf);
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    inA[i] = (float32_t)ldexp(uniform(1, 2), (int)uniform(-149, 127));
+  }
+  bench_unary_f32("arm_vlog_f32", "(0 inf)", arm_vlog_f32, log, 1, "logf", loop_logf);
+
+  fill_f32(0, 1e6);
+  bench_unary_f32("arm_vsqrt_f32", "[0 1e6]", arm_vsqrt_f32, sqrt, 1, "sqrtf", loop_sqrtf);
+
+  return 0;
+}
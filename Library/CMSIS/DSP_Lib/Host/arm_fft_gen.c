@@ -0,0 +1,724 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_fft_gen.c
+*
+* Description:  Generator of fixed-length floating-point FFT functions.
+*               For each length N it writes arm_cfft_lenN_f32.c, a
+*               complex FFT of N points, and arm_rfft_fast_lenN_f32.c, a
+*               real FFT of N points built on the complex FFT of N/2
+*               points, which is written too.
+*
+*               The complex FFT is a self-sorting (Stockham) radix-4
+*               FFT, with a last radix-2 stage when N is not a power of
+*               4. Each stage reads one buffer and writes the other in
+*               natural order, so there is no bit reversal pass. The
+*               loop bounds and strides are constants and the twiddle
+*               factors are const tables in the order the stage reads
+*               them. The stages of 4 butterflies or fewer are unrolled
+*               with the twiddle factors as literals, and the products
+*               by 1 and -j are left out.
+*
+*               Usage: arm_fft_gen [-o directory] length...
+*                 -o directory  where to write the files, default .
+*                 length        real FFT lengths, powers of 2 from 32 to 4096
+*
+*               Regenerate the library files with "make fft-kernels
+*               FFT_SIZES=..." in this directory.
+*
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+/* PI of arm_math.h is single precision */
+#define PI_D            3.14159265358979323846
+
+#define MIN_LEN         32
+#define MAX_LEN         4096
+#define UNROLL_MAX      4
+
+static const char *outDir = ".";
+
+static const char license[] =
+  "* Redistribution and use in source and binary forms, with or without \n"
+  "* modification, are permitted provided that the following conditions\n"
+  "* are met:\n"
+  "*   - Redistributions of source code must retain the above copyright\n"
+  "*     notice, this list of conditions and the following disclaimer.\n"
+  "*   - Redistributions in binary form must reproduce the above copyright\n"
+  "*     notice, this list of conditions and the following disclaimer in\n"
+  "*     the documentation and/or other materials provided with the \n"
+  "*     distribution.\n"
+  "*   - Neither the name of ARM LIMITED nor the names of its contributors\n"
+  "*     may be used to endorse or promote products derived from this\n"
+  "*     software without specific prior written permission.\n"
+  "*\n"
+  "* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS\n"
+  "* \"AS IS\" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT\n"
+  "* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS\n"
+  "* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE \n"
+  "* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,\n"
+  "* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,\n"
+  "* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;\n"
+  "* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER\n"
+  "* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT\n"
+  "* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN\n"
+  "* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE\n"
+  "* POSSIBILITY OF SUCH DAMAGE.   \n"
+  "* ---------------------------------------------------------------------------*/\n";
+
+/* The library sources have CRLF line endings */
+static FILE *out;
+
+static void emit(const char *fmt, ...)
+{
+  char line[2048];
+  const char *s;
+  va_list ap;
+
+  va_start(ap, fmt);
+  vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+
+  for (s = line; *s; s++)
+  {
+    if (*s == '\n')
+      fputc('\r', out);
+    fputc(*s, out);
+  }
+}
+
+static void open_file(const char *name, const char *desc)
+{
+  char path[1024];
+
+  snprintf(path, sizeof(path), "%s/%s", outDir, name);
+  out = fopen(path, "wb");
+  if (out == NULL)
+  {
+    perror(path);
+    exit(1);
+  }
+
+  emit("/*-----------------------------------------------------------------------------    \n");
+  emit("* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    \n");
+  emit("*    \n");
+  emit("* $Date:        19. March 2015\n");
+  emit("* $Revision: \tV.1.4.5\n");
+  emit("*    \n");
+  emit("* Project: \t    CMSIS DSP Library    \n");
+  emit("* Title:        %s    \n", name);
+  emit("*    \n");
+  emit("* Description:  %s    \n", desc);
+  emit("*               Generated by arm_fft_gen, do not edit.    \n");
+  emit("*    \n");
+  emit("* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0\n");
+  emit("*  \n");
+  emit("%s", license);
+  emit("\n#include \"arm_math.h\"\n");
+}
+
+static void close_file(void)
+{
+  if (fclose(out) != 0)
+  {
+    perror("fclose");
+    exit(1);
+  }
+}
+
+/* Float literal that converts back to the same float32_t */
+static const char *flt(double v)
+{
+  static char buf[8][32];
+  static int n;
+  char *s = buf[n++ & 7];
+
+  if (fabs(v) < 1e-12)
+    v = 0;                                       /* No -0.0f or 6.1e-17f */
+  snprintf(s, 32, "%.9gf", (float) v);
+  if (strpbrk(s, ".e") == NULL)
+    snprintf(s, 32, "%.1ff", (float) v);
+  return s;
+}
+
+/* ----------------------------------------------------------------------
+ * Complex FFT
+ * ------------------------------------------------------------------- */
+
+typedef struct
+{
+  int radix;                                     /* 4 or 2 */
+  int n;                                         /* Length of the sub-transforms the stage splits */
+  int s;                                         /* Number of interleaved sub-transforms, N / n */
+} stage_t;
+
+static int plan(int len, stage_t *stages)
+{
+  int k = 0, n = len;
+
+  while (n > 1)
+  {
+    stages[k].radix = (n % 4 == 0) ? 4 : 2;
+    stages[k].n = n;
+    stages[k].s = len / n;
+    n /= stages[k].radix;
+    k++;
+  }
+  return k;
+}
+
+/* Twiddle factors of a stage, exp(-j*2*pi*p*k/n) */
+static double tw_re(int n, int pk)
+{
+  return cos(2 * PI_D * pk / n);
+}
+
+static double tw_im(int n, int pk)
+{
+  return -sin(2 * PI_D * pk / n);
+}
+
+static int is_val(double v, double c)
+{
+  return fabs(v - c) < 1e-12;
+}
+
+/*
+ * Writes py[off] = (tr + j*ti) * w, w = wr + j*wi or its conjugate. wr and wi are
+ * either variable names (table twiddles) or NULL, with the constant (cr, ci).
+ */
+static void emit_cmul(const char *ind, int off, const char *tr, const char *ti,
+                      const char *wr, const char *wi, double cr, double ci, int inverse, double scale)
+{
+  char sc[40] = "";
+
+  if (wr != NULL)
+  {
+    const char *open = "", *close = "";
+
+    if (scale != 1)
+    {
+      snprintf(sc, sizeof(sc), ") * %s", flt(scale));
+      open = "(";
+      close = sc;
+    }
+    if (!inverse)
+    {
+      emit("%spy[%d] = %s%s * %s - %s * %s%s;\n", ind, off, open, tr, wr, ti, wi, close);
+      emit("%spy[%d] = %s%s * %s + %s * %s%s;\n", ind, off + 1, open, tr, wi, ti, wr, close);
+    }
+    else
+    {
+      emit("%spy[%d] = %s%s * %s + %s * %s%s;\n", ind, off, open, tr, wr, ti, wi, close);
+      emit("%spy[%d] = %s%s * %s - %s * %s%s;\n", ind, off + 1, open, ti, wr, tr, wi, close);
+    }
+    return;
+  }
+
+  if (inverse)
+    ci = -ci;
+  cr *= scale;
+  ci *= scale;
+
+  if (is_val(ci, 0))
+  {
+    if (is_val(cr, 1))
+    {
+      emit("%spy[%d] = %s;\n", ind, off, tr);
+      emit("%spy[%d] = %s;\n", ind, off + 1, ti);
+    }
+    else if (is_val(cr, -1))
+    {
+      emit("%spy[%d] = -%s;\n", ind, off, tr);
+      emit("%spy[%d] = -%s;\n", ind, off + 1, ti);
+    }
+    else
+    {
+      emit("%spy[%d] = %s * %s;\n", ind, off, tr, flt(cr));
+      emit("%spy[%d] = %s * %s;\n", ind, off + 1, ti, flt(cr));
+    }
+  }
+  else if (is_val(cr, 0))
+  {
+    /* (tr + j*ti) * j*ci = -ti*ci + j*tr*ci */
+    if (is_val(ci, 1))
+    {
+      emit("%spy[%d] = -%s;\n", ind, off, ti);
+      emit("%spy[%d] = %s;\n", ind, off + 1, tr);
+    }
+    else if (is_val(ci, -1))
+    {
+      emit("%spy[%d] = %s;\n", ind, off, ti);
+      emit("%spy[%d] = -%s;\n", ind, off + 1, tr);
+    }
+    else
+    {
+      emit("%spy[%d] = %s * %s;\n", ind, off, ti, flt(-ci));
+      emit("%spy[%d] = %s * %s;\n", ind, off + 1, tr, flt(ci));
+    }
+  }
+  else
+  {
+    emit("%spy[%d] = %s * %s - %s * %s;\n", ind, off, tr, flt(cr), ti, flt(ci));
+    emit("%spy[%d] = %s * %s + %s * %s;\n", ind, off + 1, tr, flt(ci), ti, flt(cr));
+  }
+}
+
+/*
+ * One radix-4 butterfly, inputs at px[k * inStep], outputs at py[k * outStep].
+ * Table twiddles when p < 0, else the constants of index p.
+ */
+static void emit_bfly4(const char *ind, const stage_t *st, int p, int inStep, int outStep,
+                       int inverse, double scale)
+{
+  int k;
+
+  emit("%sar = px[0];\n", ind);
+  emit("%sai = px[1];\n", ind);
+  emit("%sbr = px[%d];\n", ind, inStep);
+  emit("%sbi = px[%d];\n", ind, inStep + 1);
+  emit("%scr = px[%d];\n", ind, 2 * inStep);
+  emit("%sci = px[%d];\n", ind, 2 * inStep + 1);
+  emit("%sdr = px[%d];\n", ind, 3 * inStep);
+  emit("%sdi = px[%d];\n", ind, 3 * inStep + 1);
+  emit("%st0r = ar + cr;\n", ind);
+  emit("%st0i = ai + ci;\n", ind);
+  emit("%st1r = ar - cr;\n", ind);
+  emit("%st1i = ai - ci;\n", ind);
+  emit("%st2r = br + dr;\n", ind);
+  emit("%st2i = bi + di;\n", ind);
+  emit("%st3r = br - dr;\n", ind);
+  emit("%st3i = bi - di;\n", ind);
+
+  /* y0 = t0 + t2, y1 = (t1 -+ j*t3) * w1, y2 = (t0 - t2) * w2, y3 = (t1 +- j*t3) * w3 */
+  if (scale == 1)
+  {
+    emit("%spy[0] = t0r + t2r;\n", ind);
+    emit("%spy[1] = t0i + t2i;\n", ind);
+  }
+  else
+  {
+    emit("%spy[0] = (t0r + t2r) * %s;\n", ind, flt(scale));
+    emit("%spy[1] = (t0i + t2i) * %s;\n", ind, flt(scale));
+  }
+  emit("%sur = t0r - t2r;\n", ind);
+  emit("%sui = t0i - t2i;\n", ind);
+  emit("%svr = t1r %c t3i;\n", ind, inverse ? '-' : '+');
+  emit("%svi = t1i %c t3r;\n", ind, inverse ? '+' : '-');
+  emit("%swr = t1r %c t3i;\n", ind, inverse ? '+' : '-');
+  emit("%swi = t1i %c t3r;\n", ind, inverse ? '-' : '+');
+
+  for (k = 1; k < 4; k++)
+  {
+    const char *tr = (k == 1) ? "vr" : (k == 2) ? "ur" : "wr";
+    const char *ti = (k == 1) ? "vi" : (k == 2) ? "ui" : "wi";
+    char wr[8], wi[8];
+
+    if (p < 0)
+    {
+      snprintf(wr, sizeof(wr), "w%dr", k);
+      snprintf(wi, sizeof(wi), "w%di", k);
+      emit_cmul(ind, k * outStep, tr, ti, wr, wi, 0, 0, inverse, scale);
+    }
+    else
+    {
+      emit_cmul(ind, k * outStep, tr, ti, NULL, NULL, tw_re(st->n, p * k), tw_im(st->n, p * k), inverse, scale);
+    }
+  }
+}
+
+/* Last stage, always with p = 0 */
+static void emit_bfly2(const char *ind, int inStep, int outStep, double scale)
+{
+  emit("%sar = px[0];\n", ind);
+  emit("%sai = px[1];\n", ind);
+  emit("%sbr = px[%d];\n", ind, inStep);
+  emit("%sbi = px[%d];\n", ind, inStep + 1);
+  if (scale == 1)
+  {
+    emit("%spy[0] = ar + br;\n", ind);
+    emit("%spy[1] = ai + bi;\n", ind);
+    emit("%spy[%d] = ar - br;\n", ind, outStep);
+    emit("%spy[%d] = ai - bi;\n", ind, outStep + 1);
+  }
+  else
+  {
+    emit("%spy[0] = (ar + br) * %s;\n", ind, flt(scale));
+    emit("%spy[1] = (ai + bi) * %s;\n", ind, flt(scale));
+    emit("%spy[%d] = (ar - br) * %s;\n", ind, outStep, flt(scale));
+    emit("%spy[%d] = (ai - bi) * %s;\n", ind, outStep + 1, flt(scale));
+  }
+}
+
+/* Twiddle table of a stage: w1, w2 and w3 of each p, interleaved */
+static void emit_table(int len, int idx, const stage_t *st)
+{
+  int p, k, P = st->n / 4;
+
+  emit("\n/* Stage %d twiddle factors, {w1r, w1i, w2r, w2i, w3r, w3i} for each butterfly */\n", idx + 1);
+  emit("static const float32_t cfftLen%dTwiddle%d[%d] =\n{\n", len, idx + 1, 6 * P);
+  for (p = 0; p < P; p++)
+  {
+    emit("  ");
+    for (k = 1; k < 4; k++)
+      emit("%s, %s%s", flt(tw_re(st->n, p * k)), flt(tw_im(st->n, p * k)),
+           (k < 3) ? ", " : (p < P - 1) ? ",\n" : "\n");
+  }
+  emit("};\n");
+}
+
+/*
+ * Stage idx of k. Stage i reads buffer i % 2 and writes the other, except the
+ * last stage, whose butterflies only use p = 0: it runs in place when the
+ * result would otherwise end up in the scratch buffer.
+ */
+static void emit_stage(int len, int idx, int count, const stage_t *st, int inverse)
+{
+  const char *src = (idx % 2 == 0) ? "p" : "pScratch";
+  const char *dst = (idx % 2 == 0) ? "pScratch" : "p";
+  int P = st->n / st->radix;                     /* Butterflies per sub-transform */
+  int inStep = 2 * len / st->radix;              /* Floats between the inputs of a butterfly */
+  int outStep = 2 * st->s;                       /* Floats between its outputs */
+  double scale = (inverse && idx == count - 1) ? 1.0 / len : 1;
+  int p;
+
+  if (idx == count - 1)
+    dst = "p";
+
+  emit("\n  /* Stage %d: radix-%d, %d butterfl%s of stride %d, %s to %s */\n", idx + 1, st->radix,
+       P * st->s, (P * st->s == 1) ? "y" : "ies", st->s, src, dst);
+
+  if (st->radix == 2)
+  {
+    /* Only as last stage, n = 2 */
+    emit("  px = %s;\n", src);
+    emit("  py = %s;\n", dst);
+    emit("  for(j = 0u; j < %du; j++)\n  {\n", st->s);
+    emit_bfly2("    ", inStep, outStep, scale);
+    emit("    px += 2;\n");
+    emit("    py += 2;\n");
+    emit("  }\n");
+    return;
+  }
+
+  if (P <= UNROLL_MAX)
+  {
+    for (p = 0; p < P; p++)
+    {
+      if (p == 0)
+      {
+        emit("  px = %s;\n", src);
+        emit("  py = %s;\n", dst);
+      }
+      else
+      {
+        emit("  px = %s + %d;\n", src, 2 * st->s * p);
+        emit("  py = %s + %d;\n", dst, 8 * st->s * p);
+      }
+      if (st->s == 1)
+      {
+        emit("  {\n");
+        emit_bfly4("    ", st, p, inStep, outStep, inverse, scale);
+        emit("  }\n");
+      }
+      else
+      {
+        emit("  for(j = 0u; j < %du; j++)\n  {\n", st->s);
+        emit_bfly4("    ", st, p, inStep, outStep, inverse, scale);
+        emit("    px += 2;\n");
+        emit("    py += 2;\n");
+        emit("  }\n");
+      }
+    }
+    return;
+  }
+
+  emit("  pTw = cfftLen%dTwiddle%d;\n", len, idx + 1);
+  emit("  px = %s;\n", src);
+  emit("  py = %s;\n", dst);
+  emit("  for(i = 0u; i < %du; i++)\n  {\n", P);
+  emit("    w1r = pTw[0];\n");
+  emit("    w1i = pTw[1];\n");
+  emit("    w2r = pTw[2];\n");
+  emit("    w2i = pTw[3];\n");
+  emit("    w3r = pTw[4];\n");
+  emit("    w3i = pTw[5];\n");
+  emit("    pTw += 6;\n\n");
+  if (st->s == 1)
+  {
+    emit_bfly4("    ", st, -1, inStep, outStep, inverse, scale);
+    emit("    px += 2;\n");
+    emit("    py += 8;\n");
+  }
+  else
+  {
+    emit("    for(j = 0u; j < %du; j++)\n    {\n", st->s);
+    emit_bfly4("      ", st, -1, inStep, outStep, inverse, scale);
+    emit("      px += 2;\n");
+    emit("      py += 2;\n");
+    emit("    }\n");
+    emit("    py += %d;\n", 6 * st->s);
+  }
+  emit("  }\n");
+}
+
+static void emit_direction(int len, const stage_t *stages, int count, int inverse)
+{
+  int i, tables = 0, loops = 0;
+
+  for (i = 0; i < count; i++)
+  {
+    if (stages[i].radix == 4 && stages[i].n / 4 > UNROLL_MAX)
+      tables = 1;
+    if (stages[i].s > 1 || (stages[i].radix == 4 && stages[i].n / 4 > UNROLL_MAX))
+      loops = 1;
+  }
+
+  emit("\nstatic void cfft_len%d_%s(\n", len, inverse ? "inverse" : "forward");
+  emit("  float32_t * p,\n");
+  emit("  float32_t * pScratch)\n{\n");
+  emit("  const float32_t *px;                           /* Input pointer */\n");
+  emit("  float32_t *py;                                 /* Output pointer */\n");
+  if (tables)
+  {
+    emit("  const float32_t *pTw;                          /* Twiddle factor pointer */\n");
+    emit("  float32_t w1r, w1i, w2r, w2i, w3r, w3i;        /* Twiddle factors */\n");
+  }
+  emit("  float32_t ar, ai, br, bi, cr, ci, dr, di;      /* Butterfly inputs */\n");
+  emit("  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;  /* Temporary variables */\n");
+  emit("  float32_t ur, ui, vr, vi, wr, wi;              /* Temporary variables */\n");
+  if (loops)
+  {
+    if (tables)
+      emit("  uint32_t i, j;                                 /* Loop counters */\n");
+    else
+      emit("  uint32_t j;                                    /* Loop counter */\n");
+  }
+
+  for (i = 0; i < count; i++)
+    emit_stage(len, i, count, &stages[i], inverse);
+
+  emit("}\n");
+}
+
+static void gen_cfft(int len)
+{
+  stage_t stages[16];
+  char name[64], desc[128];
+  int count = plan(len, stages), i;
+
+  snprintf(name, sizeof(name), "arm_cfft_len%d_f32.c", len);
+  snprintf(desc, sizeof(desc), "Floating-point complex FFT of %d points.", len);
+  open_file(name, desc);
+
+  for (i = 0; i < count; i++)
+    if (stages[i].radix == 4 && stages[i].n / 4 > UNROLL_MAX)
+      emit_table(len, i, &stages[i]);
+
+  emit_direction(len, stages, count, 0);
+  emit_direction(len, stages, count, 1);
+
+  emit("\n/**    \n * @addtogroup ComplexFFT    \n * @{    \n */\n");
+  emit("\n/**    \n");
+  emit(" * @brief Processing function for the floating-point complex FFT of %d points.    \n", len);
+  emit(" * @param[in, out] *p points to the complex data buffer of size <code>%d</code>, processed in place.    \n", 2 * len);
+  emit(" * @param[in]  *pScratch points to a scratch buffer of size <code>%d</code>.    \n", 2 * len);
+  emit(" * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    \n");
+  emit(" * @return     none.    \n");
+  emit(" *    \n");
+  emit(" * The result is the same as the one of <code>arm_cfft_f32(&arm_cfft_sR_f32_len%d, p, ifftFlag, 1)</code>,    \n", len);
+  emit(" * in natural order and with the <code>1/%d</code> scaling of the inverse transform.    \n", len);
+  emit(" * The %d stages use constant lengths and twiddle factors and need no bit reversal.    \n", count);
+  emit(" */\n");
+  emit("\nvoid arm_cfft_len%d_f32(\n", len);
+  emit("  float32_t * p,\n");
+  emit("  float32_t * pScratch,\n");
+  emit("  uint8_t ifftFlag)\n{\n");
+  emit("  if(ifftFlag == 1u)\n  {\n");
+  emit("    cfft_len%d_inverse(p, pScratch);\n", len);
+  emit("  }\n  else\n  {\n");
+  emit("    cfft_len%d_forward(p, pScratch);\n", len);
+  emit("  }\n}\n");
+  emit("\n/**    \n * @} end of ComplexFFT group    \n */\n");
+  close_file();
+}
+
+/* ----------------------------------------------------------------------
+ * Real FFT
+ * ------------------------------------------------------------------- */
+
+static void gen_rfft(int len)
+{
+  int half = len / 2, quarter = len / 4, k;
+  char name[64], desc[128];
+
+  snprintf(name, sizeof(name), "arm_rfft_fast_len%d_f32.c", len);
+  snprintf(desc, sizeof(desc), "Floating-point real FFT of %d points.", len);
+  open_file(name, desc);
+
+  /* 0.5 * {sin, cos}(2*pi*k/len), the twiddles of arm_rfft_fast_f32() halved */
+  emit("\n/* Split twiddle factors, 0.5 * {sin(2*pi*k/%d), cos(2*pi*k/%d)} for k = 1 ... %d */\n",
+       len, len, quarter - 1);
+  emit("static const float32_t rfftLen%dTwiddle[%d] =\n{\n", len, 2 * (quarter - 1));
+  for (k = 1; k < quarter; k++)
+    emit("  %s, %s%s\n", flt(0.5 * sin(2 * PI_D * k / len)), flt(0.5 * cos(2 * PI_D * k / len)),
+         (k < quarter - 1) ? "," : "");
+  emit("};\n");
+
+  emit("\n/**    \n * @addtogroup RealFFT    \n * @{    \n */\n");
+  emit("\n/**    \n");
+  emit(" * @brief Processing function for the floating-point real FFT of %d points.    \n", len);
+  emit(" * @param[in]  *p points to the input buffer of size <code>%d</code>. It is modified.    \n", len);
+  emit(" * @param[out] *pOut points to the output buffer of size <code>%d</code>.    \n", len);
+  emit(" * @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.    \n");
+  emit(" * @return     none.    \n");
+  emit(" *    \n");
+  emit(" * The input and output formats and the scaling are the ones of <code>arm_rfft_fast_f32()</code>    \n");
+  emit(" * for <code>fftLen = %d</code>. The complex FFT of %d points is done by    \n", len, half);
+  emit(" * <code>arm_cfft_len%d_f32()</code>, with the other buffer as scratch, and the    \n", half);
+  emit(" * conjugate symmetric bins <code>k</code> and <code>%d - k</code> are split or merged together.    \n", half);
+  emit(" */\n");
+  emit("\nvoid arm_rfft_fast_len%d_f32(\n", len);
+  emit("  float32_t * p,\n");
+  emit("  float32_t * pOut,\n");
+  emit("  uint8_t ifftFlag)\n{\n");
+  emit("  const float32_t *pTw = rfftLen%dTwiddle;     /* Twiddle factor pointer */\n", len);
+  emit("  float32_t *pA, *pB;                            /* Bins k and %d - k */\n", half);
+  emit("  float32_t *pOutA, *pOutB;                      /* Output bins k and %d - k */\n", half);
+  emit("  float32_t xAR, xAI, xBR, xBI;                  /* Temporary variables */\n");
+  emit("  float32_t hR, hI, t1a, t1b, sR, dI, u, v;      /* Temporary variables */\n");
+  emit("  uint32_t k;                                    /* Loop counter */\n");
+
+  emit("\n  if(ifftFlag == 1u)\n  {\n");
+  emit("    /* Merge the half spectrum into the spectrum of the even and odd samples */\n");
+  emit("    xAR = p[0];\n");
+  emit("    xAI = p[1];\n");
+  emit("    pOut[0] = 0.5f * (xAR + xAI);\n");
+  emit("    pOut[1] = 0.5f * (xAR - xAI);\n");
+  emit("    pOut[%d] = p[%d];\n", half, half);
+  emit("    pOut[%d] = -p[%d];\n", half + 1, half + 1);
+  emit("\n    pA = p + 2;\n");
+  emit("    pB = p + %d;\n", len - 2);
+  emit("    pOutA = pOut + 2;\n");
+  emit("    pOutB = pOut + %d;\n", len - 2);
+  emit("    for(k = 1u; k < %du; k++)\n    {\n", quarter);
+  emit("      xAR = pA[0];\n");
+  emit("      xAI = pA[1];\n");
+  emit("      xBR = pB[0];\n");
+  emit("      xBI = pB[1];\n");
+  emit("      hR = pTw[0];\n");
+  emit("      hI = pTw[1];\n");
+  emit("      pTw += 2;\n");
+  emit("\n      t1a = xAR - xBR;\n");
+  emit("      t1b = xAI + xBI;\n");
+  emit("      sR = 0.5f * (xAR + xBR);\n");
+  emit("      dI = 0.5f * (xAI - xBI);\n");
+  emit("      u = hR * t1a + hI * t1b;\n");
+  emit("      v = hI * t1a - hR * t1b;\n");
+  emit("\n      pOutA[0] = sR - u;\n");
+  emit("      pOutA[1] = dI + v;\n");
+  emit("      pOutB[0] = sR + u;\n");
+  emit("      pOutB[1] = v - dI;\n");
+  emit("\n      pA += 2;\n");
+  emit("      pB -= 2;\n");
+  emit("      pOutA += 2;\n");
+  emit("      pOutB -= 2;\n");
+  emit("    }\n");
+  emit("\n    arm_cfft_len%d_f32(pOut, p, 1u);\n", half);
+  emit("  }\n  else\n  {\n");
+  emit("    arm_cfft_len%d_f32(p, pOut, 0u);\n", half);
+  emit("\n    /* Split the spectrum of the even and odd samples into the half spectrum */\n");
+  emit("    xAR = p[0];\n");
+  emit("    xAI = p[1];\n");
+  emit("    pOut[0] = xAR + xAI;\n");
+  emit("    pOut[1] = xAR - xAI;\n");
+  emit("    pOut[%d] = p[%d];\n", half, half);
+  emit("    pOut[%d] = -p[%d];\n", half + 1, half + 1);
+  emit("\n    pA = p + 2;\n");
+  emit("    pB = p + %d;\n", len - 2);
+  emit("    pOutA = pOut + 2;\n");
+  emit("    pOutB = pOut + %d;\n", len - 2);
+  emit("    for(k = 1u; k < %du; k++)\n    {\n", quarter);
+  emit("      xAR = pA[0];\n");
+  emit("      xAI = pA[1];\n");
+  emit("      xBR = pB[0];\n");
+  emit("      xBI = pB[1];\n");
+  emit("      hR = pTw[0];\n");
+  emit("      hI = pTw[1];\n");
+  emit("      pTw += 2;\n");
+  emit("\n      t1a = xBR - xAR;\n");
+  emit("      t1b = xBI + xAI;\n");
+  emit("      sR = 0.5f * (xAR + xBR);\n");
+  emit("      dI = 0.5f * (xAI - xBI);\n");
+  emit("      u = hR * t1a + hI * t1b;\n");
+  emit("      v = hI * t1a - hR * t1b;\n");
+  emit("\n      pOutA[0] = sR + u;\n");
+  emit("      pOutA[1] = dI + v;\n");
+  emit("      pOutB[0] = sR - u;\n");
+  emit("      pOutB[1] = v - dI;\n");
+  emit("\n      pA += 2;\n");
+  emit("      pB -= 2;\n");
+  emit("      pOutA += 2;\n");
+  emit("      pOutB -= 2;\n");
+  emit("    }\n");
+  emit("  }\n}\n");
+  emit("\n/**    \n * @} end of RealFFT group    \n */\n");
+  close_file();
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: arm_fft_gen [-o directory] length...\n");
+  fprintf(stderr, "  length  real FFT length, a power of 2 from %d to %d\n", MIN_LEN, MAX_LEN);
+  exit(2);
+}
+
+int main(int argc, char **argv)
+{
+  int lengths[32], count = 0, i, j, len;
+  int cfft[MAX_LEN + 1] = {0};
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+    {
+      outDir = argv[++i];
+      continue;
+    }
+    len = atoi(argv[i]);
+    if (len < MIN_LEN || len > MAX_LEN || (len & (len - 1)) != 0 || count == 32)
+      usage();
+    lengths[count++] = len;
+  }
+  if (count == 0)
+    usage();
+
+  for (i = 0; i < count; i++)
+  {
+    cfft[lengths[i]] = 1;
+    cfft[lengths[i] / 2] = 1;
+  }
+
+  for (j = 0; j <= MAX_LEN; j++)
+    if (cfft[j])
+    {
+      gen_cfft(j);
+      printf("%s/arm_cfft_len%d_f32.c\n", outDir, j);
+    }
+  for (i = 0; i < count; i++)
+  {
+    gen_rfft(lengths[i]);
+    printf("%s/arm_rfft_fast_len%d_f32.c\n", outDir, lengths[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_fft_len_bench.c
+*
+* Description:  Host benchmark of the fixed-length FFT functions written
+*               by arm_fft_gen against arm_cfft_f32() and
+*               arm_rfft_fast_f32() of the same lengths. Every call
+*               transforms a fresh copy of the input; the time of the
+*               copy is measured alone and subtracted.
+*
+*               Build and run with "make bench" in this directory.
+*
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#define MAX_LEN         1024
+#define MIN_SECONDS     0.2
+
+static float32_t src[2 * MAX_LEN];
+static float32_t buf[2 * MAX_LEN];
+static float32_t scratch[2 * MAX_LEN];
+static float32_t refOut[2 * MAX_LEN];
+static float32_t lenOut[2 * MAX_LEN];
+static float32_t refSave[2 * MAX_LEN];
+
+typedef struct
+{
+  uint16_t fftLen;
+  const arm_cfft_instance_f32 *pCfft;
+  void (*cfft)(float32_t *p, float32_t *pScratch, uint8_t ifftFlag);
+  void (*rfft)(float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+} fft_len;
+
+static const fft_len lengths[] =
+{
+  { 128, &arm_cfft_sR_f32_len128, arm_cfft_len128_f32, NULL },
+  { 256, &arm_cfft_sR_f32_len256, arm_cfft_len256_f32, arm_rfft_fast_len256_f32 },
+  { 512, &arm_cfft_sR_f32_len512, arm_cfft_len512_f32, arm_rfft_fast_len512_f32 },
+  { 1024, &arm_cfft_sR_f32_len1024, arm_cfft_len1024_f32, arm_rfft_fast_len1024_f32 }
+};
+
+static const fft_len *cur;
+static arm_rfft_fast_instance_f32 rfftF32;
+static uint8_t ifft;
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void run_copy(void)
+{
+  memcpy(buf, src, sizeof(float32_t) * 2 * cur->fftLen);
+}
+
+static void run_cfft(void)
+{
+  run_copy();
+  arm_cfft_f32(cur->pCfft, buf, ifft, 1);
+}
+
+static void run_cfft_len(void)
+{
+  run_copy();
+  cur->cfft(buf, scratch, ifft);
+}
+
+static void run_rfft(void)
+{
+  run_copy();
+  arm_rfft_fast_f32(&rfftF32, buf, refOut, ifft);
+}
+
+static void run_rfft_len(void)
+{
+  run_copy();
+  cur->rfft(buf, lenOut, ifft);
+}
+
+/* Nanoseconds per call */
+static double time_ns(void (*run)(void))
+{
+  double t0, t;
+  uint32_t runs = 0;
+
+  t0 = seconds();
+  do
+  {
+    run();
+    runs++;
+  } while((t = seconds() - t0) < MIN_SECONDS);
+
+  return t * 1e9 / runs;
+}
+
+static double snr(const float32_t *ref, const float32_t *out, uint32_t n)
+{
+  double sig = 0, err = 0;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    sig += (double)ref[i] * ref[i];
+    err += ((double)ref[i] - out[i]) * ((double)ref[i] - out[i]);
+  }
+  return (err == 0) ? 999.0 : 10 * log10(sig / err);
+}
+
+static void bench(const char *name, uint32_t n, void (*runRef)(void), void (*runLen)(void),
+                  const float32_t *ref, const float32_t *out)
+{
+  double tCopy, tRef, tLen, dB;
+
+  tCopy = time_ns(run_copy);
+  tRef = time_ns(runRef) - tCopy;
+  tLen = time_ns(runLen) - tCopy;
+
+  runRef();
+  memcpy(refSave, ref, sizeof(float32_t) * n);
+  runLen();
+  dB = snr(refSave, out, n);
+
+  printf("%-5s %4u %4u %9.1f %9.1f %8.2f %7.1f\n", name, cur->fftLen, ifft, tRef, tLen, tRef / tLen, dB);
+}
+
+int main(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2 * MAX_LEN; i++)
+  {
+    src[i] = (float32_t)((double)rand() / RAND_MAX - 0.5);
+  }
+
+  printf("fft    len  inv    ref_ns    len_ns  speedup  snr_db\n");
+
+  for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+  {
+    cur = &lengths[i];
+
+    for (ifft = 0; ifft < 2; ifft++)
+    {
+      bench("cfft", 2 * cur->fftLen, run_cfft, run_cfft_len, buf, buf);
+    }
+
+    if (cur->rfft != NULL)
+    {
+      arm_rfft_fast_init_f32(&rfftF32, cur->fftLen);
+      for (ifft = 0; ifft < 2; ifft++)
+      {
+        bench("rfft", cur->fftLen, run_rfft, run_rfft_len, refOut, lenOut);
+      }
+    }
+  }
+
+  return 0;
+}
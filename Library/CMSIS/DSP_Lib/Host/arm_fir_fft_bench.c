@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_bench.c    
+*    
+* Description:  Host benchmark of the FFT based FIR filters against the    
+*               direct form FIR filters.    
+*    
+*               Build and run with "make bench" in this directory.    
+*    
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+
+#define MAX_TAPS        2048
+#define MAX_PART        1024
+#define NUM_SAMPLES     16384
+#define MIN_SECONDS     0.2
+
+static float32_t src[NUM_SAMPLES];
+static float32_t refOut[NUM_SAMPLES];
+static float32_t fftOut[NUM_SAMPLES];
+static float32_t coeffs[MAX_TAPS];
+static float32_t firState[MAX_TAPS + NUM_SAMPLES - 1];
+static float32_t spectra[2 * MAX_TAPS + 2 * MAX_PART];
+static float32_t fftState[2 * MAX_TAPS + 6 * MAX_PART];
+
+static q31_t srcQ31[NUM_SAMPLES];
+static q31_t refOutQ31[NUM_SAMPLES];
+static q31_t fftOutQ31[NUM_SAMPLES];
+static q31_t coeffsQ31[MAX_TAPS];
+static q31_t firStateQ31[MAX_TAPS + NUM_SAMPLES - 1];
+static q31_t spectraQ31[4 * MAX_TAPS + 4 * MAX_PART];
+static q31_t fftStateQ31[4 * MAX_TAPS + 9 * MAX_PART];
+
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_fft_instance_f32 fftF32;
+static arm_fir_fft_instance_q31 fftQ31;
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Decaying noise like a room impulse response, with a sum of 0.9 in absolute value */
+static void make_filter(uint32_t numTaps)
+{
+  double sum = 0;
+  uint32_t i;
+
+  for (i = 0; i < numTaps; i++)
+  {
+    coeffs[i] = (float32_t)(((double)rand() / RAND_MAX - 0.5) * exp(-4.0 * (numTaps - 1 - i) / numTaps));
+    sum += fabs(coeffs[i]);
+  }
+  for (i = 0; i < numTaps; i++)
+  {
+    coeffs[i] = (float32_t)(coeffs[i] * 0.9 / sum);
+  }
+  arm_float_to_q31(coeffs, coeffsQ31, numTaps);
+}
+
+static double snr(const double *ref, const double *out, uint32_t n)
+{
+  double sig = 0, err = 0;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    sig += ref[i] * ref[i];
+    err += (ref[i] - out[i]) * (ref[i] - out[i]);
+  }
+  return (err == 0) ? 999.0 : 10 * log10(sig / err);
+}
+
+static double refD[NUM_SAMPLES];
+static double outD[NUM_SAMPLES];
+
+static double snr_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    refD[i] = refOut[i];
+    outD[i] = fftOut[i];
+  }
+  return snr(refD, outD, NUM_SAMPLES);
+}
+
+static double snr_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    refD[i] = refOutQ31[i];
+    outD[i] = fftOutQ31[i];
+  }
+  return snr(refD, outD, NUM_SAMPLES);
+}
+
+static void run_fir_f32(void)     { arm_fir_f32(&firF32, src, refOut, NUM_SAMPLES); }
+static void run_fir_q31(void)     { arm_fir_q31(&firQ31, srcQ31, refOutQ31, NUM_SAMPLES); }
+static void run_fir_fft_f32(void) { arm_fir_fft_f32(&fftF32, src, fftOut, NUM_SAMPLES); }
+static void run_fir_fft_q31(void) { arm_fir_fft_q31(&fftQ31, srcQ31, fftOutQ31, NUM_SAMPLES); }
+
+/* Nanoseconds per sample */
+static double time_ns(void (*run)(void))
+{
+  double t0, t;
+  uint32_t runs = 0;
+
+  t0 = seconds();
+  do
+  {
+    run();
+    runs++;
+  } while((t = seconds() - t0) < MIN_SECONDS);
+
+  return t * 1e9 / ((double)runs * NUM_SAMPLES);
+}
+
+int main(void)
+{
+  static const uint16_t taps[] = { 256, 512, 1024, 2048 };
+  static const uint16_t parts[] = { 64, 128, 256, 512, 1024 };
+  double tFir, tFft;
+  uint32_t i, j;
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    src[i] = (float32_t)((double)rand() / RAND_MAX - 0.5);
+  }
+  arm_float_to_q31(src, srcQ31, NUM_SAMPLES);
+
+  printf("type taps part   fir_ns  fft_ns  speedup  snr_db\n");
+
+  for (i = 0; i < sizeof(taps) / sizeof(taps[0]); i++)
+  {
+    make_filter(taps[i]);
+
+    /* The direct form filters are the reference, time them then compute from a clean state */
+    arm_fir_init_f32(&firF32, taps[i], coeffs, firState, NUM_SAMPLES);
+    tFir = time_ns(run_fir_f32);
+    arm_fir_init_f32(&firF32, taps[i], coeffs, firState, NUM_SAMPLES);
+    run_fir_f32();
+
+    for (j = 0; j < sizeof(parts) / sizeof(parts[0]) && parts[j] <= taps[i]; j++)
+    {
+      arm_fir_fft_init_f32(&fftF32, taps[i], coeffs, spectra, fftState, parts[j]);
+      tFft = time_ns(run_fir_fft_f32);
+      arm_fir_fft_init_f32(&fftF32, taps[i], coeffs, spectra, fftState, parts[j]);
+      run_fir_fft_f32();
+      printf("f32  %4u %4u %8.1f %7.1f %8.1f %7.1f\n", taps[i], parts[j], tFir, tFft, tFir / tFft, snr_f32());
+    }
+
+    arm_fir_init_q31(&firQ31, taps[i], coeffsQ31, firStateQ31, NUM_SAMPLES);
+    tFir = time_ns(run_fir_q31);
+    arm_fir_init_q31(&firQ31, taps[i], coeffsQ31, firStateQ31, NUM_SAMPLES);
+    run_fir_q31();
+
+    for (j = 0; j < sizeof(parts) / sizeof(parts[0]) && parts[j] <= taps[i]; j++)
+    {
+      arm_fir_fft_init_q31(&fftQ31, taps[i], coeffsQ31, spectraQ31, fftStateQ31, parts[j]);
+      tFft = time_ns(run_fir_fft_q31);
+      arm_fir_fft_init_q31(&fftQ31, taps[i], coeffsQ31, spectraQ31, fftStateQ31, parts[j]);
+      run_fir_fft_q31();
+      printf("q31  %4u %4u %8.1f %7.1f %8.1f %7.1f\n", taps[i], parts[j], tFir, tFft, tFir / tFft, snr_q31());
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,246 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_bench.c    
+*    
+* Description:  Host benchmark of the Goertzel filter bank and the sliding    
+*               DFT. 8 bins at the mains harmonics of a 8 kHz signal are    
+*               computed for blocks of 1024 samples, and compared with a    
+*               real FFT of each block followed by the magnitude of every    
+*               bin, and with a double-precision DFT. The number of bins    
+*               where the floating-point Goertzel filter bank costs as    
+*               much as the FFT is printed last.    
+*    
+*               Build and run with "make bench" in this directory.    
+*    
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+
+#define FS              8000.0
+#define MAINS_HZ        50.0
+#define N               1024
+#define NUM_BINS        8
+#define NUM_FRAMES      64
+#define NUM_SAMPLES     (N * NUM_FRAMES)
+#define MIN_SECONDS     0.2
+
+/* PI of arm_math.h is single precision */
+#define PI_D            3.14159265358979323846
+
+static float32_t src[NUM_SAMPLES];
+static q31_t srcQ31[NUM_SAMPLES];
+
+static float32_t freqs[NUM_BINS], coeffs[NUM_BINS], state[2 * NUM_BINS];
+static q31_t freqsQ31[NUM_BINS], coeffsQ31[NUM_BINS], stateQ31[2 * NUM_BINS];
+static float32_t power[NUM_BINS * (NUM_FRAMES + 1)];
+static q31_t powerQ31[NUM_BINS * (NUM_FRAMES + 1)];
+
+static uint16_t binIndex[NUM_BINS];
+static float32_t twiddle[2 * NUM_BINS], delay[N], bins[2 * NUM_BINS];
+static q31_t twiddleQ31[2 * NUM_BINS], delayQ31[N], binsQ31[2 * NUM_BINS];
+
+static float32_t fftIn[N], fftOut[N], fftMag[N / 2];
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* |DFT| at the normalized frequency f of the N samples starting at x */
+static double dft_mag(const float32_t *x, double f)
+{
+  double re = 0, im = 0;
+  int n;
+
+  for (n = 0; n < N; n++)
+  {
+    re += x[n] * cos(2 * PI_D * f * n);
+    im -= x[n] * sin(2 * PI_D * f * n);
+  }
+  return sqrt(re * re + im * im);
+}
+
+/* Largest error of the bin magnitudes, in dB relative to a full-scale sine */
+static double err_db(double err)
+{
+  return 20 * log10(err / (N / 2.0));
+}
+
+static void run_fft(void)
+{
+  static arm_rfft_fast_instance_f32 S;
+  uint32_t f;
+
+  arm_rfft_fast_init_f32(&S, N);
+  for (f = 0; f < NUM_FRAMES; f++)
+  {
+    arm_copy_f32(&src[f * N], fftIn, N);
+    arm_rfft_fast_f32(&S, fftIn, fftOut, 0);
+    arm_cmplx_mag_squared_f32(fftOut, fftMag, N / 2);
+  }
+}
+
+static void run_goertzel_f32(void)
+{
+  arm_goertzel_instance_f32 S;
+
+  arm_goertzel_init_f32(&S, NUM_BINS, N, freqs, coeffs, state);
+  arm_goertzel_f32(&S, src, power, NUM_SAMPLES);
+}
+
+static void run_goertzel_q31(void)
+{
+  arm_goertzel_instance_q31 S;
+
+  arm_goertzel_init_q31(&S, NUM_BINS, N, freqsQ31, coeffsQ31, stateQ31);
+  arm_goertzel_q31(&S, srcQ31, powerQ31, NUM_SAMPLES);
+}
+
+static void run_sdft_f32(void)
+{
+  arm_sdft_instance_f32 S;
+
+  arm_sdft_init_f32(&S, NUM_BINS, N, binIndex, 1.0f - 1e-6f, twiddle, delay, bins);
+  arm_sdft_f32(&S, src, NULL, NUM_SAMPLES);
+}
+
+static void run_sdft_q31(void)
+{
+  arm_sdft_instance_q31 S;
+
+  arm_sdft_init_q31(&S, NUM_BINS, N, binIndex, 0x7FFFF79D, twiddleQ31, delayQ31, binsQ31);
+  arm_sdft_q31(&S, srcQ31, NULL, NUM_SAMPLES);
+}
+
+/* Nanoseconds per frame of N samples */
+static double time_ns(void (*run)(void))
+{
+  double t0, t;
+  uint32_t runs = 0;
+
+  t0 = seconds();
+  do
+  {
+    run();
+    runs++;
+  } while((t = seconds() - t0) < MIN_SECONDS);
+
+  return t * 1e9 / ((double)runs * NUM_FRAMES);
+}
+
+/* One frame of every sample, the SDFT instance is kept running to show the drift */
+static double sdft_long_run_f32(uint32_t frames)
+{
+  arm_sdft_instance_f32 S;
+  double err = 0, e, ref;
+  uint32_t f, b;
+
+  arm_sdft_init_f32(&S, NUM_BINS, N, binIndex, 1.0f - 1e-6f, twiddle, delay, bins);
+  for (f = 0; f < frames; f++)
+  {
+    arm_sdft_f32(&S, &src[(f % NUM_FRAMES) * N], NULL, N);
+  }
+  for (b = 0; b < NUM_BINS; b++)
+  {
+    ref = dft_mag(&src[((frames - 1) % NUM_FRAMES) * N], binIndex[b] / (double)N);
+    e = fabs(sqrt(bins[2 * b] * bins[2 * b] + bins[2 * b + 1] * bins[2 * b + 1]) - ref);
+    err = (e > err) ? e : err;
+  }
+  return err;
+}
+
+static double sdft_long_run_q31(uint32_t frames)
+{
+  arm_sdft_instance_q31 S;
+  double err = 0, e, ref, re, im;
+  uint32_t f, b;
+
+  arm_sdft_init_q31(&S, NUM_BINS, N, binIndex, 0x7FFFF79D, twiddleQ31, delayQ31, binsQ31);
+  for (f = 0; f < frames; f++)
+  {
+    arm_sdft_q31(&S, &srcQ31[(f % NUM_FRAMES) * N], NULL, N);
+  }
+  for (b = 0; b < NUM_BINS; b++)
+  {
+    ref = dft_mag(&src[((frames - 1) % NUM_FRAMES) * N], binIndex[b] / (double)N);
+    re = binsQ31[2 * b] / 2147483648.0 * (1 << S.shift);
+    im = binsQ31[2 * b + 1] / 2147483648.0 * (1 << S.shift);
+    e = fabs(sqrt(re * re + im * im) - ref);
+    err = (e > err) ? e : err;
+  }
+  return err;
+}
+
+int main(void)
+{
+  arm_goertzel_instance_q31 Sq;
+  double errF32 = 0, errQ31 = 0, e, ref, t, tF32;
+  uint32_t i, f, b;
+
+  /* Mains with odd harmonics, a small even one and some noise */
+  srand(1);
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    src[i] = (float32_t)(0.5 * sin(2 * PI_D * MAINS_HZ * i / FS) +
+                         0.1 * sin(2 * PI_D * 3 * MAINS_HZ * i / FS + 1) +
+                         0.05 * sin(2 * PI_D * 5 * MAINS_HZ * i / FS + 2) +
+                         0.01 * sin(2 * PI_D * 2 * MAINS_HZ * i / FS + 3) +
+                         1e-3 * (rand() / (RAND_MAX + 1.0) - 0.5));
+  }
+  arm_float_to_q31(src, srcQ31, NUM_SAMPLES);
+
+  for (b = 0; b < NUM_BINS; b++)
+  {
+    freqs[b] = (float32_t)((b + 1) * MAINS_HZ / FS);
+    freqsQ31[b] = (q31_t)((b + 1) * MAINS_HZ / FS * 2147483648.0);
+    binIndex[b] = (uint16_t)floor((b + 1) * MAINS_HZ / FS * N + 0.5);
+  }
+
+  printf("method        frame_ns  err_db\n");
+
+  t = time_ns(run_fft);
+  printf("rfft+mag      %8.0f       -\n", t);
+
+  /* Goertzel at the exact harmonic frequencies */
+  run_goertzel_f32();
+  run_goertzel_q31();
+  arm_goertzel_init_q31(&Sq, NUM_BINS, N, freqsQ31, coeffsQ31, stateQ31);
+  for (f = 0; f < NUM_FRAMES; f++)
+  {
+    for (b = 0; b < NUM_BINS; b++)
+    {
+      ref = dft_mag(&src[f * N], freqs[b]);
+      e = fabs(sqrt(power[f * NUM_BINS + b]) - ref);
+      errF32 = (e > errF32) ? e : errF32;
+      e = fabs(sqrt(powerQ31[f * NUM_BINS + b] / 2147483648.0) * N - ref);
+      errQ31 = (e > errQ31) ? e : errQ31;
+    }
+  }
+  tF32 = time_ns(run_goertzel_f32);
+  printf("goertzel_f32  %8.0f %7.1f\n", tF32, err_db(errF32));
+  printf("goertzel_q31  %8.0f %7.1f   shift %u\n", time_ns(run_goertzel_q31), err_db(errQ31), Sq.shift);
+
+  /* Sliding DFT at the nearest bins, updated at every sample */
+  printf("sdft_f32      %8.0f %7.1f   after %u frames %7.1f\n", time_ns(run_sdft_f32),
+         err_db(sdft_long_run_f32(NUM_FRAMES)), 100 * NUM_FRAMES, err_db(sdft_long_run_f32(100 * NUM_FRAMES)));
+  printf("sdft_q31      %8.0f %7.1f   after %u frames %7.1f\n", time_ns(run_sdft_q31),
+         err_db(sdft_long_run_q31(NUM_FRAMES)), 100 * NUM_FRAMES, err_db(sdft_long_run_q31(100 * NUM_FRAMES)));
+
+  /* The Goertzel cost grows with the number of bins, the FFT cost does not */
+  printf("goertzel_f32 costs as much as rfft+mag for %.1f bins\n", t * NUM_BINS / tF32);
+
+  return 0;
+}
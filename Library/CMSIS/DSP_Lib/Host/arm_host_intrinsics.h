@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_host_intrinsics.h    
+*    
+* Description:  C versions of the Cortex-M3 and Cortex-M4 instructions used    
+*               by the library, for host builds of the M3 and M4 code.    
+*               Included ahead of arm_math.h with -include by the    
+*               check-cm3 and check-cm4 targets of the Makefile.    
+*    
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_HOST_INTRINSICS_H
+#define _ARM_HOST_INTRINSICS_H
+
+#include <stdint.h>
+
+/* The instructions of cmsis_gcc.h are ARM inline assembly, skip the file */
+#define __CMSIS_GCC_H
+
+/*    
+ * arm_math.h has C versions of the SIMD instructions for the Cortex-M3 only.    
+ * It includes the core header of ARM_MATH_CM4 first, and the library code    
+ * tests the two cores together, so defining both gives the M4 code with them.    
+ */
+#if defined (ARM_MATH_CM4) && !defined (ARM_MATH_CM3)
+#define ARM_MATH_CM3
+#endif
+
+static __inline int32_t __SSAT(
+  int32_t val,
+  uint32_t sat)
+{
+  int32_t max = (int32_t) ((1u << (sat - 1u)) - 1u);
+  int32_t min = -max - 1;
+
+  return (val > max) ? max : ((val < min) ? min : val);
+}
+
+static __inline uint32_t __USAT(
+  int32_t val,
+  uint32_t sat)
+{
+  uint32_t max = (sat < 32u) ? ((1u << sat) - 1u) : 0xFFFFFFFFu;
+
+  return (val < 0) ? 0u : (((uint32_t) val > max) ? max : (uint32_t) val);
+}
+
+static __inline uint32_t __CLZ(
+  uint32_t val)
+{
+  return (val != 0u) ? (uint32_t) __builtin_clz(val) : 32u;
+}
+
+static __inline uint32_t __ROR(
+  uint32_t val,
+  uint32_t shift)
+{
+  shift &= 31u;
+  return (shift != 0u) ? ((val >> shift) | (val << (32u - shift))) : val;
+}
+
+#endif /* _ARM_HOST_INTRINSICS_H */
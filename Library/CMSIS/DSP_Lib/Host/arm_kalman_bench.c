@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:        arm_kalman_bench.c
+*
+* Description:  Host benchmark of arm_kalman_update_f32() against the
+*               textbook update, K = P * H' * inv(S), written with
+*               arm_mat_inverse_f32() and the other matrix functions.
+*               Every call starts from a copy of the same state; the time
+*               of the copy is measured alone and subtracted. The largest
+*               difference between the two updated covariances is
+*               printed relative to the largest element.
+*
+*               Build and run with "make bench" in this directory.
+*
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+
+#define MAX_N           12
+#define MAX_M           6
+#define MIN_SECONDS     0.2
+
+typedef struct
+{
+  uint16_t n;
+  uint16_t m;
+} kalman_size;
+
+static const kalman_size sizes[] =
+{
+  { 4, 2 }, { 6, 3 }, { 9, 3 }, { 9, 6 }, { 12, 6 }
+};
+
+static float32_t x0[MAX_N], p0[MAX_N * MAX_N];
+static float32_t x[MAX_N], p[MAX_N * MAX_N];
+static float32_t f[MAX_N * MAX_N], q[MAX_N * MAX_N];
+static float32_t h[MAX_M * MAX_N], r[MAX_M * MAX_M], z[MAX_M];
+static float32_t work[MAX_N * MAX_N + MAX_M * MAX_N + MAX_M * MAX_M + MAX_M];
+static float32_t refP[MAX_N * MAX_N];
+
+/* Buffers of the textbook update */
+static float32_t y[MAX_M], hp[MAX_M * MAX_N], ht[MAX_N * MAX_M], s[MAX_M * MAX_M];
+static float32_t sInv[MAX_M * MAX_M], hpt[MAX_N * MAX_M], k[MAX_N * MAX_M], kHp[MAX_N * MAX_N];
+
+static arm_kalman_instance_f32 kalman;
+static uint16_t n, m;
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void run_copy(void)
+{
+  memcpy(x, x0, sizeof(float32_t) * n);
+  memcpy(p, p0, sizeof(float32_t) * n * n);
+}
+
+static void run_kalman(void)
+{
+  run_copy();
+  arm_kalman_update_f32(&kalman, z);
+}
+
+static void run_inverse(void)
+{
+  arm_matrix_instance_f32 X, Y, P, H, HT, HP, HPT, S, SI, K, KHP;
+  float32_t dot;
+  uint16_t i;
+
+  run_copy();
+  arm_mat_init_f32(&X, n, 1, x);
+  arm_mat_init_f32(&Y, m, 1, y);
+  arm_mat_init_f32(&P, n, n, p);
+  arm_mat_init_f32(&H, m, n, h);
+  arm_mat_init_f32(&HT, n, m, ht);
+  arm_mat_init_f32(&HP, m, n, hp);
+  arm_mat_init_f32(&HPT, n, m, hpt);
+  arm_mat_init_f32(&S, m, m, s);
+  arm_mat_init_f32(&SI, m, m, sInv);
+  arm_mat_init_f32(&K, n, m, k);
+  arm_mat_init_f32(&KHP, n, n, kHp);
+
+  /* y = z - H * x */
+  arm_mat_mult_f32(&H, &X, &Y);
+  arm_sub_f32(z, y, y, m);
+
+  /* S = H * P * H' + R */
+  arm_mat_mult_f32(&H, &P, &HP);
+  arm_mat_trans_f32(&H, &HT);
+  arm_mat_mult_f32(&HP, &HT, &S);
+  arm_add_f32(s, r, s, m * m);
+
+  /* K = P * H' * inv(S), P * H' = (H * P)' */
+  arm_mat_inverse_f32(&S, &SI);
+  arm_mat_trans_f32(&HP, &HPT);
+  arm_mat_mult_f32(&HPT, &SI, &K);
+
+  /* x = x + K * y, P = P - K * H * P */
+  for (i = 0; i < n; i++)
+  {
+    arm_dot_prod_f32(&k[i * m], y, m, &dot);
+    x[i] += dot;
+  }
+  arm_mat_mult_f32(&K, &HP, &KHP);
+  arm_sub_f32(p, kHp, p, n * n);
+}
+
+/* Nanoseconds per call */
+static double time_ns(void (*run)(void))
+{
+  double t0, t;
+  uint32_t runs = 0;
+
+  t0 = seconds();
+  do
+  {
+    run();
+    runs++;
+  } while((t = seconds() - t0) < MIN_SECONDS);
+
+  return t * 1e9 / runs;
+}
+
+static float32_t uniform(void)
+{
+  return (float32_t)((double)rand() / RAND_MAX - 0.5);
+}
+
+/* Random model, P = G * G' + I is positive definite */
+static void init_model(void)
+{
+  uint16_t i, j, l;
+  float32_t g[MAX_N * MAX_N];
+
+  for (i = 0; i < n * n; i++)
+  {
+    g[i] = uniform();
+    f[i] = uniform();
+    q[i] = 0;
+  }
+  for (i = 0; i < n; i++)
+  {
+    x0[i] = uniform();
+    q[i * n + i] = 0.01f;
+    for (j = 0; j < n; j++)
+    {
+      p0[i * n + j] = (i == j) ? 1.0f : 0.0f;
+      for (l = 0; l < n; l++)
+      {
+        p0[i * n + j] += g[i * n + l] * g[j * n + l];
+      }
+    }
+  }
+  for (i = 0; i < m * n; i++)
+  {
+    h[i] = uniform();
+  }
+  for (i = 0; i < m * m; i++)
+  {
+    r[i] = (i % (m + 1) == 0) ? 0.1f : 0.0f;
+  }
+  for (i = 0; i < m; i++)
+  {
+    z[i] = uniform();
+  }
+
+  arm_kalman_init_f32(&kalman, n, m, x, p, f, q, h, r, work);
+}
+
+int main(void)
+{
+  double tCopy, tInv, tKal, diff, big;
+  uint32_t i, j;
+
+  printf("   n    m    inv_ns    kal_ns  speedup  rel_diff_P\n");
+
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    n = sizes[i].n;
+    m = sizes[i].m;
+    init_model();
+
+    tCopy = time_ns(run_copy);
+    tInv = time_ns(run_inverse) - tCopy;
+    tKal = time_ns(run_kalman) - tCopy;
+
+    run_inverse();
+    memcpy(refP, p, sizeof(float32_t) * n * n);
+    run_kalman();
+
+    diff = big = 0;
+    for (j = 0; j < (uint32_t) n * n; j++)
+    {
+      diff = fmax(diff, fabs((double)refP[j] - p[j]));
+      big = fmax(big, fabs((double)refP[j]));
+    }
+
+    printf("%4u %4u %9.1f %9.1f %8.2f %11.2e\n", n, m, tInv, tKal, tInv / tKal, diff / big);
+  }
+
+  return 0;
+}
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_resample_bench.c    
+*    
+* Description:  Host benchmark of the arbitrary ratio resamplers. A sine    
+*               is converted between 44.1 kHz and 48 kHz, with a fixed    
+*               ratio and with a ratio drifting by +-200 ppm, and compared    
+*               with the exact resampled sine.    
+*    
+*               Build and run with "make bench" in this directory.    
+*    
+* Target Processor: Host
+* -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#include "arm_math.h"
+
+#define PHASES          64
+#define PHASE_LEN       16
+#define NUM_TAPS        (PHASES * PHASE_LEN)
+#define BLOCK_SIZE      256
+#define NUM_BLOCKS      64
+#define NUM_SAMPLES     (BLOCK_SIZE * NUM_BLOCKS)
+#define MAX_OUT         (2 * NUM_SAMPLES)
+#define TONE_HZ         997.0
+#define MIN_SECONDS     0.2
+
+static float32_t coeffs[NUM_TAPS];
+static q31_t coeffsQ31[NUM_TAPS];
+static q15_t coeffsQ15[NUM_TAPS];
+
+static float32_t src[NUM_SAMPLES];
+static q31_t srcQ31[NUM_SAMPLES];
+static q15_t srcQ15[NUM_SAMPLES];
+
+static float32_t out[MAX_OUT];
+static q31_t outQ31[MAX_OUT];
+static q15_t outQ15[MAX_OUT];
+static double outD[MAX_OUT];
+static double refD[MAX_OUT];
+static uint32_t steps[NUM_BLOCKS];
+
+static float32_t state[PHASE_LEN + BLOCK_SIZE - 1];
+static q31_t stateQ31[PHASE_LEN + BLOCK_SIZE - 1];
+static q15_t stateQ15[PHASE_LEN + BLOCK_SIZE - 1];
+
+static double seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double bessel_i0(double x)
+{
+  double sum = 1, term = 1;
+  int k;
+
+  for (k = 1; k < 30; k++)
+  {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+/* Kaiser windowed sinc at PHASES times the input rate, gain PHASES */
+static void make_filter(double cutoff)
+{
+  double beta = 9.0, c = (NUM_TAPS - 1) / 2.0, x, w;
+  int i;
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    x = (i - c) / PHASES;
+    w = bessel_i0(beta * sqrt(1 - ((i - c) / c) * ((i - c) / c))) / bessel_i0(beta);
+    coeffs[i] = (float32_t)(w * ((x == 0) ? 2 * cutoff : sin(2 * PI * cutoff * x) / (PI * x)));
+  }
+
+  /* The largest coefficient is 2 * cutoff, the fixed-point versions need no scaling */
+  arm_float_to_q31(coeffs, coeffsQ31, NUM_TAPS);
+  arm_float_to_q15(coeffs, coeffsQ15, NUM_TAPS);
+}
+
+/* Exact output, the filter delays by (NUM_TAPS - 1) / 2 samples at PHASES times the input rate */
+static uint32_t make_reference(double fs, double amplitude)
+{
+  double delay = (NUM_TAPS - 1) / (2.0 * PHASES);
+  uint64_t pos = 0;
+  uint32_t n = 0, b;
+
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    while(pos < ((uint64_t)(b + 1) * BLOCK_SIZE << 24))
+    {
+      refD[n++] = amplitude * sin(2 * PI * TONE_HZ * ((double)pos / 16777216.0 - delay) / fs);
+      pos += steps[b];
+    }
+  }
+  return n;
+}
+
+static double snr(uint32_t n, uint32_t skip)
+{
+  double sig = 0, err = 0;
+  uint32_t i;
+
+  for (i = skip; i < n; i++)
+  {
+    sig += refD[i] * refD[i];
+    err += (refD[i] - outD[i]) * (refD[i] - outD[i]);
+  }
+  return 10 * log10(sig / err);
+}
+
+static uint32_t run_f32(void)
+{
+  arm_resample_instance_f32 S;
+  uint32_t b, n = 0;
+
+  arm_resample_init_f32(&S, PHASES, NUM_TAPS, coeffs, state, steps[0], BLOCK_SIZE);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    S.step = steps[b];
+    n += arm_resample_f32(&S, &src[b * BLOCK_SIZE], &out[n], BLOCK_SIZE);
+  }
+  return n;
+}
+
+static uint32_t run_q31(void)
+{
+  arm_resample_instance_q31 S;
+  uint32_t b, n = 0;
+
+  arm_resample_init_q31(&S, PHASES, NUM_TAPS, coeffsQ31, stateQ31, steps[0], BLOCK_SIZE);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    S.step = steps[b];
+    n += arm_resample_q31(&S, &srcQ31[b * BLOCK_SIZE], &outQ31[n], BLOCK_SIZE);
+  }
+  return n;
+}
+
+static uint32_t run_q15(void)
+{
+  arm_resample_instance_q15 S;
+  uint32_t b, n = 0;
+
+  arm_resample_init_q15(&S, PHASES, NUM_TAPS, coeffsQ15, stateQ15, steps[0], BLOCK_SIZE);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    S.step = steps[b];
+    n += arm_resample_q15(&S, &srcQ15[b * BLOCK_SIZE], &outQ15[n], BLOCK_SIZE);
+  }
+  return n;
+}
+
+/* Nanoseconds per output sample */
+static double time_ns(uint32_t (*run)(void))
+{
+  double t0, t;
+  uint32_t runs = 0, n = 0;
+
+  t0 = seconds();
+  do
+  {
+    n += run();
+    runs++;
+  } while((t = seconds() - t0) < MIN_SECONDS);
+
+  return t * 1e9 / n;
+}
+
+static void bench(const char *name, double fsIn, double fsOut, double drift)
+{
+  double ratio = fsIn / fsOut, t;
+  uint32_t b, i, n, nRef;
+
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    steps[b] = (uint32_t)(ratio * (1 + drift * sin(2 * PI * b / NUM_BLOCKS)) * 16777216.0 + 0.5);
+  }
+  make_filter(0.45 * ((ratio > 1) ? 1 / ratio : 1));
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    src[i] = (float32_t)(0.9 * sin(2 * PI * TONE_HZ * i / fsIn));
+  }
+  arm_float_to_q31(src, srcQ31, NUM_SAMPLES);
+  arm_float_to_q15(src, srcQ15, NUM_SAMPLES);
+
+  nRef = make_reference(fsIn, 0.9);
+
+  n = run_f32();
+  t = time_ns(run_f32);
+  for (i = 0; i < n && i < nRef; i++)
+  {
+    outD[i] = out[i];
+  }
+  printf("f32  %-8s %5u %5u %7.1f %7.1f\n", name, NUM_SAMPLES, n, t, snr(nRef < n ? nRef : n, 2 * PHASE_LEN));
+
+  n = run_q31();
+  t = time_ns(run_q31);
+  for (i = 0; i < n && i < nRef; i++)
+  {
+    outD[i] = outQ31[i] / 2147483648.0;
+  }
+  printf("q31  %-8s %5u %5u %7.1f %7.1f\n", name, NUM_SAMPLES, n, t, snr(nRef < n ? nRef : n, 2 * PHASE_LEN));
+
+  n = run_q15();
+  t = time_ns(run_q15);
+  for (i = 0; i < n && i < nRef; i++)
+  {
+    outD[i] = outQ15[i] / 32768.0;
+  }
+  printf("q15  %-8s %5u %5u %7.1f %7.1f\n", name, NUM_SAMPLES, n, t, snr(nRef < n ? nRef : n, 2 * PHASE_LEN));
+}
+
+int main(void)
+{
+  printf("type ratio     in_n out_n  out_ns  snr_db\n");
+  bench("44k1-48k", 44100, 48000, 0);
+  bench("48k-44k1", 48000, 44100, 0);
+  bench("drift", 44100, 48000, 200e-6);
+  return 0;
+}
@@ -27249,3 +27249,19 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
    0xE3F4, 0xE57D, 0xE707, 0xE892, 0xEA1E, 0xEBAB, 0xED38, 0xEEC6, 0xF055, 0xF1E4, 0xF374, 0xF505, 0xF695,
    0xF827, 0xF9B8, 0xFB4A, 0xFCDC, 0xFE6E, 0x0000
 };
+
+/**    
+ * \par    
+ * Table for the CORDIC arctangent of the fixed-point vector functions, generated as:
+ * <pre>atanTable[i] = atan(pow(2, -i)) / pi;    
+ * for i = 0, 1, ..., 29 </pre>    
+ * and converted to Q31, rounded to the nearest integer.    
+ * The angle pi maps to 1.0 so that the arctangent wraps around like the fixed-point sine inputs.    
+ */
+const q31_t atanTable_q31[FAST_MATH_ATAN_TABLE_SIZE] = {
+   0x20000000, 0x12E4051E, 0x09FB385B, 0x051111D4, 0x028B0D43, 0x0145D7E1,
+   0x00A2F61E, 0x00517C55, 0x0028BE53, 0x00145F2F, 0x000A2F98, 0x000517CC,
+   0x00028BE6, 0x000145F3, 0x0000A2FA, 0x0000517D, 0x000028BE, 0x0000145F,
+   0x00000A30, 0x00000518, 0x0000028C, 0x00000146, 0x000000A3, 0x00000051,
+   0x00000029, 0x00000014, 0x0000000A, 0x00000005, 0x00000003, 0x00000001
+};
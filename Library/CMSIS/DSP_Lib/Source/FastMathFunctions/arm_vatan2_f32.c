@@ -0,0 +1,168 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vatan2_f32.c    
+*    
+* Description:  Fast vectorized four quadrant arctangent for floating-point values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+#define VATAN_HALF_PI   1.57079632679489662f
+
+/* atan(a) = a + a^3 * P(a^2) for 0 <= a <= 1, minimax */
+#define VATAN_A3        -0.333329870596f
+#define VATAN_A5         0.199903966288f
+#define VATAN_A7        -0.141859753163f
+#define VATAN_A9         0.105739321372f
+#define VATAN_A11       -0.073667061988f
+#define VATAN_A13        0.041121861041f
+#define VATAN_A15       -0.015132536923f
+#define VATAN_A17        0.002622244718f
+
+static __INLINE float32_t arm_vatan2_one_f32(
+  float32_t y,
+  float32_t x)
+{
+  float32_t ax, ay, a, a2, r;
+
+  ax = (x < 0.0f) ? -x : x;
+  ay = (y < 0.0f) ? -y : y;
+
+  /* Divide the smaller magnitude by the larger one, so that 0 <= a <= 1 */
+  if(ay > ax)
+  {
+    a = ax / ay;
+  }
+  else
+  {
+    a = (ax > 0.0f) ? (ay / ax) : 0.0f;
+  }
+
+  a2 = a * a;
+  r = a + ((a * a2) * (VATAN_A3 + (a2 * (VATAN_A5 + (a2 * (VATAN_A7 + (a2 * (VATAN_A9 +
+                       (a2 * (VATAN_A11 + (a2 * (VATAN_A13 + (a2 * (VATAN_A15 + (a2 * VATAN_A17)))))))))))))));
+
+  /* Move the angle to the octant and the quadrant of (x, y) */
+  r = (ay > ax) ? (VATAN_HALF_PI - r) : r;
+  r = (x < 0.0f) ? (PI - r) : r;
+  r = (y < 0.0f) ? -r : r;
+
+  return (r);
+}
+
+/**    
+ * @brief  Four quadrant arctangent of the elements of two floating-point vectors.    
+ * @param[in]  *pSrcY points to the vector of y coordinates.    
+ * @param[in]  *pSrcX points to the vector of x coordinates.    
+ * @param[out] *pDst points to the output vector, in radians.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * Computes <code>pDst[n] = atan2(pSrcY[n], pSrcX[n])</code>, in radians in the range [-pi pi].    
+ * The output is 0 when both inputs are 0.    
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t y1, y2, x1, x2;                      /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.    
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* Read the inputs first, pDst may be the same buffer as pSrcY or pSrcX */
+    y1 = pSrcY[0];
+    y2 = pSrcY[1];
+    x1 = pSrcX[0];
+    x2 = pSrcX[1];
+
+    pDst[0] = arm_vatan2_one_f32(y1, x1);
+    pDst[1] = arm_vatan2_one_f32(y2, x2);
+
+    pSrcY += 2u;
+    pSrcX += 2u;
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here. */
+  blkCnt = blockSize % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vatan2_one_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
@@ -0,0 +1,182 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vatan2_q31.c    
+*    
+* Description:  Fast vectorized four quadrant arctangent for Q31 values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+#define VATAN_ITERATIONS  30u
+
+static __INLINE q31_t arm_vatan2_one_q31(
+  q31_t y,
+  q31_t x)
+{
+  uint32_t ux, uy, lz, i;
+  int32_t xr, yr, xt, theta, sign;
+
+  ux = (x < 0) ? (0u - (uint32_t) x) : (uint32_t) x;
+  uy = (y < 0) ? (0u - (uint32_t) y) : (uint32_t) y;
+
+  if((ux | uy) == 0u)
+  {
+    return (0);
+  }
+
+  /* Scale so that the larger magnitude is in [2^28 2^29), the CORDIC gain of 1.65 does not overflow */
+  lz = __CLZ(ux | uy);
+  if(lz >= 3u)
+  {
+    xr = (int32_t) (ux << (lz - 3u));
+    yr = (int32_t) (uy << (lz - 3u));
+  }
+  else
+  {
+    xr = (int32_t) (ux >> (3u - lz));
+    yr = (int32_t) (uy >> (3u - lz));
+  }
+
+  /* Rotate (xr, yr) onto the x axis, theta accumulates the angle in units of pi.    
+     The direction of each rotation is the sign of yr, applied without branches as    
+     (v ^ sign) - sign, which negates v when sign is -1. */
+  theta = 0;
+  for (i = 0u; i < VATAN_ITERATIONS; i++)
+  {
+    sign = yr >> 31;
+    xt = xr + (((yr >> i) ^ sign) - sign);
+    yr = yr - (((xr >> i) ^ sign) - sign);
+    theta += (atanTable_q31[i] ^ sign) - sign;
+    xr = xt;
+  }
+
+  /* Move the angle to the quadrant of (x, y) */
+  if(x < 0)
+  {
+    theta = (int32_t) (0x80000000u - (uint32_t) theta);
+  }
+  if(y < 0)
+  {
+    theta = (int32_t) (0u - (uint32_t) theta);
+  }
+
+  return (theta);
+}
+
+/**    
+ * @brief  Four quadrant arctangent of the elements of two Q31 vectors.    
+ * @param[in]  *pSrcY points to the vector of y coordinates.    
+ * @param[in]  *pSrcX points to the vector of x coordinates.    
+ * @param[out] *pDst points to the output vector, in the range [-1 +1) for [-pi pi).    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * Computes <code>pDst[n] = atan2(pSrcY[n], pSrcX[n])</code>. Only the ratio of the inputs matters,    
+ * so they need no scaling. The output is 0 when both inputs are 0, and -1 for an angle of +pi.    
+ */
+
+void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t y1, y2, x1, x2;                          /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.    
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* Read the inputs first, pDst may be the same buffer as pSrcY or pSrcX */
+    y1 = pSrcY[0];
+    y2 = pSrcY[1];
+    x1 = pSrcX[0];
+    x2 = pSrcX[1];
+
+    pDst[0] = arm_vatan2_one_q31(y1, x1);
+    pDst[1] = arm_vatan2_one_q31(y2, x2);
+
+    pSrcY += 2u;
+    pSrcX += 2u;
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 2, compute the remaining output sample here. */
+  blkCnt = blockSize % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vatan2_one_q31(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
@@ -0,0 +1,163 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vcos_f32.c    
+*    
+* Description:  Fast vectorized cosine calculation for floating-point values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+/* Cody-Waite split of pi, k * VSIN_PI_A and k * VSIN_PI_B are exact for |k| < 65536 */
+#define VSIN_PI_A       3.140625f
+#define VSIN_PI_B       9.6893310546875e-4f
+#define VSIN_PI_C       -1.2795156862921430e-6f
+#define VSIN_INV_PI     0.318309886183790672f
+
+/* Adding 1.5 * 2^23 rounds to an integer, stored in the low bits of the mantissa */
+#define VSIN_ROUND      12582912.0f
+
+/* sin(r) = r + r^3 * P(r^2) for |r| <= pi/2, minimax */
+#define VSIN_S3         -1.666665709650e-1f
+#define VSIN_S5          8.333017291562e-3f
+#define VSIN_S7         -1.980661520137e-4f
+#define VSIN_S9          2.600054767927e-6f
+
+static __INLINE float32_t arm_vcos_one_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t i;
+  } t, s;
+  float32_t k, r, r2;
+
+  /* x = (k + 0.5) * pi + r, cos(x) = (-1)^(k + 1) * sin(r) */
+  t.f = ((x * VSIN_INV_PI) - 0.5f) + VSIN_ROUND;
+  k = (t.f - VSIN_ROUND) + 0.5f;
+  r = ((x - (k * VSIN_PI_A)) - (k * VSIN_PI_B)) - (k * VSIN_PI_C);
+
+  r2 = r * r;
+  s.f = r + ((r * r2) * (VSIN_S3 + (r2 * (VSIN_S5 + (r2 * (VSIN_S7 + (r2 * VSIN_S9)))))));
+
+  /* The sign is negative when the integer part of k is even */
+  s.i ^= (~t.i) << 31;
+
+  return (s.f);
+}
+
+/**    
+ * @brief  Cosine of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector, in radians.    
+ * @param[out] *pDst points to the output vector.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * The error is below 1.2e-7 for <code>|x| <= 1e5</code> and grows with <code>|x|</code> beyond.    
+ */
+
+void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs first, pSrc and pDst may be the same buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vcos_one_f32(in1);
+    pDst[1] = arm_vcos_one_f32(in2);
+    pDst[2] = arm_vcos_one_f32(in3);
+    pDst[3] = arm_vcos_one_f32(in4);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
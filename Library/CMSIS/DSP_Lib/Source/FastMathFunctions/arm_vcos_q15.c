@@ -0,0 +1,149 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vcos_q15.c    
+*    
+* Description:  Fast vectorized cosine calculation for Q15 values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+static __INLINE q15_t arm_vcos_one_q15(
+  q15_t x)
+{
+  uint32_t p;
+  int32_t a, b, f, y;
+
+  /* Phase with 2^15 for a full turn, cos(a) = sin(a + pi/2) */
+  p = ((uint32_t) x + 0x2000u) & 0x7FFFu;
+
+  /* Nearest table entries, in 15.17 format, and the remainder between them */
+  a = sinTable_q31[p >> 6] >> 14;
+  b = sinTable_q31[(p >> 6) + 1u] >> 14;
+  f = (int32_t) (p & 0x3Fu);
+
+  /* Linear interpolation in 9.23 format */
+  y = (a * 64) + ((b - a) * f);
+
+  /* The chord lies inside the sine, add f * (64 - f) * (a + b) * (2*pi/512)^2 / 256, (2*pi/512)^2 / 256 = 79 / 2^27 */
+  y += ((((a + b) * (f * (64 - f))) >> 8) * 79) >> 19;
+
+  /* 9.23 to 1.15 format with rounding, +1 saturates */
+  return (clip_q31_to_q15((y + 0x80) >> 8));
+}
+
+/**    
+ * @brief  Cosine of the elements of a Q15 vector.    
+ * @param[in]  *pSrc points to the input vector, in units of 2*pi.    
+ * @param[out] *pDst points to the output vector.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * The input is in the range [-1 +1), which maps to [-2*pi 2*pi), and wraps around.    
+ */
+
+void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t in1, in2, in3, in4;                      /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs first, pSrc and pDst may be the same buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vcos_one_q15(in1);
+    pDst[1] = arm_vcos_one_q15(in2);
+    pDst[2] = arm_vcos_one_q15(in3);
+    pDst[3] = arm_vcos_one_q15(in4);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_one_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
@@ -0,0 +1,150 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vcos_q31.c    
+*    
+* Description:  Fast vectorized cosine calculation for Q31 values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+static __INLINE q31_t arm_vcos_one_q31(
+  q31_t x)
+{
+  uint32_t p, i;
+  q31_t sa, ca, b, u, v, w;
+
+  /* Phase with 2^32 for a full turn, cos(a) = sin(a + pi/2), the upper 9 bits index the table */
+  p = ((uint32_t) x << 1) + 0x40000000u;
+  i = p >> 23;
+
+  /* Sine and cosine of the table angle a, the cosine is a quarter turn further */
+  sa = sinTable_q31[i];
+  ca = sinTable_q31[(i + 128u) & 511u];
+
+  /* Remainder b in radians, in 1.31 format, with pi in 3.29 format */
+  b = (q31_t) ((((q63_t) (p & 0x7FFFFFu) * 0x6487ED51) + 0x10000000) >> 29);
+
+  /* sin(a + b) = sa + b * (ca - b * (sa / 2 + b * ca / 6)), the b^4 terms are below 2 LSB */
+  u = (q31_t) (((q63_t) ca * b) >> 31);
+  v = (sa >> 1) + (q31_t) (((q63_t) u * 0x15555555) >> 31);
+  w = ca - (q31_t) (((q63_t) v * b) >> 31);
+
+  return (clip_q63_to_q31((q63_t) sa + ((((q63_t) w * b) + 0x40000000) >> 31)));
+}
+
+/**    
+ * @brief  Cosine of the elements of a Q31 vector.    
+ * @param[in]  *pSrc points to the input vector, in units of 2*pi.    
+ * @param[out] *pDst points to the output vector.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * The input is in the range [-1 +1), which maps to [-2*pi 2*pi), and wraps around.    
+ */
+
+void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2, in3, in4;                      /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs first, pSrc and pDst may be the same buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vcos_one_q31(in1);
+    pDst[1] = arm_vcos_one_q31(in2);
+    pDst[2] = arm_vcos_one_q31(in3);
+    pDst[3] = arm_vcos_one_q31(in4);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_one_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
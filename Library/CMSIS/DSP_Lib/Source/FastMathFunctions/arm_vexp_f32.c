@@ -0,0 +1,181 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vexp_f32.c    
+*    
+* Description:  Fast vectorized exponential calculation for floating-point values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+#define VEXP_LOG2E      1.44269504088896341f
+
+/* Cody-Waite split of ln(2), k * VEXP_LN2_HI is exact */
+#define VEXP_LN2_HI     0.693359375f
+#define VEXP_LN2_LO     -2.12194440e-4f
+
+/* Adding 1.5 * 2^23 rounds to an integer, stored in the low bits of the mantissa */
+#define VEXP_ROUND      12582912.0f
+#define VEXP_ROUND_BITS 0x4B400000
+
+/* Beyond these limits the result overflows to infinity or underflows to 0 */
+#define VEXP_MAX        88.8f
+#define VEXP_MIN        -104.0f
+
+/* exp(r) = 1 + r + r^2 * P(r) for |r| <= ln(2) / 2, minimax */
+#define VEXP_P0         5.0000001201e-1f
+#define VEXP_P1         1.6666665459e-1f
+#define VEXP_P2         4.1665795894e-2f
+#define VEXP_P3         8.3334519073e-3f
+#define VEXP_P4         1.3981999507e-3f
+#define VEXP_P5         1.9875691500e-4f
+
+static __INLINE float32_t arm_vexp_one_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } t, s1, s2;
+  float32_t k, r, p;
+  int32_t n;
+
+  x = (x > VEXP_MAX) ? VEXP_MAX : x;
+  x = (x < VEXP_MIN) ? VEXP_MIN : x;
+
+  /* x = k * ln(2) + r, exp(x) = 2^k * exp(r) */
+  t.f = (x * VEXP_LOG2E) + VEXP_ROUND;
+  k = t.f - VEXP_ROUND;
+  n = t.i - VEXP_ROUND_BITS;
+  r = (x - (k * VEXP_LN2_HI)) - (k * VEXP_LN2_LO);
+
+  p = VEXP_P5;
+  p = (p * r) + VEXP_P4;
+  p = (p * r) + VEXP_P3;
+  p = (p * r) + VEXP_P2;
+  p = (p * r) + VEXP_P1;
+  p = (p * r) + VEXP_P0;
+  p = (((p * r) * r) + r) + 1.0f;
+
+  /* 2^k is built in two halves, so that the results below 2^-126 are denormalized correctly */
+  s1.i = ((n >> 1) + 127) << 23;
+  s2.i = ((n - (n >> 1)) + 127) << 23;
+
+  return ((p * s1.f) * s2.f);
+}
+
+/**    
+ * @brief  Exponential of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector.    
+ * @param[out] *pDst points to the output vector.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * Results above the largest floating-point value are +Inf, results below the smallest denormalized value are 0.    
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs first, pSrc and pDst may be the same buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vexp_one_f32(in1);
+    pDst[1] = arm_vexp_one_f32(in2);
+    pDst[2] = arm_vexp_one_f32(in3);
+    pDst[3] = arm_vexp_one_f32(in4);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vexp_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
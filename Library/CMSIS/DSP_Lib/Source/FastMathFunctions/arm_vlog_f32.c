@@ -0,0 +1,203 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vlog_f32.c    
+*    
+* Description:  Fast vectorized natural logarithm calculation for floating-point values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+#define VLOG_SQRTHF     0.707106781186547524f
+
+/* Cody-Waite split of ln(2), e * VLOG_LN2_HI is exact */
+#define VLOG_LN2_HI     0.693359375f
+#define VLOG_LN2_LO     -2.12194440e-4f
+
+/* log(1 + f) = f - f^2 / 2 + f^3 * P(f) for sqrt(0.5) - 1 <= f <= sqrt(2) - 1, minimax */
+#define VLOG_P0         3.3333331174e-1f
+#define VLOG_P1         -2.4999993993e-1f
+#define VLOG_P2         2.0000714765e-1f
+#define VLOG_P3         -1.6668057665e-1f
+#define VLOG_P4         1.4249322787e-1f
+#define VLOG_P5         -1.2420140846e-1f
+#define VLOG_P6         1.1676998740e-1f
+#define VLOG_P7         -1.1514610310e-1f
+#define VLOG_P8         7.0376836292e-2f
+
+static __INLINE float32_t arm_vlog_one_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } v, m;
+  float32_t f, f2, p, e;
+  int32_t n = -126;
+
+  v.f = x;
+
+  /* Zero, negative and denormalized inputs, the sign bit makes v.i negative */
+  if(v.i < 0x00800000)
+  {
+    if(v.i <= 0)
+    {
+      /* -Inf for +0 and -0, NaN below */
+      v.i = ((v.i & 0x7FFFFFFF) == 0) ? (int32_t) 0xFF800000 : 0x7FC00000;
+      return (v.f);
+    }
+
+    v.f *= 8388608.0f;
+    n -= 23;
+  }
+  else if(v.i >= 0x7F800000)
+  {
+    /* +Inf and NaN */
+    return (x);
+  }
+
+  /* x = 2^n * m with 0.5 <= m < 1, moved to sqrt(0.5) <= m < sqrt(2) */
+  n += v.i >> 23;
+  m.i = (v.i & 0x007FFFFF) | 0x3F000000;
+  if(m.f < VLOG_SQRTHF)
+  {
+    m.f += m.f;
+    n--;
+  }
+  f = m.f - 1.0f;
+  e = (float32_t) n;
+
+  f2 = f * f;
+  p = VLOG_P8;
+  p = (p * f) + VLOG_P7;
+  p = (p * f) + VLOG_P6;
+  p = (p * f) + VLOG_P5;
+  p = (p * f) + VLOG_P4;
+  p = (p * f) + VLOG_P3;
+  p = (p * f) + VLOG_P2;
+  p = (p * f) + VLOG_P1;
+  p = (p * f) + VLOG_P0;
+  p = (p * f) * f2;
+
+  /* log(x) = n * ln(2) + log(1 + f) */
+  p += e * VLOG_LN2_LO;
+  p -= 0.5f * f2;
+
+  return ((f + p) + (e * VLOG_LN2_HI));
+}
+
+/**    
+ * @brief  Natural logarithm of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector.    
+ * @param[out] *pDst points to the output vector.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * The output is -Inf for 0, NaN for negative inputs and +Inf for +Inf.    
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs first, pSrc and pDst may be the same buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vlog_one_f32(in1);
+    pDst[1] = arm_vlog_one_f32(in2);
+    pDst[2] = arm_vlog_one_f32(in3);
+    pDst[3] = arm_vlog_one_f32(in4);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vlog_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
@@ -0,0 +1,197 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vsin_f32.c    
+*    
+* Description:  Fast vectorized sine calculation for floating-point values.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup VectorFastMath Vector Fast Math Functions    
+ *    
+ * Compute the sine, cosine, arctangent, exponential, logarithm and square root of every element of a vector.    
+ * Unlike the scalar fast math functions, which interpolate a table, the functions are accurate to a few units in the    
+ * last place, and are meant for blocks of data, as in field oriented motor control or demodulation loops:    
+ * - The floating-point functions reduce the argument arithmetically and evaluate a minimax polynomial, without    
+ *   table lookups. The loops process several elements per iteration so that the independent multiply-accumulates    
+ *   of the polynomials fill the FPU pipeline.    
+ * - The fixed-point sine and cosine start from the table of the scalar functions and add the terms the linear    
+ *   interpolation misses: the Q31 functions a Taylor expansion around the table angle, the Q15 functions the    
+ *   curvature of the sine between two entries, in 32-bit arithmetic.    
+ *   The input range [-1 +1) maps to [-2*pi 2*pi) and wraps around, so that a phase accumulator can be passed directly.    
+ *   The extra terms trade speed for accuracy: an element costs about 1.3 to 1.7 times a call of arm_sin_q15,    
+ *   arm_cos_q15, arm_sin_q31 or arm_cos_q31, whose errors reach 5 LSB in Q15 and 40000 LSB in Q31. Where that is    
+ *   accurate enough, a loop over the scalar functions is faster.    
+ * - The fixed-point arctangent uses CORDIC iterations, with shifts and additions only. The output range    
+ *   [-1 +1) maps to [-pi pi).    
+ *    
+ * \par    
+ * The maximum errors, measured against double-precision references over the input ranges given for each function, are:    
+ * <pre>    
+ *    arm_vsin_f32, arm_vcos_f32    |x| <= 1e5             1.2e-7 absolute    
+ *    arm_vatan2_f32                                       2.6e-7 rad    
+ *    arm_vexp_f32                  -87.3 <= x <= 88.7     1 ULP    
+ *    arm_vlog_f32                  x > 0                  4e-8 absolute for x in [0.5 2], 1 ULP elsewhere    
+ *    arm_vsin_q31, arm_vcos_q31                           4 LSB    
+ *    arm_vsin_q15, arm_vcos_q15                           1 LSB    
+ *    arm_vatan2_q31                                       20 LSB    
+ *    arm_vatan2_q15                                       1 LSB    
+ * </pre>    
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.    
+ */
+
+/**    
+ * @addtogroup VectorFastMath    
+ * @{    
+ */
+
+/* Cody-Waite split of pi, k * VSIN_PI_A and k * VSIN_PI_B are exact for |k| < 65536 */
+#define VSIN_PI_A       3.140625f
+#define VSIN_PI_B       9.6893310546875e-4f
+#define VSIN_PI_C       -1.2795156862921430e-6f
+#define VSIN_INV_PI     0.318309886183790672f
+
+/* Adding 1.5 * 2^23 rounds to an integer, stored in the low bits of the mantissa */
+#define VSIN_ROUND      12582912.0f
+
+/* sin(r) = r + r^3 * P(r^2) for |r| <= pi/2, minimax */
+#define VSIN_S3         -1.666665709650e-1f
+#define VSIN_S5          8.333017291562e-3f
+#define VSIN_S7         -1.980661520137e-4f
+#define VSIN_S9          2.600054767927e-6f
+
+static __INLINE float32_t arm_vsin_one_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t i;
+  } t, s;
+  float32_t k, r, r2;
+
+  /* x = k * pi + r, sin(x) = (-1)^k * sin(r) */
+  t.f = (x * VSIN_INV_PI) + VSIN_ROUND;
+  k = t.f - VSIN_ROUND;
+  r = ((x - (k * VSIN_PI_A)) - (k * VSIN_PI_B)) - (k * VSIN_PI_C);
+
+  r2 = r * r;
+  s.f = r + ((r * r2) * (VSIN_S3 + (r2 * (VSIN_S5 + (r2 * (VSIN_S7 + (r2 * VSIN_S9)))))));
+
+  /* The parity of k is the lowest mantissa bit of t */
+  s.i ^= t.i << 31;
+
+  return (s.f);
+}
+
+/**    
+ * @brief  Sine of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector, in radians.    
+ * @param[out] *pDst points to the output vector.    
+ * @param[in]  blockSize number of samples in each vector.    
+ * @return none.    
+ *    
+ * \par    
+ * The error is below 1.2e-7 for <code>|x| <= 1e5</code> and grows with <code>|x|</code> beyond.    
+ */
+
+void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs first, pSrc and pDst may be the same buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vsin_one_f32(in1);
+    pDst[1] = arm_vsin_one_f32(in2);
+    pDst[2] = arm_vsin_one_f32(in3);
+    pDst[3] = arm_vsin_one_f32(in4);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vsin_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of VectorFastMath group    
+ */
@@ -0,0 +1,156 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_interleaved_df1_q31.c    
+*    
+* Description:  Q31 multichannel interleaved direct form I Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeInterleaved    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 multichannel interleaved direct form I Biquad cascade filter.    
+ * @param[in]  *S points to an instance of the Q31 interleaved Biquad cascade structure.    
+ * @param[in]  *pSrc points to the block of interleaved input frames.    
+ * @param[out] *pDst points to the block of interleaved output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * As for <code>arm_biquad_cascade_df1_q31()</code>, the accumulation is performed in a    
+ * 64-bit accumulator in 2.62 format, and the result is shifted by <code>postShift</code>    
+ * and truncated to 1.31 format by discarding the high bits, without saturation.    
+ */
+
+void arm_biquad_cascade_interleaved_df1_q31(
+  const arm_biquad_cascade_interleaved_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn, *pOut;                             /* Source and destination pointers */
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q63_t acc;                                     /* Accumulator */
+  q31_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /* Filter state variables */
+  q31_t Xn;                                      /* Temporary input */
+  uint32_t lShift = 31u - (uint32_t) S->postShift;  /* Shift to be applied to the output */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t stage = S->numStages;                 /* Stage loop counter */
+  uint32_t chan, sample;                         /* Loop counters */
+
+  do
+  {
+    /* Reading the coefficients, shared by all the channels */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5u;
+
+    for (chan = 0u; chan < numChans; chan++)
+    {
+      pIn = pSrc + chan;
+      pOut = pDst + chan;
+
+      /* Reading the state values */
+      Xn1 = pState[0];
+      Xn2 = pState[1];
+      Yn1 = pState[2];
+      Yn2 = pState[3];
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *pIn;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+
+        /* The result is converted to 1.31 */
+        acc = acc >> lShift;
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *pOut = (q31_t) acc;
+
+        /* Same channel in the next frame */
+        pIn += numChans;
+        pOut += numChans;
+
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = Xn1;
+      pState[1] = Xn2;
+      pState[2] = Yn1;
+      pState[3] = Yn2;
+      pState += 4u;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer.
+     * Subsequent stages occur in-place in the output buffer */
+    pSrc = pDst;
+
+  } while(--stage);
+}
+
+/**    
+ * @} end of BiquadCascadeInterleaved group    
+ */
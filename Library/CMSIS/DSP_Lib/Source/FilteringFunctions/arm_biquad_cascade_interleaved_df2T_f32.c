@@ -0,0 +1,235 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_interleaved_df2T_f32.c    
+*    
+* Description:  Floating-point multichannel interleaved transposed direct form II Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup BiquadCascadeInterleaved Multichannel Interleaved Biquad Cascade IIR Filters    
+ *    
+ * These functions filter <code>numChans</code> channels stored interleaved, as received    
+ * from an I2S or PDMA buffer, with the same cascade of Biquad sections:    
+ * <pre>    
+ *     {x0[0], x1[0], ..., xC[0], x0[1], x1[1], ..., xC[1], ...}    
+ * </pre>    
+ * where <code>xc[n]</code> is sample <code>n</code> of channel <code>c</code>.    
+ * The output is interleaved the same way, and may overwrite the input.    
+ * <code>blockSize</code> is the number of frames to process, a frame being one sample of    
+ * every channel. They generalize <code>arm_biquad_cascade_stereo_df2T_f32()</code> to any    
+ * number of channels, and avoid splitting the frames into one buffer per channel and    
+ * merging them afterwards.    
+ *    
+ * \par    
+ * The floating-point function uses the transposed direct form II of    
+ * <code>arm_biquad_cascade_df2T_f32()</code>, with the same coefficients.    
+ * The Q31 and Q15 functions use the direct form I of <code>arm_biquad_cascade_df1_q31()</code>    
+ * and <code>arm_biquad_cascade_df1_q15()</code>, with the same coefficients, post shift and    
+ * fixed-point behavior, and give the same results for each channel.    
+ *    
+ * \par Algorithm    
+ * The coefficients of a stage are loaded once and shared by all the channels.    
+ * Within a stage, the floating-point function processes the channels by pairs, which    
+ * interleaves two independent recursions as the stereo function does; the fixed-point    
+ * functions process one channel at a time, with its 4 state variables in registers.    
+ * The output of each stage is written in place to <code>pDst</code> and is the input of    
+ * the next stage.    
+ *    
+ * \par    
+ * The state variables of each stage are stored channel after channel, then the state    
+ * variables of the next stage, and so on:    
+ * <pre>    
+ *     {d11[0], d12[0], d11[1], d12[1], ..., d21[0], d22[0], ...}     floating-point    
+ *     {x[n-1], x[n-2], y[n-1], y[n-2]} for each channel of each stage  Q31 and Q15    
+ * </pre>    
+ * where <code>dsk[c]</code> is the state variable <code>k</code> of stage <code>s</code> for    
+ * channel <code>c</code>. For 2 channels, the floating-point layout is the layout of    
+ * <code>arm_biquad_cascade_stereo_df2T_f32()</code>.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables for a filter are stored together in an instance data    
+ * structure. A separate instance structure must be defined for each set of channels.    
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.    
+ * There are separate instance structure declarations for each of the 3 supported data types.    
+ *    
+ * \par Init Functions    
+ * The initialization functions set the values of the internal structure fields and zero    
+ * out the values in the state buffer.    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeInterleaved    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point multichannel interleaved transposed direct form II Biquad cascade filter.    
+ * @param[in]  *S points to an instance of the filter data structure.    
+ * @param[in]  *pSrc points to the block of interleaved input frames.    
+ * @param[out] *pDst points to the block of interleaved output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return none.    
+ */
+
+void arm_biquad_cascade_interleaved_df2T_f32(
+  const arm_biquad_cascade_interleaved_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn, *pOut;                         /* Source and destination pointers */
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+  float32_t Xn1a, Xn1b;                          /* Temporary inputs */
+  float32_t acc1a, acc1b;                        /* Accumulators */
+  float32_t d1a, d2a, d1b, d2b;                  /* State variables */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t stage = S->numStages;                 /* Stage loop counter */
+  uint32_t chan, sample;                         /* Loop counters */
+
+  do
+  {
+    /* Reading the coefficients, shared by all the channels */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5u;
+
+    /* Channels by pairs */
+    for (chan = 0u; (chan + 1u) < numChans; chan += 2u)
+    {
+      pIn = pSrc + chan;
+      pOut = pDst + chan;
+
+      /* Reading the state values */
+      d1a = pState[0];
+      d2a = pState[1];
+      d1b = pState[2];
+      d2b = pState[3];
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs of the 2 channels */
+        Xn1a = pIn[0];
+        Xn1b = pIn[1];
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1a = (b0 * Xn1a) + d1a;
+        acc1b = (b0 * Xn1b) + d1b;
+
+        pOut[0] = acc1a;
+        pOut[1] = acc1b;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1a = ((b1 * Xn1a) + (a1 * acc1a)) + d2a;
+        d1b = ((b1 * Xn1b) + (a1 * acc1b)) + d2b;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2a = (b2 * Xn1a) + (a2 * acc1a);
+        d2b = (b2 * Xn1b) + (a2 * acc1b);
+
+        /* Same channels in the next frame */
+        pIn += numChans;
+        pOut += numChans;
+
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = d1a;
+      pState[1] = d2a;
+      pState[2] = d1b;
+      pState[3] = d2b;
+      pState += 4u;
+    }
+
+    /* Last channel when the number of channels is odd */
+    if(chan < numChans)
+    {
+      pIn = pSrc + chan;
+      pOut = pDst + chan;
+
+      /* Reading the state values */
+      d1a = pState[0];
+      d2a = pState[1];
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn1a = *pIn;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1a = (b0 * Xn1a) + d1a;
+        *pOut = acc1a;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2, d2 = b2 * x[n] + a2 * y[n] */
+        d1a = ((b1 * Xn1a) + (a1 * acc1a)) + d2a;
+        d2a = (b2 * Xn1a) + (a2 * acc1a);
+
+        pIn += numChans;
+        pOut += numChans;
+
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = d1a;
+      pState[1] = d2a;
+      pState += 2u;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer.
+     * Subsequent stages occur in-place in the output buffer */
+    pSrc = pDst;
+
+  } while(--stage);
+}
+
+/**    
+ * @} end of BiquadCascadeInterleaved group    
+ */
@@ -0,0 +1,98 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_interleaved_df2T_init_f32.c    
+*    
+* Description:  Floating-point multichannel interleaved transposed direct form II Biquad cascade filter    
+*               initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeInterleaved    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point multichannel interleaved transposed direct form II Biquad cascade filter.    
+ * @param[in,out] *S points to an instance of the filter data structure.    
+ * @param[in]     numStages number of 2nd order stages in the filter.    
+ * @param[in]     numChans number of interleaved channels.    
+ * @param[in]     *pCoeffs points to the filter coefficients.    
+ * @param[in]     *pState points to the state buffer.    
+ * @return        none    
+ *    
+ * <b>Coefficient and State Ordering:</b>    
+ * \par    
+ * The coefficients are stored in the array <code>pCoeffs</code> in the following order:    
+ * <pre>    
+ *     {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}    
+ * </pre>    
+ * as for <code>arm_biquad_cascade_df2T_init_f32()</code>, a total of <code>5*numStages</code> values.    
+ *    
+ * \par    
+ * Each Biquad stage has 2 state variables <code>d1</code> and <code>d2</code> for each channel.    
+ * The state array has a total length of <code>2*numStages*numChans</code> values.    
+ */
+
+void arm_biquad_cascade_interleaved_df2T_init_f32(
+  arm_biquad_cascade_interleaved_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChans,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChans = numChans;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChans */
+  memset(pState, 0, (2u * (uint32_t) numStages * numChans) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**    
+ * @} end of BiquadCascadeInterleaved group    
+ */
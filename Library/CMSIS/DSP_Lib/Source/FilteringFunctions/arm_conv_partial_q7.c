@@ -263,15 +263,16 @@ arm_status arm_conv_partial_q7(
      * sum = x[srcALen-srcBLen-2] * y[srcBLen-1] + x[srcALen] * y[srcBLen-2] +...+ x[srcALen-1] * y[0]   
      */
 
-    /* Working pointer of inputA */
+    /* Working pointer of inputA, stage 2 starts at the output firstIndex */
     if((int32_t)firstIndex - (int32_t)srcBLen + 1 > 0)
     {
-      px = pIn1 + firstIndex - srcBLen + 1;
+      pSrc1 = pIn1 + firstIndex - srcBLen + 1;
     }
     else
     {
-      px = pIn1;
+      pSrc1 = pIn1;
     }
+    px = pSrc1;
 
     /* Working pointer of inputB */
     pSrc2 = pIn2 + (srcBLen - 1u);
@@ -461,7 +462,7 @@ arm_status arm_conv_partial_q7(
         count += 4u;
 
         /* Update the inputA and inputB pointers for next MAC calculation */
-        px = pIn1 + count;
+        px = pSrc1 + count;
         py = pSrc2;
 
 
@@ -536,7 +537,7 @@ arm_status arm_conv_partial_q7(
  	    count++;
 
         /* Update the inputA and inputB pointers for next MAC calculation */
-      	px = pIn1 + count;
+      	px = pSrc1 + count;
         py = pSrc2;	
 
         /* Decrement the loop counter */
@@ -573,7 +574,7 @@ arm_status arm_conv_partial_q7(
         count++;
 
         /* Update the inputA and inputB pointers for next MAC calculation */
-        px = pIn1 + count;
+        px = pSrc1 + count;
         py = pSrc2;
 
         /* Decrement the loop counter */
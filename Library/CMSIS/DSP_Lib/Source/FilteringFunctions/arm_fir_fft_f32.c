@@ -0,0 +1,205 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_f32.c    
+*    
+* Description:  Floating-point FFT based FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_FFT FFT Based FIR Filters    
+ *    
+ * These functions implement long FIR filters by fast convolution, for Q31 and floating-point data types.    
+ * The cost of the direct form FIR filters grows with <code>numTaps</code> for every sample, which makes    
+ * filters of several hundred or thousand taps too slow for real time processing.    
+ * The FFT based filters compute the same output with a cost per sample that grows with    
+ * <code>numTaps / partLen + log2(partLen)</code> instead.    
+ *    
+ * \par Algorithm:    
+ * The impulse response is split into <code>numParts</code> partitions of <code>partLen</code> taps,    
+ * the last one padded with zeros. The spectrum of each partition, zero padded to <code>2*partLen</code>,    
+ * is computed once by the initialization function.    
+ * For each block of <code>partLen</code> input samples, the last <code>2*partLen</code> input samples are    
+ * transformed and the spectrum is stored in a frequency-domain delay line that holds the spectra of the last    
+ * <code>numParts</code> blocks. The products of each partition spectrum with the input spectrum delayed by    
+ * the same number of blocks are summed and transformed back. The last <code>partLen</code> samples of the    
+ * inverse transform are the filter output (overlap-save).    
+ * <pre>    
+ *    Y = X[k] * H[0] + X[k-1] * H[1] + ... + X[k-numParts+1] * H[numParts-1]    
+ * </pre>    
+ * \par    
+ * The output is identical to the direct form FIR filter with the same coefficients, apart from rounding.    
+ * There is no added delay, but the output of a block is only available when the whole block is received,    
+ * so <code>blockSize</code> must be a multiple of <code>partLen</code>.    
+ * A short <code>partLen</code> gives a low latency and a longer one a lower cost per sample.    
+ * The lowest cost is usually reached with <code>partLen</code> close to <code>numTaps/4</code>.    
+ *    
+ * \par    
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>,    
+ * stored in time reversed order as for the direct form FIR filters.    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * The coefficient array is only read by the initialization function. <code>pSpectra</code> points to an array    
+ * receiving the partition spectra, which may be shared by several instances filtering different channels with    
+ * the same coefficients. <code>pState</code> holds the input history, the frequency-domain delay line and the    
+ * work buffers of the transforms, and cannot be shared.    
+ * The buffer sizes are given with each initialization function.    
+ *    
+ * \par Instance Structure    
+ * The partition spectra and state variables for a filter are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * There are separate instance structure declarations for each of the 2 supported data types.    
+ * The instance structures must be initialized with the initialization functions.    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point FFT based FIR filter.    
+ * @param[in,out] *S points to an instance of the floating-point FFT based FIR filter structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data.    
+ * @param[in]  blockSize number of samples to process per call, a multiple of <code>partLen</code>.    
+ * @return     none.    
+ *    
+ * \par    
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.    
+ */
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partLen = S->partLen;                 /* Samples per partition */
+  uint32_t fftLen = 2u * partLen;                /* FFT length, also the size of a packed spectrum */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  float32_t *pIn = S->pState;                    /* Last 2*partLen input samples, also the output of the inverse FFT */
+  float32_t *pDelay = pIn + fftLen;              /* Frequency-domain delay line */
+  float32_t *pAcc = pDelay + (numParts * fftLen);  /* Sum of the partition products */
+  float32_t *pX, *pH, *pY;                       /* Temporary pointers to the spectra */
+  float32_t xRe, xIm, hRe, hIm, in;              /* Temporary variables */
+  uint32_t blkCnt, part, k;                      /* Loop counters */
+
+  blkCnt = blockSize / partLen;
+
+  while(blkCnt > 0u)
+  {
+    /* The first half of pIn holds the previous block, append the new one */
+    arm_copy_f32(pSrc, pIn + partLen, partLen);
+
+    /* Transform into the newest slot of the delay line, this clobbers pIn */
+    pX = pDelay + (S->stateIndex * fftLen);
+    arm_rfft_fast_f32(&S->rfft, pIn, pX, 0u);
+
+    /* Multiply each partition spectrum with the input spectrum delayed by as many blocks.    
+     ** The packed spectrum holds the real DC and Nyquist bins in the first two values. */
+    pH = S->pCoeffs;
+
+    for (part = 0u; part < numParts; part++)
+    {
+      pY = pAcc;
+
+      if(part == 0u)
+      {
+        pY[0] = pX[0] * pH[0];
+        pY[1] = pX[1] * pH[1];
+
+        for (k = 2u; k < fftLen; k += 2u)
+        {
+          xRe = pX[k];
+          xIm = pX[k + 1u];
+          hRe = pH[k];
+          hIm = pH[k + 1u];
+          pY[k] = (xRe * hRe) - (xIm * hIm);
+          pY[k + 1u] = (xRe * hIm) + (xIm * hRe);
+        }
+      }
+      else
+      {
+        pY[0] += pX[0] * pH[0];
+        pY[1] += pX[1] * pH[1];
+
+        for (k = 2u; k < fftLen; k += 2u)
+        {
+          xRe = pX[k];
+          xIm = pX[k + 1u];
+          hRe = pH[k];
+          hIm = pH[k + 1u];
+          pY[k] += (xRe * hRe) - (xIm * hIm);
+          pY[k + 1u] += (xRe * hIm) + (xIm * hRe);
+        }
+      }
+
+      /* Step back one block in the delay line, wrapping around */
+      pX = (pX == pDelay) ? pDelay + ((numParts - 1u) * fftLen) : pX - fftLen;
+      pH += fftLen;
+    }
+
+    /* Back to the time domain, the output is the second half */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pIn, 1u);
+
+    /* Read the input before writing the output, they may be the same buffer */
+    for (k = 0u; k < partLen; k++)
+    {
+      in = pSrc[k];
+      pDst[k] = pIn[partLen + k];
+      pIn[k] = in;
+    }
+
+    /* Advance the delay line */
+    S->stateIndex = (S->stateIndex + 1u == numParts) ? 0u : S->stateIndex + 1u;
+
+    pSrc += partLen;
+    pDst += partLen;
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
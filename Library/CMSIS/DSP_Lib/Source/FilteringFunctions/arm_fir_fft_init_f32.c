@@ -0,0 +1,128 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_init_f32.c    
+*    
+* Description:  Floating-point FFT based FIR filter initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the floating-point FFT based FIR filter.    
+ * @param[in,out] *S points to an instance of the floating-point FFT based FIR filter structure.    
+ * @param[in]     numTaps  Number of filter coefficients in the filter.    
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.    
+ * @param[out]    *pSpectra points to the buffer receiving the partition spectra.    
+ * @param[in]     *pState points to the state buffer.    
+ * @param[in]     partLen  partition length, 16, 32, 64, 128, 256, 512, 1024 or 2048.    
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>partLen</code> is not supported or <code>numTaps</code> is 0.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * With <code>numParts = (numTaps + partLen - 1) / partLen</code>,    
+ * <code>pSpectra</code> is of length <code>2*partLen*numParts</code> and    
+ * <code>pState</code> is of length <code>2*partLen*(numParts+2)</code>.    
+ * <code>pState</code> is used as work buffer to compute the spectra.    
+ */
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pSpectra,
+  float32_t * pState,
+  uint16_t partLen)
+{
+  uint32_t numParts, part, tap, i;               /* Loop counters */
+  arm_status status;
+
+  if(numTaps == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The real FFT is twice as long as a partition */
+  status = arm_rfft_fast_init_f32(&S->rfft, 2u * partLen);
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  numParts = (numTaps + (partLen - 1u)) / partLen;
+
+  S->numTaps = numTaps;
+  S->partLen = partLen;
+  S->numParts = (uint16_t) numParts;
+  S->stateIndex = 0u;
+  S->pCoeffs = pSpectra;
+  S->pState = pState;
+
+  /* Spectrum of each partition of b[n], zero padded to the FFT length */
+  for (part = 0u; part < numParts; part++)
+  {
+    for (i = 0u; i < partLen; i++)
+    {
+      tap = (part * partLen) + i;
+      pState[i] = (tap < numTaps) ? pCoeffs[numTaps - 1u - tap] : 0.0f;
+    }
+    memset(pState + partLen, 0, partLen * sizeof(float32_t));
+
+    arm_rfft_fast_f32(&S->rfft, pState, pSpectra + (part * 2u * partLen), 0u);
+  }
+
+  /* Clear state buffer and the size of state buffer is 2*partLen*(numParts+2) */
+  memset(pState, 0, (2u * partLen * (numParts + 2u)) * sizeof(float32_t));
+
+  return (status);
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
@@ -0,0 +1,203 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_init_q31.c    
+*    
+* Description:  Q31 FFT based FIR filter initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the Q31 FFT based FIR filter.    
+ * @param[in,out] *S points to an instance of the Q31 FFT based FIR filter structure.    
+ * @param[in]     numTaps  Number of filter coefficients in the filter.    
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.    
+ * @param[out]    *pSpectra points to the buffer receiving the partition spectra.    
+ * @param[in]     *pState points to the state buffer.    
+ * @param[in]     partLen  partition length, 8, 16, 32, 64, 128, 256, 512, 1024 or 2048.    
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>partLen</code> is not supported or <code>numTaps</code> is 0.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * With <code>numParts = (numTaps + partLen - 1) / partLen</code>,    
+ * <code>pSpectra</code> is of length <code>2*(partLen+1)*numParts</code> and    
+ * <code>pState</code> is of length <code>5*partLen+2*(partLen+1)*numParts</code>.    
+ * <code>pState</code> is used as work buffer to compute the spectra.    
+ * \par    
+ * Each partition is scaled up by its headroom before the transform and the spectrum is scaled back afterwards,    
+ * so the small coefficients at the end of long impulse responses keep their precision.    
+ */
+
+arm_status arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pSpectra,
+  q31_t * pState,
+  uint16_t partLen)
+{
+  uint32_t specLen = 2u * (partLen + 1u);        /* Bins kept for each partition */
+  uint32_t numParts, part, tap, i;               /* Loop counters */
+  uint32_t fftLog2, gain;                        /* log2 of the FFT length, headroom of a partition */
+  q31_t *pWork = pState + partLen;               /* Complex FFT buffer */
+  q31_t coeff, maxAbs;                           /* Temporary variables */
+
+  if(numTaps == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  The complex FFT is twice as long as a partition */
+  switch (partLen)
+  {
+  case 2048u:
+    S->pCfft = &arm_cfft_sR_q31_len4096;
+    fftLog2 = 12u;
+    break;
+  case 1024u:
+    S->pCfft = &arm_cfft_sR_q31_len2048;
+    fftLog2 = 11u;
+    break;
+  case 512u:
+    S->pCfft = &arm_cfft_sR_q31_len1024;
+    fftLog2 = 10u;
+    break;
+  case 256u:
+    S->pCfft = &arm_cfft_sR_q31_len512;
+    fftLog2 = 9u;
+    break;
+  case 128u:
+    S->pCfft = &arm_cfft_sR_q31_len256;
+    fftLog2 = 8u;
+    break;
+  case 64u:
+    S->pCfft = &arm_cfft_sR_q31_len128;
+    fftLog2 = 7u;
+    break;
+  case 32u:
+    S->pCfft = &arm_cfft_sR_q31_len64;
+    fftLog2 = 6u;
+    break;
+  case 16u:
+    S->pCfft = &arm_cfft_sR_q31_len32;
+    fftLog2 = 5u;
+    break;
+  case 8u:
+    S->pCfft = &arm_cfft_sR_q31_len16;
+    fftLog2 = 4u;
+    break;
+  default:
+    /*  Reporting argument error if partLen is not valid value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  numParts = (numTaps + (partLen - 1u)) / partLen;
+
+  S->numTaps = numTaps;
+  S->partLen = partLen;
+  S->numParts = (uint16_t) numParts;
+  S->stateIndex = 0u;
+  S->fftLog2 = (uint8_t) fftLog2;
+  S->pCoeffs = pSpectra;
+  S->pState = pState;
+
+  for (part = 0u; part < numParts; part++)
+  {
+    /* Largest coefficient of the partition */
+    maxAbs = 0;
+    for (i = 0u; i < partLen; i++)
+    {
+      tap = (part * partLen) + i;
+      if(tap < numTaps)
+      {
+        coeff = pCoeffs[numTaps - 1u - tap];
+        coeff = (coeff > 0) ? coeff : (q31_t)__QSUB(0, coeff);
+        maxAbs = (coeff > maxAbs) ? coeff : maxAbs;
+      }
+    }
+
+    /* The FFT scales down by its length, scale up by as much of it as the coefficients allow */
+    gain = 0u;
+    while((gain < fftLog2) && (maxAbs < 0x40000000))
+    {
+      maxAbs <<= 1;
+      gain++;
+    }
+
+    /* Partition of b[n] as complex samples, zero padded to the FFT length */
+    memset(pWork, 0, (4u * partLen) * sizeof(q31_t));
+    for (i = 0u; i < partLen; i++)
+    {
+      tap = (part * partLen) + i;
+      if(tap < numTaps)
+      {
+        pWork[2u * i] = pCoeffs[numTaps - 1u - tap] << gain;
+      }
+    }
+
+    arm_cfft_q31(S->pCfft, pWork, 0u, 1u);
+
+    /* Keep the first half, at the scale of the unnormalized transform */
+    for (i = 0u; i < specLen; i++)
+    {
+      pSpectra[(part * specLen) + i] = clip_q63_to_q31((q63_t) pWork[i] << (fftLog2 - gain));
+    }
+  }
+
+  /* Clear state buffer and the size of state buffer is 5*partLen+2*(partLen+1)*numParts */
+  memset(pState, 0, ((5u * partLen) + (specLen * numParts)) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
@@ -0,0 +1,170 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_q31.c    
+*    
+* Description:  Q31 FFT based FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 FFT based FIR filter.    
+ * @param[in,out] *S points to an instance of the Q31 FFT based FIR filter structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data.    
+ * @param[in]  blockSize number of samples to process per call, a multiple of <code>partLen</code>.    
+ * @return     none.    
+ *    
+ * \par    
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is transformed with <code>arm_cfft_q31()</code>, which scales it down by the FFT length    
+ * <code>2*partLen</code> to avoid overflows. The products with the partition spectra are summed in    
+ * 64-bit accumulators for each frequency bin, so there is no rounding between the partitions, and saturated    
+ * to 1.31 format. After the inverse FFT the output is scaled back up by the FFT length with saturation.    
+ * The output therefore has <code>31 - log2(2*partLen)</code> significant bits, e.g. 22 bits for    
+ * <code>partLen</code> 256.    
+ * \par    
+ * As for <code>arm_fir_q31()</code>, the sum of the absolute values of the coefficients must not exceed 1    
+ * to avoid saturation of the partition spectra or of the output.    
+ */
+
+void arm_fir_fft_q31(
+  arm_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partLen = S->partLen;                 /* Samples per partition */
+  uint32_t fftLen = 2u * partLen;                /* Complex FFT length */
+  uint32_t specLen = 2u * (partLen + 1u);        /* Bins 0 to partLen of a spectrum, the others are conjugates */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  uint32_t shift = S->fftLog2;                   /* Gain restored after the inverse FFT */
+  q31_t *pPrev = S->pState;                      /* Previous block of input samples */
+  q31_t *pWork = pPrev + partLen;                /* Complex FFT buffer of fftLen bins */
+  q31_t *pDelay = pWork + (2u * fftLen);         /* Frequency-domain delay line */
+  q31_t *pNewest, *pX, *pH;                      /* Temporary pointers to the spectra */
+  q63_t sumRe, sumIm;                            /* Accumulators */
+  q31_t xRe, xIm, hRe, hIm, in;                  /* Temporary variables */
+  uint32_t blkCnt, part, k;                      /* Loop counters */
+
+  blkCnt = blockSize / partLen;
+
+  while(blkCnt > 0u)
+  {
+    /* Real input as complex samples, the previous block followed by the new one */
+    for (k = 0u; k < partLen; k++)
+    {
+      pWork[2u * k] = pPrev[k];
+      pWork[(2u * k) + 1u] = 0;
+      pWork[2u * (partLen + k)] = pSrc[k];
+      pWork[(2u * (partLen + k)) + 1u] = 0;
+    }
+
+    arm_cfft_q31(S->pCfft, pWork, 0u, 1u);
+
+    /* The spectrum of a real signal is symmetric, keep the first half in the delay line */
+    pNewest = pDelay + (S->stateIndex * specLen);
+    arm_copy_q31(pWork, pNewest, specLen);
+
+    /* Multiply each partition spectrum with the input spectrum delayed by as many blocks.    
+     ** The partitions are the inner loop so that each bin is summed in 64 bits. */
+    for (k = 0u; k < specLen; k += 2u)
+    {
+      pX = pNewest + k;
+      pH = S->pCoeffs + k;
+      sumRe = 0;
+      sumIm = 0;
+
+      for (part = 0u; part < numParts; part++)
+      {
+        xRe = pX[0];
+        xIm = pX[1];
+        hRe = pH[0];
+        hIm = pH[1];
+        sumRe += ((q63_t) xRe * hRe) - ((q63_t) xIm * hIm);
+        sumIm += ((q63_t) xRe * hIm) + ((q63_t) xIm * hRe);
+
+        /* Step back one block in the delay line, wrapping around */
+        pX = (pX < pDelay + specLen) ? pX + ((numParts - 1u) * specLen) : pX - specLen;
+        pH += specLen;
+      }
+
+      pWork[k] = clip_q63_to_q31(sumRe >> 31);
+      pWork[k + 1u] = clip_q63_to_q31(sumIm >> 31);
+    }
+
+    /* Rebuild the upper half from the complex conjugates */
+    for (k = 1u; k < partLen; k++)
+    {
+      pWork[2u * (fftLen - k)] = pWork[2u * k];
+      pWork[(2u * (fftLen - k)) + 1u] = -pWork[(2u * k) + 1u];
+    }
+
+    arm_cfft_q31(S->pCfft, pWork, 1u, 1u);
+
+    /* The output is the real part of the second half. Read the input before    
+     ** writing the output, they may be the same buffer. */
+    for (k = 0u; k < partLen; k++)
+    {
+      in = pSrc[k];
+      pDst[k] = clip_q63_to_q31((q63_t) pWork[2u * (partLen + k)] << shift);
+      pPrev[k] = in;
+    }
+
+    /* Advance the delay line */
+    S->stateIndex = (S->stateIndex + 1u == numParts) ? 0u : S->stateIndex + 1u;
+
+    pSrc += partLen;
+    pDst += partLen;
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
@@ -0,0 +1,214 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_interleaved_f32.c    
+*    
+* Description:  Floating-point multichannel interleaved FIR filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIRInterleaved Multichannel Interleaved Finite Impulse Response (FIR) Filters    
+ *    
+ * These functions filter <code>numChans</code> channels stored interleaved, as received    
+ * from an I2S or PDMA buffer, with the same FIR filter:    
+ * <pre>    
+ *     {x0[0], x1[0], ..., xC[0], x0[1], x1[1], ..., xC[1], ...}    
+ * </pre>    
+ * where <code>xc[n]</code> is sample <code>n</code> of channel <code>c</code>.    
+ * The output is interleaved the same way. Each channel is filtered as by the single-channel    
+ * <code>arm_fir_f32()</code>, <code>arm_fir_q31()</code> or <code>arm_fir_q15()</code>, so    
+ * the frames do not need to be split into one buffer per channel and merged afterwards.    
+ *    
+ * \par Algorithm    
+ * Channels are processed by groups of 4 sharing every coefficient load: for each tap the    
+ * coefficient is read once and multiplies the sample of the 4 channels, which are adjacent    
+ * in memory. The remaining 1 to 3 channels are processed one by one.    
+ * <code>blockSize</code> is the number of frames to process, a frame being one sample of    
+ * every channel, and <code>pSrc</code> and <code>pDst</code> both hold    
+ * <code>blockSize*numChans</code> values.    
+ *    
+ * \par    
+ * The coefficients are stored in time reversed order, as for the single-channel FIR filters:    
+ * <pre>    
+ *     {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}    
+ * </pre>    
+ * The state buffer holds the last <code>numTaps-1</code> frames and the frames of the current    
+ * block, <code>(numTaps+blockSize-1)*numChans</code> values.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables for a filter are stored together in an instance data    
+ * structure. A separate instance structure must be defined for each set of channels.    
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.    
+ * The instance structure is initialized by <code>arm_fir_interleaved_init_f32()</code>,    
+ * <code>arm_fir_interleaved_init_q31()</code> or <code>arm_fir_interleaved_init_q15()</code>.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The Q31 and Q15 functions compute each output as <code>arm_fir_q31()</code> and    
+ * <code>arm_fir_q15()</code> do, in a 64-bit accumulator: the Q31 result is truncated to    
+ * 1.31 format and the Q15 result is saturated to 1.15 format.    
+ */
+
+/**    
+ * @addtogroup FIRInterleaved    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point multichannel interleaved FIR filter.    
+ * @param[in]  *S points to an instance of the floating-point interleaved FIR filter structure.    
+ * @param[in]  *pSrc points to the block of interleaved input frames.    
+ * @param[out] *pDst points to the block of interleaved output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return none.    
+ */
+
+void arm_fir_interleaved_f32(
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficients */
+  float32_t acc0, acc1, acc2, acc3;              /* Accumulators */
+  float32_t c0;                                  /* Coefficient shared by the channels */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t blkCnt, chCnt, tapCnt;                /* Loop counters */
+
+  /* S->pState buffer contains previous (numTaps - 1) frames, the new frames are appended */
+  pStateCurnt = pState + ((numTaps - 1u) * numChans);
+  arm_copy_f32(pSrc, pStateCurnt, blockSize * numChans);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Groups of 4 channels share the coefficient loads */
+    chCnt = numChans >> 2u;
+    px = pState;
+
+    while(chCnt > 0u)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      do
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n], for 4 channels */
+        c0 = *pb++;
+        acc0 += c0 * px[0];
+        acc1 += c0 * px[1];
+        acc2 += c0 * px[2];
+        acc3 += c0 * px[3];
+
+        /* Same channels in the next frame */
+        px += numChans;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+
+      /* Next 4 channels of the same output frame */
+      px -= (numTaps * numChans) - 4u;
+
+      chCnt--;
+    }
+
+    /* Remaining 1 to 3 channels */
+    chCnt = numChans & 0x3u;
+
+    while(chCnt > 0u)
+    {
+      acc0 = 0.0f;
+
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      do
+      {
+        acc0 += *pb++ * *px;
+        px += numChans;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = acc0;
+
+      px -= (numTaps * numChans) - 1u;
+
+      chCnt--;
+    }
+
+    /* Advance the state pointer by one frame for the next output frame */
+    pState += numChans;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  pStateCurnt = S->pState;
+  tapCnt = (numTaps - 1u) * numChans;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    tapCnt--;
+  }
+}
+
+/**    
+ * @} end of FIRInterleaved group    
+ */
@@ -0,0 +1,172 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_interleaved_q15.c    
+*    
+* Description:  Q15 multichannel interleaved FIR filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIRInterleaved    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q15 multichannel interleaved FIR filter.    
+ * @param[in]  *S points to an instance of the Q15 interleaved FIR filter structure.    
+ * @param[in]  *pSrc points to the block of interleaved input frames.    
+ * @param[out] *pDst points to the block of interleaved output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return none.    
+ */
+
+void arm_fir_interleaved_q15(
+  const arm_fir_interleaved_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficients */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q15_t c0;                                      /* Coefficient shared by the channels */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients */
+  uint32_t numChans = S->numChans;               /* Number of interleaved channels */
+  uint32_t blkCnt, chCnt, tapCnt;                /* Loop counters */
+
+  /* S->pState buffer contains previous (numTaps - 1) frames, the new frames are appended */
+  pStateCurnt = pState + ((numTaps - 1u) * numChans);
+  arm_copy_q15(pSrc, pStateCurnt, blockSize * numChans);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Groups of 4 channels share the coefficient loads */
+    chCnt = numChans >> 2u;
+    px = pState;
+
+    while(chCnt > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      do
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n], for 4 channels */
+        c0 = *pb++;
+        acc0 += (q63_t) c0 * px[0];
+        acc1 += (q63_t) c0 * px[1];
+        acc2 += (q63_t) c0 * px[2];
+        acc3 += (q63_t) c0 * px[3];
+
+        /* Same channels in the next frame */
+        px += numChans;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((acc2 >> 15), 16));
+      *pDst++ = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+      /* Next 4 channels of the same output frame */
+      px -= (numTaps * numChans) - 4u;
+
+      chCnt--;
+    }
+
+    /* Remaining 1 to 3 channels */
+    chCnt = numChans & 0x3u;
+
+    while(chCnt > 0u)
+    {
+      acc0 = 0;
+
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      do
+      {
+        acc0 += (q63_t) *pb++ * *px;
+        px += numChans;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+      px -= (numTaps * numChans) - 1u;
+
+      chCnt--;
+    }
+
+    /* Advance the state pointer by one frame for the next output frame */
+    pState += numChans;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  pStateCurnt = S->pState;
+  tapCnt = (numTaps - 1u) * numChans;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    tapCnt--;
+  }
+}
+
+/**    
+ * @} end of FIRInterleaved group    
+ */
@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_init_f32.c    
+*    
+* Description:  Floating-point Kalman filter initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @param[in]     numStates number of states, <code>N</code>.    
+ * @param[in]     numMeas number of measurements, <code>M</code>.    
+ * @param[in,out] *pX points to the state estimate, <code>N</code> values.    
+ * @param[in,out] *pP points to the covariance of the state estimate, <code>N x N</code>.    
+ * @param[in]     *pF points to the state transition matrix, <code>N x N</code>.    
+ * @param[in]     *pQ points to the covariance of the process noise, <code>N x N</code>.    
+ * @param[in]     *pH points to the measurement matrix, <code>M x N</code>.    
+ * @param[in]     *pR points to the covariance of the measurement noise, <code>M x M</code>.    
+ * @param[in]     *pWork points to a work buffer of <code>N*N + M*N + M*M + M</code> values.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * All the matrices are stored row by row, and the filter only keeps pointers to them:    
+ * the model can be changed between two calls, for example to update <code>F</code> with    
+ * the time step. <code>pX</code> and <code>pP</code> hold the initial estimate and are    
+ * updated in place by <code>arm_kalman_predict_f32()</code> and <code>arm_kalman_update_f32()</code>.    
+ */
+
+void arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pWork)
+{
+  /* Assign the sizes */
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+
+  /* Assign the state estimate and its covariance */
+  S->pX = pX;
+  S->pP = pP;
+
+  /* Assign the model matrices */
+  S->pF = pF;
+  S->pQ = pQ;
+  S->pH = pH;
+  S->pR = pR;
+
+  /* Assign the work buffer */
+  S->pWork = pWork;
+}
+
+/**    
+ * @} end of Kalman group    
+ */
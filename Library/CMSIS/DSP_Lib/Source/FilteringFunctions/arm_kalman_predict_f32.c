@@ -0,0 +1,128 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_predict_f32.c    
+*    
+* Description:  Floating-point Kalman filter prediction step.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief Prediction step of the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * Computes <code>x = F * x</code> and <code>P = F * P * F' + Q</code>.    
+ * Only the lower triangle of <code>P</code> is computed and it is mirrored to the upper    
+ * triangle, so <code>P</code> stays exactly symmetric.    
+ */
+
+void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S)
+{
+  float32_t *pX = S->pX;                         /* State estimate */
+  float32_t *pP = S->pP;                         /* Covariance of the estimate */
+  float32_t *pF = S->pF;                         /* State transition matrix */
+  float32_t *pQ = S->pQ;                         /* Covariance of the process noise */
+  float32_t *pT = S->pWork;                      /* F * P, N x N */
+  float32_t *pFi, *pFj, *pTi;                    /* Rows of F and T */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = S->numStates;                     /* Number of states */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_matrix_instance_f32 F, P, T;               /* Matrix instances */
+
+  /* x = F * x, in the work buffer first */
+  pFi = pF;
+
+  for (i = 0u; i < n; i++)
+  {
+    sum = 0.0f;
+
+    for (k = 0u; k < n; k++)
+    {
+      sum += pFi[k] * pX[k];
+    }
+
+    pT[i] = sum;
+    pFi += n;
+  }
+
+  arm_copy_f32(pT, pX, n);
+
+  /* T = F * P */
+  arm_mat_init_f32(&F, n, n, pF);
+  arm_mat_init_f32(&P, n, n, pP);
+  arm_mat_init_f32(&T, n, n, pT);
+  arm_mat_mult_f32(&F, &P, &T);
+
+  /* P = T * F' + Q, lower triangle mirrored to the upper triangle */
+  pTi = pT;
+
+  for (i = 0u; i < n; i++)
+  {
+    pFj = pF;
+
+    for (j = 0u; j <= i; j++)
+    {
+      sum = pQ[(i * n) + j];
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += pTi[k] * pFj[k];
+      }
+
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+      pFj += n;
+    }
+
+    pTi += n;
+  }
+}
+
+/**    
+ * @} end of Kalman group    
+ */
@@ -0,0 +1,209 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_update_f32.c    
+*    
+* Description:  Floating-point Kalman filter update step.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup Kalman Kalman Filter    
+ *    
+ * Linear Kalman filter with <code>N</code> states and <code>M</code> measurements:    
+ * <pre>    
+ *     x[k] = F * x[k-1] + w,    w of covariance Q    
+ *     z[k] = H * x[k] + v,      v of covariance R    
+ * </pre>    
+ * <code>arm_kalman_predict_f32()</code> propagates the estimate <code>x</code> and its    
+ * covariance <code>P</code> by one step of the model, and <code>arm_kalman_update_f32()</code>    
+ * corrects them with a measurement <code>z</code>. Both are called as often as needed,    
+ * for example several predictions between two measurements.    
+ *    
+ * \par Algorithm    
+ * The textbook update computes the gain <code>K = P * H' * inv(S)</code>, with    
+ * <code>S = H * P * H' + R</code>. Here <code>S</code> is decomposed as <code>S = L * L'</code>    
+ * with <code>arm_mat_cholesky_f32()</code>, and with <code>W = inv(L) * H * P</code> and    
+ * <code>u = inv(L) * (z - H * x)</code>, obtained by triangular solves:    
+ * <pre>    
+ *     x = x + W' * u    
+ *     P = P - W' * W    
+ * </pre>    
+ * No inverse is computed, the triangular solves are cheaper and more accurate than    
+ * <code>arm_mat_inverse_f32()</code>, and <code>P</code> is kept exactly symmetric.    
+ * If <code>S</code> is not positive definite, the update is rejected and the state is    
+ * not changed.    
+ *    
+ * \par Instance Structure    
+ * The matrices of the model are separate arrays referenced by the instance structure,    
+ * which is initialized by <code>arm_kalman_init_f32()</code>. The instance also points to a    
+ * work buffer of <code>N*N + M*N + M*M + M</code> values, which can be shared between    
+ * filters that do not run concurrently.    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief Update step of the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @param[in]     *pZ points to the measurement, <code>M</code> values.    
+ * @return The function returns <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the covariance    
+ * of the innovation is not positive definite, and the state is not changed.    
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ)
+{
+  float32_t *pX = S->pX;                         /* State estimate */
+  float32_t *pP = S->pP;                         /* Covariance of the estimate */
+  float32_t *pH = S->pH;                         /* Measurement matrix */
+  float32_t *pR = S->pR;                         /* Covariance of the measurement noise */
+  uint16_t n = S->numStates;                     /* Number of states */
+  uint16_t m = S->numMeas;                       /* Number of measurements */
+  float32_t *pHP = S->pWork + (n * n);           /* H * P then W, M x N */
+  float32_t *pS = pHP + (m * n);                 /* S then L, M x M */
+  float32_t *pY = pS + (m * m);                  /* Innovation then u, M values */
+  float32_t *pHi, *pHj, *pHPi;                   /* Rows of H and H * P */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_matrix_instance_f32 H, P, HP, L, Y;        /* Matrix instances */
+  arm_status status;                             /* status of the update */
+
+  /* y = z - H * x */
+  pHi = pH;
+
+  for (i = 0u; i < m; i++)
+  {
+    sum = pZ[i];
+
+    for (k = 0u; k < n; k++)
+    {
+      sum -= pHi[k] * pX[k];
+    }
+
+    pY[i] = sum;
+    pHi += n;
+  }
+
+  /* HP = H * P */
+  arm_mat_init_f32(&H, m, n, pH);
+  arm_mat_init_f32(&P, n, n, pP);
+  arm_mat_init_f32(&HP, m, n, pHP);
+  arm_mat_mult_f32(&H, &P, &HP);
+
+  /* S = HP * H' + R, lower triangle only */
+  pHPi = pHP;
+
+  for (i = 0u; i < m; i++)
+  {
+    pHj = pH;
+
+    for (j = 0u; j <= i; j++)
+    {
+      sum = pR[(i * m) + j];
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += pHPi[k] * pHj[k];
+      }
+
+      pS[(i * m) + j] = sum;
+      pHj += n;
+    }
+
+    pHPi += n;
+  }
+
+  /* S = L * L', in place */
+  arm_mat_init_f32(&L, m, m, pS);
+  status = arm_mat_cholesky_f32(&L, &L);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* W = inv(L) * HP and u = inv(L) * y, in place */
+  arm_mat_init_f32(&Y, m, 1u, pY);
+  arm_mat_solve_lower_triangular_f32(&L, &HP, &HP);
+  arm_mat_solve_lower_triangular_f32(&L, &Y, &Y);
+
+  /* x = x + W' * u */
+  for (i = 0u; i < n; i++)
+  {
+    sum = 0.0f;
+
+    for (k = 0u; k < m; k++)
+    {
+      sum += pHP[(k * n) + i] * pY[k];
+    }
+
+    pX[i] += sum;
+  }
+
+  /* P = P - W' * W, lower triangle mirrored to the upper triangle */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      sum = pP[(i * n) + j];
+
+      for (k = 0u; k < m; k++)
+      {
+        sum -= pHP[(k * n) + i] * pHP[(k * n) + j];
+      }
+
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of Kalman group    
+ */
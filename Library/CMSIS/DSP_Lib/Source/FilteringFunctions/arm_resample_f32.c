@@ -0,0 +1,210 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_resample_f32.c    
+*    
+* Description:  Floating-point arbitrary ratio resampler processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup Resample Arbitrary Ratio Resampler    
+ *    
+ * These functions convert the sample rate of a signal by any ratio, e.g. from 44.1 kHz to 48 kHz, for Q15, Q31 and    
+ * floating-point data types. Unlike the FIR decimators and interpolators, the ratio does not need to be an integer    
+ * and may be changed between calls, so that a stream can follow a clock that drifts against the local one.    
+ *    
+ * \par Algorithm:    
+ * The resampler is a polyphase filter with <code>L</code> phases. The prototype low-pass filter <code>b[n]</code>,    
+ * of length <code>numTaps = L*phaseLength</code>, is designed at <code>L</code> times the input sample rate.    
+ * Each output sample is at a fractional position <code>t</code> of the input. With <code>p + mu = frac(t) * L</code>,    
+ * where <code>p</code> is an integer and <code>0 <= mu < 1</code>, the output is interpolated linearly between    
+ * the phases <code>p</code> and <code>p+1</code>:    
+ * <pre>    
+ *    y(t) = (1 - mu) * y[p] + mu * y[p+1]    
+ *    y[p] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+(phaseLength-1)*L] * x[n-phaseLength+1]    
+ * </pre>    
+ * where <code>n</code> is the integer part of <code>t</code>. Both phases are computed in the same pass over    
+ * the input. The error of the linear interpolation falls with the square of <code>L</code>; 32 to 128 phases    
+ * give an error below the quantization noise of 16-bit audio.    
+ *    
+ * \par    
+ * The ratio is given by <code>step</code>, the number of input samples per output sample in unsigned 8.24 format,    
+ * e.g. <code>(uint32_t)(44100.0 / 48000.0 * 16777216.0)</code> to convert 44.1 kHz to 48 kHz.    
+ * <code>step</code> must be between 1 and <code>0x7FFFFFFF</code>. It is stored in the instance and may be    
+ * changed between calls, e.g. by a loop that keeps the fill level of a FIFO constant.    
+ * The resolution of 6e-8 is far finer than the drift of crystal oscillators.    
+ *    
+ * \par    
+ * The cutoff frequency of the prototype filter must be below half of the lower of the input and output sample rates.    
+ * Its gain at DC must be <code>L</code>, as for the FIR interpolators.    
+ * <code>pCoeffs</code> points to the coefficient array stored in time reversed order:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}    
+ * </pre>    
+ * The coefficient array is only read, so several instances, e.g. one per audio channel, may share it.    
+ *    
+ * \par    
+ * Each call consumes <code>blockSize</code> input samples and returns the number of output samples produced,    
+ * which varies from call to call. <code>pDst</code> must hold at least    
+ * <code>(blockSize * 16777216) / step + 1</code> samples.    
+ * <code>pState</code> points to a state array of size <code>phaseLength + blockSize - 1</code>.    
+ *    
+ * \par Instance Structure    
+ * The coefficients, state variables and position for a resampler are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each resampler.    
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.    
+ * There are separate instance structure declarations for each of the 3 supported data types.    
+ *    
+ * \par Initialization Functions    
+ * There is also an associated initialization function for each data type.    
+ * The initialization function performs the following operations:    
+ * - Sets the values of the internal structure fields.    
+ * - Zeros out the values in the state buffer.    
+ * - Checks to make sure that <code>numTaps</code> is a multiple of <code>L</code>.    
+ *    
+ * \par Fixed-Point Behavior    
+ * Care must be taken when using the fixed-point versions of the resampler functions.    
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.    
+ * Refer to the function specific documentation below for usage guidelines.    
+ */
+
+/**    
+ * @addtogroup Resample    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point arbitrary ratio resampler.    
+ * @param[in,out] *S points to an instance of the floating-point resampler structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data.    
+ * @param[in]  blockSize number of input samples to process.    
+ * @return     number of output samples written to <code>pDst</code>.    
+ */
+
+uint32_t arm_resample_f32(
+  arm_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0, acc1, x, mu;                   /* Accumulators and temporary variables */
+  uint32_t L = S->L;                             /* Number of phases */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t step = S->step;                       /* Input samples per output sample */
+  uint32_t frac = S->frac;                       /* Fractional input position */
+  uint32_t i = S->skip;                          /* Input sample of the next output */
+  uint32_t pos, phase, tapCnt, outCnt = 0u;      /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* Copy new input samples into the state buffer */
+  arm_copy_f32(pSrc, pState + (phaseLen - 1u), blockSize);
+
+  while(i < blockSize)
+  {
+    /* Split the position in L phases and the fraction between two phases */
+    pos = frac * L;
+    phase = pos >> 24;
+    mu = (float32_t) (pos & 0xFFFFFFu) * (1.0f / 16777216.0f);
+
+    /* Newest input sample used by the output */
+    px = pState + (i + phaseLen - 1u);
+
+    /* Coefficient b[phase], b[phase+1] is just before it in the time reversed array */
+    pb = pCoeffs + ((L * phaseLen) - 1u - phase);
+
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+
+    tapCnt = phaseLen - 1u;
+
+    while(tapCnt > 0u)
+    {
+      x = *px--;
+      acc0 += x * pb[0];
+      acc1 += x * pb[-1];
+      pb -= L;
+
+      tapCnt--;
+    }
+
+    /* The last tap of phase L is past the end of the filter */
+    x = *px;
+    acc0 += x * pb[0];
+    if(phase + 1u < L)
+    {
+      acc1 += x * pb[-1];
+    }
+
+    *pDst++ = acc0 + ((acc1 - acc0) * mu);
+    outCnt++;
+
+    /* Advance to the next output */
+    frac += step;
+    i += frac >> 24;
+    frac &= 0xFFFFFFu;
+  }
+
+  S->frac = frac;
+  S->skip = i - blockSize;
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  tapCnt = phaseLen - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pState++ = *px++;
+
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of Resample group    
+ */
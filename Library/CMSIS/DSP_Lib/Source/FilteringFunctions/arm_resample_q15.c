@@ -0,0 +1,160 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_resample_q15.c    
+*    
+* Description:  Q15 arbitrary ratio resampler processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Resample    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q15 arbitrary ratio resampler.    
+ * @param[in,out] *S points to an instance of the Q15 resampler structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data.    
+ * @param[in]  blockSize number of input samples to process.    
+ * @return     number of output samples written to <code>pDst</code>.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The function is implemented using a 64-bit internal accumulator for each phase.    
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.    
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.    
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.    
+ * After all additions have been performed, the accumulators are truncated to 34.15 format by discarding low 15 bits    
+ * and saturated to 1.15 format. The interpolation between the two phases is done in 1.15 format.    
+ */
+
+uint32_t arm_resample_q15(
+  arm_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t acc0, acc1;                              /* Accumulators */
+  q31_t x, mu, y0, y1;                           /* Temporary variables */
+  uint32_t L = S->L;                             /* Number of phases */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t step = S->step;                       /* Input samples per output sample */
+  uint32_t frac = S->frac;                       /* Fractional input position */
+  uint32_t i = S->skip;                          /* Input sample of the next output */
+  uint32_t pos, phase, tapCnt, outCnt = 0u;      /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* Copy new input samples into the state buffer */
+  arm_copy_q15(pSrc, pState + (phaseLen - 1u), blockSize);
+
+  while(i < blockSize)
+  {
+    /* Split the position in L phases and the fraction between two phases */
+    pos = frac * L;
+    phase = pos >> 24;
+    mu = (q15_t) ((pos & 0xFFFFFFu) >> 9);
+
+    /* Newest input sample used by the output */
+    px = pState + (i + phaseLen - 1u);
+
+    /* Coefficient b[phase], b[phase+1] is just before it in the time reversed array */
+    pb = pCoeffs + ((L * phaseLen) - 1u - phase);
+
+    acc0 = 0;
+    acc1 = 0;
+
+    tapCnt = phaseLen - 1u;
+
+    while(tapCnt > 0u)
+    {
+      x = *px--;
+      acc0 += (q31_t) x * pb[0];
+      acc1 += (q31_t) x * pb[-1];
+      pb -= L;
+
+      tapCnt--;
+    }
+
+    /* The last tap of phase L is past the end of the filter */
+    x = *px;
+    acc0 += (q31_t) x * pb[0];
+    if(phase + 1u < L)
+    {
+      acc1 += (q31_t) x * pb[-1];
+    }
+
+    y0 = (q15_t) __SSAT((acc0 >> 15), 16);
+    y1 = (q15_t) __SSAT((acc1 >> 15), 16);
+    *pDst++ = (q15_t) (y0 + (((y1 - y0) * mu) >> 15));
+    outCnt++;
+
+    /* Advance to the next output */
+    frac += step;
+    i += frac >> 24;
+    frac &= 0xFFFFFFu;
+  }
+
+  S->frac = frac;
+  S->skip = i - blockSize;
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  px = pState + blockSize;
+  tapCnt = phaseLen - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pState++ = *px++;
+
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of Resample group    
+ */
@@ -0,0 +1,168 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_cholesky_f32.c    
+*    
+* Description:  Floating-point Cholesky decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixChol Cholesky and LDLT Decompositions    
+ *    
+ * Decomposes a symmetric positive definite matrix <code>A</code> into    
+ * <code>A = L * L'</code> (Cholesky) or <code>A = L * D * L'</code> (LDLT),    
+ * where <code>L</code> is lower triangular and <code>D</code> is diagonal.    
+ *    
+ * A linear system <code>A * X = B</code> is then solved with two triangular solves,    
+ * see \ref MatrixSolve. This is about three times faster than computing the inverse of    
+ * <code>A</code> with <code>arm_mat_inverse_f32()</code> and multiplying by it, and more    
+ * accurate, since the error of the decomposition grows with the square root of the condition    
+ * number of <code>A</code> only. Covariance matrices, such as the ones of a Kalman filter,    
+ * are symmetric positive definite.    
+ *    
+ * \par Algorithm    
+ * The rows of <code>L</code> are computed from the first to the last (Cholesky-Banachiewicz).    
+ * Each element is a dot product of two rows of <code>L</code> already computed, so the inner    
+ * loops read contiguous memory.    
+ * Only the lower triangle of the input matrix is read, and the output matrix may be the    
+ * input matrix. The upper triangle of the output is set to zero.    
+ * If a diagonal element of <code>L</code> is not strictly positive, the matrix is not positive    
+ * definite and the functions return <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.    
+ *    
+ * \par    
+ * <code>arm_mat_ldlt_f32()</code> has no square root, and <code>L</code> has a unit diagonal.    
+ * It also decomposes symmetric indefinite matrices, as long as no element of <code>D</code>    
+ * is zero. There is no pivoting.    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point Cholesky decomposition.    
+ * @param[in]       *pSrc points to the symmetric positive definite input matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, may be <code>pSrc</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size    
+ * of the output matrix does not match the size of the input matrix.    
+ * If the input matrix is not positive definite, then the function returns    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* Rows i and j of L */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pSrc->numRows;                    /* Size of the matrix */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) ||
+     (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    pLi = pOut;
+
+    for (i = 0u; i < n; i++)
+    {
+      pLj = pOut;
+
+      for (j = 0u; j <= i; j++)
+      {
+        /* L(i,j) = (A(i,j) - L(i,0)*L(j,0) - ... - L(i,j-1)*L(j,j-1)) / L(j,j) */
+        sum = pIn[(i * n) + j];
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= pLi[k] * pLj[k];
+        }
+
+        if(j < i)
+        {
+          pLi[j] = sum / pLj[j];
+        }
+        else
+        {
+          /* L(i,i) = sqrt(A(i,i) - L(i,0)^2 - ... - L(i,i-1)^2), NaN fails too */
+          if(!(sum > 0.0f))
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+          arm_sqrt_f32(sum, &pLi[i]);
+        }
+
+        pLj += n;
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+
+      pLi += n;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
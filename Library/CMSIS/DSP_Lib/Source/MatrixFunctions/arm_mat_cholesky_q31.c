@@ -0,0 +1,185 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_cholesky_q31.c    
+*    
+* Description:  Q31 Cholesky decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/* Square root of a positive 2.62 value, in 1.31 format */
+static q31_t sqrt_q62(
+  q63_t in)
+{
+  uint64_t val = (uint64_t) in;
+  uint64_t root = 0u;
+  uint64_t bit = (uint64_t) 1u << 62;
+
+  while(bit > val)
+  {
+    bit >>= 2;
+  }
+
+  while(bit != 0u)
+  {
+    if(val >= root + bit)
+    {
+      val -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return ((q31_t) clip_q63_to_q31((q63_t) root));
+}
+
+/**    
+ * @brief Q31 Cholesky decomposition.    
+ * @param[in]       *pSrc points to the symmetric positive definite input matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, may be <code>pSrc</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size    
+ * of the output matrix does not match the size of the input matrix.    
+ * If the input matrix is not positive definite, then the function returns    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The elements of <code>L</code> are bounded by the square root of the diagonal of    
+ * <code>A</code>, so they cannot overflow. The dot products use a 64-bit accumulator in    
+ * 2.62 format, the square roots are exact to 1 LSB and the divisions are saturated.    
+ * The precision of <code>L</code> is about <code>2^-31 / L(j,j)</code>: scale <code>A</code>    
+ * so that its diagonal is as close to 1 as possible.    
+ */
+
+arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pIn = pSrc->pData;                      /* input data matrix pointer */
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q31_t *pLi, *pLj;                              /* Rows i and j of L */
+  q63_t sum;                                     /* Accumulator */
+  uint16_t n = pSrc->numRows;                    /* Size of the matrix */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) ||
+     (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    pLi = pOut;
+
+    for (i = 0u; i < n; i++)
+    {
+      pLj = pOut;
+
+      for (j = 0u; j <= i; j++)
+      {
+        /* L(i,j) = (A(i,j) - L(i,0)*L(j,0) - ... - L(i,j-1)*L(j,j-1)) / L(j,j), in 2.62 format */
+        sum = (q63_t) pIn[(i * n) + j] << 31;
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= (q63_t) pLi[k] * pLj[k];
+        }
+
+        if(j < i)
+        {
+          /* 2.62 / 1.31 gives 1.31 */
+          pLi[j] = (q31_t) clip_q63_to_q31(sum / pLj[j]);
+        }
+        else
+        {
+          if(sum <= 0)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+          pLi[i] = sqrt_q62(sum);
+
+          /* Rounded down to zero */
+          if(pLi[i] == 0)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+        }
+
+        pLj += n;
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0;
+      }
+
+      pLi += n;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -0,0 +1,142 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_ldlt_f32.c    
+*    
+* Description:  Floating-point LDLT decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point LDLT decomposition.    
+ * @param[in]       *pSrc points to the symmetric input matrix structure    
+ * @param[out]      *pDstL points to the output matrix structure of the unit lower triangular matrix, may be <code>pSrc</code>    
+ * @param[out]      *pDstD points to the diagonal of <code>D</code>, <code>numRows</code> values    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size    
+ * of the output matrix does not match the size of the input matrix.    
+ * If an element of <code>D</code> is zero, then the function returns    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDstL,
+  float32_t * pDstD)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDstL->pData;                /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* Rows i and j of L */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pSrc->numRows;                    /* Size of the matrix */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDstL->numRows != pDstL->numCols) ||
+     (pSrc->numRows != pDstL->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    pLi = pOut;
+
+    for (i = 0u; i < n; i++)
+    {
+      pLj = pOut;
+
+      for (j = 0u; j <= i; j++)
+      {
+        /* L(i,j) * D(j) = A(i,j) - L(i,0)*D(0)*L(j,0) - ... - L(i,j-1)*D(j-1)*L(j,j-1) */
+        sum = pIn[(i * n) + j];
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= pLi[k] * pDstD[k] * pLj[k];
+        }
+
+        if(j < i)
+        {
+          pLi[j] = sum / pDstD[j];
+        }
+        else
+        {
+          /* NaN fails too */
+          if((sum == 0.0f) || (sum != sum))
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+          pDstD[i] = sum;
+          pLi[i] = 1.0f;
+        }
+
+        pLj += n;
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+
+      pLi += n;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -58,6 +58,9 @@
  * When matrix size checking is enabled, the functions check: (1) that the inner dimensions of    
  * <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output    
  * matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.    
+ *    
+ * On Cortex-M3 and Cortex-M4 the floating-point and Q31 functions compute the output in blocks    
+ * of 2 x 2, so each value loaded from the inputs is used by two multiply-accumulates.    
  */
 
 
@@ -94,8 +97,10 @@ arm_status arm_mat_mult_f32(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  float32_t in1, in2, in3, in4;
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  float32_t *pInB;                               /* input data matrix pointer B */
+  float32_t a0, a1, b0, b1;                      /* Temporary variables */
+  float32_t sum01, sum10, sum11;                 /* Accumulators of the other outputs of a block */
+  uint16_t col, row, colCnt;                     /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -113,86 +118,134 @@ arm_status arm_mat_mult_f32(
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
-    /* row loop */
-    do
-    {
-      /* Output pointer is set to starting address of the row being processed */
-      px = pOut + i;
+    /* The output is computed in blocks of 2 x 2. Each pair of values read from the    
+     ** rows of pSrcA and the columns of pSrcB is used by 4 multiply-accumulates,    
+     ** instead of 1 when the outputs are computed one by one. */
+    px = pOut;
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
+    /* row loop, 2 rows of pSrcA at a time */
+    row = numRowsA >> 1u;
 
-      /* For every row wise process, the pIn2 pointer is set    
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
+    while(row > 0u)
+    {
+      pInB = pSrcB->pData;
 
-      j = 0u;
+      /* column loop, 2 columns of pSrcB at a time */
+      col = numColsB >> 1u;
 
-      /* column loop */
-      do
+      while(col > 0u)
       {
-        /* Set the variable sum, that acts as accumulator, to zero */
         sum = 0.0f;
+        sum01 = 0.0f;
+        sum10 = 0.0f;
+        sum11 = 0.0f;
 
-        /* Initiate the pointer pIn1 to point to the starting address of the column being processed */
         pIn1 = pInA;
+        pIn2 = pInB;
+        colCnt = numColsA;
 
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2u;
-
-        /* matrix multiplication        */
         while(colCnt > 0u)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          in3 = *pIn2;
-          pIn2 += numColsB;
-          in1 = pIn1[0];
-          in2 = pIn1[1];
-          sum += in1 * in3;
-          in4 = *pIn2;
+          /* c(m,n) = a(m,1)*b(1,n) + a(m,2)*b(2,n) + .... for the rows m, m+1 and columns n, n+1 */
+          a0 = pIn1[0];
+          a1 = pIn1[numColsA];
+          b0 = pIn2[0];
+          b1 = pIn2[1];
+          pIn1++;
           pIn2 += numColsB;
-          sum += in2 * in4;
 
-          in3 = *pIn2;
-          pIn2 += numColsB;
-          in1 = pIn1[2];
-          in2 = pIn1[3];
-          sum += in1 * in3;
-          in4 = *pIn2;
+          sum += a0 * b0;
+          sum01 += a0 * b1;
+          sum10 += a1 * b0;
+          sum11 += a1 * b1;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Store the 2 x 2 block in the destination buffer */
+        px[0] = sum;
+        px[1] = sum01;
+        px[numColsB] = sum10;
+        px[numColsB + 1u] = sum11;
+        px += 2u;
+
+        /* Next 2 columns of pSrcB */
+        pInB += 2u;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* If the columns of pSrcB is not a multiple of 2, compute the last column of the 2 rows */
+      if((numColsB & 1u) != 0u)
+      {
+        sum = 0.0f;
+        sum10 = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+        colCnt = numColsA;
+
+        while(colCnt > 0u)
+        {
+          b0 = *pIn2;
           pIn2 += numColsB;
-          sum += in2 * in4;
-          pIn1 += 4u;
+          sum += pIn1[0] * b0;
+          sum10 += pIn1[numColsA] * b0;
+          pIn1++;
 
-          /* Decrement the loop count */
+          /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining MACs here.    
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4u;
+        px[0] = sum;
+        px[numColsB] = sum10;
+        px++;
+      }
+
+      /* Skip the second row of the output, and go to the next 2 rows of pSrcA */
+      px += numColsB;
+      pInA += 2u * numColsA;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* If the rows of pSrcA is not a multiple of 2, compute the last row */
+    if((numRowsA & 1u) != 0u)
+    {
+      pInB = pSrcB->pData;
+      col = numColsB;
+
+      while(col > 0u)
+      {
+        sum = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+        colCnt = numColsA;
 
         while(colCnt > 0u)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          sum += *pIn1++ * (*pIn2);
+          sum += *pIn1++ * *pIn2;
           pIn2 += numColsB;
 
           /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* Store the result in the destination buffer */
         *px++ = sum;
-
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        j++;
-        pIn2 = pSrcB->pData + j;
+        pInB++;
 
         /* Decrement the column loop counter */
         col--;
+      }
+    }
 
-      } while(col > 0u);
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
 
 #else
 
@@ -263,8 +316,6 @@ arm_status arm_mat_mult_f32(
 
       } while(col > 0u);
 
-#endif /* #ifndef ARM_MATH_CM0_FAMILY */
-
       /* Update the pointer pInA to point to the  starting address of the next row */
       i = i + numColsB;
       pInA = pInA + numColsA;
@@ -277,6 +328,8 @@ arm_status arm_mat_mult_f32(
     status = ARM_MATH_SUCCESS;
   }
 
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
   /* Return to application */
   return (status);
 }
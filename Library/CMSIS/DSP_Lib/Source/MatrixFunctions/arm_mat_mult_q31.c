@@ -94,9 +94,11 @@ arm_status arm_mat_mult_q31(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  q31_t *pInB;                                   /* input data matrix pointer B */
+  q31_t a0, a1, b0, b1;                          /* Temporary variables */
+  q63_t sum01, sum10, sum11;                     /* Accumulators of the other outputs of a block */
+  uint16_t col, row, colCnt;                     /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
-  q31_t a0, a1, a2, a3, b0, b1, b2, b3;
 
 #ifdef ARM_MATH_MATRIX_CHECK
 
@@ -105,100 +107,143 @@ arm_status arm_mat_mult_q31(
   if((pSrcA->numCols != pSrcB->numRows) ||
      (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
   {
+
     /* Set status as ARM_MATH_SIZE_MISMATCH */
     status = ARM_MATH_SIZE_MISMATCH;
   }
   else
-#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
-    /* row loop */
-    do
-    {
-      /* Output pointer is set to starting address of the row being processed */
-      px = pOut + i;
+    /* The output is computed in blocks of 2 x 2. Each pair of values read from the    
+     ** rows of pSrcA and the columns of pSrcB is used by 4 multiply-accumulates,    
+     ** instead of 1 when the outputs are computed one by one. */
+    px = pOut;
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
+    /* row loop, 2 rows of pSrcA at a time */
+    row = numRowsA >> 1u;
 
-      /* For every row wise process, the pIn2 pointer is set    
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
+    while(row > 0u)
+    {
+      pInB = pSrcB->pData;
 
-      j = 0u;
+      /* column loop, 2 columns of pSrcB at a time */
+      col = numColsB >> 1u;
 
-      /* column loop */
-      do
+      while(col > 0u)
       {
-        /* Set the variable sum, that acts as accumulator, to zero */
         sum = 0;
+        sum01 = 0;
+        sum10 = 0;
+        sum11 = 0;
 
-        /* Initiate the pointer pIn1 to point to the starting address of pInA */
         pIn1 = pInA;
+        pIn2 = pInB;
+        colCnt = numColsA;
 
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2;
-
-
-        /* matrix multiplication */
         while(colCnt > 0u)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          /* Perform the multiply-accumulates */
-          b0 = *pIn2;
+          /* c(m,n) = a(m,1)*b(1,n) + a(m,2)*b(2,n) + .... for the rows m, m+1 and columns n, n+1 */
+          a0 = pIn1[0];
+          a1 = pIn1[numColsA];
+          b0 = pIn2[0];
+          b1 = pIn2[1];
+          pIn1++;
           pIn2 += numColsB;
 
-          a0 = *pIn1++;
-          a1 = *pIn1++;
+          sum += (q63_t) a0 * b0;
+          sum01 += (q63_t) a0 * b1;
+          sum10 += (q63_t) a1 * b0;
+          sum11 += (q63_t) a1 * b1;
 
-          b1 = *pIn2;
-          pIn2 += numColsB;
-          b2 = *pIn2;
-          pIn2 += numColsB;
+          /* Decrement the loop counter */
+          colCnt--;
+        }
 
-          sum += (q63_t) a0 *b0;
-          sum += (q63_t) a1 *b1;
+        /* Store the 2 x 2 block in the destination buffer.    
+         ** The 2.62 sums are saturated to 1.31, as documented above. */
+        px[0] = (q31_t) clip_q63_to_q31(sum >> 31);
+        px[1] = (q31_t) clip_q63_to_q31(sum01 >> 31);
+        px[numColsB] = (q31_t) clip_q63_to_q31(sum10 >> 31);
+        px[numColsB + 1u] = (q31_t) clip_q63_to_q31(sum11 >> 31);
+        px += 2u;
 
-          a2 = *pIn1++;
-          a3 = *pIn1++;
+        /* Next 2 columns of pSrcB */
+        pInB += 2u;
 
-          b3 = *pIn2;
-          pIn2 += numColsB;
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* If the columns of pSrcB is not a multiple of 2, compute the last column of the 2 rows */
+      if((numColsB & 1u) != 0u)
+      {
+        sum = 0;
+        sum10 = 0;
 
-          sum += (q63_t) a2 *b2;
-          sum += (q63_t) a3 *b3;
+        pIn1 = pInA;
+        pIn2 = pInB;
+        colCnt = numColsA;
+
+        while(colCnt > 0u)
+        {
+          b0 = *pIn2;
+          pIn2 += numColsB;
+          sum += (q63_t) pIn1[0] * b0;
+          sum10 += (q63_t) pIn1[numColsA] * b0;
+          pIn1++;
 
           /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining output samples here.    
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4u;
+        px[0] = (q31_t) clip_q63_to_q31(sum >> 31);
+        px[numColsB] = (q31_t) clip_q63_to_q31(sum10 >> 31);
+        px++;
+      }
+
+      /* Skip the second row of the output, and go to the next 2 rows of pSrcA */
+      px += numColsB;
+      pInA += 2u * numColsA;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* If the rows of pSrcA is not a multiple of 2, compute the last row */
+    if((numRowsA & 1u) != 0u)
+    {
+      pInB = pSrcB->pData;
+      col = numColsB;
+
+      while(col > 0u)
+      {
+        sum = 0;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+        colCnt = numColsA;
 
         while(colCnt > 0u)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          /* Perform the multiply-accumulates */
-          sum += (q63_t) * pIn1++ * *pIn2;
+          sum += (q63_t) *pIn1++ * *pIn2;
           pIn2 += numColsB;
 
           /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
-        *px++ = (q31_t) (sum >> 31);
-
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        j++;
-        pIn2 = (pSrcB->pData) + j;
+        *px++ = (q31_t) clip_q63_to_q31(sum >> 31);
+        pInB++;
 
         /* Decrement the column loop counter */
         col--;
+      }
+    }
 
-      } while(col > 0u);
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
 
 #else
 
@@ -271,8 +316,6 @@ arm_status arm_mat_mult_q31(
 
       } while(col > 0u);
 
-#endif
-
       /* Update the pointer pInA to point to the  starting address of the next row */
       i = i + numColsB;
       pInA = pInA + numColsA;
@@ -285,6 +328,9 @@ arm_status arm_mat_mult_q31(
     /* set status as ARM_MATH_SUCCESS */
     status = ARM_MATH_SUCCESS;
   }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
   /* Return to application */
   return (status);
 }
@@ -0,0 +1,239 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_qr_f32.c    
+*    
+* Description:  Floating-point QR decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixQR QR Decomposition    
+ *    
+ * Decomposes a matrix <code>A</code> of size <code>M x N</code>, with <code>M >= N</code>,    
+ * into <code>A = Q * R</code>, where <code>Q</code> is an orthogonal matrix of size    
+ * <code>M x M</code> and <code>R</code> is an upper triangular matrix of size <code>M x N</code>.    
+ * The diagonal of <code>R</code> is made non-negative, so the decomposition is unique    
+ * when <code>A</code> has full rank.    
+ *    
+ * \par    
+ * The least-squares solution of an overdetermined system <code>A * x = b</code> is    
+ * <code>R * x = Q' * b</code>, restricted to the first <code>N</code> rows, and is solved with    
+ * <code>arm_mat_solve_upper_triangular_f32()</code>. Unlike the normal equations    
+ * <code>A' * A * x = A' * b</code>, this does not square the condition number of <code>A</code>.    
+ *    
+ * \par Algorithm    
+ * The floating-point function applies one Householder reflection per column of <code>A</code>.    
+ * The Q31 function applies Givens rotations, whose coefficients are bounded by 1, so that    
+ * all the intermediate values keep the 1.31 format.    
+ * <code>Q</code> is accumulated only if its output pointer is not NULL, and <code>R</code>    
+ * may be the input matrix.    
+ */
+
+/**    
+ * @addtogroup MatrixQR    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point QR decomposition.    
+ * @param[in]       *pSrc points to the input matrix structure, <code>M x N</code>    
+ * @param[out]      *pDstQ points to the output matrix structure of <code>Q</code>, <code>M x M</code>, or NULL    
+ * @param[out]      *pDstR points to the output matrix structure of <code>R</code>, <code>M x N</code>, may be <code>pSrc</code>    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDstQ,
+  arm_matrix_instance_f32 * pDstR)
+{
+  float32_t *pR = pDstR->pData;                  /* R data matrix pointer */
+  float32_t *pQ;                                 /* Q data matrix pointer */
+  float32_t *pv;                                 /* Householder vector, in column k of R */
+  float32_t norm, alpha, vtv, s, f;              /* Temporary variables */
+  uint16_t m = pSrc->numRows;                    /* number of rows of A */
+  uint16_t n = pSrc->numCols;                    /* number of columns of A */
+  uint16_t numSteps;                             /* number of reflections */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((m < n) || (pDstR->numRows != m) || (pDstR->numCols != n) ||
+     ((pDstQ != NULL) && ((pDstQ->numRows != m) || (pDstQ->numCols != m))))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    if(pR != pSrc->pData)
+    {
+      arm_copy_f32(pSrc->pData, pR, (uint32_t) m * n);
+    }
+
+    /* Q starts as the identity matrix */
+    if(pDstQ != NULL)
+    {
+      pQ = pDstQ->pData;
+      arm_fill_f32(0.0f, pQ, (uint32_t) m * m);
+
+      for (i = 0u; i < m; i++)
+      {
+        pQ[(i * m) + i] = 1.0f;
+      }
+    }
+
+    numSteps = (n < m) ? n : (m - 1u);
+
+    for (k = 0u; k < numSteps; k++)
+    {
+      /* Norm of R(k:m-1,k) */
+      pv = pR + (k * n) + k;
+      norm = 0.0f;
+
+      for (i = k; i < m; i++)
+      {
+        norm += *pv * *pv;
+        pv += n;
+      }
+
+      if(norm == 0.0f)
+      {
+        continue;
+      }
+
+      arm_sqrt_f32(norm, &norm);
+
+      /* alpha has the opposite sign of R(k,k), so that v has no cancellation */
+      pv = pR + (k * n) + k;
+      alpha = (*pv > 0.0f) ? -norm : norm;
+
+      /* v = R(k:m-1,k) - alpha * e1, and half of v' * v = norm^2 - R(k,k) * alpha */
+      vtv = norm * (norm + fabsf(*pv));
+      *pv -= alpha;
+
+      /* R(k:m-1,j) -= v * (v' * R(k:m-1,j)) / vtv for the columns on the right */
+      for (j = k + 1u; j < n; j++)
+      {
+        s = 0.0f;
+
+        for (i = k; i < m; i++)
+        {
+          s += pR[(i * n) + k] * pR[(i * n) + j];
+        }
+
+        f = s / vtv;
+
+        for (i = k; i < m; i++)
+        {
+          pR[(i * n) + j] -= f * pR[(i * n) + k];
+        }
+      }
+
+      /* Q(:,k:m-1) -= (Q(:,k:m-1) * v) * v' / vtv */
+      if(pDstQ != NULL)
+      {
+        pQ = pDstQ->pData + k;
+
+        for (j = 0u; j < m; j++)
+        {
+          s = 0.0f;
+
+          for (i = k; i < m; i++)
+          {
+            s += pQ[i - k] * pR[(i * n) + k];
+          }
+
+          f = s / vtv;
+
+          for (i = k; i < m; i++)
+          {
+            pQ[i - k] -= f * pR[(i * n) + k];
+          }
+
+          pQ += m;
+        }
+      }
+
+      /* Column k of R becomes alpha * e1 */
+      pR[(k * n) + k] = alpha;
+
+      for (i = k + 1u; i < m; i++)
+      {
+        pR[(i * n) + k] = 0.0f;
+      }
+    }
+
+    /* Make the diagonal of R non-negative: negate row k of R and column k of Q */
+    for (k = 0u; k < n; k++)
+    {
+      if(pR[(k * n) + k] < 0.0f)
+      {
+        arm_negate_f32(pR + (k * n) + k, pR + (k * n) + k, n - k);
+
+        if(pDstQ != NULL)
+        {
+          pQ = pDstQ->pData + k;
+
+          for (i = 0u; i < m; i++)
+          {
+            *pQ = -*pQ;
+            pQ += m;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixQR group    
+ */
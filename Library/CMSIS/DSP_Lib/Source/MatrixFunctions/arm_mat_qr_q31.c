@@ -0,0 +1,232 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_qr_q31.c    
+*    
+* Description:  Q31 QR decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixQR    
+ * @{    
+ */
+
+/* sqrt(a^2 + b^2) of two 1.31 values, in 1.31 format */
+static q31_t hypot_q31(
+  q31_t a,
+  q31_t b)
+{
+  uint64_t val = (uint64_t) ((q63_t) a * a) + (uint64_t) ((q63_t) b * b);
+  uint64_t root = 0u;
+  uint64_t bit = (uint64_t) 1u << 62;
+
+  while(bit > val)
+  {
+    bit >>= 2;
+  }
+
+  while(bit != 0u)
+  {
+    if(val >= root + bit)
+    {
+      val -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return ((q31_t) clip_q63_to_q31((q63_t) root));
+}
+
+/* Applies the rotation [c s; -s c] to the pair (x, y) */
+static void rotate_q31(
+  q31_t c,
+  q31_t s,
+  q31_t * pX,
+  q31_t * pY)
+{
+  q63_t x = *pX;
+  q63_t y = *pY;
+
+  *pX = (q31_t) clip_q63_to_q31(((c * x) + (s * y)) >> 31);
+  *pY = (q31_t) clip_q63_to_q31(((c * y) - (s * x)) >> 31);
+}
+
+/**    
+ * @brief Q31 QR decomposition.    
+ * @param[in]       *pSrc points to the input matrix structure, <code>M x N</code>    
+ * @param[out]      *pDstQ points to the output matrix structure of <code>Q</code>, <code>M x M</code>, or NULL    
+ * @param[out]      *pDstR points to the output matrix structure of <code>R</code>, <code>M x N</code>, may be <code>pSrc</code>    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The rotations keep the norm of each column of <code>A</code>, so the elements of    
+ * <code>R</code> do not overflow if the norm of each column of <code>A</code> is smaller than 1.    
+ * The cosines and sines of the rotations are computed with a 64-bit square root and    
+ * saturated divisions, and every rotated element is rounded to 1.31 format, so the    
+ * error grows with the number of rotations, <code>M * N</code>.    
+ */
+
+arm_status arm_mat_qr_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDstQ,
+  arm_matrix_instance_q31 * pDstR)
+{
+  q31_t *pR = pDstR->pData;                      /* R data matrix pointer */
+  q31_t *pQ;                                     /* Q data matrix pointer */
+  q31_t *pRk, *pRi;                              /* Rows k and i of R */
+  q31_t a, b, r, c, s;                           /* Rotation variables */
+  uint16_t m = pSrc->numRows;                    /* number of rows of A */
+  uint16_t n = pSrc->numCols;                    /* number of columns of A */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((m < n) || (pDstR->numRows != m) || (pDstR->numCols != n) ||
+     ((pDstQ != NULL) && ((pDstQ->numRows != m) || (pDstQ->numCols != m))))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    if(pR != pSrc->pData)
+    {
+      arm_copy_q31(pSrc->pData, pR, (uint32_t) m * n);
+    }
+
+    /* Q starts as the identity matrix */
+    if(pDstQ != NULL)
+    {
+      pQ = pDstQ->pData;
+      arm_fill_q31(0, pQ, (uint32_t) m * m);
+
+      for (i = 0u; i < m; i++)
+      {
+        pQ[(i * m) + i] = 0x7FFFFFFF;
+      }
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      pRk = pR + (k * n);
+
+      /* Zero R(i,k) below the diagonal by rotating rows k and i */
+      for (i = k + 1u; i < m; i++)
+      {
+        pRi = pR + (i * n);
+        a = pRk[k];
+        b = pRi[k];
+
+        if(b == 0)
+        {
+          continue;
+        }
+
+        /* c = a / r and s = b / r, both in 1.31 format */
+        r = hypot_q31(a, b);
+        c = (q31_t) clip_q63_to_q31(((q63_t) a << 31) / r);
+        s = (q31_t) clip_q63_to_q31(((q63_t) b << 31) / r);
+
+        pRk[k] = r;
+        pRi[k] = 0;
+
+        for (j = k + 1u; j < n; j++)
+        {
+          rotate_q31(c, s, &pRk[j], &pRi[j]);
+        }
+
+        /* Q = Q * G': columns k and i of Q */
+        if(pDstQ != NULL)
+        {
+          pQ = pDstQ->pData;
+
+          for (j = 0u; j < m; j++)
+          {
+            rotate_q31(c, s, &pQ[k], &pQ[i]);
+            pQ += m;
+          }
+        }
+      }
+    }
+
+    /* Make the diagonal of R non-negative: negate row k of R and column k of Q */
+    for (k = 0u; k < n; k++)
+    {
+      if(pR[(k * n) + k] < 0)
+      {
+        arm_negate_q31(pR + (k * n) + k, pR + (k * n) + k, n - k);
+
+        if(pDstQ != NULL)
+        {
+          pQ = pDstQ->pData + k;
+
+          for (i = 0u; i < m; i++)
+          {
+            *pQ = (q31_t) clip_q63_to_q31(-(q63_t) *pQ);
+            pQ += m;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixQR group    
+ */
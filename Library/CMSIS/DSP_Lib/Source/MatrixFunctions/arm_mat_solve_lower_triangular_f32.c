@@ -0,0 +1,162 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_solve_lower_triangular_f32.c    
+*    
+* Description:  Floating-point solve of a lower triangular system.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixSolve Triangular Solve    
+ *    
+ * Solves <code>T * X = B</code> for <code>X</code>, where <code>T</code> is a square lower    
+ * or upper triangular matrix and <code>B</code> has as many rows as <code>T</code>.    
+ * The elements on the other side of the diagonal of <code>T</code> are not read, so the output    
+ * of a Cholesky or QR decomposition can be passed as is.    
+ * The output matrix may be <code>B</code>.    
+ *    
+ * \par    
+ * With <code>A = L * L'</code> from <code>arm_mat_cholesky_f32()</code>, <code>A * X = B</code> is    
+ * solved by <code>L * Y = B</code> then <code>L' * X = Y</code>, with the transpose of <code>L</code> from    
+ * <code>arm_mat_trans_f32()</code>. With <code>A = Q * R</code> from <code>arm_mat_qr_f32()</code>,    
+ * the least-squares solution is <code>R * X = Q' * B</code>.    
+ *    
+ * \par Algorithm    
+ * Forward substitution for lower triangular matrices and back substitution for upper    
+ * triangular ones. The floating-point functions update whole rows of <code>X</code>, so their    
+ * inner loops read contiguous memory. If an element of the diagonal of <code>T</code> is zero,    
+ * the functions return <code>ARM_MATH_SINGULAR</code>.    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point solve of a lower triangular system.    
+ * @param[in]       *pSrcL points to the lower triangular matrix structure    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, may be <code>pSrcB</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if <code>pSrcL</code> is not square or if its size does    
+ * not match the number of rows of the other matrices.    
+ * If an element of the diagonal is zero, then the function returns    
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL = pSrcL->pData;                  /* Row i of L */
+  float32_t *pB = pSrcB->pData;                  /* Row i of B */
+  float32_t *pX = pDst->pData;                   /* Row i of X */
+  float32_t *pXk, *px;                           /* Temporary output data matrix pointers */
+  float32_t lik, invDiag;                        /* Temporary variables */
+  uint16_t n = pSrcL->numRows;                   /* Size of L */
+  uint16_t numCols = pSrcB->numCols;             /* Columns of B and X */
+  uint16_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcL->numRows != pSrcL->numCols) || (pSrcB->numRows != n) ||
+     (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; i < n; i++)
+    {
+      if(pL[i] == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      if(pX != pB)
+      {
+        arm_copy_f32(pB, pX, numCols);
+      }
+
+      /* X(i,:) = (B(i,:) - L(i,0)*X(0,:) - ... - L(i,i-1)*X(i-1,:)) / L(i,i) */
+      pXk = pDst->pData;
+
+      for (k = 0u; k < i; k++)
+      {
+        lik = pL[k];
+        px = pX;
+
+        for (col = 0u; col < numCols; col++)
+        {
+          *px++ -= lik * *pXk++;
+        }
+      }
+
+      invDiag = 1.0f / pL[i];
+      px = pX;
+
+      for (col = 0u; col < numCols; col++)
+      {
+        *px++ *= invDiag;
+      }
+
+      pL += n;
+      pB += numCols;
+      pX += numCols;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
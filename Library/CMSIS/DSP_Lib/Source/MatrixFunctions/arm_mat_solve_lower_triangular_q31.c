@@ -0,0 +1,141 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_solve_lower_triangular_q31.c    
+*    
+* Description:  Q31 solve of a lower triangular system.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Q31 solve of a lower triangular system.    
+ * @param[in]       *pSrcL points to the lower triangular matrix structure    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, may be <code>pSrcB</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if <code>pSrcL</code> is not square or if its size does    
+ * not match the number of rows of the other matrices.    
+ * If an element of the diagonal is zero, then the function returns    
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * Each element of <code>X</code> is computed in a 64-bit accumulator in 2.62 format and    
+ * divided by the diagonal of <code>L</code>. The results are saturated to 1.31 format:    
+ * the diagonal of <code>L</code> is smaller than 1, so the inputs must be scaled down by the    
+ * caller to keep <code>X</code> in range.    
+ */
+
+arm_status arm_mat_solve_lower_triangular_q31(
+  const arm_matrix_instance_q31 * pSrcL,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pL;                                     /* Row i of L */
+  q31_t *pB = pSrcB->pData;                      /* input data matrix pointer */
+  q31_t *pX = pDst->pData;                       /* output data matrix pointer */
+  q31_t *pXk;                                    /* Column col of X */
+  q63_t sum;                                     /* Accumulator */
+  uint16_t n = pSrcL->numRows;                   /* Size of L */
+  uint16_t numCols = pSrcB->numCols;             /* Columns of B and X */
+  uint16_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcL->numRows != pSrcL->numCols) || (pSrcB->numRows != n) ||
+     (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; i < n; i++)
+    {
+      if(pSrcL->pData[(i * n) + i] == 0)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+    }
+
+    /* Each column of X is solved on its own, one 64-bit accumulator per element */
+    for (col = 0u; col < numCols; col++)
+    {
+      pL = pSrcL->pData;
+
+      for (i = 0u; i < n; i++)
+      {
+        /* X(i,col) = (B(i,col) - L(i,0)*X(0,col) - ... - L(i,i-1)*X(i-1,col)) / L(i,i) */
+        sum = (q63_t) pB[(i * numCols) + col] << 31;
+        pXk = pX + col;
+
+        for (k = 0u; k < i; k++)
+        {
+          sum -= (q63_t) pL[k] * *pXk;
+          pXk += numCols;
+        }
+
+        pX[(i * numCols) + col] = (q31_t) clip_q63_to_q31(sum / pL[i]);
+
+        pL += n;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
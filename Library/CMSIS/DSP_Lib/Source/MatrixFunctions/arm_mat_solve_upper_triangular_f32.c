@@ -0,0 +1,145 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_solve_upper_triangular_f32.c    
+*    
+* Description:  Floating-point solve of an upper triangular system.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point solve of an upper triangular system.    
+ * @param[in]       *pSrcU points to the upper triangular matrix structure    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, may be <code>pSrcB</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if <code>pSrcU</code> is not square or if its size does    
+ * not match the number of rows of the other matrices.    
+ * If an element of the diagonal is zero, then the function returns    
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.    
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pU;                                 /* Row i of U */
+  float32_t *pB;                                 /* Row i of B */
+  float32_t *pX;                                 /* Row i of X */
+  float32_t *pXk, *px;                           /* Temporary output data matrix pointers */
+  float32_t uik, invDiag;                        /* Temporary variables */
+  uint16_t n = pSrcU->numRows;                   /* Size of U */
+  uint16_t numCols = pSrcB->numCols;             /* Columns of B and X */
+  uint16_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcU->numRows != pSrcU->numCols) || (pSrcB->numRows != n) ||
+     (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Rows are solved from the last to the first */
+    i = n;
+
+    while(i > 0u)
+    {
+      i--;
+
+      pU = pSrcU->pData + (i * n);
+      pB = pSrcB->pData + (i * numCols);
+      pX = pDst->pData + (i * numCols);
+
+      if(pU[i] == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      if(pX != pB)
+      {
+        arm_copy_f32(pB, pX, numCols);
+      }
+
+      /* X(i,:) = (B(i,:) - U(i,i+1)*X(i+1,:) - ... - U(i,n-1)*X(n-1,:)) / U(i,i) */
+      pXk = pX + numCols;
+
+      for (k = i + 1u; k < n; k++)
+      {
+        uik = pU[k];
+        px = pX;
+
+        for (col = 0u; col < numCols; col++)
+        {
+          *px++ -= uik * *pXk++;
+        }
+      }
+
+      invDiag = 1.0f / pU[i];
+      px = pX;
+
+      for (col = 0u; col < numCols; col++)
+      {
+        *px++ *= invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
@@ -0,0 +1,90 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_moving_rms_init_q31.c    
+*    
+* Description:  Q31 moving RMS initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup MovingRMS    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 moving RMS.    
+ * @param[out] *S points to an instance of the Q31 moving RMS structure.    
+ * @param[in]  windowLen number of samples in the window, 1 to 65535.    
+ * @param[in]  *pState points to the state buffer of <code>windowLen</code> samples.    
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0.    
+ *    
+ * \par Description:    
+ * Clears the state buffer and the sum of squares. It is also called to restart the estimation.    
+ */
+
+arm_status arm_moving_rms_init_q31(
+  arm_moving_rms_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState)
+{
+  if(windowLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length */
+  S->windowLen = windowLen;
+
+  /* Empty window */
+  S->stateIndex = 0u;
+  S->numValid = 0u;
+  S->sumSq = 0;
+
+  /* Clear the state buffer and assign the state pointer */
+  memset(pState, 0, windowLen * sizeof(q31_t));
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MovingRMS group    
+ */
@@ -0,0 +1,138 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_moving_rms_q31.c    
+*    
+* Description:  Q31 moving RMS.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup MovingRMS Moving RMS    
+ *    
+ * Computes, for each input sample, the root mean square of the last <code>windowLen</code>    
+ * samples:    
+ * <pre>    
+ *     pDst[n] = sqrt((x[n]<sup>2</sup> + x[n-1]<sup>2</sup> + ... + x[n-windowLen+1]<sup>2</sup>) / windowLen)    
+ * </pre>    
+ * Until the window is full, the mean is taken over the samples received so far.    
+ *    
+ * \par Algorithm    
+ * The instance keeps the last <code>windowLen</code> samples in a circular state buffer and    
+ * the sum of their squares. Each new sample adds its square and removes the square of the    
+ * sample leaving the window, so the work per sample does not depend on the window length.    
+ * The squares are truncated to a 2.46 format before the sum, so that the same value is    
+ * added and later removed: the sum is exact, and does not drift however long the stream is.    
+ * The truncated bits are below 1 LSB of the 1.31 mean square.    
+ */
+
+/**    
+ * @addtogroup MovingRMS    
+ * @{    
+ */
+
+/**    
+ * @brief Q31 moving RMS.    
+ * @param[in,out] *S points to an instance of the Q31 moving RMS structure.    
+ * @param[in]     *pSrc points to the block of input data.    
+ * @param[out]    *pDst points to the block of output data, the RMS of the window ending at each input sample.    
+ * @param[in]     blockSize number of samples to process.    
+ * @return none.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The sum of squares is kept in a 64-bit accumulator in 18.46 format, which cannot overflow    
+ * for windows of up to 65535 samples. The mean square is converted to 1.31 format, saturated    
+ * and passed to <code>arm_sqrt_q31()</code>.    
+ */
+
+void arm_moving_rms_q31(
+  arm_moving_rms_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q63_t sumSq = S->sumSq;                        /* Sum of squares of the window in 18.46 format */
+  q31_t in, out;                                 /* Temporary variables */
+  uint16_t windowLen = S->windowLen;             /* Window length */
+  uint16_t stateIndex = S->stateIndex;           /* Index of the oldest sample */
+  uint16_t numValid = S->numValid;               /* Number of samples in the window */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* Add the new square and remove the one of the sample leaving the window, zero until it is full */
+    out = pState[stateIndex];
+    sumSq += ((q63_t) in * in) >> 16;
+    sumSq -= ((q63_t) out * out) >> 16;
+
+    pState[stateIndex] = in;
+    stateIndex++;
+
+    if(stateIndex == windowLen)
+    {
+      stateIndex = 0u;
+    }
+
+    if(numValid < windowLen)
+    {
+      numValid++;
+    }
+
+    /* Mean square converted from 18.46 to 1.31 format, then its square root */
+    arm_sqrt_q31((q31_t) clip_q63_to_q31((sumSq / numValid) >> 15), pDst++);
+
+    blkCnt--;
+  }
+
+  /* Save the state for the next call */
+  S->sumSq = sumSq;
+  S->stateIndex = stateIndex;
+  S->numValid = numValid;
+}
+
+/**    
+ * @} end of MovingRMS group    
+ */
@@ -0,0 +1,225 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_p2_quantile_f32.c    
+*    
+* Description:  Floating-point P2 quantile estimator.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup P2Quantile P<sup>2</sup> Quantile Estimator    
+ *    
+ * Estimates a quantile of all the samples seen since the initialization, for example the    
+ * median or the 99th percentile, with five markers instead of a sorted copy of the stream.    
+ * Memory and work per sample are constant.    
+ *    
+ * \par Algorithm    
+ * The P<sup>2</sup> algorithm of Jain and Chlamtac keeps five markers: the minimum, the    
+ * quantiles <code>p/2</code>, <code>p</code> and <code>(1+p)/2</code>, and the maximum.    
+ * Each marker has a height, the estimate of its quantile, and a position, the number of    
+ * samples at or below it. A new sample increments the positions of the markers above it.    
+ * When the position of a middle marker is off by one or more from its desired position,    
+ * <code>p * (count - 1)</code> for the marker of <code>p</code>, the marker moves by one    
+ * position and its height is corrected with a piecewise-parabolic interpolation of its    
+ * neighbours, or a linear one if the parabola is not monotonic.    
+ *    
+ * \par    
+ * The instance keeps the difference between the desired and the actual positions of the    
+ * middle markers, rather than the desired positions themselves, so that the single-precision    
+ * arithmetic does not lose the fractional part after 2<sup>24</sup> samples.    
+ * Before the fifth sample, the estimate is the nearest-rank quantile of the samples received.    
+ */
+
+/**    
+ * @addtogroup P2Quantile    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point P<sup>2</sup> quantile estimator.    
+ * @param[in,out] *S points to an instance of the floating-point P<sup>2</sup> quantile structure.    
+ * @param[in]     *pSrc points to the block of input data.    
+ * @param[in]     blockSize number of samples to process, may be zero.    
+ * @param[out]    *pResult estimate of the quantile of all the samples seen so far, zero before the first sample.    
+ * @return none.    
+ */
+
+void arm_p2_quantile_f32(
+  arm_p2_quantile_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult)
+{
+  float32_t *q = S->q;                           /* Heights of the markers */
+  uint32_t *n = S->n;                            /* Positions of the markers */
+  float32_t *d = S->d;                           /* Desired minus actual positions of the middle markers */
+  float32_t in, qp, ds;                          /* Temporary variables */
+  int32_t nl, nr;                                /* Distances to the neighbours */
+  uint32_t i, j, k;                              /* loop counters */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(S->count < 5u)
+    {
+      /* The first five samples are the initial heights, sorted by insertion */
+      j = S->count;
+
+      while((j > 0u) && (q[j - 1u] > in))
+      {
+        q[j] = q[j - 1u];
+        j--;
+      }
+      q[j] = in;
+
+      S->count++;
+
+      if(S->count == 5u)
+      {
+        for (i = 0u; i < 5u; i++)
+        {
+          n[i] = i;
+        }
+
+        /* Desired positions 2p, 4p and 2+2p, 0 based */
+        d[0] = (2.0f * S->p) - 1.0f;
+        d[1] = (4.0f * S->p) - 2.0f;
+        d[2] = (2.0f * S->p) - 1.0f;
+      }
+    }
+    else
+    {
+      /* Cell k of the sample, the extreme markers follow the minimum and the maximum */
+      if(in < q[0])
+      {
+        q[0] = in;
+        k = 0u;
+      }
+      else if(in >= q[4])
+      {
+        q[4] = in;
+        k = 3u;
+      }
+      else
+      {
+        k = 0u;
+
+        while(in >= q[k + 1u])
+        {
+          k++;
+        }
+      }
+
+      /* Markers above the sample move up, the desired positions move by dn */
+      for (i = k + 1u; i < 5u; i++)
+      {
+        n[i]++;
+      }
+
+      for (i = 0u; i < 3u; i++)
+      {
+        d[i] += S->dn[i];
+        d[i] -= (i + 1u > k) ? 1.0f : 0.0f;
+      }
+
+      /* Adjust the middle markers that are one position or more off */
+      for (i = 1u; i < 4u; i++)
+      {
+        nr = (int32_t) (n[i + 1u] - n[i]);
+        nl = (int32_t) (n[i] - n[i - 1u]);
+
+        if(((d[i - 1u] >= 1.0f) && (nr > 1)) || ((d[i - 1u] <= -1.0f) && (nl > 1)))
+        {
+          ds = (d[i - 1u] > 0.0f) ? 1.0f : -1.0f;
+
+          /* Piecewise-parabolic prediction */
+          qp = q[i] + (ds / (float32_t) (nl + nr)) *
+            ((((float32_t) nl + ds) * (q[i + 1u] - q[i]) / (float32_t) nr) +
+             (((float32_t) nr - ds) * (q[i] - q[i - 1u]) / (float32_t) nl));
+
+          if((qp <= q[i - 1u]) || (qp >= q[i + 1u]))
+          {
+            /* Linear prediction towards the neighbour */
+            qp = (ds > 0.0f) ? q[i] + ((q[i + 1u] - q[i]) / (float32_t) nr) :
+              q[i] - ((q[i] - q[i - 1u]) / (float32_t) nl);
+          }
+
+          q[i] = qp;
+          d[i - 1u] -= ds;
+
+          if(ds > 0.0f)
+          {
+            n[i]++;
+          }
+          else
+          {
+            n[i]--;
+          }
+        }
+      }
+
+      /* Saturated, so that the first branch is never taken again */
+      S->count += (S->count < 0xFFFFFFFFu) ? 1u : 0u;
+    }
+
+    blkCnt--;
+  }
+
+  if(S->count >= 5u)
+  {
+    *pResult = q[2];
+  }
+  else if(S->count > 0u)
+  {
+    /* Nearest rank among the first samples, which are sorted */
+    *pResult = q[(uint32_t) ((S->p * (float32_t) (S->count - 1u)) + 0.5f)];
+  }
+  else
+  {
+    *pResult = 0.0f;
+  }
+}
+
+/**    
+ * @} end of P2Quantile group    
+ */
@@ -0,0 +1,88 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_p2_quantile_init_f32.c    
+*    
+* Description:  Floating-point P2 quantile estimator initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup P2Quantile    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point P<sup>2</sup> quantile estimator.    
+ * @param[out] *S points to an instance of the floating-point P<sup>2</sup> quantile structure.    
+ * @param[in]  p quantile to estimate, between 0 and 1 exclusive, for example 0.5 for the median.    
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>p</code> is not in (0, 1).    
+ *    
+ * \par Description:    
+ * Clears the markers. It is also called to restart the estimation.    
+ */
+
+arm_status arm_p2_quantile_init_f32(
+  arm_p2_quantile_instance_f32 * S,
+  float32_t p)
+{
+  /* NaN fails too */
+  if(!((p > 0.0f) && (p < 1.0f)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the quantile */
+  S->p = p;
+
+  /* No sample yet */
+  S->count = 0u;
+
+  /* Increments of the desired positions of the three middle markers */
+  S->dn[0] = 0.5f * p;
+  S->dn[1] = p;
+  S->dn[2] = 0.5f * (1.0f + p);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of P2Quantile group    
+ */
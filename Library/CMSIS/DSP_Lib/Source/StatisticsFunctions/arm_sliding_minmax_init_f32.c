@@ -0,0 +1,98 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sliding_minmax_init_f32.c    
+*    
+* Description:  Floating-point sliding minimum and maximum initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup SlidingMinMax    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point sliding minimum and maximum.    
+ * @param[out] *S points to an instance of the floating-point sliding minimum and maximum structure.    
+ * @param[in]  windowLen number of samples in the window, 1 to 65535.    
+ * @param[in]  *pValues points to a buffer of <code>2*windowLen</code> values.    
+ * @param[in]  *pPos points to a buffer of <code>2*windowLen</code> sample positions.    
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0.    
+ *    
+ * \par Description:    
+ * Empties the window. It is also called to restart the estimation.    
+ * The first half of the buffers holds the candidates for the maximum and the second half    
+ * the candidates for the minimum.    
+ */
+
+arm_status arm_sliding_minmax_init_f32(
+  arm_sliding_minmax_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pValues,
+  uint32_t * pPos)
+{
+  if(windowLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length */
+  S->windowLen = windowLen;
+
+  /* Empty window */
+  S->count = 0u;
+  S->maxHead = 0u;
+  S->maxLen = 0u;
+  S->minHead = 0u;
+  S->minLen = 0u;
+
+  /* Assign the buffer pointers */
+  S->pMaxVal = pValues;
+  S->pMaxPos = pPos;
+  S->pMinVal = pValues + windowLen;
+  S->pMinPos = pPos + windowLen;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of SlidingMinMax group    
+ */
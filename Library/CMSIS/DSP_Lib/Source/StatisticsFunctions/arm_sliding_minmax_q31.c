@@ -0,0 +1,153 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sliding_minmax_q31.c    
+*    
+* Description:  Q31 sliding minimum and maximum.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup SlidingMinMax    
+ * @{    
+ */
+
+/**    
+ * @brief Q31 sliding minimum and maximum.    
+ * @param[in,out] *S points to an instance of the Q31 sliding minimum and maximum structure.    
+ * @param[in]     *pSrc points to the block of input data.    
+ * @param[out]    *pMin points to the block of minimum values of the window ending at each input sample.    
+ * @param[out]    *pMax points to the block of maximum values of the window ending at each input sample.    
+ * @param[in]     blockSize number of samples to process.    
+ * @return none.    
+ */
+
+void arm_sliding_minmax_q31(
+  arm_sliding_minmax_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pMin,
+  q31_t * pMax,
+  uint32_t blockSize)
+{
+  q31_t *pMaxVal = S->pMaxVal;                   /* Values of the maximum deque */
+  q31_t *pMinVal = S->pMinVal;                   /* Values of the minimum deque */
+  uint32_t *pMaxPos = S->pMaxPos;                /* Positions of the maximum deque */
+  uint32_t *pMinPos = S->pMinPos;                /* Positions of the minimum deque */
+  q31_t in;                                      /* Input sample */
+  uint32_t count = S->count;                     /* Position of the input sample */
+  uint16_t windowLen = S->windowLen;             /* Window length */
+  uint16_t maxHead = S->maxHead, maxLen = S->maxLen; /* Front and length of the maximum deque */
+  uint16_t minHead = S->minHead, minLen = S->minLen; /* Front and length of the minimum deque */
+  uint32_t idx;                                  /* Index in a deque */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* Maximum: drop the front if it left the window, then the smaller values at the back */
+    if((maxLen > 0u) && ((count - pMaxPos[maxHead]) >= windowLen))
+    {
+      maxHead = (maxHead + 1u == windowLen) ? 0u : maxHead + 1u;
+      maxLen--;
+    }
+
+    while(maxLen > 0u)
+    {
+      idx = (uint32_t) maxHead + maxLen - 1u;
+      idx = (idx >= windowLen) ? idx - windowLen : idx;
+
+      if(pMaxVal[idx] > in)
+      {
+        break;
+      }
+      maxLen--;
+    }
+
+    idx = (uint32_t) maxHead + maxLen;
+    idx = (idx >= windowLen) ? idx - windowLen : idx;
+    pMaxVal[idx] = in;
+    pMaxPos[idx] = count;
+    maxLen++;
+
+    /* Minimum: same with the larger values dropped */
+    if((minLen > 0u) && ((count - pMinPos[minHead]) >= windowLen))
+    {
+      minHead = (minHead + 1u == windowLen) ? 0u : minHead + 1u;
+      minLen--;
+    }
+
+    while(minLen > 0u)
+    {
+      idx = (uint32_t) minHead + minLen - 1u;
+      idx = (idx >= windowLen) ? idx - windowLen : idx;
+
+      if(pMinVal[idx] < in)
+      {
+        break;
+      }
+      minLen--;
+    }
+
+    idx = (uint32_t) minHead + minLen;
+    idx = (idx >= windowLen) ? idx - windowLen : idx;
+    pMinVal[idx] = in;
+    pMinPos[idx] = count;
+    minLen++;
+
+    /* The fronts are the extremes of the window */
+    *pMax++ = pMaxVal[maxHead];
+    *pMin++ = pMinVal[minHead];
+
+    count++;
+    blkCnt--;
+  }
+
+  /* Save the state for the next call */
+  S->count = count;
+  S->maxHead = maxHead;
+  S->maxLen = maxLen;
+  S->minHead = minHead;
+  S->minLen = minLen;
+}
+
+/**    
+ * @} end of SlidingMinMax group    
+ */
@@ -0,0 +1,140 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_welford_f32.c    
+*    
+* Description:  Floating-point running mean and variance.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup Welford Running Mean and Variance    
+ *    
+ * Updates the mean and the variance of all the samples seen since the initialization,    
+ * one block at a time, in constant memory and with a constant work per sample.    
+ * The variance is normalized by <code>count - 1</code>, like <code>arm_var_f32()</code>.    
+ *    
+ * \par Algorithm    
+ * Accumulating the sum and the sum of squares of a long stream, as <code>arm_var_f32()</code>    
+ * does for one block, loses all the precision when the mean is large against the deviation,    
+ * because the variance is the difference of two large sums. The instance instead keeps the    
+ * mean and the sum of squared deviations <code>M2</code>. Each block is reduced to its own    
+ * mean and <code>M2</code> in two passes, and merged with the statistics of the previous    
+ * samples (Chan, Golub and LeVeque):    
+ * <pre>    
+ *     delta = meanB - mean    
+ *     mean  = mean + delta * nB / (n + nB)    
+ *     M2    = M2 + M2B + delta<sup>2</sup> * n * nB / (n + nB)    
+ *     n     = n + nB    
+ * </pre>    
+ * With blocks of one sample this is Welford's algorithm. Larger blocks take two divisions    
+ * per block instead of one per sample.    
+ */
+
+/**    
+ * @addtogroup Welford    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point running mean and variance.    
+ * @param[in,out] *S points to an instance of the floating-point running mean and variance structure.    
+ * @param[in]     *pSrc points to the block of input data.    
+ * @param[in]     blockSize number of samples to process, may be zero.    
+ * @param[out]    *pMean mean of all the samples seen so far.    
+ * @param[out]    *pVar variance of all the samples seen so far, zero before the second sample.    
+ * @return none.    
+ */
+
+void arm_welford_f32(
+  arm_welford_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pMean,
+  float32_t * pVar)
+{
+  float32_t *pIn = pSrc;                         /* source pointer */
+  float32_t sum = 0.0f;                          /* Sum of the block */
+  float32_t meanB, m2B = 0.0f;                   /* Statistics of the block */
+  float32_t delta, nA, nB, n;                    /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize > 0u)
+  {
+    /* Mean of the block */
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      sum += *pIn++;
+      blkCnt--;
+    }
+
+    nB = (float32_t) blockSize;
+    meanB = sum / nB;
+
+    /* Sum of the squared deviations of the block from its mean */
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      delta = *pIn++ - meanB;
+      m2B += delta * delta;
+      blkCnt--;
+    }
+
+    /* Merge with the previous samples */
+    nA = (float32_t) S->count;
+    n = nA + nB;
+    delta = meanB - S->mean;
+
+    S->mean += delta * (nB / n);
+    S->m2 += m2B + (delta * delta) * (nA * nB / n);
+    S->count += blockSize;
+  }
+
+  *pMean = S->mean;
+  *pVar = (S->count > 1u) ? S->m2 / (float32_t) (S->count - 1u) : 0.0f;
+}
+
+/**    
+ * @} end of Welford group    
+ */
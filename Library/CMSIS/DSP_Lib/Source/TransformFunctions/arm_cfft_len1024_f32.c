@@ -0,0 +1,1139 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_cfft_len1024_f32.c    
+*    
+* Description:  Floating-point complex FFT of 1024 points.    
+*               Generated by arm_fft_gen, do not edit.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/* Stage 1 twiddle factors, {w1r, w1i, w2r, w2i, w3r, w3i} for each butterfly */
+static const float32_t cfftLen1024Twiddle1[1536] =
+{
+  1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+  0.999981165f, -0.00613588467f, 0.999924719f, -0.0122715384f, 0.999830604f, -0.0184067301f,
+  0.999924719f, -0.0122715384f, 0.999698818f, -0.024541229f, 0.999322355f, -0.0368072242f,
+  0.999830604f, -0.0184067301f, 0.999322355f, -0.0368072242f, 0.998475552f, -0.0551952459f,
+  0.999698818f, -0.024541229f, 0.99879545f, -0.0490676761f, 0.997290432f, -0.0735645667f,
+  0.999529421f, -0.030674804f, 0.998118103f, -0.061320737f, 0.995767415f, -0.0919089541f,
+  0.999322355f, -0.0368072242f, 0.997290432f, -0.0735645667f, 0.993906975f, -0.110222206f,
+  0.999077737f, -0.0429382585f, 0.996312618f, -0.0857973099f, 0.991709769f, -0.128498107f,
+  0.99879545f, -0.0490676761f, 0.99518472f, -0.0980171412f, 0.989176512f, -0.146730468f,
+  0.998475552f, -0.0551952459f, 0.993906975f, -0.110222206f, 0.986308098f, -0.164913118f,
+  0.998118103f, -0.061320737f, 0.992479563f, -0.122410677f, 0.983105481f, -0.183039889f,
+  0.997723043f, -0.0674439222f, 0.990902662f, -0.134580702f, 0.979569793f, -0.201104641f,
+  0.997290432f, -0.0735645667f, 0.989176512f, -0.146730468f, 0.975702107f, -0.219101235f,
+  0.996820271f, -0.0796824396f, 0.987301409f, -0.15885815f, 0.971503913f, -0.237023607f,
+  0.996312618f, -0.0857973099f, 0.985277653f, -0.170961887f, 0.966976464f, -0.254865646f,
+  0.995767415f, -0.0919089541f, 0.983105481f, -0.183039889f, 0.962121427f, -0.272621363f,
+  0.99518472f, -0.0980171412f, 0.980785251f, -0.195090324f, 0.956940353f, -0.290284663f,
+  0.994564593f, -0.104121633f, 0.97831738f, -0.207111374f, 0.95143503f, -0.307849646f,
+  0.993906975f, -0.110222206f, 0.975702107f, -0.219101235f, 0.945607305f, -0.32531029f,
+  0.993211925f, -0.116318628f, 0.972939968f, -0.231058106f, 0.939459205f, -0.342660725f,
+  0.992479563f, -0.122410677f, 0.970031261f, -0.242980182f, 0.932992816f, -0.359895051f,
+  0.991709769f, -0.128498107f, 0.966976464f, -0.254865646f, 0.926210225f, -0.377007425f,
+  0.990902662f, -0.134580702f, 0.963776052f, -0.266712755f, 0.919113874f, -0.393992037f,
+  0.990058184f, -0.140658244f, 0.960430503f, -0.27851969f, 0.91170603f, -0.410843164f,
+  0.989176512f, -0.146730468f, 0.956940353f, -0.290284663f, 0.903989315f, -0.427555084f,
+  0.988257587f, -0.152797192f, 0.953306019f, -0.302005947f, 0.895966232f, -0.444122136f,
+  0.987301409f, -0.15885815f, 0.949528158f, -0.313681751f, 0.887639642f, -0.460538715f,
+  0.986308098f, -0.164913118f, 0.945607305f, -0.32531029f, 0.879012227f, -0.47679922f,
+  0.985277653f, -0.170961887f, 0.941544056f, -0.336889863f, 0.870086968f, -0.492898196f,
+  0.984210074f, -0.177004218f, 0.937339008f, -0.348418683f, 0.860866964f, -0.50883013f,
+  0.983105481f, -0.183039889f, 0.932992816f, -0.359895051f, 0.851355195f, -0.524589658f,
+  0.981963873f, -0.18906866f, 0.928506076f, -0.371317208f, 0.841554999f, -0.540171444f,
+  0.980785251f, -0.195090324f, 0.923879504f, -0.382683426f, 0.831469595f, -0.555570245f,
+  0.979569793f, -0.201104641f, 0.919113874f, -0.393992037f, 0.8211025f, -0.570780754f,
+  0.97831738f, -0.207111374f, 0.914209783f, -0.405241311f, 0.81045717f, -0.585797846f,
+  0.977028131f, -0.213110313f, 0.909168005f, -0.416429549f, 0.799537241f, -0.600616455f,
+  0.975702107f, -0.219101235f, 0.903989315f, -0.427555084f, 0.78834641f, -0.615231574f,
+  0.974339366f, -0.225083917f, 0.898674488f, -0.438616246f, 0.77688849f, -0.629638255f,
+  0.972939968f, -0.231058106f, 0.893224299f, -0.449611336f, 0.765167236f, -0.643831551f,
+  0.971503913f, -0.237023607f, 0.887639642f, -0.460538715f, 0.753186822f, -0.657806695f,
+  0.970031261f, -0.242980182f, 0.881921291f, -0.471396744f, 0.740951121f, -0.671558976f,
+  0.968522072f, -0.248927608f, 0.876070082f, -0.482183784f, 0.728464365f, -0.685083687f,
+  0.966976464f, -0.254865646f, 0.870086968f, -0.492898196f, 0.715730846f, -0.698376238f,
+  0.965394437f, -0.260794103f, 0.863972843f, -0.50353837f, 0.702754736f, -0.711432219f,
+  0.963776052f, -0.266712755f, 0.857728601f, -0.514102757f, 0.689540565f, -0.724247098f,
+  0.962121427f, -0.272621363f, 0.851355195f, -0.524589658f, 0.676092684f, -0.736816585f,
+  0.960430503f, -0.27851969f, 0.84485358f, -0.534997642f, 0.662415802f, -0.749136388f,
+  0.958703458f, -0.284407526f, 0.838224709f, -0.545324981f, 0.64851439f, -0.761202395f,
+  0.956940353f, -0.290284663f, 0.831469595f, -0.555570245f, 0.634393275f, -0.773010433f,
+  0.955141187f, -0.296150893f, 0.824589312f, -0.565731823f, 0.620057225f, -0.784556568f,
+  0.953306019f, -0.302005947f, 0.817584813f, -0.575808167f, 0.605511069f, -0.795836926f,
+  0.95143503f, -0.307849646f, 0.81045717f, -0.585797846f, 0.590759695f, -0.806847572f,
+  0.949528158f, -0.313681751f, 0.803207517f, -0.59569931f, 0.575808167f, -0.817584813f,
+  0.947585583f, -0.319502026f, 0.795836926f, -0.605511069f, 0.560661554f, -0.82804507f,
+  0.945607305f, -0.32531029f, 0.78834641f, -0.615231574f, 0.545324981f, -0.838224709f,
+  0.943593442f, -0.331106305f, 0.780737221f, -0.624859512f, 0.529803634f, -0.848120332f,
+  0.941544056f, -0.336889863f, 0.773010433f, -0.634393275f, 0.514102757f, -0.857728601f,
+  0.939459205f, -0.342660725f, 0.765167236f, -0.643831551f, 0.498227656f, -0.867046237f,
+  0.937339008f, -0.348418683f, 0.757208824f, -0.653172851f, 0.482183784f, -0.876070082f,
+  0.935183525f, -0.354163527f, 0.749136388f, -0.662415802f, 0.465976506f, -0.884797096f,
+  0.932992816f, -0.359895051f, 0.740951121f, -0.671558976f, 0.449611336f, -0.893224299f,
+  0.93076694f, -0.365612984f, 0.732654274f, -0.680601001f, 0.433093816f, -0.901348829f,
+  0.928506076f, -0.371317208f, 0.724247098f, -0.689540565f, 0.416429549f, -0.909168005f,
+  0.926210225f, -0.377007425f, 0.715730846f, -0.698376238f, 0.399624199f, -0.916679084f,
+  0.923879504f, -0.382683426f, 0.707106769f, -0.707106769f, 0.382683426f, -0.923879504f,
+  0.921514034f, -0.388345033f, 0.698376238f, -0.715730846f, 0.365612984f, -0.93076694f,
+  0.919113874f, -0.393992037f, 0.689540565f, -0.724247098f, 0.348418683f, -0.937339008f,
+  0.916679084f, -0.399624199f, 0.680601001f, -0.732654274f, 0.331106305f, -0.943593442f,
+  0.914209783f, -0.405241311f, 0.671558976f, -0.740951121f, 0.313681751f, -0.949528158f,
+  0.91170603f, -0.410843164f, 0.662415802f, -0.749136388f, 0.296150893f, -0.955141187f,
+  0.909168005f, -0.416429549f, 0.653172851f, -0.757208824f, 0.27851969f, -0.960430503f,
+  0.906595707f, -0.422000259f, 0.643831551f, -0.765167236f, 0.260794103f, -0.965394437f,
+  0.903989315f, -0.427555084f, 0.634393275f, -0.773010433f, 0.242980182f, -0.970031261f,
+  0.901348829f, -0.433093816f, 0.624859512f, -0.780737221f, 0.225083917f, -0.974339366f,
+  0.898674488f, -0.438616246f, 0.615231574f, -0.78834641f, 0.207111374f, -0.97831738f,
+  0.895966232f, -0.444122136f, 0.605511069f, -0.795836926f, 0.18906866f, -0.981963873f,
+  0.893224299f, -0.449611336f, 0.59569931f, -0.803207517f, 0.170961887f, -0.985277653f,
+  0.890448749f, -0.455083579f, 0.585797846f, -0.81045717f, 0.152797192f, -0.988257587f,
+  0.887639642f, -0.460538715f, 0.575808167f, -0.817584813f, 0.134580702f, -0.990902662f,
+  0.884797096f, -0.465976506f, 0.565731823f, -0.824589312f, 0.116318628f, -0.993211925f,
+  0.881921291f, -0.471396744f, 0.555570245f, -0.831469595f, 0.0980171412f, -0.99518472f,
+  0.879012227f, -0.47679922f, 0.545324981f, -0.838224709f, 0.0796824396f, -0.996820271f,
+  0.876070082f, -0.482183784f, 0.534997642f, -0.84485358f, 0.061320737f, -0.998118103f,
+  0.873094976f, -0.487550169f, 0.524589658f, -0.851355195f, 0.0429382585f, -0.999077737f,
+  0.870086968f, -0.492898196f, 0.514102757f, -0.857728601f, 0.024541229f, -0.999698818f,
+  0.867046237f, -0.498227656f, 0.50353837f, -0.863972843f, 0.00613588467f, -0.999981165f,
+  0.863972843f, -0.50353837f, 0.492898196f, -0.870086968f, -0.0122715384f, -0.999924719f,
+  0.860866964f, -0.50883013f, 0.482183784f, -0.876070082f, -0.030674804f, -0.999529421f,
+  0.857728601f, -0.514102757f, 0.471396744f, -0.881921291f, -0.0490676761f, -0.99879545f,
+  0.854557991f, -0.519356012f, 0.460538715f, -0.887639642f, -0.0674439222f, -0.997723043f,
+  0.851355195f, -0.524589658f, 0.449611336f, -0.893224299f, -0.0857973099f, -0.996312618f,
+  0.848120332f, -0.529803634f, 0.438616246f, -0.898674488f, -0.104121633f, -0.994564593f,
+  0.84485358f, -0.534997642f, 0.427555084f, -0.903989315f, -0.122410677f, -0.992479563f,
+  0.841554999f, -0.540171444f, 0.416429549f, -0.909168005f, -0.140658244f, -0.990058184f,
+  0.838224709f, -0.545324981f, 0.405241311f, -0.914209783f, -0.15885815f, -0.987301409f,
+  0.834862888f, -0.550457954f, 0.393992037f, -0.919113874f, -0.177004218f, -0.984210074f,
+  0.831469595f, -0.555570245f, 0.382683426f, -0.923879504f, -0.195090324f, -0.980785251f,
+  0.82804507f, -0.560661554f, 0.371317208f, -0.928506076f, -0.213110313f, -0.977028131f,
+  0.824589312f, -0.565731823f, 0.359895051f, -0.932992816f, -0.231058106f, -0.972939968f,
+  0.8211025f, -0.570780754f, 0.348418683f, -0.937339008f, -0.248927608f, -0.968522072f,
+  0.817584813f, -0.575808167f, 0.336889863f, -0.941544056f, -0.266712755f, -0.963776052f,
+  0.81403631f, -0.580813944f, 0.32531029f, -0.945607305f, -0.284407526f, -0.958703458f,
+  0.81045717f, -0.585797846f, 0.313681751f, -0.949528158f, -0.302005947f, -0.953306019f,
+  0.806847572f, -0.590759695f, 0.302005947f, -0.953306019f, -0.319502026f, -0.947585583f,
+  0.803207517f, -0.59569931f, 0.290284663f, -0.956940353f, -0.336889863f, -0.941544056f,
+  0.799537241f, -0.600616455f, 0.27851969f, -0.960430503f, -0.354163527f, -0.935183525f,
+  0.795836926f, -0.605511069f, 0.266712755f, -0.963776052f, -0.371317208f, -0.928506076f,
+  0.792106569f, -0.610382795f, 0.254865646f, -0.966976464f, -0.388345033f, -0.921514034f,
+  0.78834641f, -0.615231574f, 0.242980182f, -0.970031261f, -0.405241311f, -0.914209783f,
+  0.784556568f, -0.620057225f, 0.231058106f, -0.972939968f, -0.422000259f, -0.906595707f,
+  0.780737221f, -0.624859512f, 0.219101235f, -0.975702107f, -0.438616246f, -0.898674488f,
+  0.77688849f, -0.629638255f, 0.207111374f, -0.97831738f, -0.455083579f, -0.890448749f,
+  0.773010433f, -0.634393275f, 0.195090324f, -0.980785251f, -0.471396744f, -0.881921291f,
+  0.769103348f, -0.639124453f, 0.183039889f, -0.983105481f, -0.487550169f, -0.873094976f,
+  0.765167236f, -0.643831551f, 0.170961887f, -0.985277653f, -0.50353837f, -0.863972843f,
+  0.761202395f, -0.64851439f, 0.15885815f, -0.987301409f, -0.519356012f, -0.854557991f,
+  0.757208824f, -0.653172851f, 0.146730468f, -0.989176512f, -0.534997642f, -0.84485358f,
+  0.753186822f, -0.657806695f, 0.134580702f, -0.990902662f, -0.550457954f, -0.834862888f,
+  0.749136388f, -0.662415802f, 0.122410677f, -0.992479563f, -0.565731823f, -0.824589312f,
+  0.745057762f, -0.666999936f, 0.110222206f, -0.993906975f, -0.580813944f, -0.81403631f,
+  0.740951121f, -0.671558976f, 0.0980171412f, -0.99518472f, -0.59569931f, -0.803207517f,
+  0.736816585f, -0.676092684f, 0.0857973099f, -0.996312618f, -0.610382795f, -0.792106569f,
+  0.732654274f, -0.680601001f, 0.0735645667f, -0.997290432f, -0.624859512f, -0.780737221f,
+  0.728464365f, -0.685083687f, 0.061320737f, -0.998118103f, -0.639124453f, -0.769103348f,
+  0.724247098f, -0.689540565f, 0.0490676761f, -0.99879545f, -0.653172851f, -0.757208824f,
+  0.720002532f, -0.693971455f, 0.0368072242f, -0.999322355f, -0.666999936f, -0.745057762f,
+  0.715730846f, -0.698376238f, 0.024541229f, -0.999698818f, -0.680601001f, -0.732654274f,
+  0.711432219f, -0.702754736f, 0.0122715384f, -0.999924719f, -0.693971455f, -0.720002532f,
+  0.707106769f, -0.707106769f, 0.0f, -1.0f, -0.707106769f, -0.707106769f,
+  0.702754736f, -0.711432219f, -0.0122715384f, -0.999924719f, -0.720002532f, -0.693971455f,
+  0.698376238f, -0.715730846f, -0.024541229f, -0.999698818f, -0.732654274f, -0.680601001f,
+  0.693971455f, -0.720002532f, -0.0368072242f, -0.999322355f, -0.745057762f, -0.666999936f,
+  0.689540565f, -0.724247098f, -0.0490676761f, -0.99879545f, -0.757208824f, -0.653172851f,
+  0.685083687f, -0.728464365f, -0.061320737f, -0.998118103f, -0.769103348f, -0.639124453f,
+  0.680601001f, -0.732654274f, -0.0735645667f, -0.997290432f, -0.780737221f, -0.624859512f,
+  0.676092684f, -0.736816585f, -0.0857973099f, -0.996312618f, -0.792106569f, -0.610382795f,
+  0.671558976f, -0.740951121f, -0.0980171412f, -0.99518472f, -0.803207517f, -0.59569931f,
+  0.666999936f, -0.745057762f, -0.110222206f, -0.993906975f, -0.81403631f, -0.580813944f,
+  0.662415802f, -0.749136388f, -0.122410677f, -0.992479563f, -0.824589312f, -0.565731823f,
+  0.657806695f, -0.753186822f, -0.134580702f, -0.990902662f, -0.834862888f, -0.550457954f,
+  0.653172851f, -0.757208824f, -0.146730468f, -0.989176512f, -0.84485358f, -0.534997642f,
+  0.64851439f, -0.761202395f, -0.15885815f, -0.987301409f, -0.854557991f, -0.519356012f,
+  0.643831551f, -0.765167236f, -0.170961887f, -0.985277653f, -0.863972843f, -0.50353837f,
+  0.639124453f, -0.769103348f, -0.183039889f, -0.983105481f, -0.873094976f, -0.487550169f,
+  0.634393275f, -0.773010433f, -0.195090324f, -0.980785251f, -0.881921291f, -0.471396744f,
+  0.629638255f, -0.77688849f, -0.207111374f, -0.97831738f, -0.890448749f, -0.455083579f,
+  0.624859512f, -0.780737221f, -0.219101235f, -0.975702107f, -0.898674488f, -0.438616246f,
+  0.620057225f, -0.784556568f, -0.231058106f, -0.972939968f, -0.906595707f, -0.422000259f,
+  0.615231574f, -0.78834641f, -0.242980182f, -0.970031261f, -0.914209783f, -0.405241311f,
+  0.610382795f, -0.792106569f, -0.254865646f, -0.966976464f, -0.921514034f, -0.388345033f,
+  0.605511069f, -0.795836926f, -0.266712755f, -0.963776052f, -0.928506076f, -0.371317208f,
+  0.600616455f, -0.799537241f, -0.27851969f, -0.960430503f, -0.935183525f, -0.354163527f,
+  0.59569931f, -0.803207517f, -0.290284663f, -0.956940353f, -0.941544056f, -0.336889863f,
+  0.590759695f, -0.806847572f, -0.302005947f, -0.953306019f, -0.947585583f, -0.319502026f,
+  0.585797846f, -0.81045717f, -0.313681751f, -0.949528158f, -0.953306019f, -0.302005947f,
+  0.580813944f, -0.81403631f, -0.32531029f, -0.945607305f, -0.958703458f, -0.284407526f,
+  0.575808167f, -0.817584813f, -0.336889863f, -0.941544056f, -0.963776052f, -0.266712755f,
+  0.570780754f, -0.8211025f, -0.348418683f, -0.937339008f, -0.968522072f, -0.248927608f,
+  0.565731823f, -0.824589312f, -0.359895051f, -0.932992816f, -0.972939968f, -0.231058106f,
+  0.560661554f, -0.82804507f, -0.371317208f, -0.928506076f, -0.977028131f, -0.213110313f,
+  0.555570245f, -0.831469595f, -0.382683426f, -0.923879504f, -0.980785251f, -0.195090324f,
+  0.550457954f, -0.834862888f, -0.393992037f, -0.919113874f, -0.984210074f, -0.177004218f,
+  0.545324981f, -0.838224709f, -0.405241311f, -0.914209783f, -0.987301409f, -0.15885815f,
+  0.540171444f, -0.841554999f, -0.416429549f, -0.909168005f, -0.990058184f, -0.140658244f,
+  0.534997642f, -0.84485358f, -0.427555084f, -0.903989315f, -0.992479563f, -0.122410677f,
+  0.529803634f, -0.848120332f, -0.438616246f, -0.898674488f, -0.994564593f, -0.104121633f,
+  0.524589658f, -0.851355195f, -0.449611336f, -0.893224299f, -0.996312618f, -0.0857973099f,
+  0.519356012f, -0.854557991f, -0.460538715f, -0.887639642f, -0.997723043f, -0.0674439222f,
+  0.514102757f, -0.857728601f, -0.471396744f, -0.881921291f, -0.99879545f, -0.0490676761f,
+  0.50883013f, -0.860866964f, -0.482183784f, -0.876070082f, -0.999529421f, -0.030674804f,
+  0.50353837f, -0.863972843f, -0.492898196f, -0.870086968f, -0.999924719f, -0.0122715384f,
+  0.498227656f, -0.867046237f, -0.50353837f, -0.863972843f, -0.999981165f, 0.00613588467f,
+  0.492898196f, -0.870086968f, -0.514102757f, -0.857728601f, -0.999698818f, 0.024541229f,
+  0.487550169f, -0.873094976f, -0.524589658f, -0.851355195f, -0.999077737f, 0.0429382585f,
+  0.482183784f, -0.876070082f, -0.534997642f, -0.84485358f, -0.998118103f, 0.061320737f,
+  0.47679922f, -0.879012227f, -0.545324981f, -0.838224709f, -0.996820271f, 0.0796824396f,
+  0.471396744f, -0.881921291f, -0.555570245f, -0.831469595f, -0.99518472f, 0.0980171412f,
+  0.465976506f, -0.884797096f, -0.565731823f, -0.824589312f, -0.993211925f, 0.116318628f,
+  0.460538715f, -0.887639642f, -0.575808167f, -0.817584813f, -0.990902662f, 0.134580702f,
+  0.455083579f, -0.890448749f, -0.585797846f, -0.81045717f, -0.988257587f, 0.152797192f,
+  0.449611336f, -0.893224299f, -0.59569931f, -0.803207517f, -0.985277653f, 0.170961887f,
+  0.444122136f, -0.895966232f, -0.605511069f, -0.795836926f, -0.981963873f, 0.18906866f,
+  0.438616246f, -0.898674488f, -0.615231574f, -0.78834641f, -0.97831738f, 0.207111374f,
+  0.433093816f, -0.901348829f, -0.624859512f, -0.780737221f, -0.974339366f, 0.225083917f,
+  0.427555084f, -0.903989315f, -0.634393275f, -0.773010433f, -0.970031261f, 0.242980182f,
+  0.422000259f, -0.906595707f, -0.643831551f, -0.765167236f, -0.965394437f, 0.260794103f,
+  0.416429549f, -0.909168005f, -0.653172851f, -0.757208824f, -0.960430503f, 0.27851969f,
+  0.410843164f, -0.91170603f, -0.662415802f, -0.749136388f, -0.955141187f, 0.296150893f,
+  0.405241311f, -0.914209783f, -0.671558976f, -0.740951121f, -0.949528158f, 0.313681751f,
+  0.399624199f, -0.916679084f, -0.680601001f, -0.732654274f, -0.943593442f, 0.331106305f,
+  0.393992037f, -0.919113874f, -0.689540565f, -0.724247098f, -0.937339008f, 0.348418683f,
+  0.388345033f, -0.921514034f, -0.698376238f, -0.715730846f, -0.93076694f, 0.365612984f,
+  0.382683426f, -0.923879504f, -0.707106769f, -0.707106769f, -0.923879504f, 0.382683426f,
+  0.377007425f, -0.926210225f, -0.715730846f, -0.698376238f, -0.916679084f, 0.399624199f,
+  0.371317208f, -0.928506076f, -0.724247098f, -0.689540565f, -0.909168005f, 0.416429549f,
+  0.365612984f, -0.93076694f, -0.732654274f, -0.680601001f, -0.901348829f, 0.433093816f,
+  0.359895051f, -0.932992816f, -0.740951121f, -0.671558976f, -0.893224299f, 0.449611336f,
+  0.354163527f, -0.935183525f, -0.749136388f, -0.662415802f, -0.884797096f, 0.465976506f,
+  0.348418683f, -0.937339008f, -0.757208824f, -0.653172851f, -0.876070082f, 0.482183784f,
+  0.342660725f, -0.939459205f, -0.765167236f, -0.643831551f, -0.867046237f, 0.498227656f,
+  0.336889863f, -0.941544056f, -0.773010433f, -0.634393275f, -0.857728601f, 0.514102757f,
+  0.331106305f, -0.943593442f, -0.780737221f, -0.624859512f, -0.848120332f, 0.529803634f,
+  0.32531029f, -0.945607305f, -0.78834641f, -0.615231574f, -0.838224709f, 0.545324981f,
+  0.319502026f, -0.947585583f, -0.795836926f, -0.605511069f, -0.82804507f, 0.560661554f,
+  0.313681751f, -0.949528158f, -0.803207517f, -0.59569931f, -0.817584813f, 0.575808167f,
+  0.307849646f, -0.95143503f, -0.81045717f, -0.585797846f, -0.806847572f, 0.590759695f,
+  0.302005947f, -0.953306019f, -0.817584813f, -0.575808167f, -0.795836926f, 0.605511069f,
+  0.296150893f, -0.955141187f, -0.824589312f, -0.565731823f, -0.784556568f, 0.620057225f,
+  0.290284663f, -0.956940353f, -0.831469595f, -0.555570245f, -0.773010433f, 0.634393275f,
+  0.284407526f, -0.958703458f, -0.838224709f, -0.545324981f, -0.761202395f, 0.64851439f,
+  0.27851969f, -0.960430503f, -0.84485358f, -0.534997642f, -0.749136388f, 0.662415802f,
+  0.272621363f, -0.962121427f, -0.851355195f, -0.524589658f, -0.736816585f, 0.676092684f,
+  0.266712755f, -0.963776052f, -0.857728601f, -0.514102757f, -0.724247098f, 0.689540565f,
+  0.260794103f, -0.965394437f, -0.863972843f, -0.50353837f, -0.711432219f, 0.702754736f,
+  0.254865646f, -0.966976464f, -0.870086968f, -0.492898196f, -0.698376238f, 0.715730846f,
+  0.248927608f, -0.968522072f, -0.876070082f, -0.482183784f, -0.685083687f, 0.728464365f,
+  0.242980182f, -0.970031261f, -0.881921291f, -0.471396744f, -0.671558976f, 0.740951121f,
+  0.237023607f, -0.971503913f, -0.887639642f, -0.460538715f, -0.657806695f, 0.753186822f,
+  0.231058106f, -0.972939968f, -0.893224299f, -0.449611336f, -0.643831551f, 0.765167236f,
+  0.225083917f, -0.974339366f, -0.898674488f, -0.438616246f, -0.629638255f, 0.77688849f,
+  0.219101235f, -0.975702107f, -0.903989315f, -0.427555084f, -0.615231574f, 0.78834641f,
+  0.213110313f, -0.977028131f, -0.909168005f, -0.416429549f, -0.600616455f, 0.799537241f,
+  0.207111374f, -0.97831738f, -0.914209783f, -0.405241311f, -0.585797846f, 0.81045717f,
+  0.201104641f, -0.979569793f, -0.919113874f, -0.393992037f, -0.570780754f, 0.8211025f,
+  0.195090324f, -0.980785251f, -0.923879504f, -0.382683426f, -0.555570245f, 0.831469595f,
+  0.18906866f, -0.981963873f, -0.928506076f, -0.371317208f, -0.540171444f, 0.841554999f,
+  0.183039889f, -0.983105481f, -0.932992816f, -0.359895051f, -0.524589658f, 0.851355195f,
+  0.177004218f, -0.984210074f, -0.937339008f, -0.348418683f, -0.50883013f, 0.860866964f,
+  0.170961887f, -0.985277653f, -0.941544056f, -0.336889863f, -0.492898196f, 0.870086968f,
+  0.164913118f, -0.986308098f, -0.945607305f, -0.32531029f, -0.47679922f, 0.879012227f,
+  0.15885815f, -0.987301409f, -0.949528158f, -0.313681751f, -0.460538715f, 0.887639642f,
+  0.152797192f, -0.988257587f, -0.953306019f, -0.302005947f, -0.444122136f, 0.895966232f,
+  0.146730468f, -0.989176512f, -0.956940353f, -0.290284663f, -0.427555084f, 0.903989315f,
+  0.140658244f, -0.990058184f, -0.960430503f, -0.27851969f, -0.410843164f, 0.91170603f,
+  0.134580702f, -0.990902662f, -0.963776052f, -0.266712755f, -0.393992037f, 0.919113874f,
+  0.128498107f, -0.991709769f, -0.966976464f, -0.254865646f, -0.377007425f, 0.926210225f,
+  0.122410677f, -0.992479563f, -0.970031261f, -0.242980182f, -0.359895051f, 0.932992816f,
+  0.116318628f, -0.993211925f, -0.972939968f, -0.231058106f, -0.342660725f, 0.939459205f,
+  0.110222206f, -0.993906975f, -0.975702107f, -0.219101235f, -0.32531029f, 0.945607305f,
+  0.104121633f, -0.994564593f, -0.97831738f, -0.207111374f, -0.307849646f, 0.95143503f,
+  0.0980171412f, -0.99518472f, -0.980785251f, -0.195090324f, -0.290284663f, 0.956940353f,
+  0.0919089541f, -0.995767415f, -0.983105481f, -0.183039889f, -0.272621363f, 0.962121427f,
+  0.0857973099f, -0.996312618f, -0.985277653f, -0.170961887f, -0.254865646f, 0.966976464f,
+  0.0796824396f, -0.996820271f, -0.987301409f, -0.15885815f, -0.237023607f, 0.971503913f,
+  0.0735645667f, -0.997290432f, -0.989176512f, -0.146730468f, -0.219101235f, 0.975702107f,
+  0.0674439222f, -0.997723043f, -0.990902662f, -0.134580702f, -0.201104641f, 0.979569793f,
+  0.061320737f, -0.998118103f, -0.992479563f, -0.122410677f, -0.183039889f, 0.983105481f,
+  0.0551952459f, -0.998475552f, -0.993906975f, -0.110222206f, -0.164913118f, 0.986308098f,
+  0.0490676761f, -0.99879545f, -0.99518472f, -0.0980171412f, -0.146730468f, 0.989176512f,
+  0.0429382585f, -0.999077737f, -0.996312618f, -0.0857973099f, -0.128498107f, 0.991709769f,
+  0.0368072242f, -0.999322355f, -0.997290432f, -0.0735645667f, -0.110222206f, 0.993906975f,
+  0.030674804f, -0.999529421f, -0.998118103f, -0.061320737f, -0.0919089541f, 0.995767415f,
+  0.024541229f, -0.999698818f, -0.99879545f, -0.0490676761f, -0.0735645667f, 0.997290432f,
+  0.0184067301f, -0.999830604f, -0.999322355f, -0.0368072242f, -0.0551952459f, 0.998475552f,
+  0.0122715384f, -0.999924719f, -0.999698818f, -0.024541229f, -0.0368072242f, 0.999322355f,
+  0.00613588467f, -0.999981165f, -0.999924719f, -0.0122715384f, -0.0184067301f, 0.999830604f
+};
+
+/* Stage 2 twiddle factors, {w1r, w1i, w2r, w2i, w3r, w3i} for each butterfly */
+static const float32_t cfftLen1024Twiddle2[384] =
+{
+  1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+  0.999698818f, -0.024541229f, 0.99879545f, -0.0490676761f, 0.997290432f, -0.0735645667f,
+  0.99879545f, -0.0490676761f, 0.99518472f, -0.0980171412f, 0.989176512f, -0.146730468f,
+  0.997290432f, -0.0735645667f, 0.989176512f, -0.146730468f, 0.975702107f, -0.219101235f,
+  0.99518472f, -0.0980171412f, 0.980785251f, -0.195090324f, 0.956940353f, -0.290284663f,
+  0.992479563f, -0.122410677f, 0.970031261f, -0.242980182f, 0.932992816f, -0.359895051f,
+  0.989176512f, -0.146730468f, 0.956940353f, -0.290284663f, 0.903989315f, -0.427555084f,
+  0.985277653f, -0.170961887f, 0.941544056f, -0.336889863f, 0.870086968f, -0.492898196f,
+  0.980785251f, -0.195090324f, 0.923879504f, -0.382683426f, 0.831469595f, -0.555570245f,
+  0.975702107f, -0.219101235f, 0.903989315f, -0.427555084f, 0.78834641f, -0.615231574f,
+  0.970031261f, -0.242980182f, 0.881921291f, -0.471396744f, 0.740951121f, -0.671558976f,
+  0.963776052f, -0.266712755f, 0.857728601f, -0.514102757f, 0.689540565f, -0.724247098f,
+  0.956940353f, -0.290284663f, 0.831469595f, -0.555570245f, 0.634393275f, -0.773010433f,
+  0.949528158f, -0.313681751f, 0.803207517f, -0.59569931f, 0.575808167f, -0.817584813f,
+  0.941544056f, -0.336889863f, 0.773010433f, -0.634393275f, 0.514102757f, -0.857728601f,
+  0.932992816f, -0.359895051f, 0.740951121f, -0.671558976f, 0.449611336f, -0.893224299f,
+  0.923879504f, -0.382683426f, 0.707106769f, -0.707106769f, 0.382683426f, -0.923879504f,
+  0.914209783f, -0.405241311f, 0.671558976f, -0.740951121f, 0.313681751f, -0.949528158f,
+  0.903989315f, -0.427555084f, 0.634393275f, -0.773010433f, 0.242980182f, -0.970031261f,
+  0.893224299f, -0.449611336f, 0.59569931f, -0.803207517f, 0.170961887f, -0.985277653f,
+  0.881921291f, -0.471396744f, 0.555570245f, -0.831469595f, 0.0980171412f, -0.99518472f,
+  0.870086968f, -0.492898196f, 0.514102757f, -0.857728601f, 0.024541229f, -0.999698818f,
+  0.857728601f, -0.514102757f, 0.471396744f, -0.881921291f, -0.0490676761f, -0.99879545f,
+  0.84485358f, -0.534997642f, 0.427555084f, -0.903989315f, -0.122410677f, -0.992479563f,
+  0.831469595f, -0.555570245f, 0.382683426f, -0.923879504f, -0.195090324f, -0.980785251f,
+  0.817584813f, -0.575808167f, 0.336889863f, -0.941544056f, -0.266712755f, -0.963776052f,
+  0.803207517f, -0.59569931f, 0.290284663f, -0.956940353f, -0.336889863f, -0.941544056f,
+  0.78834641f, -0.615231574f, 0.242980182f, -0.970031261f, -0.405241311f, -0.914209783f,
+  0.773010433f, -0.634393275f, 0.195090324f, -0.980785251f, -0.471396744f, -0.881921291f,
+  0.757208824f, -0.653172851f, 0.146730468f, -0.989176512f, -0.534997642f, -0.84485358f,
+  0.740951121f, -0.671558976f, 0.0980171412f, -0.99518472f, -0.59569931f, -0.803207517f,
+  0.724247098f, -0.689540565f, 0.0490676761f, -0.99879545f, -0.653172851f, -0.757208824f,
+  0.707106769f, -0.707106769f, 0.0f, -1.0f, -0.707106769f, -0.707106769f,
+  0.689540565f, -0.724247098f, -0.0490676761f, -0.99879545f, -0.757208824f, -0.653172851f,
+  0.671558976f, -0.740951121f, -0.0980171412f, -0.99518472f, -0.803207517f, -0.59569931f,
+  0.653172851f, -0.757208824f, -0.146730468f, -0.989176512f, -0.84485358f, -0.534997642f,
+  0.634393275f, -0.773010433f, -0.195090324f, -0.980785251f, -0.881921291f, -0.471396744f,
+  0.615231574f, -0.78834641f, -0.242980182f, -0.970031261f, -0.914209783f, -0.405241311f,
+  0.59569931f, -0.803207517f, -0.290284663f, -0.956940353f, -0.941544056f, -0.336889863f,
+  0.575808167f, -0.817584813f, -0.336889863f, -0.941544056f, -0.963776052f, -0.266712755f,
+  0.555570245f, -0.831469595f, -0.382683426f, -0.923879504f, -0.980785251f, -0.195090324f,
+  0.534997642f, -0.84485358f, -0.427555084f, -0.903989315f, -0.992479563f, -0.122410677f,
+  0.514102757f, -0.857728601f, -0.471396744f, -0.881921291f, -0.99879545f, -0.0490676761f,
+  0.492898196f, -0.870086968f, -0.514102757f, -0.857728601f, -0.999698818f, 0.024541229f,
+  0.471396744f, -0.881921291f, -0.555570245f, -0.831469595f, -0.99518472f, 0.0980171412f,
+  0.449611336f, -0.893224299f, -0.59569931f, -0.803207517f, -0.985277653f, 0.170961887f,
+  0.427555084f, -0.903989315f, -0.634393275f, -0.773010433f, -0.970031261f, 0.242980182f,
+  0.405241311f, -0.914209783f, -0.671558976f, -0.740951121f, -0.949528158f, 0.313681751f,
+  0.382683426f, -0.923879504f, -0.707106769f, -0.707106769f, -0.923879504f, 0.382683426f,
+  0.359895051f, -0.932992816f, -0.740951121f, -0.671558976f, -0.893224299f, 0.449611336f,
+  0.336889863f, -0.941544056f, -0.773010433f, -0.634393275f, -0.857728601f, 0.514102757f,
+  0.313681751f, -0.949528158f, -0.803207517f, -0.59569931f, -0.817584813f, 0.575808167f,
+  0.290284663f, -0.956940353f, -0.831469595f, -0.555570245f, -0.773010433f, 0.634393275f,
+  0.266712755f, -0.963776052f, -0.857728601f, -0.514102757f, -0.724247098f, 0.689540565f,
+  0.242980182f, -0.970031261f, -0.881921291f, -0.471396744f, -0.671558976f, 0.740951121f,
+  0.219101235f, -0.975702107f, -0.903989315f, -0.427555084f, -0.615231574f, 0.78834641f,
+  0.195090324f, -0.980785251f, -0.923879504f, -0.382683426f, -0.555570245f, 0.831469595f,
+  0.170961887f, -0.985277653f, -0.941544056f, -0.336889863f, -0.492898196f, 0.870086968f,
+  0.146730468f, -0.989176512f, -0.956940353f, -0.290284663f, -0.427555084f, 0.903989315f,
+  0.122410677f, -0.992479563f, -0.970031261f, -0.242980182f, -0.359895051f, 0.932992816f,
+  0.0980171412f, -0.99518472f, -0.980785251f, -0.195090324f, -0.290284663f, 0.956940353f,
+  0.0735645667f, -0.997290432f, -0.989176512f, -0.146730468f, -0.219101235f, 0.975702107f,
+  0.0490676761f, -0.99879545f, -0.99518472f, -0.0980171412f, -0.146730468f, 0.989176512f,
+  0.024541229f, -0.999698818f, -0.99879545f, -0.0490676761f, -0.0735645667f, 0.997290432f
+};
+
+/* Stage 3 twiddle factors, {w1r, w1i, w2r, w2i, w3r, w3i} for each butterfly */
+static const float32_t cfftLen1024Twiddle3[96] =
+{
+  1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+  0.99518472f, -0.0980171412f, 0.980785251f, -0.195090324f, 0.956940353f, -0.290284663f,
+  0.980785251f, -0.195090324f, 0.923879504f, -0.382683426f, 0.831469595f, -0.555570245f,
+  0.956940353f, -0.290284663f, 0.831469595f, -0.555570245f, 0.634393275f, -0.773010433f,
+  0.923879504f, -0.382683426f, 0.707106769f, -0.707106769f, 0.382683426f, -0.923879504f,
+  0.881921291f, -0.471396744f, 0.555570245f, -0.831469595f, 0.0980171412f, -0.99518472f,
+  0.831469595f, -0.555570245f, 0.382683426f, -0.923879504f, -0.195090324f, -0.980785251f,
+  0.773010433f, -0.634393275f, 0.195090324f, -0.980785251f, -0.471396744f, -0.881921291f,
+  0.707106769f, -0.707106769f, 0.0f, -1.0f, -0.707106769f, -0.707106769f,
+  0.634393275f, -0.773010433f, -0.195090324f, -0.980785251f, -0.881921291f, -0.471396744f,
+  0.555570245f, -0.831469595f, -0.382683426f, -0.923879504f, -0.980785251f, -0.195090324f,
+  0.471396744f, -0.881921291f, -0.555570245f, -0.831469595f, -0.99518472f, 0.0980171412f,
+  0.382683426f, -0.923879504f, -0.707106769f, -0.707106769f, -0.923879504f, 0.382683426f,
+  0.290284663f, -0.956940353f, -0.831469595f, -0.555570245f, -0.773010433f, 0.634393275f,
+  0.195090324f, -0.980785251f, -0.923879504f, -0.382683426f, -0.555570245f, 0.831469595f,
+  0.0980171412f, -0.99518472f, -0.980785251f, -0.195090324f, -0.290284663f, 0.956940353f
+};
+
+static void cfft_len1024_forward(
+  float32_t * p,
+  float32_t * pScratch)
+{
+  const float32_t *px;                           /* Input pointer */
+  float32_t *py;                                 /* Output pointer */
+  const float32_t *pTw;                          /* Twiddle factor pointer */
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i;        /* Twiddle factors */
+  float32_t ar, ai, br, bi, cr, ci, dr, di;      /* Butterfly inputs */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;  /* Temporary variables */
+  float32_t ur, ui, vr, vi, wr, wi;              /* Temporary variables */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* Stage 1: radix-4, 256 butterflies of stride 1, p to pScratch */
+  pTw = cfftLen1024Twiddle1;
+  px = p;
+  py = pScratch;
+  for(i = 0u; i < 256u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[2] = vr * w1r - vi * w1i;
+    py[3] = vr * w1i + vi * w1r;
+    py[4] = ur * w2r - ui * w2i;
+    py[5] = ur * w2i + ui * w2r;
+    py[6] = wr * w3r - wi * w3i;
+    py[7] = wr * w3i + wi * w3r;
+    px += 2;
+    py += 8;
+  }
+
+  /* Stage 2: radix-4, 256 butterflies of stride 4, pScratch to p */
+  pTw = cfftLen1024Twiddle2;
+  px = pScratch;
+  py = p;
+  for(i = 0u; i < 64u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    for(j = 0u; j < 4u; j++)
+    {
+      ar = px[0];
+      ai = px[1];
+      br = px[512];
+      bi = px[513];
+      cr = px[1024];
+      ci = px[1025];
+      dr = px[1536];
+      di = px[1537];
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+      py[0] = t0r + t2r;
+      py[1] = t0i + t2i;
+      ur = t0r - t2r;
+      ui = t0i - t2i;
+      vr = t1r + t3i;
+      vi = t1i - t3r;
+      wr = t1r - t3i;
+      wi = t1i + t3r;
+      py[8] = vr * w1r - vi * w1i;
+      py[9] = vr * w1i + vi * w1r;
+      py[16] = ur * w2r - ui * w2i;
+      py[17] = ur * w2i + ui * w2r;
+      py[24] = wr * w3r - wi * w3i;
+      py[25] = wr * w3i + wi * w3r;
+      px += 2;
+      py += 2;
+    }
+    py += 24;
+  }
+
+  /* Stage 3: radix-4, 256 butterflies of stride 16, p to pScratch */
+  pTw = cfftLen1024Twiddle3;
+  px = p;
+  py = pScratch;
+  for(i = 0u; i < 16u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    for(j = 0u; j < 16u; j++)
+    {
+      ar = px[0];
+      ai = px[1];
+      br = px[512];
+      bi = px[513];
+      cr = px[1024];
+      ci = px[1025];
+      dr = px[1536];
+      di = px[1537];
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+      py[0] = t0r + t2r;
+      py[1] = t0i + t2i;
+      ur = t0r - t2r;
+      ui = t0i - t2i;
+      vr = t1r + t3i;
+      vi = t1i - t3r;
+      wr = t1r - t3i;
+      wi = t1i + t3r;
+      py[32] = vr * w1r - vi * w1i;
+      py[33] = vr * w1i + vi * w1r;
+      py[64] = ur * w2r - ui * w2i;
+      py[65] = ur * w2i + ui * w2r;
+      py[96] = wr * w3r - wi * w3i;
+      py[97] = wr * w3i + wi * w3r;
+      px += 2;
+      py += 2;
+    }
+    py += 96;
+  }
+
+  /* Stage 4: radix-4, 256 butterflies of stride 64, pScratch to p */
+  px = pScratch;
+  py = p;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[128] = vr;
+    py[129] = vi;
+    py[256] = ur;
+    py[257] = ui;
+    py[384] = wr;
+    py[385] = wi;
+    px += 2;
+    py += 2;
+  }
+  px = pScratch + 128;
+  py = p + 512;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[128] = vr * 0.923879504f - vi * -0.382683426f;
+    py[129] = vr * -0.382683426f + vi * 0.923879504f;
+    py[256] = ur * 0.707106769f - ui * -0.707106769f;
+    py[257] = ur * -0.707106769f + ui * 0.707106769f;
+    py[384] = wr * 0.382683426f - wi * -0.923879504f;
+    py[385] = wr * -0.923879504f + wi * 0.382683426f;
+    px += 2;
+    py += 2;
+  }
+  px = pScratch + 256;
+  py = p + 1024;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[128] = vr * 0.707106769f - vi * -0.707106769f;
+    py[129] = vr * -0.707106769f + vi * 0.707106769f;
+    py[256] = ui;
+    py[257] = -ur;
+    py[384] = wr * -0.707106769f - wi * -0.707106769f;
+    py[385] = wr * -0.707106769f + wi * -0.707106769f;
+    px += 2;
+    py += 2;
+  }
+  px = pScratch + 384;
+  py = p + 1536;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[128] = vr * 0.382683426f - vi * -0.923879504f;
+    py[129] = vr * -0.923879504f + vi * 0.382683426f;
+    py[256] = ur * -0.707106769f - ui * -0.707106769f;
+    py[257] = ur * -0.707106769f + ui * -0.707106769f;
+    py[384] = wr * -0.923879504f - wi * 0.382683426f;
+    py[385] = wr * 0.382683426f + wi * -0.923879504f;
+    px += 2;
+    py += 2;
+  }
+
+  /* Stage 5: radix-4, 256 butterflies of stride 256, p to p */
+  px = p;
+  py = p;
+  for(j = 0u; j < 256u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[512] = vr;
+    py[513] = vi;
+    py[1024] = ur;
+    py[1025] = ui;
+    py[1536] = wr;
+    py[1537] = wi;
+    px += 2;
+    py += 2;
+  }
+}
+
+static void cfft_len1024_inverse(
+  float32_t * p,
+  float32_t * pScratch)
+{
+  const float32_t *px;                           /* Input pointer */
+  float32_t *py;                                 /* Output pointer */
+  const float32_t *pTw;                          /* Twiddle factor pointer */
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i;        /* Twiddle factors */
+  float32_t ar, ai, br, bi, cr, ci, dr, di;      /* Butterfly inputs */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;  /* Temporary variables */
+  float32_t ur, ui, vr, vi, wr, wi;              /* Temporary variables */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* Stage 1: radix-4, 256 butterflies of stride 1, p to pScratch */
+  pTw = cfftLen1024Twiddle1;
+  px = p;
+  py = pScratch;
+  for(i = 0u; i < 256u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[2] = vr * w1r + vi * w1i;
+    py[3] = vi * w1r - vr * w1i;
+    py[4] = ur * w2r + ui * w2i;
+    py[5] = ui * w2r - ur * w2i;
+    py[6] = wr * w3r + wi * w3i;
+    py[7] = wi * w3r - wr * w3i;
+    px += 2;
+    py += 8;
+  }
+
+  /* Stage 2: radix-4, 256 butterflies of stride 4, pScratch to p */
+  pTw = cfftLen1024Twiddle2;
+  px = pScratch;
+  py = p;
+  for(i = 0u; i < 64u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    for(j = 0u; j < 4u; j++)
+    {
+      ar = px[0];
+      ai = px[1];
+      br = px[512];
+      bi = px[513];
+      cr = px[1024];
+      ci = px[1025];
+      dr = px[1536];
+      di = px[1537];
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+      py[0] = t0r + t2r;
+      py[1] = t0i + t2i;
+      ur = t0r - t2r;
+      ui = t0i - t2i;
+      vr = t1r - t3i;
+      vi = t1i + t3r;
+      wr = t1r + t3i;
+      wi = t1i - t3r;
+      py[8] = vr * w1r + vi * w1i;
+      py[9] = vi * w1r - vr * w1i;
+      py[16] = ur * w2r + ui * w2i;
+      py[17] = ui * w2r - ur * w2i;
+      py[24] = wr * w3r + wi * w3i;
+      py[25] = wi * w3r - wr * w3i;
+      px += 2;
+      py += 2;
+    }
+    py += 24;
+  }
+
+  /* Stage 3: radix-4, 256 butterflies of stride 16, p to pScratch */
+  pTw = cfftLen1024Twiddle3;
+  px = p;
+  py = pScratch;
+  for(i = 0u; i < 16u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    for(j = 0u; j < 16u; j++)
+    {
+      ar = px[0];
+      ai = px[1];
+      br = px[512];
+      bi = px[513];
+      cr = px[1024];
+      ci = px[1025];
+      dr = px[1536];
+      di = px[1537];
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+      py[0] = t0r + t2r;
+      py[1] = t0i + t2i;
+      ur = t0r - t2r;
+      ui = t0i - t2i;
+      vr = t1r - t3i;
+      vi = t1i + t3r;
+      wr = t1r + t3i;
+      wi = t1i - t3r;
+      py[32] = vr * w1r + vi * w1i;
+      py[33] = vi * w1r - vr * w1i;
+      py[64] = ur * w2r + ui * w2i;
+      py[65] = ui * w2r - ur * w2i;
+      py[96] = wr * w3r + wi * w3i;
+      py[97] = wi * w3r - wr * w3i;
+      px += 2;
+      py += 2;
+    }
+    py += 96;
+  }
+
+  /* Stage 4: radix-4, 256 butterflies of stride 64, pScratch to p */
+  px = pScratch;
+  py = p;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[128] = vr;
+    py[129] = vi;
+    py[256] = ur;
+    py[257] = ui;
+    py[384] = wr;
+    py[385] = wi;
+    px += 2;
+    py += 2;
+  }
+  px = pScratch + 128;
+  py = p + 512;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[128] = vr * 0.923879504f - vi * 0.382683426f;
+    py[129] = vr * 0.382683426f + vi * 0.923879504f;
+    py[256] = ur * 0.707106769f - ui * 0.707106769f;
+    py[257] = ur * 0.707106769f + ui * 0.707106769f;
+    py[384] = wr * 0.382683426f - wi * 0.923879504f;
+    py[385] = wr * 0.923879504f + wi * 0.382683426f;
+    px += 2;
+    py += 2;
+  }
+  px = pScratch + 256;
+  py = p + 1024;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[128] = vr * 0.707106769f - vi * 0.707106769f;
+    py[129] = vr * 0.707106769f + vi * 0.707106769f;
+    py[256] = -ui;
+    py[257] = ur;
+    py[384] = wr * -0.707106769f - wi * 0.707106769f;
+    py[385] = wr * 0.707106769f + wi * -0.707106769f;
+    px += 2;
+    py += 2;
+  }
+  px = pScratch + 384;
+  py = p + 1536;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[128] = vr * 0.382683426f - vi * 0.923879504f;
+    py[129] = vr * 0.923879504f + vi * 0.382683426f;
+    py[256] = ur * -0.707106769f - ui * 0.707106769f;
+    py[257] = ur * 0.707106769f + ui * -0.707106769f;
+    py[384] = wr * -0.923879504f - wi * -0.382683426f;
+    py[385] = wr * -0.382683426f + wi * -0.923879504f;
+    px += 2;
+    py += 2;
+  }
+
+  /* Stage 5: radix-4, 256 butterflies of stride 256, p to p */
+  px = p;
+  py = p;
+  for(j = 0u; j < 256u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[512];
+    bi = px[513];
+    cr = px[1024];
+    ci = px[1025];
+    dr = px[1536];
+    di = px[1537];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = (t0r + t2r) * 0.0009765625f;
+    py[1] = (t0i + t2i) * 0.0009765625f;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[512] = vr * 0.0009765625f;
+    py[513] = vi * 0.0009765625f;
+    py[1024] = ur * 0.0009765625f;
+    py[1025] = ui * 0.0009765625f;
+    py[1536] = wr * 0.0009765625f;
+    py[1537] = wi * 0.0009765625f;
+    px += 2;
+    py += 2;
+  }
+}
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point complex FFT of 1024 points.    
+ * @param[in, out] *p points to the complex data buffer of size <code>2048</code>, processed in place.    
+ * @param[in]  *pScratch points to a scratch buffer of size <code>2048</code>.    
+ * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @return     none.    
+ *    
+ * The result is the same as the one of <code>arm_cfft_f32(&arm_cfft_sR_f32_len1024, p, ifftFlag, 1)</code>,    
+ * in natural order and with the <code>1/1024</code> scaling of the inverse transform.    
+ * The 5 stages use constant lengths and twiddle factors and need no bit reversal.    
+ */
+
+void arm_cfft_len1024_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag)
+{
+  if(ifftFlag == 1u)
+  {
+    cfft_len1024_inverse(p, pScratch);
+  }
+  else
+  {
+    cfft_len1024_forward(p, pScratch);
+  }
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
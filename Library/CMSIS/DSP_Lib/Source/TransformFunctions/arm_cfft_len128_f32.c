@@ -0,0 +1,542 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_cfft_len128_f32.c    
+*    
+* Description:  Floating-point complex FFT of 128 points.    
+*               Generated by arm_fft_gen, do not edit.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/* Stage 1 twiddle factors, {w1r, w1i, w2r, w2i, w3r, w3i} for each butterfly */
+static const float32_t cfftLen128Twiddle1[192] =
+{
+  1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+  0.99879545f, -0.0490676761f, 0.99518472f, -0.0980171412f, 0.989176512f, -0.146730468f,
+  0.99518472f, -0.0980171412f, 0.980785251f, -0.195090324f, 0.956940353f, -0.290284663f,
+  0.989176512f, -0.146730468f, 0.956940353f, -0.290284663f, 0.903989315f, -0.427555084f,
+  0.980785251f, -0.195090324f, 0.923879504f, -0.382683426f, 0.831469595f, -0.555570245f,
+  0.970031261f, -0.242980182f, 0.881921291f, -0.471396744f, 0.740951121f, -0.671558976f,
+  0.956940353f, -0.290284663f, 0.831469595f, -0.555570245f, 0.634393275f, -0.773010433f,
+  0.941544056f, -0.336889863f, 0.773010433f, -0.634393275f, 0.514102757f, -0.857728601f,
+  0.923879504f, -0.382683426f, 0.707106769f, -0.707106769f, 0.382683426f, -0.923879504f,
+  0.903989315f, -0.427555084f, 0.634393275f, -0.773010433f, 0.242980182f, -0.970031261f,
+  0.881921291f, -0.471396744f, 0.555570245f, -0.831469595f, 0.0980171412f, -0.99518472f,
+  0.857728601f, -0.514102757f, 0.471396744f, -0.881921291f, -0.0490676761f, -0.99879545f,
+  0.831469595f, -0.555570245f, 0.382683426f, -0.923879504f, -0.195090324f, -0.980785251f,
+  0.803207517f, -0.59569931f, 0.290284663f, -0.956940353f, -0.336889863f, -0.941544056f,
+  0.773010433f, -0.634393275f, 0.195090324f, -0.980785251f, -0.471396744f, -0.881921291f,
+  0.740951121f, -0.671558976f, 0.0980171412f, -0.99518472f, -0.59569931f, -0.803207517f,
+  0.707106769f, -0.707106769f, 0.0f, -1.0f, -0.707106769f, -0.707106769f,
+  0.671558976f, -0.740951121f, -0.0980171412f, -0.99518472f, -0.803207517f, -0.59569931f,
+  0.634393275f, -0.773010433f, -0.195090324f, -0.980785251f, -0.881921291f, -0.471396744f,
+  0.59569931f, -0.803207517f, -0.290284663f, -0.956940353f, -0.941544056f, -0.336889863f,
+  0.555570245f, -0.831469595f, -0.382683426f, -0.923879504f, -0.980785251f, -0.195090324f,
+  0.514102757f, -0.857728601f, -0.471396744f, -0.881921291f, -0.99879545f, -0.0490676761f,
+  0.471396744f, -0.881921291f, -0.555570245f, -0.831469595f, -0.99518472f, 0.0980171412f,
+  0.427555084f, -0.903989315f, -0.634393275f, -0.773010433f, -0.970031261f, 0.242980182f,
+  0.382683426f, -0.923879504f, -0.707106769f, -0.707106769f, -0.923879504f, 0.382683426f,
+  0.336889863f, -0.941544056f, -0.773010433f, -0.634393275f, -0.857728601f, 0.514102757f,
+  0.290284663f, -0.956940353f, -0.831469595f, -0.555570245f, -0.773010433f, 0.634393275f,
+  0.242980182f, -0.970031261f, -0.881921291f, -0.471396744f, -0.671558976f, 0.740951121f,
+  0.195090324f, -0.980785251f, -0.923879504f, -0.382683426f, -0.555570245f, 0.831469595f,
+  0.146730468f, -0.989176512f, -0.956940353f, -0.290284663f, -0.427555084f, 0.903989315f,
+  0.0980171412f, -0.99518472f, -0.980785251f, -0.195090324f, -0.290284663f, 0.956940353f,
+  0.0490676761f, -0.99879545f, -0.99518472f, -0.0980171412f, -0.146730468f, 0.989176512f
+};
+
+/* Stage 2 twiddle factors, {w1r, w1i, w2r, w2i, w3r, w3i} for each butterfly */
+static const float32_t cfftLen128Twiddle2[48] =
+{
+  1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+  0.980785251f, -0.195090324f, 0.923879504f, -0.382683426f, 0.831469595f, -0.555570245f,
+  0.923879504f, -0.382683426f, 0.707106769f, -0.707106769f, 0.382683426f, -0.923879504f,
+  0.831469595f, -0.555570245f, 0.382683426f, -0.923879504f, -0.195090324f, -0.980785251f,
+  0.707106769f, -0.707106769f, 0.0f, -1.0f, -0.707106769f, -0.707106769f,
+  0.555570245f, -0.831469595f, -0.382683426f, -0.923879504f, -0.980785251f, -0.195090324f,
+  0.382683426f, -0.923879504f, -0.707106769f, -0.707106769f, -0.923879504f, 0.382683426f,
+  0.195090324f, -0.980785251f, -0.923879504f, -0.382683426f, -0.555570245f, 0.831469595f
+};
+
+static void cfft_len128_forward(
+  float32_t * p,
+  float32_t * pScratch)
+{
+  const float32_t *px;                           /* Input pointer */
+  float32_t *py;                                 /* Output pointer */
+  const float32_t *pTw;                          /* Twiddle factor pointer */
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i;        /* Twiddle factors */
+  float32_t ar, ai, br, bi, cr, ci, dr, di;      /* Butterfly inputs */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;  /* Temporary variables */
+  float32_t ur, ui, vr, vi, wr, wi;              /* Temporary variables */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* Stage 1: radix-4, 32 butterflies of stride 1, p to pScratch */
+  pTw = cfftLen128Twiddle1;
+  px = p;
+  py = pScratch;
+  for(i = 0u; i < 32u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    ar = px[0];
+    ai = px[1];
+    br = px[64];
+    bi = px[65];
+    cr = px[128];
+    ci = px[129];
+    dr = px[192];
+    di = px[193];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[2] = vr * w1r - vi * w1i;
+    py[3] = vr * w1i + vi * w1r;
+    py[4] = ur * w2r - ui * w2i;
+    py[5] = ur * w2i + ui * w2r;
+    py[6] = wr * w3r - wi * w3i;
+    py[7] = wr * w3i + wi * w3r;
+    px += 2;
+    py += 8;
+  }
+
+  /* Stage 2: radix-4, 32 butterflies of stride 4, pScratch to p */
+  pTw = cfftLen128Twiddle2;
+  px = pScratch;
+  py = p;
+  for(i = 0u; i < 8u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    for(j = 0u; j < 4u; j++)
+    {
+      ar = px[0];
+      ai = px[1];
+      br = px[64];
+      bi = px[65];
+      cr = px[128];
+      ci = px[129];
+      dr = px[192];
+      di = px[193];
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+      py[0] = t0r + t2r;
+      py[1] = t0i + t2i;
+      ur = t0r - t2r;
+      ui = t0i - t2i;
+      vr = t1r + t3i;
+      vi = t1i - t3r;
+      wr = t1r - t3i;
+      wi = t1i + t3r;
+      py[8] = vr * w1r - vi * w1i;
+      py[9] = vr * w1i + vi * w1r;
+      py[16] = ur * w2r - ui * w2i;
+      py[17] = ur * w2i + ui * w2r;
+      py[24] = wr * w3r - wi * w3i;
+      py[25] = wr * w3i + wi * w3r;
+      px += 2;
+      py += 2;
+    }
+    py += 24;
+  }
+
+  /* Stage 3: radix-4, 32 butterflies of stride 16, p to pScratch */
+  px = p;
+  py = pScratch;
+  for(j = 0u; j < 16u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[64];
+    bi = px[65];
+    cr = px[128];
+    ci = px[129];
+    dr = px[192];
+    di = px[193];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[32] = vr;
+    py[33] = vi;
+    py[64] = ur;
+    py[65] = ui;
+    py[96] = wr;
+    py[97] = wi;
+    px += 2;
+    py += 2;
+  }
+  px = p + 32;
+  py = pScratch + 128;
+  for(j = 0u; j < 16u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[64];
+    bi = px[65];
+    cr = px[128];
+    ci = px[129];
+    dr = px[192];
+    di = px[193];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r + t3i;
+    vi = t1i - t3r;
+    wr = t1r - t3i;
+    wi = t1i + t3r;
+    py[32] = vr * 0.707106769f - vi * -0.707106769f;
+    py[33] = vr * -0.707106769f + vi * 0.707106769f;
+    py[64] = ui;
+    py[65] = -ur;
+    py[96] = wr * -0.707106769f - wi * -0.707106769f;
+    py[97] = wr * -0.707106769f + wi * -0.707106769f;
+    px += 2;
+    py += 2;
+  }
+
+  /* Stage 4: radix-2, 64 butterflies of stride 64, pScratch to p */
+  px = pScratch;
+  py = p;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[128];
+    bi = px[129];
+    py[0] = ar + br;
+    py[1] = ai + bi;
+    py[128] = ar - br;
+    py[129] = ai - bi;
+    px += 2;
+    py += 2;
+  }
+}
+
+static void cfft_len128_inverse(
+  float32_t * p,
+  float32_t * pScratch)
+{
+  const float32_t *px;                           /* Input pointer */
+  float32_t *py;                                 /* Output pointer */
+  const float32_t *pTw;                          /* Twiddle factor pointer */
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i;        /* Twiddle factors */
+  float32_t ar, ai, br, bi, cr, ci, dr, di;      /* Butterfly inputs */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;  /* Temporary variables */
+  float32_t ur, ui, vr, vi, wr, wi;              /* Temporary variables */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* Stage 1: radix-4, 32 butterflies of stride 1, p to pScratch */
+  pTw = cfftLen128Twiddle1;
+  px = p;
+  py = pScratch;
+  for(i = 0u; i < 32u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    ar = px[0];
+    ai = px[1];
+    br = px[64];
+    bi = px[65];
+    cr = px[128];
+    ci = px[129];
+    dr = px[192];
+    di = px[193];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[2] = vr * w1r + vi * w1i;
+    py[3] = vi * w1r - vr * w1i;
+    py[4] = ur * w2r + ui * w2i;
+    py[5] = ui * w2r - ur * w2i;
+    py[6] = wr * w3r + wi * w3i;
+    py[7] = wi * w3r - wr * w3i;
+    px += 2;
+    py += 8;
+  }
+
+  /* Stage 2: radix-4, 32 butterflies of stride 4, pScratch to p */
+  pTw = cfftLen128Twiddle2;
+  px = pScratch;
+  py = p;
+  for(i = 0u; i < 8u; i++)
+  {
+    w1r = pTw[0];
+    w1i = pTw[1];
+    w2r = pTw[2];
+    w2i = pTw[3];
+    w3r = pTw[4];
+    w3i = pTw[5];
+    pTw += 6;
+
+    for(j = 0u; j < 4u; j++)
+    {
+      ar = px[0];
+      ai = px[1];
+      br = px[64];
+      bi = px[65];
+      cr = px[128];
+      ci = px[129];
+      dr = px[192];
+      di = px[193];
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+      py[0] = t0r + t2r;
+      py[1] = t0i + t2i;
+      ur = t0r - t2r;
+      ui = t0i - t2i;
+      vr = t1r - t3i;
+      vi = t1i + t3r;
+      wr = t1r + t3i;
+      wi = t1i - t3r;
+      py[8] = vr * w1r + vi * w1i;
+      py[9] = vi * w1r - vr * w1i;
+      py[16] = ur * w2r + ui * w2i;
+      py[17] = ui * w2r - ur * w2i;
+      py[24] = wr * w3r + wi * w3i;
+      py[25] = wi * w3r - wr * w3i;
+      px += 2;
+      py += 2;
+    }
+    py += 24;
+  }
+
+  /* Stage 3: radix-4, 32 butterflies of stride 16, p to pScratch */
+  px = p;
+  py = pScratch;
+  for(j = 0u; j < 16u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[64];
+    bi = px[65];
+    cr = px[128];
+    ci = px[129];
+    dr = px[192];
+    di = px[193];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[32] = vr;
+    py[33] = vi;
+    py[64] = ur;
+    py[65] = ui;
+    py[96] = wr;
+    py[97] = wi;
+    px += 2;
+    py += 2;
+  }
+  px = p + 32;
+  py = pScratch + 128;
+  for(j = 0u; j < 16u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[64];
+    bi = px[65];
+    cr = px[128];
+    ci = px[129];
+    dr = px[192];
+    di = px[193];
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+    py[0] = t0r + t2r;
+    py[1] = t0i + t2i;
+    ur = t0r - t2r;
+    ui = t0i - t2i;
+    vr = t1r - t3i;
+    vi = t1i + t3r;
+    wr = t1r + t3i;
+    wi = t1i - t3r;
+    py[32] = vr * 0.707106769f - vi * 0.707106769f;
+    py[33] = vr * 0.707106769f + vi * 0.707106769f;
+    py[64] = -ui;
+    py[65] = ur;
+    py[96] = wr * -0.707106769f - wi * 0.707106769f;
+    py[97] = wr * 0.707106769f + wi * -0.707106769f;
+    px += 2;
+    py += 2;
+  }
+
+  /* Stage 4: radix-2, 64 butterflies of stride 64, pScratch to p */
+  px = pScratch;
+  py = p;
+  for(j = 0u; j < 64u; j++)
+  {
+    ar = px[0];
+    ai = px[1];
+    br = px[128];
+    bi = px[129];
+    py[0] = (ar + br) * 0.0078125f;
+    py[1] = (ai + bi) * 0.0078125f;
+    py[128] = (ar - br) * 0.0078125f;
+    py[129] = (ai - bi) * 0.0078125f;
+    px += 2;
+    py += 2;
+  }
+}
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point complex FFT of 128 points.    
+ * @param[in, out] *p points to the complex data buffer of size <code>256</code>, processed in place.    
+ * @param[in]  *pScratch points to a scratch buffer of size <code>256</code>.    
+ * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @return     none.    
+ *    
+ * The result is the same as the one of <code>arm_cfft_f32(&arm_cfft_sR_f32_len128, p, ifftFlag, 1)</code>,    
+ * in natural order and with the <code>1/128</code> scaling of the inverse transform.    
+ * The 4 stages use constant lengths and twiddle factors and need no bit reversal.    
+ */
+
+void arm_cfft_len128_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag)
+{
+  if(ifftFlag == 1u)
+  {
+    cfft_len128_inverse(p, pScratch);
+  }
+  else
+  {
+    cfft_len128_forward(p, pScratch);
+  }
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
@@ -0,0 +1,250 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_f32.c    
+*    
+* Description:  Floating-point Goertzel filter bank processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup Goertzel Goertzel Filter Bank    
+ *    
+ * Computes the power of a few DFT bins of consecutive blocks of <code>N</code> samples, for Q31 and floating-point    
+ * data types. When only a handful of frequencies are monitored, as for DTMF tones, mains harmonics or bearing fault    
+ * frequencies, this costs about one multiply-accumulate per sample and per bin, compared to a complex FFT of the    
+ * whole block followed by the magnitude of every bin. The frequencies need not be multiples of <code>1/N</code>,    
+ * and <code>N</code> need not be a power of 2.    
+ *    
+ * \par Algorithm:    
+ * Each bin is a second order resonator at its normalized frequency <code>f</code>, run over the <code>N</code> samples:    
+ * <pre>    
+ *    s[n] = x[n] + 2 * cos(2*pi*f) * s[n-1] - s[n-2]    
+ * </pre>    
+ * After the last sample the squared magnitude of the DFT at <code>f</code> is    
+ * <pre>    
+ *    |X(f)|^2 = s[N-1]^2 + s[N-2]^2 - 2 * cos(2*pi*f) * s[N-1] * s[N-2]    
+ * </pre>    
+ * and the resonators are cleared for the next block.    
+ * A sine of amplitude <code>A</code> at frequency <code>f = k/N</code> gives <code>|X(f)|^2 = (A*N/2)^2</code>.    
+ *    
+ * \par    
+ * The samples can be passed one at a time or in blocks of any size, independent of <code>N</code>.    
+ * The processing function writes the <code>numBins</code> power values of each DFT completed during the call    
+ * to <code>pDst</code>, and returns the number of DFTs completed.    
+ * <code>pDst</code> must hold <code>numBins * (blockSize / N + 1)</code> values.    
+ *    
+ * \par    
+ * For a running spectrum updated at every sample rather than once per block, use the sliding DFT functions.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter bank.    
+ * There are separate instance structure declarations for each of the 2 supported data types.    
+ * The instance structures must be initialized with the initialization functions, which compute the coefficients    
+ * from the bin frequencies.    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point Goertzel filter bank.    
+ * @param[in,out] *S points to an instance of the floating-point Goertzel structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data, <code>numBins</code> power values for each completed DFT.    
+ * @param[in]  blockSize number of samples to process.    
+ * @return     number of DFTs completed during the call.    
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pc, *ps;                       /* Input, coefficient and state pointers */
+  float32_t c, s0, s1, s2;                       /* Coefficient and resonator states */
+  float32_t a1, a2, b1, b2, d1, d2, e1, e2;      /* States of four resonators */
+  float32_t c0, c1, c2, c3;                      /* Coefficients of four resonators */
+  float32_t x0, x1;                              /* Input samples */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t numOut = 0u;                          /* Number of DFTs completed */
+  uint32_t blkCnt, binCnt, n, bin;               /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Samples up to the end of the current DFT */
+    n = (uint32_t) S->blockLength - S->count;
+    n = (n < blockSize) ? n : blockSize;
+
+    pc = pCoeffs;
+    ps = pState;
+
+    /* Four bins at a time, on every core. Each resonator waits for its previous sample,    
+     ** so a single one is bound by the latency of the multiply-add. Four independent ones    
+     ** keep the pipeline busy, and cost nothing where floating-point is done in software. */
+    binCnt = numBins >> 2u;
+
+    while(binCnt > 0u)
+    {
+      c0 = pc[0];
+      c1 = pc[1];
+      c2 = pc[2];
+      c3 = pc[3];
+      a1 = ps[0];
+      a2 = ps[1];
+      b1 = ps[2];
+      b2 = ps[3];
+      d1 = ps[4];
+      d2 = ps[5];
+      e1 = ps[6];
+      e2 = ps[7];
+      px = pSrc;
+
+      /* The states swap roles at every sample instead of being moved */
+      blkCnt = n >> 1u;
+
+      while(blkCnt > 0u)
+      {
+        x0 = px[0];
+        x1 = px[1];
+        a2 = (x0 + (c0 * a1)) - a2;
+        b2 = (x0 + (c1 * b1)) - b2;
+        d2 = (x0 + (c2 * d1)) - d2;
+        e2 = (x0 + (c3 * e1)) - e2;
+        a1 = (x1 + (c0 * a2)) - a1;
+        b1 = (x1 + (c1 * b2)) - b1;
+        d1 = (x1 + (c2 * d2)) - d1;
+        e1 = (x1 + (c3 * e2)) - e1;
+        px += 2u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      if((n & 1u) != 0u)
+      {
+        x0 = px[0];
+        s0 = (x0 + (c0 * a1)) - a2;
+        a2 = a1;
+        a1 = s0;
+        s0 = (x0 + (c1 * b1)) - b2;
+        b2 = b1;
+        b1 = s0;
+        s0 = (x0 + (c2 * d1)) - d2;
+        d2 = d1;
+        d1 = s0;
+        s0 = (x0 + (c3 * e1)) - e2;
+        e2 = e1;
+        e1 = s0;
+      }
+
+      ps[0] = a1;
+      ps[1] = a2;
+      ps[2] = b1;
+      ps[3] = b2;
+      ps[4] = d1;
+      ps[5] = d2;
+      ps[6] = e1;
+      ps[7] = e2;
+      pc += 4u;
+      ps += 8u;
+
+      /* Decrement the bin counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is not a multiple of 4, process the remaining 1 to 3 bins here */
+    binCnt = numBins & 3u;
+
+    while(binCnt > 0u)
+    {
+      c = pc[0];
+      a1 = ps[0];
+      a2 = ps[1];
+      px = pSrc;
+
+      for (blkCnt = n; blkCnt > 0u; blkCnt--)
+      {
+        s0 = (*px++ + (c * a1)) - a2;
+        a2 = a1;
+        a1 = s0;
+      }
+
+      ps[0] = a1;
+      ps[1] = a2;
+      pc++;
+      ps += 2u;
+
+      /* Decrement the bin counter */
+      binCnt--;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count += (uint16_t) n;
+
+    /* End of a DFT, output the power of every bin and clear the resonators */
+    if(S->count == S->blockLength)
+    {
+      for (bin = 0u; bin < numBins; bin++)
+      {
+        s1 = pState[2u * bin];
+        s2 = pState[(2u * bin) + 1u];
+        *pDst++ = ((s1 * s1) + (s2 * s2)) - ((pCoeffs[bin] * s1) * s2);
+      }
+
+      arm_fill_f32(0.0f, pState, 2u * numBins);
+      S->count = 0u;
+      numOut++;
+    }
+  }
+
+  return (numOut);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,98 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_init_f32.c    
+*    
+* Description:  Floating-point Goertzel filter bank initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the floating-point Goertzel filter bank.    
+ * @param[in,out] *S points to an instance of the floating-point Goertzel structure.    
+ * @param[in]     numBins number of frequency bins.    
+ * @param[in]     blockLength number of samples <code>N</code> of each DFT.    
+ * @param[in]     *pFreqs points to the frequencies of the bins, normalized by the sample rate, in the range [0 0.5].    
+ * @param[out]    *pCoeffs points to the coefficient buffer of length <code>numBins</code>.    
+ * @param[in]     *pState points to the state buffer of length <code>2*numBins</code>.    
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLength</code> is 0.    
+ *    
+ * \par    
+ * The frequency of bin <code>k</code> of an <code>N</code> point DFT is <code>k/N</code>.    
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  if((numBins == 0u) || (blockLength == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->blockLength = blockLength;
+  S->count = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* 2 * cos(2 * pi * f) */
+  arm_scale_f32(pFreqs, 2.0f * PI, pCoeffs, numBins);
+  arm_vcos_f32(pCoeffs, pCoeffs, numBins);
+  arm_scale_f32(pCoeffs, 2.0f, pCoeffs, numBins);
+
+  /* Clear state buffer and the size of state buffer is 2*numBins */
+  memset(pState, 0, (2u * numBins) * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
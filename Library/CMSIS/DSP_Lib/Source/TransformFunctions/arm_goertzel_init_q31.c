@@ -0,0 +1,136 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_init_q31.c    
+*    
+* Description:  Q31 Goertzel filter bank initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the Q31 Goertzel filter bank.    
+ * @param[in,out] *S points to an instance of the Q31 Goertzel structure.    
+ * @param[in]     numBins number of frequency bins.    
+ * @param[in]     blockLength number of samples <code>N</code> of each DFT.    
+ * @param[in]     *pFreqs points to the frequencies of the bins, normalized by the sample rate, in the range [0 0.5].    
+ * @param[out]    *pCoeffs points to the coefficient buffer of length <code>numBins</code>.    
+ * @param[in]     *pState points to the state buffer of length <code>2*numBins</code>.    
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLength</code> is 0.    
+ *    
+ * \par    
+ * The frequency of bin <code>k</code> of an <code>N</code> point DFT is <code>k/N</code>, or    
+ * <code>(k << 31) / N</code> in 1.31 format.    
+ * \par    
+ * The gain of a resonator from the input to its state is at most <code>N/|sin(2*pi*f)|</code>, and    
+ * <code>N*(N+1)/2</code> close to 0 and 0.5. The input shift is the log2 of the largest gain of the bins,    
+ * rounded up, and at least the log2 of <code>N</code>, so that the DFT itself cannot overflow.    
+ * Bins close to 0 or 0.5 cost precision to the other bins of the same instance.    
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q31_t * pState)
+{
+  uint64_t gain, bound, maxGain;                 /* Gain of a resonator, largest gain */
+  q31_t sinW;                                    /* sin(2*pi*f) */
+  uint32_t shift, log2N, bin;                    /* Input shift, log2 of N, loop counter */
+
+  if((numBins == 0u) || (blockLength == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* cos(2 * pi * f), the input range [0 1) of the vector functions maps to [0 2*pi) */
+  arm_vcos_q31(pFreqs, pCoeffs, numBins);
+
+  maxGain = blockLength;
+  for (bin = 0u; bin < numBins; bin++)
+  {
+    arm_vsin_q31(&pFreqs[bin], &sinW, 1u);
+    sinW = (sinW > 0) ? sinW : (q31_t) __QSUB(0, sinW);
+
+    gain = ((uint64_t) blockLength * (blockLength + 1u)) >> 1;
+    if(sinW > 0)
+    {
+      bound = ((uint64_t) blockLength << 31) / (uint32_t) sinW;
+      gain = (bound < gain) ? bound : gain;
+    }
+    maxGain = (gain > maxGain) ? gain : maxGain;
+  }
+
+  shift = 0u;
+  while((shift < 31u) && (((uint64_t) 1u << shift) < maxGain))
+  {
+    shift++;
+  }
+
+  /* log2 of N rounded up, at most shift */
+  log2N = 0u;
+  while((1u << log2N) < blockLength)
+  {
+    log2N++;
+  }
+
+  S->numBins = numBins;
+  S->blockLength = blockLength;
+  S->count = 0u;
+  S->shift = (uint8_t) shift;
+  S->powerShift = (uint8_t) (2u * (shift - log2N));
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear state buffer and the size of state buffer is 2*numBins */
+  memset(pState, 0, (2u * numBins) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,220 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_q31.c    
+*    
+* Description:  Q31 Goertzel filter bank processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 Goertzel filter bank.    
+ * @param[in,out] *S points to an instance of the Q31 Goertzel structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data, <code>numBins</code> power values for each completed DFT.    
+ * @param[in]  blockSize number of samples to process.    
+ * @return     number of DFTs completed during the call.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is shifted right by <code>shift</code> bits, chosen by the initialization function so that the resonator    
+ * states cannot overflow for any input. The states are updated with 64-bit intermediate products.    
+ * The output in 1.31 format is <code>|X(f)|^2 / 2^(2*L)</code>, where <code>L</code> is the log2 of <code>N</code>    
+ * rounded up. When <code>N</code> is a power of 2 this is the power of the DFT divided by <code>N</code>, and a sine    
+ * of amplitude <code>A</code> at a bin frequency gives <code>A^2/4</code>.    
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *px, *pc, *ps;                           /* Input, coefficient and state pointers */
+  q31_t c, s0, s1, s2;                           /* Coefficient and resonator states */
+  q31_t a1, a2;                                  /* Resonator states */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t shift = S->shift;                     /* Input shift */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t numOut = 0u;                          /* Number of DFTs completed */
+  uint32_t blkCnt, binCnt, n, bin;               /* Loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  q31_t d, b1, b2;                               /* Coefficient and states of the second resonator */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blockSize > 0u)
+  {
+    /* Samples up to the end of the current DFT */
+    n = (uint32_t) S->blockLength - S->count;
+    n = (n < blockSize) ? n : blockSize;
+
+    pc = pCoeffs;
+    ps = pState;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two bins at a time, the two independent resonators keep the pipeline busy */
+    binCnt = numBins >> 1u;
+
+    while(binCnt > 0u)
+    {
+      c = pc[0];
+      d = pc[1];
+      a1 = ps[0];
+      a2 = ps[1];
+      b1 = ps[2];
+      b2 = ps[3];
+      px = pSrc;
+
+      /* The states swap roles at every sample instead of being moved.    
+       ** cos(2*pi*f) is in 1.31 format, shifting the product by 30 gives 2*cos(2*pi*f)*s[n-1]. */
+      blkCnt = n >> 1u;
+
+      while(blkCnt > 0u)
+      {
+        a2 = (q31_t) ((((q63_t) c * a1) >> 30) + (px[0] >> shift) - a2);
+        b2 = (q31_t) ((((q63_t) d * b1) >> 30) + (px[0] >> shift) - b2);
+        a1 = (q31_t) ((((q63_t) c * a2) >> 30) + (px[1] >> shift) - a1);
+        b1 = (q31_t) ((((q63_t) d * b2) >> 30) + (px[1] >> shift) - b1);
+        px += 2u;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+
+      if((n & 1u) != 0u)
+      {
+        s0 = (q31_t) ((((q63_t) c * a1) >> 30) + (px[0] >> shift) - a2);
+        a2 = a1;
+        a1 = s0;
+        s0 = (q31_t) ((((q63_t) d * b1) >> 30) + (px[0] >> shift) - b2);
+        b2 = b1;
+        b1 = s0;
+      }
+
+      ps[0] = a1;
+      ps[1] = a2;
+      ps[2] = b1;
+      ps[3] = b2;
+      pc += 2u;
+      ps += 4u;
+
+      /* Decrement the bin counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is odd, process the last bin here */
+    binCnt = numBins & 1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    binCnt = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(binCnt > 0u)
+    {
+      c = pc[0];
+      a1 = ps[0];
+      a2 = ps[1];
+      px = pSrc;
+
+      for (blkCnt = n; blkCnt > 0u; blkCnt--)
+      {
+        s0 = (q31_t) ((((q63_t) c * a1) >> 30) + (*px++ >> shift) - a2);
+        a2 = a1;
+        a1 = s0;
+      }
+
+      ps[0] = a1;
+      ps[1] = a2;
+      pc++;
+      ps += 2u;
+
+      /* Decrement the bin counter */
+      binCnt--;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    S->count += (uint16_t) n;
+
+    /* End of a DFT, output the power of every bin and clear the resonators */
+    if(S->count == S->blockLength)
+    {
+      for (bin = 0u; bin < numBins; bin++)
+      {
+        s1 = pState[2u * bin];
+        s2 = pState[(2u * bin) + 1u];
+
+        /* Half of the power in 2.62 format, so that the sum cannot overflow */
+        acc = (((q63_t) s1 * s1) >> 1) + (((q63_t) s2 * s2) >> 1);
+        acc -= (q63_t) ((q31_t) (((q63_t) pCoeffs[bin] * s1) >> 31)) * s2;
+
+        /* The power cannot be negative, rounding apart. Scale from the state format to 1/2^(2*log2(N)) */
+        acc = (acc > 0) ? acc : 0;
+        *pDst++ = clip_q63_to_q31((acc << S->powerShift) >> 30);
+      }
+
+      memset(pState, 0, (2u * numBins) * sizeof(q31_t));
+      S->count = 0u;
+      numOut++;
+    }
+  }
+
+  return (numOut);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,426 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_rfft_fast_len1024_f32.c    
+*    
+* Description:  Floating-point real FFT of 1024 points.    
+*               Generated by arm_fft_gen, do not edit.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/* Split twiddle factors, 0.5 * {sin(2*pi*k/1024), cos(2*pi*k/1024)} for k = 1 ... 255 */
+static const float32_t rfftLen1024Twiddle[510] =
+{
+  0.00306794234f, 0.499990582f,
+  0.00613576919f, 0.49996236f,
+  0.00920336507f, 0.499915302f,
+  0.0122706145f, 0.499849409f,
+  0.015337402f, 0.499764711f,
+  0.0184036121f, 0.499661177f,
+  0.0214691292f, 0.499538869f,
+  0.024533838f, 0.499397725f,
+  0.0275976229f, 0.499237776f,
+  0.0306603685f, 0.499059051f,
+  0.0337219611f, 0.498861521f,
+  0.0367822833f, 0.498645216f,
+  0.0398412198f, 0.498410136f,
+  0.0428986549f, 0.498156309f,
+  0.045954477f, 0.497883707f,
+  0.0490085706f, 0.49759236f,
+  0.0520608164f, 0.497282296f,
+  0.0551111028f, 0.496953487f,
+  0.0581593141f, 0.496605963f,
+  0.0612053387f, 0.496239781f,
+  0.0642490536f, 0.495854884f,
+  0.0672903508f, 0.495451331f,
+  0.0703291222f, 0.495029092f,
+  0.0733652338f, 0.494588256f,
+  0.0763985962f, 0.494128793f,
+  0.0794290751f, 0.493650705f,
+  0.0824565589f, 0.493154049f,
+  0.0854809433f, 0.492638826f,
+  0.0885021091f, 0.492105037f,
+  0.0915199444f, 0.49155274f,
+  0.0945343301f, 0.490981936f,
+  0.0975451618f, 0.490392625f,
+  0.10055232f, 0.489784896f,
+  0.103555687f, 0.48915869f,
+  0.106555156f, 0.488514066f,
+  0.109550618f, 0.487851053f,
+  0.112541959f, 0.487169683f,
+  0.115529053f, 0.486469984f,
+  0.118511803f, 0.485751957f,
+  0.121490091f, 0.485015631f,
+  0.124463804f, 0.484261036f,
+  0.127432823f, 0.483488232f,
+  0.130397052f, 0.482697219f,
+  0.133356377f, 0.481888026f,
+  0.136310682f, 0.481060714f,
+  0.139259845f, 0.480215251f,
+  0.142203763f, 0.479351729f,
+  0.145142332f, 0.478470176f,
+  0.148075446f, 0.477570593f,
+  0.151002973f, 0.47665301f,
+  0.153924823f, 0.475717515f,
+  0.156840876f, 0.474764079f,
+  0.159751013f, 0.473792791f,
+  0.162655145f, 0.472803652f,
+  0.165553153f, 0.471796721f,
+  0.168444932f, 0.470772028f,
+  0.171330363f, 0.469729602f,
+  0.174209341f, 0.468669504f,
+  0.177081764f, 0.467591763f,
+  0.179947525f, 0.466496408f,
+  0.182806492f, 0.46538347f,
+  0.185658604f, 0.464253038f,
+  0.188503712f, 0.463105112f,
+  0.191341713f, 0.461939752f,
+  0.194172516f, 0.460757017f,
+  0.196996018f, 0.459556937f,
+  0.199812099f, 0.458339542f,
+  0.202620655f, 0.457104892f,
+  0.205421582f, 0.455853015f,
+  0.208214775f, 0.454584002f,
+  0.21100013f, 0.453297853f,
+  0.213777542f, 0.451994658f,
+  0.216546908f, 0.450674415f,
+  0.219308123f, 0.449337244f,
+  0.222061068f, 0.447983116f,
+  0.224805668f, 0.446612149f,
+  0.227541789f, 0.445224375f,
+  0.230269358f, 0.443819821f,
+  0.232988253f, 0.442398548f,
+  0.235698372f, 0.440960646f,
+  0.23839961f, 0.439506114f,
+  0.241091892f, 0.438035041f,
+  0.243775085f, 0.436547488f,
+  0.246449098f, 0.435043484f,
+  0.249113828f, 0.433523118f,
+  0.251769185f, 0.431986421f,
+  0.254415065f, 0.430433482f,
+  0.257051378f, 0.4288643f,
+  0.259678006f, 0.427278996f,
+  0.262294829f, 0.425677598f,
+  0.264901817f, 0.424060166f,
+  0.267498821f, 0.42242679f,
+  0.270085722f, 0.4207775f,
+  0.272662491f, 0.419112355f,
+  0.275228977f, 0.417431444f,
+  0.277785122f, 0.415734798f,
+  0.280330777f, 0.414022535f,
+  0.282865912f, 0.412294656f,
+  0.285390377f, 0.41055125f,
+  0.287904084f, 0.408792406f,
+  0.290406972f, 0.407018155f,
+  0.292898923f, 0.405228585f,
+  0.295379847f, 0.403423786f,
+  0.297849655f, 0.401603758f,
+  0.300308228f, 0.399768621f,
+  0.302755535f, 0.397918463f,
+  0.305191398f, 0.396053284f,
+  0.307615787f, 0.394173205f,
+  0.310028613f, 0.392278284f,
+  0.312429756f, 0.390368611f,
+  0.314819127f, 0.388444245f,
+  0.317196637f, 0.386505216f,
+  0.319562227f, 0.384551674f,
+  0.321915776f, 0.382583618f,
+  0.324257195f, 0.380601197f,
+  0.326586425f, 0.378604412f,
+  0.328903347f, 0.376593411f,
+  0.331207901f, 0.374568194f,
+  0.333499968f, 0.372528881f,
+  0.335779488f, 0.37047556f,
+  0.338046342f, 0.368408293f,
+  0.3403005f, 0.366327137f,
+  0.342541844f, 0.364232183f,
+  0.344770283f, 0.362123549f,
+  0.346985728f, 0.360001266f,
+  0.349188119f, 0.357865423f,
+  0.351377368f, 0.355716109f,
+  0.353553385f, 0.353553385f,
+  0.355716109f, 0.351377368f,
+  0.357865423f, 0.349188119f,
+  0.360001266f, 0.346985728f,
+  0.362123549f, 0.344770283f,
+  0.364232183f, 0.342541844f,
+  0.366327137f, 0.3403005f,
+  0.368408293f, 0.338046342f,
+  0.37047556f, 0.335779488f,
+  0.372528881f, 0.333499968f,
+  0.374568194f, 0.331207901f,
+  0.376593411f, 0.328903347f,
+  0.378604412f, 0.326586425f,
+  0.380601197f, 0.324257195f,
+  0.382583618f, 0.321915776f,
+  0.384551674f, 0.319562227f,
+  0.386505216f, 0.317196637f,
+  0.388444245f, 0.314819127f,
+  0.390368611f, 0.312429756f,
+  0.392278284f, 0.310028613f,
+  0.394173205f, 0.307615787f,
+  0.396053284f, 0.305191398f,
+  0.397918463f, 0.302755535f,
+  0.399768621f, 0.300308228f,
+  0.401603758f, 0.297849655f,
+  0.403423786f, 0.295379847f,
+  0.405228585f, 0.292898923f,
+  0.407018155f, 0.290406972f,
+  0.408792406f, 0.287904084f,
+  0.41055125f, 0.285390377f,
+  0.412294656f, 0.282865912f,
+  0.414022535f, 0.280330777f,
+  0.415734798f, 0.277785122f,
+  0.417431444f, 0.275228977f,
+  0.419112355f, 0.272662491f,
+  0.4207775f, 0.270085722f,
+  0.42242679f, 0.267498821f,
+  0.424060166f, 0.264901817f,
+  0.425677598f, 0.262294829f,
+  0.427278996f, 0.259678006f,
+  0.4288643f, 0.257051378f,
+  0.430433482f, 0.254415065f,
+  0.431986421f, 0.251769185f,
+  0.433523118f, 0.249113828f,
+  0.435043484f, 0.246449098f,
+  0.436547488f, 0.243775085f,
+  0.438035041f, 0.241091892f,
+  0.439506114f, 0.23839961f,
+  0.440960646f, 0.235698372f,
+  0.442398548f, 0.232988253f,
+  0.443819821f, 0.230269358f,
+  0.445224375f, 0.227541789f,
+  0.446612149f, 0.224805668f,
+  0.447983116f, 0.222061068f,
+  0.449337244f, 0.219308123f,
+  0.450674415f, 0.216546908f,
+  0.451994658f, 0.213777542f,
+  0.453297853f, 0.21100013f,
+  0.454584002f, 0.208214775f,
+  0.455853015f, 0.205421582f,
+  0.457104892f, 0.202620655f,
+  0.458339542f, 0.199812099f,
+  0.459556937f, 0.196996018f,
+  0.460757017f, 0.194172516f,
+  0.461939752f, 0.191341713f,
+  0.463105112f, 0.188503712f,
+  0.464253038f, 0.185658604f,
+  0.46538347f, 0.182806492f,
+  0.466496408f, 0.179947525f,
+  0.467591763f, 0.177081764f,
+  0.468669504f, 0.174209341f,
+  0.469729602f, 0.171330363f,
+  0.470772028f, 0.168444932f,
+  0.471796721f, 0.165553153f,
+  0.472803652f, 0.162655145f,
+  0.473792791f, 0.159751013f,
+  0.474764079f, 0.156840876f,
+  0.475717515f, 0.153924823f,
+  0.47665301f, 0.151002973f,
+  0.477570593f, 0.148075446f,
+  0.478470176f, 0.145142332f,
+  0.479351729f, 0.142203763f,
+  0.480215251f, 0.139259845f,
+  0.481060714f, 0.136310682f,
+  0.481888026f, 0.133356377f,
+  0.482697219f, 0.130397052f,
+  0.483488232f, 0.127432823f,
+  0.484261036f, 0.124463804f,
+  0.485015631f, 0.121490091f,
+  0.485751957f, 0.118511803f,
+  0.486469984f, 0.115529053f,
+  0.487169683f, 0.112541959f,
+  0.487851053f, 0.109550618f,
+  0.488514066f, 0.106555156f,
+  0.48915869f, 0.103555687f,
+  0.489784896f, 0.10055232f,
+  0.490392625f, 0.0975451618f,
+  0.490981936f, 0.0945343301f,
+  0.49155274f, 0.0915199444f,
+  0.492105037f, 0.0885021091f,
+  0.492638826f, 0.0854809433f,
+  0.493154049f, 0.0824565589f,
+  0.493650705f, 0.0794290751f,
+  0.494128793f, 0.0763985962f,
+  0.494588256f, 0.0733652338f,
+  0.495029092f, 0.0703291222f,
+  0.495451331f, 0.0672903508f,
+  0.495854884f, 0.0642490536f,
+  0.496239781f, 0.0612053387f,
+  0.496605963f, 0.0581593141f,
+  0.496953487f, 0.0551111028f,
+  0.497282296f, 0.0520608164f,
+  0.49759236f, 0.0490085706f,
+  0.497883707f, 0.045954477f,
+  0.498156309f, 0.0428986549f,
+  0.498410136f, 0.0398412198f,
+  0.498645216f, 0.0367822833f,
+  0.498861521f, 0.0337219611f,
+  0.499059051f, 0.0306603685f,
+  0.499237776f, 0.0275976229f,
+  0.499397725f, 0.024533838f,
+  0.499538869f, 0.0214691292f,
+  0.499661177f, 0.0184036121f,
+  0.499764711f, 0.015337402f,
+  0.499849409f, 0.0122706145f,
+  0.499915302f, 0.00920336507f,
+  0.49996236f, 0.00613576919f,
+  0.499990582f, 0.00306794234f
+};
+
+/**    
+ * @addtogroup RealFFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point real FFT of 1024 points.    
+ * @param[in]  *p points to the input buffer of size <code>1024</code>. It is modified.    
+ * @param[out] *pOut points to the output buffer of size <code>1024</code>.    
+ * @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.    
+ * @return     none.    
+ *    
+ * The input and output formats and the scaling are the ones of <code>arm_rfft_fast_f32()</code>    
+ * for <code>fftLen = 1024</code>. The complex FFT of 512 points is done by    
+ * <code>arm_cfft_len512_f32()</code>, with the other buffer as scratch, and the    
+ * conjugate symmetric bins <code>k</code> and <code>512 - k</code> are split or merged together.    
+ */
+
+void arm_rfft_fast_len1024_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  const float32_t *pTw = rfftLen1024Twiddle;     /* Twiddle factor pointer */
+  float32_t *pA, *pB;                            /* Bins k and 512 - k */
+  float32_t *pOutA, *pOutB;                      /* Output bins k and 512 - k */
+  float32_t xAR, xAI, xBR, xBI;                  /* Temporary variables */
+  float32_t hR, hI, t1a, t1b, sR, dI, u, v;      /* Temporary variables */
+  uint32_t k;                                    /* Loop counter */
+
+  if(ifftFlag == 1u)
+  {
+    /* Merge the half spectrum into the spectrum of the even and odd samples */
+    xAR = p[0];
+    xAI = p[1];
+    pOut[0] = 0.5f * (xAR + xAI);
+    pOut[1] = 0.5f * (xAR - xAI);
+    pOut[512] = p[512];
+    pOut[513] = -p[513];
+
+    pA = p + 2;
+    pB = p + 1022;
+    pOutA = pOut + 2;
+    pOutB = pOut + 1022;
+    for(k = 1u; k < 256u; k++)
+    {
+      xAR = pA[0];
+      xAI = pA[1];
+      xBR = pB[0];
+      xBI = pB[1];
+      hR = pTw[0];
+      hI = pTw[1];
+      pTw += 2;
+
+      t1a = xAR - xBR;
+      t1b = xAI + xBI;
+      sR = 0.5f * (xAR + xBR);
+      dI = 0.5f * (xAI - xBI);
+      u = hR * t1a + hI * t1b;
+      v = hI * t1a - hR * t1b;
+
+      pOutA[0] = sR - u;
+      pOutA[1] = dI + v;
+      pOutB[0] = sR + u;
+      pOutB[1] = v - dI;
+
+      pA += 2;
+      pB -= 2;
+      pOutA += 2;
+      pOutB -= 2;
+    }
+
+    arm_cfft_len512_f32(pOut, p, 1u);
+  }
+  else
+  {
+    arm_cfft_len512_f32(p, pOut, 0u);
+
+    /* Split the spectrum of the even and odd samples into the half spectrum */
+    xAR = p[0];
+    xAI = p[1];
+    pOut[0] = xAR + xAI;
+    pOut[1] = xAR - xAI;
+    pOut[512] = p[512];
+    pOut[513] = -p[513];
+
+    pA = p + 2;
+    pB = p + 1022;
+    pOutA = pOut + 2;
+    pOutB = pOut + 1022;
+    for(k = 1u; k < 256u; k++)
+    {
+      xAR = pA[0];
+      xAI = pA[1];
+      xBR = pB[0];
+      xBI = pB[1];
+      hR = pTw[0];
+      hI = pTw[1];
+      pTw += 2;
+
+      t1a = xBR - xAR;
+      t1b = xBI + xAI;
+      sR = 0.5f * (xAR + xBR);
+      dI = 0.5f * (xAI - xBI);
+      u = hR * t1a + hI * t1b;
+      v = hI * t1a - hR * t1b;
+
+      pOutA[0] = sR + u;
+      pOutA[1] = dI + v;
+      pOutB[0] = sR - u;
+      pOutB[1] = v - dI;
+
+      pA += 2;
+      pB -= 2;
+      pOutA += 2;
+      pOutB -= 2;
+    }
+  }
+}
+
+/**    
+ * @} end of RealFFT group    
+ */
@@ -0,0 +1,298 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_rfft_fast_len512_f32.c    
+*    
+* Description:  Floating-point real FFT of 512 points.    
+*               Generated by arm_fft_gen, do not edit.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/* Split twiddle factors, 0.5 * {sin(2*pi*k/512), cos(2*pi*k/512)} for k = 1 ... 127 */
+static const float32_t rfftLen512Twiddle[254] =
+{
+  0.00613576919f, 0.49996236f,
+  0.0122706145f, 0.499849409f,
+  0.0184036121f, 0.499661177f,
+  0.024533838f, 0.499397725f,
+  0.0306603685f, 0.499059051f,
+  0.0367822833f, 0.498645216f,
+  0.0428986549f, 0.498156309f,
+  0.0490085706f, 0.49759236f,
+  0.0551111028f, 0.496953487f,
+  0.0612053387f, 0.496239781f,
+  0.0672903508f, 0.495451331f,
+  0.0733652338f, 0.494588256f,
+  0.0794290751f, 0.493650705f,
+  0.0854809433f, 0.492638826f,
+  0.0915199444f, 0.49155274f,
+  0.0975451618f, 0.490392625f,
+  0.103555687f, 0.48915869f,
+  0.109550618f, 0.487851053f,
+  0.115529053f, 0.486469984f,
+  0.121490091f, 0.485015631f,
+  0.127432823f, 0.483488232f,
+  0.133356377f, 0.481888026f,
+  0.139259845f, 0.480215251f,
+  0.145142332f, 0.478470176f,
+  0.151002973f, 0.47665301f,
+  0.156840876f, 0.474764079f,
+  0.162655145f, 0.472803652f,
+  0.168444932f, 0.470772028f,
+  0.174209341f, 0.468669504f,
+  0.179947525f, 0.466496408f,
+  0.185658604f, 0.464253038f,
+  0.191341713f, 0.461939752f,
+  0.196996018f, 0.459556937f,
+  0.202620655f, 0.457104892f,
+  0.208214775f, 0.454584002f,
+  0.213777542f, 0.451994658f,
+  0.219308123f, 0.449337244f,
+  0.224805668f, 0.446612149f,
+  0.230269358f, 0.443819821f,
+  0.235698372f, 0.440960646f,
+  0.241091892f, 0.438035041f,
+  0.246449098f, 0.435043484f,
+  0.251769185f, 0.431986421f,
+  0.257051378f, 0.4288643f,
+  0.262294829f, 0.425677598f,
+  0.267498821f, 0.42242679f,
+  0.272662491f, 0.419112355f,
+  0.277785122f, 0.415734798f,
+  0.282865912f, 0.412294656f,
+  0.287904084f, 0.408792406f,
+  0.292898923f, 0.405228585f,
+  0.297849655f, 0.401603758f,
+  0.302755535f, 0.397918463f,
+  0.307615787f, 0.394173205f,
+  0.312429756f, 0.390368611f,
+  0.317196637f, 0.386505216f,
+  0.321915776f, 0.382583618f,
+  0.326586425f, 0.378604412f,
+  0.331207901f, 0.374568194f,
+  0.335779488f, 0.37047556f,
+  0.3403005f, 0.366327137f,
+  0.344770283f, 0.362123549f,
+  0.349188119f, 0.357865423f,
+  0.353553385f, 0.353553385f,
+  0.357865423f, 0.349188119f,
+  0.362123549f, 0.344770283f,
+  0.366327137f, 0.3403005f,
+  0.37047556f, 0.335779488f,
+  0.374568194f, 0.331207901f,
+  0.378604412f, 0.326586425f,
+  0.382583618f, 0.321915776f,
+  0.386505216f, 0.317196637f,
+  0.390368611f, 0.312429756f,
+  0.394173205f, 0.307615787f,
+  0.397918463f, 0.302755535f,
+  0.401603758f, 0.297849655f,
+  0.405228585f, 0.292898923f,
+  0.408792406f, 0.287904084f,
+  0.412294656f, 0.282865912f,
+  0.415734798f, 0.277785122f,
+  0.419112355f, 0.272662491f,
+  0.42242679f, 0.267498821f,
+  0.425677598f, 0.262294829f,
+  0.4288643f, 0.257051378f,
+  0.431986421f, 0.251769185f,
+  0.435043484f, 0.246449098f,
+  0.438035041f, 0.241091892f,
+  0.440960646f, 0.235698372f,
+  0.443819821f, 0.230269358f,
+  0.446612149f, 0.224805668f,
+  0.449337244f, 0.219308123f,
+  0.451994658f, 0.213777542f,
+  0.454584002f, 0.208214775f,
+  0.457104892f, 0.202620655f,
+  0.459556937f, 0.196996018f,
+  0.461939752f, 0.191341713f,
+  0.464253038f, 0.185658604f,
+  0.466496408f, 0.179947525f,
+  0.468669504f, 0.174209341f,
+  0.470772028f, 0.168444932f,
+  0.472803652f, 0.162655145f,
+  0.474764079f, 0.156840876f,
+  0.47665301f, 0.151002973f,
+  0.478470176f, 0.145142332f,
+  0.480215251f, 0.139259845f,
+  0.481888026f, 0.133356377f,
+  0.483488232f, 0.127432823f,
+  0.485015631f, 0.121490091f,
+  0.486469984f, 0.115529053f,
+  0.487851053f, 0.109550618f,
+  0.48915869f, 0.103555687f,
+  0.490392625f, 0.0975451618f,
+  0.49155274f, 0.0915199444f,
+  0.492638826f, 0.0854809433f,
+  0.493650705f, 0.0794290751f,
+  0.494588256f, 0.0733652338f,
+  0.495451331f, 0.0672903508f,
+  0.496239781f, 0.0612053387f,
+  0.496953487f, 0.0551111028f,
+  0.49759236f, 0.0490085706f,
+  0.498156309f, 0.0428986549f,
+  0.498645216f, 0.0367822833f,
+  0.499059051f, 0.0306603685f,
+  0.499397725f, 0.024533838f,
+  0.499661177f, 0.0184036121f,
+  0.499849409f, 0.0122706145f,
+  0.49996236f, 0.00613576919f
+};
+
+/**    
+ * @addtogroup RealFFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point real FFT of 512 points.    
+ * @param[in]  *p points to the input buffer of size <code>512</code>. It is modified.    
+ * @param[out] *pOut points to the output buffer of size <code>512</code>.    
+ * @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.    
+ * @return     none.    
+ *    
+ * The input and output formats and the scaling are the ones of <code>arm_rfft_fast_f32()</code>    
+ * for <code>fftLen = 512</code>. The complex FFT of 256 points is done by    
+ * <code>arm_cfft_len256_f32()</code>, with the other buffer as scratch, and the    
+ * conjugate symmetric bins <code>k</code> and <code>256 - k</code> are split or merged together.    
+ */
+
+void arm_rfft_fast_len512_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  const float32_t *pTw = rfftLen512Twiddle;     /* Twiddle factor pointer */
+  float32_t *pA, *pB;                            /* Bins k and 256 - k */
+  float32_t *pOutA, *pOutB;                      /* Output bins k and 256 - k */
+  float32_t xAR, xAI, xBR, xBI;                  /* Temporary variables */
+  float32_t hR, hI, t1a, t1b, sR, dI, u, v;      /* Temporary variables */
+  uint32_t k;                                    /* Loop counter */
+
+  if(ifftFlag == 1u)
+  {
+    /* Merge the half spectrum into the spectrum of the even and odd samples */
+    xAR = p[0];
+    xAI = p[1];
+    pOut[0] = 0.5f * (xAR + xAI);
+    pOut[1] = 0.5f * (xAR - xAI);
+    pOut[256] = p[256];
+    pOut[257] = -p[257];
+
+    pA = p + 2;
+    pB = p + 510;
+    pOutA = pOut + 2;
+    pOutB = pOut + 510;
+    for(k = 1u; k < 128u; k++)
+    {
+      xAR = pA[0];
+      xAI = pA[1];
+      xBR = pB[0];
+      xBI = pB[1];
+      hR = pTw[0];
+      hI = pTw[1];
+      pTw += 2;
+
+      t1a = xAR - xBR;
+      t1b = xAI + xBI;
+      sR = 0.5f * (xAR + xBR);
+      dI = 0.5f * (xAI - xBI);
+      u = hR * t1a + hI * t1b;
+      v = hI * t1a - hR * t1b;
+
+      pOutA[0] = sR - u;
+      pOutA[1] = dI + v;
+      pOutB[0] = sR + u;
+      pOutB[1] = v - dI;
+
+      pA += 2;
+      pB -= 2;
+      pOutA += 2;
+      pOutB -= 2;
+    }
+
+    arm_cfft_len256_f32(pOut, p, 1u);
+  }
+  else
+  {
+    arm_cfft_len256_f32(p, pOut, 0u);
+
+    /* Split the spectrum of the even and odd samples into the half spectrum */
+    xAR = p[0];
+    xAI = p[1];
+    pOut[0] = xAR + xAI;
+    pOut[1] = xAR - xAI;
+    pOut[256] = p[256];
+    pOut[257] = -p[257];
+
+    pA = p + 2;
+    pB = p + 510;
+    pOutA = pOut + 2;
+    pOutB = pOut + 510;
+    for(k = 1u; k < 128u; k++)
+    {
+      xAR = pA[0];
+      xAI = pA[1];
+      xBR = pB[0];
+      xBI = pB[1];
+      hR = pTw[0];
+      hI = pTw[1];
+      pTw += 2;
+
+      t1a = xBR - xAR;
+      t1b = xBI + xAI;
+      sR = 0.5f * (xAR + xBR);
+      dI = 0.5f * (xAI - xBI);
+      u = hR * t1a + hI * t1b;
+      v = hI * t1a - hR * t1b;
+
+      pOutA[0] = sR + u;
+      pOutA[1] = dI + v;
+      pOutB[0] = sR - u;
+      pOutB[1] = v - dI;
+
+      pA += 2;
+      pB -= 2;
+      pOutA += 2;
+      pOutB -= 2;
+    }
+  }
+}
+
+/**    
+ * @} end of RealFFT group    
+ */
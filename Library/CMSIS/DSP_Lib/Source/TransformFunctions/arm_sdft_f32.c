@@ -0,0 +1,171 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_f32.c    
+*    
+* Description:  Floating-point sliding DFT processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup SDFT Sliding DFT    
+ *    
+ * Updates a few bins of the DFT of the last <code>N</code> samples at every sample, for Q31 and floating-point    
+ * data types. Each bin costs one complex multiplication per sample, whatever <code>N</code>, so a running    
+ * spectrum of a few bins is much cheaper than an FFT per sample or per block, and has no block latency.    
+ *    
+ * \par Algorithm:    
+ * Bin <code>k</code> is updated recursively from the sample entering the window and the sample leaving it:    
+ * <pre>    
+ *    X[k](n) = W * (r * X[k](n-1) + x[n] - r^N * x[n-N]),   W = exp(j*2*pi*k/N)    
+ * </pre>    
+ * With <code>r = 1</code> the result is the DFT of <code>x[n-N+1] ... x[n]</code>. The rounding of <code>W</code>    
+ * makes the recursion marginally stable, and the errors would grow without bound. A damping factor    
+ * <code>r</code> slightly below 1, such as <code>1 - 1e-6</code>, keeps them bounded: the rounding errors are    
+ * forgotten after about <code>1/(1 - r)</code> samples. The damping also weights the window by <code>r^m</code>    
+ * for the sample <code>m</code> samples old, which changes the magnitudes by up to <code>1 - r^N</code>.    
+ * Moving <code>r</code> closer to 1 reduces this bias but lets more rounding error build up, which is    
+ * significant in floating-point. For runs of many millions of samples the Q31 version, whose    
+ * error does not grow with the run length, is the better choice.    
+ *    
+ * \par    
+ * The samples can be passed one at a time or in blocks of any size. After each call the current bins are    
+ * in the <code>pState</code> buffer of the instance, as <code>{real[0], imag[0], real[1], imag[1], ...}</code>.    
+ * If <code>pDst</code> is not NULL it also receives the bins after every sample, <code>2*numBins</code> values per    
+ * input sample.    
+ *    
+ * \par    
+ * For the power of a few bins once per block of <code>N</code> samples, the Goertzel functions are cheaper.    
+ *    
+ * \par Instance Structure    
+ * The twiddle factors, the delay line and the bins are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each sliding DFT.    
+ * There are separate instance structure declarations for each of the 2 supported data types.    
+ * The instance structures must be initialized with the initialization functions.    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point sliding DFT.    
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the bins after each sample, <code>2*numBins</code> values per sample, or NULL.    
+ * @param[in]  blockSize number of samples to process.    
+ * @return     none.    
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Bins */
+  float32_t *pTwiddle = S->pTwiddle;             /* Twiddle factors */
+  float32_t *pDelay;                             /* Oldest samples of the window */
+  float32_t *px, *pOut;                          /* Input and output pointers */
+  float32_t r = S->damping, rN = S->dampingN;    /* Damping factors */
+  float32_t c, s, re, im, tr;                    /* Temporary variables */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t stride = 2u * numBins;                /* Output values per sample */
+  uint32_t n, i, bin;                            /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Process up to the end of the delay line, the samples leaving the window are then contiguous */
+    n = (uint32_t) S->blockLength - S->delayIndex;
+    n = (n < blockSize) ? n : blockSize;
+    pDelay = &S->pDelay[S->delayIndex];
+
+    for (bin = 0u; bin < numBins; bin++)
+    {
+      c = pTwiddle[2u * bin];
+      s = pTwiddle[(2u * bin) + 1u];
+      re = pState[2u * bin];
+      im = pState[(2u * bin) + 1u];
+      px = pSrc;
+      pOut = (pDst != NULL) ? &pDst[2u * bin] : NULL;
+
+      for (i = 0u; i < n; i++)
+      {
+        /* r * X(n-1) + x[n] - r^N * x[n-N] */
+        tr = (r * re) + (px[i] - (rN * pDelay[i]));
+        im = r * im;
+
+        /* Multiply by W */
+        re = (c * tr) - (s * im);
+        im = (s * tr) + (c * im);
+
+        if(pOut != NULL)
+        {
+          pOut[0] = re;
+          pOut[1] = im;
+          pOut += stride;
+        }
+      }
+
+      pState[2u * bin] = re;
+      pState[(2u * bin) + 1u] = im;
+    }
+
+    /* The new samples replace the ones that left the window */
+    arm_copy_f32(pSrc, pDelay, n);
+    S->delayIndex += (uint16_t) n;
+    if(S->delayIndex == S->blockLength)
+    {
+      S->delayIndex = 0u;
+    }
+
+    pSrc += n;
+    if(pDst != NULL)
+    {
+      pDst += n * stride;
+    }
+    blockSize -= n;
+  }
+}
+
+/**    
+ * @} end of SDFT group    
+ */
@@ -0,0 +1,123 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_init_f32.c    
+*    
+* Description:  Floating-point sliding DFT initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the floating-point sliding DFT.    
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]     numBins number of frequency bins.    
+ * @param[in]     blockLength length <code>N</code> of the sliding window.    
+ * @param[in]     *pBinIndex points to the indexes <code>k</code> of the bins, each less than <code>N</code>.    
+ * @param[in]     damping damping factor <code>r</code>, in the range (0 1].    
+ * @param[out]    *pTwiddle points to the twiddle factor buffer of length <code>2*numBins</code>.    
+ * @param[in]     *pDelay points to the delay line buffer of length <code>N</code>.    
+ * @param[in]     *pState points to the bin buffer of length <code>2*numBins</code>.    
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLength</code>    
+ *                is 0, a bin index is not less than <code>N</code> or <code>damping</code> is out of range.    
+ *    
+ * \par    
+ * The window starts filled with zeros, so the bins are exact after the first <code>N</code> samples.    
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  uint16_t * pBinIndex,
+  float32_t damping,
+  float32_t * pTwiddle,
+  float32_t * pDelay,
+  float32_t * pState)
+{
+  float32_t rN;                                  /* damping to the power N */
+  float32_t w;                                   /* 2*pi*k/N */
+  uint32_t i;                                    /* Loop counter */
+
+  if((numBins == 0u) || (blockLength == 0u) || (damping <= 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if(pBinIndex[i] >= blockLength)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    w = (2.0f * PI * (float32_t) pBinIndex[i]) / (float32_t) blockLength;
+    arm_vcos_f32(&w, &pTwiddle[2u * i], 1u);
+    arm_vsin_f32(&w, &pTwiddle[(2u * i) + 1u], 1u);
+  }
+
+  /* r^N = exp(N * log(r)), rounded once rather than N times, so that the sample leaving the window cancels */
+  arm_vlog_f32(&damping, &rN, 1u);
+  rN *= (float32_t) blockLength;
+  arm_vexp_f32(&rN, &rN, 1u);
+
+  S->numBins = numBins;
+  S->blockLength = blockLength;
+  S->delayIndex = 0u;
+  S->damping = damping;
+  S->dampingN = rN;
+  S->pTwiddle = pTwiddle;
+  S->pDelay = pDelay;
+  S->pState = pState;
+
+  /* Clear the delay line of length N and the bins of length 2*numBins */
+  memset(pDelay, 0, blockLength * sizeof(float32_t));
+  memset(pState, 0, (2u * numBins) * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of SDFT group    
+ */
@@ -0,0 +1,133 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_init_q31.c    
+*    
+* Description:  Q31 sliding DFT initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the Q31 sliding DFT.    
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.    
+ * @param[in]     numBins number of frequency bins.    
+ * @param[in]     blockLength length <code>N</code> of the sliding window.    
+ * @param[in]     *pBinIndex points to the indexes <code>k</code> of the bins, each less than <code>N</code>.    
+ * @param[in]     damping damping factor <code>r</code>, positive. 0x7FFFFFFF stands for 1.    
+ * @param[out]    *pTwiddle points to the twiddle factor buffer of length <code>2*numBins</code>.    
+ * @param[in]     *pDelay points to the delay line buffer of length <code>N</code>.    
+ * @param[in]     *pState points to the bin buffer of length <code>2*numBins</code>.    
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLength</code>    
+ *                is 0, a bin index is not less than <code>N</code> or <code>damping</code> is not positive.    
+ *    
+ * \par    
+ * The window starts filled with zeros, so the bins are exact after the first <code>N</code> samples.    
+ * A damping factor of 0x7FFFF79D (1 - 1e-6) keeps the rounding errors of the recursion below 1e-6 of full scale.    
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  uint16_t * pBinIndex,
+  q31_t damping,
+  q31_t * pTwiddle,
+  q31_t * pDelay,
+  q31_t * pState)
+{
+  q31_t rN = 0x7FFFFFFF;                         /* damping to the power N */
+  q31_t phase;                                   /* k/N in 1.31 format */
+  uint32_t shift, i;                             /* Input shift, loop counter */
+
+  if((numBins == 0u) || (blockLength == 0u) || (damping <= 0))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if(pBinIndex[i] >= blockLength)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* The input range [0 1) of the vector functions maps to [0 2*pi) */
+    phase = (q31_t) (((q63_t) pBinIndex[i] << 31) / blockLength);
+    arm_vcos_q31(&phase, &pTwiddle[2u * i], 1u);
+    arm_vsin_q31(&phase, &pTwiddle[(2u * i) + 1u], 1u);
+  }
+
+  for (i = 0u; i < blockLength; i++)
+  {
+    rN = (q31_t) (((q63_t) rN * damping) >> 31);
+  }
+
+  /* log2 of N rounded up */
+  shift = 0u;
+  while((1u << shift) < blockLength)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->blockLength = blockLength;
+  S->delayIndex = 0u;
+  S->shift = (uint8_t) shift;
+  S->damping = damping;
+  S->dampingN = rN;
+  S->pTwiddle = pTwiddle;
+  S->pDelay = pDelay;
+  S->pState = pState;
+
+  /* Clear the delay line of length N and the bins of length 2*numBins */
+  memset(pDelay, 0, blockLength * sizeof(q31_t));
+  memset(pState, 0, (2u * numBins) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of SDFT group    
+ */
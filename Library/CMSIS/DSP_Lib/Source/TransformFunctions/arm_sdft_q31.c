@@ -0,0 +1,143 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_q31.c    
+*    
+* Description:  Q31 sliding DFT processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 sliding DFT.    
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the bins after each sample, <code>2*numBins</code> values per sample, or NULL.    
+ * @param[in]  blockSize number of samples to process.    
+ * @return     none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is shifted right by <code>shift</code> bits, the log2 of <code>N</code> rounded up, so that the bins    
+ * cannot overflow. The bins in 1.31 format are the DFT divided by <code>2^shift</code>, which is the DFT divided    
+ * by <code>N</code> when <code>N</code> is a power of 2. The products are computed with 64-bit intermediates,    
+ * rounded, so that the errors do not drift, and saturated to 1.31 format.    
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* Bins */
+  q31_t *pTwiddle = S->pTwiddle;                 /* Twiddle factors */
+  q31_t *pDelay;                                 /* Oldest samples of the window */
+  q31_t *px, *pOut;                              /* Input and output pointers */
+  q31_t r = S->damping, rN = S->dampingN;        /* Damping factors */
+  q31_t c, s, re, im, tr;                        /* Temporary variables */
+  uint32_t shift = S->shift;                     /* Input shift */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t stride = 2u * numBins;                /* Output values per sample */
+  uint32_t n, i, bin;                            /* Loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Process up to the end of the delay line, the samples leaving the window are then contiguous */
+    n = (uint32_t) S->blockLength - S->delayIndex;
+    n = (n < blockSize) ? n : blockSize;
+    pDelay = &S->pDelay[S->delayIndex];
+
+    for (bin = 0u; bin < numBins; bin++)
+    {
+      c = pTwiddle[2u * bin];
+      s = pTwiddle[(2u * bin) + 1u];
+      re = pState[2u * bin];
+      im = pState[(2u * bin) + 1u];
+      px = pSrc;
+      pOut = (pDst != NULL) ? &pDst[2u * bin] : NULL;
+
+      for (i = 0u; i < n; i++)
+      {
+        /* r * X(n-1) + x[n] - r^N * x[n-N] */
+        tr = clip_q63_to_q31(((((q63_t) r * re) + 0x40000000) >> 31) + (px[i] >> shift) -
+                             ((((q63_t) rN * (pDelay[i] >> shift)) + 0x40000000) >> 31));
+        im = (q31_t) ((((q63_t) r * im) + 0x40000000) >> 31);
+
+        /* Multiply by W */
+        re = clip_q63_to_q31(((((q63_t) c * tr) - ((q63_t) s * im)) + 0x40000000) >> 31);
+        im = clip_q63_to_q31(((((q63_t) s * tr) + ((q63_t) c * im)) + 0x40000000) >> 31);
+
+        if(pOut != NULL)
+        {
+          pOut[0] = re;
+          pOut[1] = im;
+          pOut += stride;
+        }
+      }
+
+      pState[2u * bin] = re;
+      pState[(2u * bin) + 1u] = im;
+    }
+
+    /* The new samples replace the ones that left the window */
+    arm_copy_q31(pSrc, pDelay, n);
+    S->delayIndex += (uint16_t) n;
+    if(S->delayIndex == S->blockLength)
+    {
+      S->delayIndex = 0u;
+    }
+
+    pSrc += n;
+    if(pDst != NULL)
+    {
+      pDst += n * stride;
+    }
+    blockSize -= n;
+  }
+}
+
+/**    
+ * @} end of SDFT group    
+ */
@@ -133,4 +133,8 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Table for the CORDIC arctangent of the fixed-point vector functions */
+#define FAST_MATH_ATAN_TABLE_SIZE  30
+extern const q31_t atanTable_q31[FAST_MATH_ATAN_TABLE_SIZE];
+
 #endif /*  ARM_COMMON_TABLES_H */
@@ -378,7 +378,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix is not positive definite. */
   } arm_status;
 
   /**
@@ -1213,6 +1214,136 @@ extern "C"
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 multichannel interleaved FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+    uint16_t numChans;         /**< number of interleaved channels. */
+    q15_t *pState;             /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChans. */
+    q15_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_interleaved_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 multichannel interleaved FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+    uint16_t numChans;         /**< number of interleaved channels. */
+    q31_t *pState;             /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChans. */
+    q31_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_interleaved_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point multichannel interleaved FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+    uint16_t numChans;         /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChans. */
+    float32_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_interleaved_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 multichannel interleaved FIR filter.
+   * @param[in]  *S points to an instance of the Q15 interleaved FIR filter structure.
+   * @param[in]  *pSrc points to the block of interleaved input frames.
+   * @param[out] *pDst points to the block of interleaved output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_interleaved_q15(
+  const arm_fir_interleaved_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel interleaved FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 interleaved FIR filter structure.
+   * @param[in]     numTaps  number of filter coefficients in the filter.
+   * @param[in]     numChans number of interleaved channels.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize largest number of frames processed per call.
+   * @return        none.
+   */
+  void arm_fir_interleaved_init_q15(
+  arm_fir_interleaved_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChans,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 multichannel interleaved FIR filter.
+   * @param[in]  *S points to an instance of the Q31 interleaved FIR filter structure.
+   * @param[in]  *pSrc points to the block of interleaved input frames.
+   * @param[out] *pDst points to the block of interleaved output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_interleaved_q31(
+  const arm_fir_interleaved_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel interleaved FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 interleaved FIR filter structure.
+   * @param[in]     numTaps  number of filter coefficients in the filter.
+   * @param[in]     numChans number of interleaved channels.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize largest number of frames processed per call.
+   * @return        none.
+   */
+  void arm_fir_interleaved_init_q31(
+  arm_fir_interleaved_instance_q31 * S,
+  uint16_t numTaps,
+  uint16_t numChans,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point multichannel interleaved FIR filter.
+   * @param[in]  *S points to an instance of the floating-point interleaved FIR filter structure.
+   * @param[in]  *pSrc points to the block of interleaved input frames.
+   * @param[out] *pDst points to the block of interleaved output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_interleaved_f32(
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel interleaved FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point interleaved FIR filter structure.
+   * @param[in]     numTaps  number of filter coefficients in the filter.
+   * @param[in]     numChans number of interleaved channels.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pState points to the state buffer.
+   * @param[in]     blockSize largest number of frames processed per call.
+   * @return        none.
+   */
+  void arm_fir_interleaved_init_f32(
+  arm_fir_interleaved_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChans,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
@@ -2248,6 +2379,109 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Fixed-length floating-point complex FFT, generated by arm_fft_gen.
+   * @param[in, out] *p points to the complex data buffer of size <code>2*fftLen</code>, processed in place.
+   * @param[in]      *pScratch points to a scratch buffer of size <code>2*fftLen</code>.
+   * @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @return none.
+   *
+   * Only the lengths generated in Source/TransformFunctions are defined, see Host/arm_fft_gen.c.
+   */
+  void arm_cfft_len16_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len32_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len64_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len128_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len256_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len512_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len1024_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len2048_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  void arm_cfft_len4096_f32(
+  float32_t * p,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Fixed-length floating-point real FFT, generated by arm_fft_gen.
+   * @param[in]  *p points to the input buffer of size <code>fftLen</code>. It is modified.
+   * @param[out] *pOut points to the output buffer of size <code>fftLen</code>.
+   * @param[in]  ifftFlag RFFT if flag is 0, RIFFT if flag is 1.
+   * @return none.
+   *
+   * Same formats and scaling as arm_rfft_fast_f32(). Needs the complex FFT of <code>fftLen/2</code>.
+   */
+  void arm_rfft_fast_len32_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len64_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len128_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len256_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len512_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len1024_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len2048_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  void arm_rfft_fast_len4096_f32(
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2386,6 +2620,201 @@ void arm_rfft_fast_f32(
   q15_t * pInlineBuffer);
 
 
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of frequency bins. */
+    uint16_t blockLength;                /**< number of samples N of each DFT. */
+    uint16_t count;                      /**< number of samples of the current DFT already processed. */
+    float32_t *pCoeffs;                  /**< points to the coefficients 2*cos(2*pi*f), one per bin. */
+    float32_t *pState;                   /**< points to the state array of length 2*numBins. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of frequency bins. */
+    uint16_t blockLength;                /**< number of samples N of each DFT. */
+    uint16_t count;                      /**< number of samples of the current DFT already processed. */
+    uint8_t shift;                       /**< right shift of the input, so that the states cannot overflow. */
+    uint8_t powerShift;                  /**< left shift of the output power, twice the shift beyond log2 of N. */
+    q31_t *pCoeffs;                      /**< points to the coefficients cos(2*pi*f), one per bin. */
+    q31_t *pState;                       /**< points to the state array of length 2*numBins. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[in,out] *S           points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins      number of frequency bins.
+   * @param[in]     blockLength  number of samples N of each DFT.
+   * @param[in]     *pFreqs      points to the frequencies of the bins, normalized by the sample rate.
+   * @param[out]    *pCoeffs     points to the coefficient buffer of length numBins.
+   * @param[in]     *pState      points to the state buffer of length 2*numBins.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLength</code> is 0.
+   */
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel filter bank.
+   * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output power values, numBins per completed DFT.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of DFTs completed during the call.
+   */
+  uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[in,out] *S           points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins      number of frequency bins.
+   * @param[in]     blockLength  number of samples N of each DFT.
+   * @param[in]     *pFreqs      points to the frequencies of the bins, normalized by the sample rate.
+   * @param[out]    *pCoeffs     points to the coefficient buffer of length numBins.
+   * @param[in]     *pState      points to the state buffer of length 2*numBins.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLength</code> is 0.
+   */
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel filter bank.
+   * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output power values, numBins per completed DFT.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of DFTs completed during the call.
+   */
+  uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of frequency bins. */
+    uint16_t blockLength;                /**< length N of the sliding window. */
+    uint16_t delayIndex;                 /**< index of the oldest sample in the delay line. */
+    float32_t damping;                   /**< damping factor r, slightly below 1 for stability. */
+    float32_t dampingN;                  /**< r to the power N. */
+    float32_t *pTwiddle;                 /**< points to cos(2*pi*k/N) and sin(2*pi*k/N) of each bin, 2*numBins values. */
+    float32_t *pDelay;                   /**< points to the delay line of the last N input samples. */
+    float32_t *pState;                   /**< points to the current bins, 2*numBins values, real and imaginary parts interleaved. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                    /**< number of frequency bins. */
+    uint16_t blockLength;                /**< length N of the sliding window. */
+    uint16_t delayIndex;                 /**< index of the oldest sample in the delay line. */
+    uint8_t shift;                       /**< right shift of the input, log2 of N rounded up. */
+    q31_t damping;                       /**< damping factor r, slightly below 1 for stability. */
+    q31_t dampingN;                      /**< r to the power N. */
+    q31_t *pTwiddle;                     /**< points to cos(2*pi*k/N) and sin(2*pi*k/N) of each bin, 2*numBins values. */
+    q31_t *pDelay;                       /**< points to the delay line of the last N input samples. */
+    q31_t *pState;                       /**< points to the current bins, 2*numBins values, real and imaginary parts interleaved. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] *S           points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     numBins      number of frequency bins.
+   * @param[in]     blockLength  length N of the sliding window.
+   * @param[in]     *pBinIndex   points to the indexes k of the bins, each less than N.
+   * @param[in]     damping      damping factor r.
+   * @param[out]    *pTwiddle    points to the twiddle buffer of length 2*numBins.
+   * @param[in]     *pDelay      points to the delay line buffer of length N.
+   * @param[in]     *pState      points to the bin buffer of length 2*numBins.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range.
+   */
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  uint16_t * pBinIndex,
+  float32_t damping,
+  float32_t * pTwiddle,
+  float32_t * pDelay,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the bins after each sample, 2*numBins values per sample, or NULL.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
+   */
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[in,out] *S           points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     numBins      number of frequency bins.
+   * @param[in]     blockLength  length N of the sliding window.
+   * @param[in]     *pBinIndex   points to the indexes k of the bins, each less than N.
+   * @param[in]     damping      damping factor r.
+   * @param[out]    *pTwiddle    points to the twiddle buffer of length 2*numBins.
+   * @param[in]     *pDelay      points to the delay line buffer of length N.
+   * @param[in]     *pState      points to the bin buffer of length 2*numBins.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range.
+   */
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLength,
+  uint16_t * pBinIndex,
+  q31_t damping,
+  q31_t * pTwiddle,
+  q31_t * pDelay,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 sliding DFT.
+   * @param[in,out] *S         points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the bins after each sample, 2*numBins values per sample, or NULL.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
+   */
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Floating-point vector addition.
    * @param[in]  pSrcA      points to the first input vector
@@ -3561,6 +3990,158 @@ void arm_rfft_fast_f32(
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 arbitrary ratio resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< number of phases of the polyphase filter, 1 to 256. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+    uint32_t step;                 /**< input samples per output sample in 8.24 format, may be changed between calls. */
+    uint32_t frac;                 /**< fractional input position of the next output in 0.24 format. */
+    uint32_t skip;                 /**< input samples to skip before the next output. */
+  } arm_resample_instance_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 arbitrary ratio resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< number of phases of the polyphase filter, 1 to 256. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+    uint32_t step;                 /**< input samples per output sample in 8.24 format, may be changed between calls. */
+    uint32_t frac;                 /**< fractional input position of the next output in 0.24 format. */
+    uint32_t skip;                 /**< input samples to skip before the next output. */
+  } arm_resample_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the floating-point arbitrary ratio resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< number of phases of the polyphase filter, 1 to 256. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+    uint32_t step;                 /**< input samples per output sample in 8.24 format, may be changed between calls. */
+    uint32_t frac;                 /**< fractional input position of the next output in 0.24 format. */
+    uint32_t skip;                 /**< input samples to skip before the next output. */
+  } arm_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 arbitrary ratio resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_resample_q15(
+  arm_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 arbitrary ratio resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     L          number of phases of the polyphase filter.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     step       input samples per output sample in 8.24 format.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>numTaps</code> is not a multiple of <code>L</code>
+   * or ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>step</code> is out of range.
+   */
+  arm_status arm_resample_init_q15(
+  arm_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t step,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 arbitrary ratio resampler.
+   * @param[in,out] S          points to an instance of the Q31 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_resample_q31(
+  arm_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 arbitrary ratio resampler.
+   * @param[in,out] S          points to an instance of the Q31 resampler structure.
+   * @param[in]     L          number of phases of the polyphase filter.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     step       input samples per output sample in 8.24 format.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>numTaps</code> is not a multiple of <code>L</code>
+   * or ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>step</code> is out of range.
+   */
+  arm_status arm_resample_init_q31(
+  arm_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t step,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point arbitrary ratio resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_resample_f32(
+  arm_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point arbitrary ratio resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     L          number of phases of the polyphase filter.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     step       input samples per output sample in 8.24 format.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>numTaps</code> is not a multiple of <code>L</code>
+   * or ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>step</code> is out of range.
+   */
+  arm_status arm_resample_init_f32(
+  arm_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t step,
+  uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
@@ -3704,17 +4285,147 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_df2T_init_f64(
+  arm_biquad_cascade_df2T_instance_f64 * S,
+  uint8_t numStages,
+  float64_t * pCoeffs,
+  float64_t * pState);
+
+
+  /**
+   * @brief Instance structure for the floating-point multichannel interleaved transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChans;         /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChans. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_interleaved_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 multichannel interleaved direct form I Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChans;         /**< number of interleaved channels. */
+    q31_t *pState;             /**< points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    int8_t postShift;          /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_interleaved_df1_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 multichannel interleaved direct form I Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChans;         /**< number of interleaved channels. */
+    q15_t *pState;             /**< points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;          /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_interleaved_df1_instance_q15;
+
+
+  /**
+   * @brief Processing function for the floating-point multichannel interleaved transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_interleaved_df2T_f32(
+  const arm_biquad_cascade_interleaved_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel interleaved transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_interleaved_df2T_init_f32(
+  arm_biquad_cascade_interleaved_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChans,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 multichannel interleaved direct form I Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_interleaved_df1_q31(
+  const arm_biquad_cascade_interleaved_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel interleaved direct form I Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of interleaved channels.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format.
+   */
+  void arm_biquad_cascade_interleaved_df1_init_q31(
+  arm_biquad_cascade_interleaved_df1_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t numChans,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief Processing function for the Q15 multichannel interleaved direct form I Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_interleaved_df1_q15(
+  const arm_biquad_cascade_interleaved_df1_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 multichannel interleaved direct form I Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
    * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numChans   number of interleaved channels.
    * @param[in]     pCoeffs    points to the filter coefficients.
    * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format.
    */
-  void arm_biquad_cascade_df2T_init_f64(
-  arm_biquad_cascade_df2T_instance_f64 * S,
+  void arm_biquad_cascade_interleaved_df1_init_q15(
+  arm_biquad_cascade_interleaved_df1_instance_q15 * S,
   uint8_t numStages,
-  float64_t * pCoeffs,
-  float64_t * pState);
+  uint16_t numChans,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
 
 
   /**
@@ -4624,6 +5335,156 @@ void arm_rfft_fast_f32(
   uint16_t maxDelay,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the floating-point FFT based FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t partLen;             /**< partition length, the number of samples processed per FFT. */
+    uint16_t numParts;            /**< number of partitions of the impulse response, ceil(numTaps / partLen). */
+    uint16_t stateIndex;          /**< index of the newest input spectrum in the frequency-domain delay line. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length 2*partLen*(numParts+2). */
+    float32_t *pCoeffs;           /**< points to the partition spectra. The array is of length 2*partLen*numParts. */
+    arm_rfft_fast_instance_f32 rfft; /**< real FFT instance of length 2*partLen. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 FFT based FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t partLen;             /**< partition length, the number of samples processed per FFT. */
+    uint16_t numParts;            /**< number of partitions of the impulse response, ceil(numTaps / partLen). */
+    uint16_t stateIndex;          /**< index of the newest input spectrum in the frequency-domain delay line. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length 5*partLen+2*(partLen+1)*numParts. */
+    q31_t *pCoeffs;               /**< points to the partition spectra. The array is of length 2*(partLen+1)*numParts. */
+    const arm_cfft_instance_q31 *pCfft; /**< complex FFT instance of length 2*partLen. */
+    uint8_t fftLog2;              /**< log2 of the FFT length, the gain restored after the inverse FFT. */
+  } arm_fir_fft_instance_q31;
+
+  /**
+   * @brief Processing function for the floating-point FFT based FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FFT based FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of partLen.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FFT based FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FFT based FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[out]    pSpectra   points to the buffer receiving the partition spectra.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     partLen    partition length, 16 to 2048 and a power of 2.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>partLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pSpectra,
+  float32_t * pState,
+  uint16_t partLen);
+
+  /**
+   * @brief Processing function for the Q31 FFT based FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 FFT based FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of partLen.
+   */
+  void arm_fir_fft_q31(
+  arm_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FFT based FIR filter.
+   * @param[in,out] S          points to an instance of the Q31 FFT based FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[out]    pSpectra   points to the buffer receiving the partition spectra.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     partLen    partition length, 8 to 2048 and a power of 2.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>partLen</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pSpectra,
+  q31_t * pState,
+  uint16_t partLen);
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;           /**< number of states N. */
+    uint16_t numMeas;             /**< number of measurements M. */
+    float32_t *pX;                /**< points to the state estimate, N values. */
+    float32_t *pP;                /**< points to the covariance of the state estimate, N x N. */
+    float32_t *pF;                /**< points to the state transition matrix, N x N. */
+    float32_t *pQ;                /**< points to the covariance of the process noise, N x N. */
+    float32_t *pH;                /**< points to the measurement matrix, M x N. */
+    float32_t *pR;                /**< points to the covariance of the measurement noise, M x M. */
+    float32_t *pWork;             /**< points to the work buffer. The array is of length N*N+M*N+M*M+M. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     numStates  number of states N.
+   * @param[in]     numMeas    number of measurements M.
+   * @param[in,out] pX         points to the state estimate.
+   * @param[in,out] pP         points to the covariance of the state estimate.
+   * @param[in]     pF         points to the state transition matrix.
+   * @param[in]     pQ         points to the covariance of the process noise.
+   * @param[in]     pH         points to the measurement matrix.
+   * @param[in]     pR         points to the covariance of the measurement noise.
+   * @param[in]     pWork      points to the work buffer.
+   */
+  void arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pWork);
+
+  /**
+   * @brief Prediction step of the floating-point Kalman filter.
+   * @param[in,out] S          points to an instance of the floating-point Kalman filter structure.
+   */
+  void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S);
+
+  /**
+   * @brief Update step of the floating-point Kalman filter.
+   * @param[in,out] S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pZ         points to the measurement.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_DECOMPOSITION_FAILURE if the covariance of the innovation is not positive definite.
+   */
+  arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ);
+
+
 
   /**
    * @brief  Floating-point sin_cos function.
@@ -4944,6 +5805,126 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  pSrc  points to the instance of the symmetric positive definite input matrix structure.
+   * @param[out] pDst  points to the instance of the output lower triangular matrix structure, may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 Cholesky decomposition.
+   * @param[in]  pSrc  points to the instance of the symmetric positive definite input matrix structure.
+   * @param[out] pDst  points to the instance of the output lower triangular matrix structure, may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst);
+
+
+  /**
+   * @brief Floating-point LDLT decomposition.
+   * @param[in]  pSrc   points to the instance of the symmetric input matrix structure.
+   * @param[out] pDstL  points to the instance of the output unit lower triangular matrix structure, may be pSrc.
+   * @param[out] pDstD  points to the output diagonal of D.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of D is zero, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDstL,
+  float32_t * pDstD);
+
+
+  /**
+   * @brief Floating-point solve of a lower triangular system L * X = B.
+   * @param[in]  pSrcL  points to the instance of the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst   points to the instance of the output matrix structure, may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of the diagonal is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 solve of a lower triangular system L * X = B.
+   * @param[in]  pSrcL  points to the instance of the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst   points to the instance of the output matrix structure, may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of the diagonal is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_q31(
+  const arm_matrix_instance_q31 * pSrcL,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+
+  /**
+   * @brief Floating-point solve of an upper triangular system U * X = B.
+   * @param[in]  pSrcU  points to the instance of the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst   points to the instance of the output matrix structure, may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of the diagonal is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 solve of an upper triangular system U * X = B.
+   * @param[in]  pSrcU  points to the instance of the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst   points to the instance of the output matrix structure, may be pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of the diagonal is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_q31(
+  const arm_matrix_instance_q31 * pSrcU,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+
+  /**
+   * @brief Floating-point QR decomposition.
+   * @param[in]  pSrc   points to the instance of the M x N input matrix structure, M >= N.
+   * @param[out] pDstQ  points to the instance of the M x M output orthogonal matrix structure, or NULL.
+   * @param[out] pDstR  points to the instance of the M x N output upper triangular matrix structure, may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDstQ,
+  arm_matrix_instance_f32 * pDstR);
+
+
+  /**
+   * @brief Q31 QR decomposition.
+   * @param[in]  pSrc   points to the instance of the M x N input matrix structure, M >= N.
+   * @param[out] pDstQ  points to the instance of the M x M output orthogonal matrix structure, or NULL.
+   * @param[out] pDstR  points to the instance of the M x N output upper triangular matrix structure, may be pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_qr_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDstQ,
+  arm_matrix_instance_q31 * pDstR);
+
+
 
   /**
    * @ingroup groupController
@@ -5704,6 +6685,168 @@ void arm_rfft_fast_f32(
   q15_t x);
 
 
+  /**
+   * @brief  Sine of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector, in radians.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sine of the elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector, in units of 2*pi.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sine of the elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector, in units of 2*pi.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Cosine of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector, in radians.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Cosine of the elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector, in units of 2*pi.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Cosine of the elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector, in units of 2*pi.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Four quadrant arctangent of the elements of two floating-point vectors.
+   * @param[in]  *pSrcY points to the vector of y coordinates.
+   * @param[in]  *pSrcX points to the vector of x coordinates.
+   * @param[out] *pDst points to the output vector, in radians.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Four quadrant arctangent of the elements of two Q31 vectors.
+   * @param[in]  *pSrcY points to the vector of y coordinates.
+   * @param[in]  *pSrcX points to the vector of x coordinates.
+   * @param[out] *pDst points to the output vector, in the range [-1 +1) for [-pi pi).
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Four quadrant arctangent of the elements of two Q15 vectors.
+   * @param[in]  *pSrcY points to the vector of y coordinates.
+   * @param[in]  *pSrcX points to the vector of x coordinates.
+   * @param[out] *pDst points to the output vector, in the range [-1 +1) for [-pi pi).
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Exponential of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Natural logarithm of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Square root of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector.
+   * @param[out] *pDst points to the output vector.
+   * @param[in]  blockSize number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @ingroup groupFastMath
    */
@@ -6541,6 +7684,204 @@ void arm_rfft_fast_f32(
   uint32_t * pIndex);
 
 
+  /**
+   * @brief Instance structure for the floating-point running mean and variance.
+   */
+  typedef struct
+  {
+    uint32_t count;               /**< number of samples seen since the initialization. */
+    float32_t mean;               /**< mean of the samples. */
+    float32_t m2;                 /**< sum of the squared deviations from the mean. */
+  } arm_welford_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point running mean and variance.
+   * @param[out] S          points to an instance of the floating-point running mean and variance structure.
+   */
+  void arm_welford_init_f32(
+  arm_welford_instance_f32 * S);
+
+  /**
+   * @brief Floating-point running mean and variance.
+   * @param[in,out] S          points to an instance of the floating-point running mean and variance structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    pMean      mean of all the samples seen so far.
+   * @param[out]    pVar       variance of all the samples seen so far.
+   */
+  void arm_welford_f32(
+  arm_welford_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pMean,
+  float32_t * pVar);
+
+  /**
+   * @brief Instance structure for the Q31 moving RMS.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t stateIndex;          /**< index of the oldest sample in the state buffer. */
+    uint16_t numValid;            /**< number of samples in the window, windowLen once it is full. */
+    q63_t sumSq;                  /**< sum of the squares of the window in 18.46 format. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length windowLen. */
+  } arm_moving_rms_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 moving RMS.
+   * @param[out] S          points to an instance of the Q31 moving RMS structure.
+   * @param[in]  windowLen  number of samples in the window.
+   * @param[in]  pState     points to the state buffer.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0.
+   */
+  arm_status arm_moving_rms_init_q31(
+  arm_moving_rms_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState);
+
+  /**
+   * @brief Q31 moving RMS.
+   * @param[in,out] S          points to an instance of the Q31 moving RMS structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_moving_rms_q31(
+  arm_moving_rms_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sliding minimum and maximum.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t maxHead;             /**< index of the front of the maximum deque. */
+    uint16_t maxLen;              /**< number of values in the maximum deque. */
+    uint16_t minHead;             /**< index of the front of the minimum deque. */
+    uint16_t minLen;              /**< number of values in the minimum deque. */
+    uint32_t count;               /**< position of the next input sample in the stream. */
+    float32_t *pMaxVal;           /**< points to the values of the maximum deque. The array is of length windowLen. */
+    uint32_t *pMaxPos;            /**< points to the positions of the maximum deque. The array is of length windowLen. */
+    float32_t *pMinVal;           /**< points to the values of the minimum deque. The array is of length windowLen. */
+    uint32_t *pMinPos;            /**< points to the positions of the minimum deque. The array is of length windowLen. */
+  } arm_sliding_minmax_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding minimum and maximum.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t maxHead;             /**< index of the front of the maximum deque. */
+    uint16_t maxLen;              /**< number of values in the maximum deque. */
+    uint16_t minHead;             /**< index of the front of the minimum deque. */
+    uint16_t minLen;              /**< number of values in the minimum deque. */
+    uint32_t count;               /**< position of the next input sample in the stream. */
+    q31_t *pMaxVal;               /**< points to the values of the maximum deque. The array is of length windowLen. */
+    uint32_t *pMaxPos;            /**< points to the positions of the maximum deque. The array is of length windowLen. */
+    q31_t *pMinVal;               /**< points to the values of the minimum deque. The array is of length windowLen. */
+    uint32_t *pMinPos;            /**< points to the positions of the minimum deque. The array is of length windowLen. */
+  } arm_sliding_minmax_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding minimum and maximum.
+   * @param[out] S          points to an instance of the floating-point sliding minimum and maximum structure.
+   * @param[in]  windowLen  number of samples in the window.
+   * @param[in]  pValues    points to a buffer of 2*windowLen values.
+   * @param[in]  pPos       points to a buffer of 2*windowLen positions.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0.
+   */
+  arm_status arm_sliding_minmax_init_f32(
+  arm_sliding_minmax_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pValues,
+  uint32_t * pPos);
+
+  /**
+   * @brief Floating-point sliding minimum and maximum.
+   * @param[in,out] S          points to an instance of the floating-point sliding minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pMin       points to the block of minimum values.
+   * @param[out]    pMax       points to the block of maximum values.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_minmax_f32(
+  arm_sliding_minmax_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMin,
+  float32_t * pMax,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding minimum and maximum.
+   * @param[out] S          points to an instance of the Q31 sliding minimum and maximum structure.
+   * @param[in]  windowLen  number of samples in the window.
+   * @param[in]  pValues    points to a buffer of 2*windowLen values.
+   * @param[in]  pPos       points to a buffer of 2*windowLen positions.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0.
+   */
+  arm_status arm_sliding_minmax_init_q31(
+  arm_sliding_minmax_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pValues,
+  uint32_t * pPos);
+
+  /**
+   * @brief Q31 sliding minimum and maximum.
+   * @param[in,out] S          points to an instance of the Q31 sliding minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pMin       points to the block of minimum values.
+   * @param[out]    pMax       points to the block of maximum values.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_minmax_q31(
+  arm_sliding_minmax_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pMin,
+  q31_t * pMax,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point P<sup>2</sup> quantile estimator.
+   */
+  typedef struct
+  {
+    float32_t p;                  /**< quantile to estimate. */
+    uint32_t count;               /**< number of samples seen, saturated. */
+    float32_t q[5];               /**< heights of the markers, the first samples before the fifth. */
+    uint32_t n[5];                /**< positions of the markers. */
+    float32_t d[3];               /**< desired minus actual positions of the middle markers. */
+    float32_t dn[3];              /**< increments of the desired positions of the middle markers. */
+  } arm_p2_quantile_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point P<sup>2</sup> quantile estimator.
+   * @param[out] S          points to an instance of the floating-point P<sup>2</sup> quantile structure.
+   * @param[in]  p          quantile to estimate, in (0, 1).
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>p</code> is not in (0, 1).
+   */
+  arm_status arm_p2_quantile_init_f32(
+  arm_p2_quantile_instance_f32 * S,
+  float32_t p);
+
+  /**
+   * @brief Floating-point P<sup>2</sup> quantile estimator.
+   * @param[in,out] S          points to an instance of the floating-point P<sup>2</sup> quantile structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    pResult    estimate of the quantile of all the samples seen so far.
+   */
+  void arm_p2_quantile_f32(
+  arm_p2_quantile_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
@@ -490,7 +490,7 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id);
 extern const osPoolDef_t os_pool_def_##name
 #else                            // define the object
 #define osPoolDef(name, no, type)   \
-uint32_t os_pool_m_##name[3+((sizeof(type)+3)/4)*(no)]; \
+uint32_t os_pool_m_##name[6+((sizeof(type)+3)/4)*(no)]; \
 const osPoolDef_t os_pool_def_##name = \
 { (no), sizeof(type), (os_pool_m_##name) }
 #endif
@@ -583,7 +583,7 @@ extern const osMailQDef_t os_mailQ_def_##name
 #else                            // define the object
 #define osMailQDef(name, queue_sz, type) \
 uint32_t os_mailQ_q_##name[4+(queue_sz)] = { 0 }; \
-uint32_t os_mailQ_m_##name[3+((sizeof(type)+3)/4)*(queue_sz)]; \
+uint32_t os_mailQ_m_##name[6+((sizeof(type)+3)/4)*(queue_sz)]; \
 void *   os_mailQ_p_##name[2] = { (os_mailQ_q_##name), os_mailQ_m_##name }; \
 const osMailQDef_t os_mailQ_def_##name =  \
 { (queue_sz), sizeof(type), (os_mailQ_p_##name) }
@@ -643,6 +643,25 @@ uint32_t os_suspend (void);
 /// \param[in]     sleep_time    specifies how long the system was in sleep or power-down mode.
 void os_resume (uint32_t sleep_time);
 
+/// Memory pool usage statistics, see \ref os_pool_stats.
+typedef struct os_pool_stats  {
+  uint32_t                   used;    ///< number of allocated blocks
+  uint32_t               max_used;    ///< peak number of allocated blocks
+  uint32_t                 failed;    ///< number of allocations that found the pool empty
+} osPoolStats;
+
+/// Get the usage statistics of a memory pool, can be called from ISR.
+/// \param[in]     pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+/// \param[out]    stats         usage statistics of the memory pool.
+/// \return status code that indicates the execution status of the function.
+osStatus os_pool_stats (osPoolId pool_id, osPoolStats *stats);
+
+/// Get the usage statistics of the memory pool of a mail queue, can be called from ISR.
+/// \param[in]     queue_id      mail queue ID obtained with \ref osMailCreate.
+/// \param[out]    stats         usage statistics of the mail queue memory.
+/// \return status code that indicates the execution status of the function.
+osStatus os_mail_stats (osMailQId queue_id, osPoolStats *stats);
+
 
 #ifdef  __cplusplus
 }
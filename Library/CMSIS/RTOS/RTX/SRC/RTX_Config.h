@@ -41,8 +41,8 @@
 
 /* Definitions */
 #define BOX_ALIGN_8                   0x80000000U
-#define _declare_box(pool,size,cnt)   U32 pool[(((size)+3)/4)*(cnt) + 3]
-#define _declare_box8(pool,size,cnt)  U64 pool[(((size)+7)/8)*(cnt) + 2]
+#define _declare_box(pool,size,cnt)   U32 pool[(((size)+3)/4)*(cnt) + 6]
+#define _declare_box8(pool,size,cnt)  U64 pool[(((size)+7)/8)*(cnt) + 3]
 #define _init_box8(pool,size,bsize)   _init_box (pool,size,(bsize) | BOX_ALIGN_8)
 
 /* Variables */
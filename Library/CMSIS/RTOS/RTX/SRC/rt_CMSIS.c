@@ -1717,7 +1717,10 @@ osPoolId svcPoolCreate (const osPoolDef_t *pool_def) {
 
   blk_sz = (pool_def->item_sz + 3U) & (uint32_t)~3U;
 
-  _init_box(pool_def->pool, sizeof(struct OS_BM) + (pool_def->pool_sz * blk_sz), blk_sz);
+  if (_init_box(pool_def->pool, sizeof(struct OS_BM) + (pool_def->pool_sz * blk_sz), blk_sz) != 0U) {
+    sysThreadError(osErrorParameter);
+    return NULL;
+  }
 
   return pool_def->pool;
 }
@@ -1996,7 +1999,10 @@ osMailQId svcMailCreate (const osMailQDef_t *queue_def, osThreadId thread_id) {
 
   blk_sz = (queue_def->item_sz + 3U) & (uint32_t)~3U;
 
-  _init_box(pool, sizeof(struct OS_BM) + (queue_def->queue_sz * blk_sz), blk_sz);
+  if (_init_box(pool, sizeof(struct OS_BM) + (queue_def->queue_sz * blk_sz), blk_sz) != 0U) {
+    sysThreadError(osErrorParameter);
+    return NULL;
+  }
 
   rt_mbx_init(pmcb, (uint16_t)(4U*(queue_def->queue_sz + 4U)));
 
@@ -2184,3 +2190,20 @@ uint32_t os_suspend (void) {
 void os_resume (uint32_t sleep_time) {
   __rt_resume(sleep_time);
 }
+
+/// Get the usage statistics of a memory pool
+osStatus os_pool_stats (osPoolId pool_id, osPoolStats *stats) {
+  if ((pool_id == NULL) || (stats == NULL)) {
+    return osErrorParameter;
+  }
+  rt_box_stats(pool_id, &stats->used, &stats->max_used, &stats->failed);
+  return osOK;
+}
+
+/// Get the usage statistics of the memory pool of a mail queue
+osStatus os_mail_stats (osMailQId queue_id, osPoolStats *stats) {
+  if (queue_id == NULL) {
+    return osErrorParameter;
+  }
+  return os_pool_stats(*(((void **)queue_id) + 1), stats);
+}
@@ -131,6 +131,11 @@ static inline U32 __disable_irq(void)
   return(result & 1);
 }
 
+static inline void __DMB(void)
+{
+  __asm volatile ("dmb 0xF":::"memory");
+}
+
 #endif
 
 static inline U8 __clz(U32 value)
@@ -143,6 +148,36 @@ static inline U8 __clz(U32 value)
 
 #endif
 
+/* Word exclusive access, used by the lock-free memory box lists */
+#if defined (__CC_ARM)
+ #ifdef __USE_EXCLUSIVE_ACCESS
+  #define __USE_EXCLUSIVE_BOX
+  #define rt_ldrexw(p)    __ldrex(p)
+  #define rt_strexw(v,p)  __strex(v,p)
+  #define rt_clrex()      __clrex()
+ #endif
+#elif !defined(__TARGET_ARCH_6S_M) && !defined(NO_EXCLUSIVE_ACCESS)
+ #define __USE_EXCLUSIVE_BOX
+
+__inline static U32 rt_ldrexw (volatile U32 *p) {
+  U32 result;
+
+  __asm volatile ("ldrex %0, [%1]" : "=r" (result) : "r" (p) : "memory");
+  return (result);
+}
+
+__inline static U32 rt_strexw (U32 value, volatile U32 *p) {
+  U32 result;
+
+  __asm volatile ("strex %0, %1, [%2]" : "=&r" (result) : "r" (value), "r" (p) : "memory");
+  return (result);
+}
+
+__inline static void rt_clrex (void) {
+  __asm volatile ("clrex" ::: "memory");
+}
+#endif
+
 /* NVIC registers */
 #define NVIC_ST_CTRL    (*((volatile U32 *)0xE000E010U))
 #define NVIC_ST_RELOAD  (*((volatile U32 *)0xE000E014U))
@@ -46,8 +46,93 @@
 
 /* List head of chained ready tasks */
 struct OS_XCB  os_rdy;
-/* List head of chained delay tasks */
-struct OS_XCB  os_dly;
+/* Ready list levels holding at least one task */
+U32            os_rdy_map;
+/* Last task of each ready list level */
+P_TCB          os_rdy_last[OS_RDY_LEVELS];
+/* Timer wheel of delayed tasks, the slot is selected by the time-out tick */
+struct OS_XCB  os_dly[OS_DLY_SLOTS];
+/* Number of tasks in the timer wheel */
+U32            os_dly_cnt;
+
+
+/*----------------------------------------------------------------------------
+ *      Local Functions
+ *---------------------------------------------------------------------------*/
+
+/*--------------------------- rt_rdy_lowest ---------------------------------*/
+
+static U32 rt_rdy_lowest (U32 map) {
+  /* Return the lowest level set in "map", which must not be zero.          */
+#if defined(__TARGET_ARCH_6S_M)
+  U32 lvl = 0U;
+
+  if ((map & 0x0000FFFFU) == 0U) { map >>= 16; lvl += 16U; }
+  if ((map & 0x000000FFU) == 0U) { map >>=  8; lvl +=  8U; }
+  if ((map & 0x0000000FU) == 0U) { map >>=  4; lvl +=  4U; }
+  if ((map & 0x00000003U) == 0U) { map >>=  2; lvl +=  2U; }
+  if ((map & 0x00000001U) == 0U) {             lvl +=  1U; }
+  return (lvl);
+#else
+  return (31U - __clz(map & (0U - map)));
+#endif
+}
+
+
+/*--------------------------- rt_put_rdy ------------------------------------*/
+
+static void rt_put_rdy (P_TCB p_task) {
+  /* Put task "p_task" into the ready list behind all tasks of a higher or  */
+  /* the same priority. The level bitmap locates the insertion point, so    */
+  /* the list is not searched.                                              */
+  P_TCB p_CB;
+  U32 lvl, map;
+
+  lvl = OS_RDY_LEVEL(p_task->prio);
+  if (lvl == (OS_RDY_LEVELS - 1U)) {
+    /* The top level holds several priorities, it is at the list head */
+    p_CB = (P_TCB)&os_rdy;
+    while ((p_CB->p_lnk != NULL) && (p_task->prio <= p_CB->p_lnk->prio)) {
+      p_CB = p_CB->p_lnk;
+    }
+  }
+  else if (os_rdy_map & (1U << lvl)) {
+    p_CB = os_rdy_last[lvl];
+  }
+  else {
+    /* Behind the last task of the next higher non-empty level */
+    map = os_rdy_map & ~((2U << lvl) - 1U);
+    if (map != 0U) {
+      p_CB = os_rdy_last[rt_rdy_lowest (map)];
+    }
+    else {
+      p_CB = (P_TCB)&os_rdy;
+    }
+  }
+  p_task->p_lnk  = p_CB->p_lnk;
+  p_task->p_rlnk = NULL;
+  p_task->rdy_lvl = (U8)lvl;
+  p_CB->p_lnk = p_task;
+  if (((os_rdy_map & (1U << lvl)) == 0U) || (os_rdy_last[lvl] == p_CB)) {
+    os_rdy_last[lvl] = p_task;
+  }
+  os_rdy_map |= (1U << lvl);
+}
+
+
+/*--------------------------- rt_get_rdy ------------------------------------*/
+
+static P_TCB rt_get_rdy (void) {
+  /* Remove the task at the head of the ready list. */
+  P_TCB p_first;
+
+  p_first = os_rdy.p_lnk;
+  os_rdy.p_lnk = p_first->p_lnk;
+  if (os_rdy_last[p_first->rdy_lvl] == p_first) {
+    os_rdy_map &= ~(1U << p_first->rdy_lvl);
+  }
+  return (p_first);
+}
 
 
 /*----------------------------------------------------------------------------
@@ -65,6 +150,10 @@ void rt_put_prio (P_XCB p_CB, P_TCB p_task) {
   U32 prio;
   BOOL sem_mbx = __FALSE;
 
+  if (p_CB == &os_rdy) {
+    rt_put_rdy (p_task);
+    return;
+  }
   if ((p_CB->cb_type == SCB) || (p_CB->cb_type == MCB) || (p_CB->cb_type == MUCB)) {
     sem_mbx = __TRUE;
   }
@@ -97,6 +186,11 @@ P_TCB rt_get_first (P_XCB p_CB) {
   /* "p_CB" points to head of list. */
   P_TCB p_first;
 
+  if (p_CB == &os_rdy) {
+    p_first = rt_get_rdy ();
+    p_first->p_lnk = NULL;
+    return (p_first);
+  }
   p_first = p_CB->p_lnk;
   p_CB->p_lnk = p_first->p_lnk;
   if ((p_CB->cb_type == SCB) || (p_CB->cb_type == MCB) || (p_CB->cb_type == MUCB)) {
@@ -118,9 +212,17 @@ P_TCB rt_get_first (P_XCB p_CB) {
 void rt_put_rdy_first (P_TCB p_task) {
   /* Put task identified with "p_task" at the head of the ready list. The   */
   /* task must have at least a priority equal to highest priority in list.  */
+  U32 lvl;
+
+  lvl = OS_RDY_LEVEL(p_task->prio);
   p_task->p_lnk = os_rdy.p_lnk;
   p_task->p_rlnk = NULL;
+  p_task->rdy_lvl = (U8)lvl;
   os_rdy.p_lnk = p_task;
+  if ((os_rdy_map & (1U << lvl)) == 0U) {
+    os_rdy_last[lvl] = p_task;
+    os_rdy_map |= (1U << lvl);
+  }
 }
 
 
@@ -133,8 +235,7 @@ P_TCB rt_get_same_rdy_prio (void) {
 
   p_first = os_rdy.p_lnk;
   if (p_first->prio == os_tsk.run->prio) {
-    os_rdy.p_lnk = os_rdy.p_lnk->p_lnk;
-    return (p_first);
+    return (rt_get_rdy ());
   }
   return (NULL);
 }
@@ -168,79 +269,83 @@ res:rt_rmv_list (p_task);
 /*--------------------------- rt_put_dly ------------------------------------*/
 
 void rt_put_dly (P_TCB p_task, U16 delay) {
-  /* Put a task identified with "p_task" into chained delay wait list using */
-  /* a delay value of "delay".                                              */
-  P_TCB p;
-  U32 delta,idelay = delay;
-
-  p = (P_TCB)&os_dly;
-  if (p->p_dlnk == NULL) {
-    /* Delay list empty */
-    delta = 0U;
-    goto last;
-  }
-  delta = os_dly.delta_time;
-  while (delta < idelay) {
-    if (p->p_dlnk == NULL) {
-      /* End of list found */
-last: p_task->p_dlnk = NULL;
-      p->p_dlnk = p_task;
-      p_task->p_blnk = p;
-      p->delta_time = (U16)(idelay - delta);
-      p_task->delta_time = 0U;
-      return;
-    }
-    p = p->p_dlnk;
-    delta += p->delta_time;
+  /* Put a task identified with "p_task" into the timer wheel using a delay */
+  /* value of "delay". "delta_time" holds the tick of the time-out.         */
+  P_XCB p_slot;
+  U16 time;
+
+  time  = (U16)os_time + delay;
+  p_slot = &os_dly[time & (OS_DLY_SLOTS - 1U)];
+  p_task->delta_time = time;
+  p_task->p_dlnk = p_slot->p_dlnk;
+  p_task->p_blnk = (P_TCB)p_slot;
+  if (p_slot->p_dlnk != NULL) {
+    p_slot->p_dlnk->p_blnk = p_task;
   }
-  /* Right place found */
-  p_task->p_dlnk = p->p_dlnk;
-  p->p_dlnk = p_task;
-  p_task->p_blnk = p;
-  if (p_task->p_dlnk != NULL) {
-    p_task->p_dlnk->p_blnk = p_task;
-  }
-  p_task->delta_time = (U16)(delta - idelay);
-  p->delta_time -= p_task->delta_time;
+  p_slot->p_dlnk = p_task;
+  os_dly_cnt++;
 }
 
 
 /*--------------------------- rt_dec_dly ------------------------------------*/
 
 void rt_dec_dly (void) {
-  /* Decrement delta time of list head: remove tasks having a value of zero.*/
-  P_TCB p_rdy;
+  /* Check the timer wheel slot of the current tick: ready tasks whose      */
+  /* time-out is now. Other tasks in the slot time out in a later turn.     */
+  P_TCB p_rdy, p_next;
+  U16 time;
 
-  if (os_dly.p_dlnk == NULL) {
+  if (os_dly_cnt == 0U) {
     return;
   }
-  os_dly.delta_time--;
-  while ((os_dly.delta_time == 0U) && (os_dly.p_dlnk != NULL)) {
-    p_rdy = os_dly.p_dlnk;
-    if (p_rdy->p_rlnk != NULL) {
-      /* Task is really enqueued, remove task from semaphore/mailbox */
-      /* timeout waiting list. */
-      p_rdy->p_rlnk->p_lnk = p_rdy->p_lnk;
-      if (p_rdy->p_lnk != NULL) {
-        p_rdy->p_lnk->p_rlnk = p_rdy->p_rlnk;
-        p_rdy->p_lnk = NULL;
+  time  = (U16)os_time;
+  p_rdy = os_dly[time & (OS_DLY_SLOTS - 1U)].p_dlnk;
+  while (p_rdy != NULL) {
+    p_next = p_rdy->p_dlnk;
+    if (p_rdy->delta_time == time) {
+      rt_rmv_dly (p_rdy);
+      if (p_rdy->p_rlnk != NULL) {
+        /* Task is really enqueued, remove task from semaphore/mailbox */
+        /* timeout waiting list. */
+        p_rdy->p_rlnk->p_lnk = p_rdy->p_lnk;
+        if (p_rdy->p_lnk != NULL) {
+          p_rdy->p_lnk->p_rlnk = p_rdy->p_rlnk;
+          p_rdy->p_lnk = NULL;
+        }
+        p_rdy->p_rlnk = NULL;
       }
-      p_rdy->p_rlnk = NULL;
-    }
-    rt_put_prio (&os_rdy, p_rdy);
-    os_dly.delta_time = p_rdy->delta_time;
-    if (p_rdy->state == WAIT_ITV) {
-      /* Calculate the next time for interval wait. */
-      p_rdy->delta_time = p_rdy->interval_time + (U16)os_time;
+      rt_put_prio (&os_rdy, p_rdy);
+      if (p_rdy->state == WAIT_ITV) {
+        /* Calculate the next time for interval wait. */
+        p_rdy->delta_time = p_rdy->interval_time + (U16)os_time;
+      }
+      p_rdy->state = READY;
     }
-    p_rdy->state   = READY;
-    os_dly.p_dlnk = p_rdy->p_dlnk;
-    if (p_rdy->p_dlnk != NULL) {
-      p_rdy->p_dlnk->p_blnk = (P_TCB)&os_dly;
-      p_rdy->p_dlnk = NULL;
+    p_rdy = p_next;
+  }
+}
+
+
+/*--------------------------- rt_dly_next -----------------------------------*/
+
+U32 rt_dly_next (void) {
+  /* Return the number of ticks until the next time-out, or 0xFFFF if no   */
+  /* task is delayed. Searches the whole wheel, used for tick suppression. */
+  P_TCB p_task;
+  U32 i, delta, next = 0xFFFFU;
+
+  if (os_dly_cnt == 0U) {
+    return (next);
+  }
+  for (i = 0U; i < OS_DLY_SLOTS; i++) {
+    for (p_task = os_dly[i].p_dlnk; p_task != NULL; p_task = p_task->p_dlnk) {
+      delta = (U16)(p_task->delta_time - (U16)os_time);
+      if (delta < next) {
+        next = delta;
+      }
     }
-    p_rdy->p_blnk = NULL;
   }
+  return (next);
 }
 
 
@@ -250,6 +355,7 @@ void rt_rmv_list (P_TCB p_task) {
   /* Remove task identified with "p_task" from ready, semaphore or mailbox  */
   /* waiting list if enqueued.                                              */
   P_TCB p_b;
+  U32 lvl, map;
 
   if (p_task->p_rlnk != NULL) {
     /* A task is enqueued in semaphore / mailbox waiting list. */
@@ -260,22 +366,42 @@ void rt_rmv_list (P_TCB p_task) {
     return;
   }
 
-  p_b = (P_TCB)&os_rdy;
-  while (p_b != NULL) {
-    /* Search the ready list for task "p_task" */
-    if (p_b->p_lnk == p_task) {
-      p_b->p_lnk = p_task->p_lnk;
+  /* The task can only be found in the level it was put into; its priority */
+  /* may have been changed since. Search that level only.                   */
+  lvl = p_task->rdy_lvl;
+  if ((os_rdy_map & (1U << lvl)) == 0U) {
+    return;
+  }
+  map = os_rdy_map & ~((2U << lvl) - 1U);
+  if ((lvl == (OS_RDY_LEVELS - 1U)) || (map == 0U)) {
+    p_b = (P_TCB)&os_rdy;
+  }
+  else {
+    p_b = os_rdy_last[rt_rdy_lowest (map)];
+  }
+  while (p_b->p_lnk != p_task) {
+    if ((p_b == os_rdy_last[lvl]) || (p_b->p_lnk == NULL)) {
+      /* Task is not in the ready list */
       return;
     }
     p_b = p_b->p_lnk;
   }
+  p_b->p_lnk = p_task->p_lnk;
+  if (os_rdy_last[lvl] == p_task) {
+    if ((p_b != (P_TCB)&os_rdy) && (p_b->rdy_lvl == lvl)) {
+      os_rdy_last[lvl] = p_b;
+    }
+    else {
+      os_rdy_map &= ~(1U << lvl);
+    }
+  }
 }
 
 
 /*--------------------------- rt_rmv_dly ------------------------------------*/
 
 void rt_rmv_dly (P_TCB p_task) {
-  /* Remove task identified with "p_task" from delay list if enqueued.      */
+  /* Remove task identified with "p_task" from timer wheel if enqueued.     */
   P_TCB p_b;
 
   p_b = p_task->p_blnk;
@@ -284,15 +410,11 @@ void rt_rmv_dly (P_TCB p_task) {
     p_b->p_dlnk = p_task->p_dlnk;
     if (p_task->p_dlnk != NULL) {
       /* 'p_task' is in the middle of list */
-      p_b->delta_time += p_task->delta_time;
       p_task->p_dlnk->p_blnk = p_b;
       p_task->p_dlnk = NULL;
     }
-    else {
-      /* 'p_task' is at the end of list */
-      p_b->delta_time = 0U;
-    }
     p_task->p_blnk = NULL;
+    os_dly_cnt--;
   }
 }
 
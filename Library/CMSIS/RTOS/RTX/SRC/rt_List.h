@@ -41,9 +41,20 @@
 #define MUCB            3U
 #define HCB             4U
 
+/* Ready list levels: priorities 0..30 have a level of their own, higher   */
+/* priorities share the top level.                                         */
+#define OS_RDY_LEVELS   32U
+#define OS_RDY_LEVEL(prio) (((prio) < (OS_RDY_LEVELS - 1U)) ? (U32)(prio) : (OS_RDY_LEVELS - 1U))
+
+/* Number of timer wheel slots, must be a power of 2 */
+#define OS_DLY_SLOTS    16U
+
 /* Variables */
 extern struct OS_XCB os_rdy;
-extern struct OS_XCB os_dly;
+extern U32           os_rdy_map;
+extern P_TCB         os_rdy_last[OS_RDY_LEVELS];
+extern struct OS_XCB os_dly[OS_DLY_SLOTS];
+extern U32           os_dly_cnt;
 
 /* Functions */
 extern void  rt_put_prio      (P_XCB p_CB, P_TCB p_task);
@@ -53,6 +64,7 @@ extern P_TCB rt_get_same_rdy_prio (void);
 extern void  rt_resort_prio   (P_TCB p_task);
 extern void  rt_put_dly       (P_TCB p_task, U16 delay);
 extern void  rt_dec_dly       (void);
+extern U32   rt_dly_next      (void);
 extern void  rt_rmv_list      (P_TCB p_task);
 extern void  rt_rmv_dly       (P_TCB p_task);
 extern void  rt_psq_enq       (OS_ID entry, U32 arg);
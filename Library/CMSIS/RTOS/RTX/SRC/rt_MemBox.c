@@ -38,6 +38,54 @@
 #include "rt_MemBox.h"
 #include "rt_HAL_CM.h"
 
+/*----------------------------------------------------------------------------
+ *      Definitions
+ *---------------------------------------------------------------------------*/
+
+/* The head of the free list holds the word offset of the first free block
+   from the start of the pool in the lower 16 bits and a generation tag in
+   the upper 16 bits. Each free block holds the word offset of the next one,
+   0 ends the list. The tag is incremented by every alloc and free, so the
+   head compared before the exclusive store can not match a list that was
+   changed in between (ABA). */
+#define BOX_OFS_MASK    0x0000FFFFU
+#define BOX_TAG_INC     0x00010000U
+#define BOX_MAX_SIZE    ((BOX_OFS_MASK + 1U) * 4U)
+
+
+/*----------------------------------------------------------------------------
+ *      Local Functions
+ *---------------------------------------------------------------------------*/
+
+#ifdef __USE_EXCLUSIVE_BOX
+
+/*--------------------------- rt_box_add ------------------------------------*/
+
+static U32 rt_box_add (volatile U32 *cnt, U32 val) {
+  /* Add val to a statistics counter and return the new count. */
+  U32 res;
+
+  do {
+    res = rt_ldrexw(cnt) + val;
+  } while (rt_strexw(res, cnt));
+  return (res);
+}
+
+/*--------------------------- rt_box_max ------------------------------------*/
+
+static void rt_box_max (volatile U32 *max, U32 val) {
+  /* Raise a peak value to val. */
+  do {
+    if (rt_ldrexw(max) >= val) {
+      rt_clrex();
+      break;
+    }
+  } while (rt_strexw(val, max));
+}
+
+#endif
+
+
 /*----------------------------------------------------------------------------
  *      Global Functions
  *---------------------------------------------------------------------------*/
@@ -47,10 +95,9 @@
 
 U32 _init_box  (void *box_mem, U32 box_size, U32 blk_size) {
   /* Initialize memory block system, returns 0 if OK, 1 if fails. */
-  void *end;
-  void *blk;
-  void *next;
+  U32 *blk;
   U32  sizeof_bm;
+  U32  ofs, end;
 
   /* Create memory structure. */
   if (blk_size & BOX_ALIGN_8) {
@@ -69,23 +116,30 @@ U32 _init_box  (void *box_mem, U32 box_size, U32 blk_size) {
   if ((blk_size + sizeof_bm) > box_size) {
     return (1U);
   }
+  /* Blocks are linked by 16-bit word offsets. */
+  if (box_size > BOX_MAX_SIZE) {
+    return (1U);
+  }
   /* Create a Memory structure. */
-  blk = ((U8 *) box_mem) + sizeof_bm;
-  ((P_BM) box_mem)->free = blk;
-  end = ((U8 *) box_mem) + box_size;
-  ((P_BM) box_mem)->end      = end;
+  ((P_BM) box_mem)->free     = sizeof_bm / 4U;
+  ((P_BM) box_mem)->end      = ((U8 *) box_mem) + box_size;
   ((P_BM) box_mem)->blk_size = blk_size;
+  ((P_BM) box_mem)->used     = 0U;
+  ((P_BM) box_mem)->max_used = 0U;
+  ((P_BM) box_mem)->failed   = 0U;
 
   /* Link all free blocks using offsets. */
-  end = ((U8 *) end) - blk_size;
-  while (1)  {
-    next = ((U8 *) blk) + blk_size;
-    if (next > end) { break; }
-    *((void **)blk) = next;
-    blk = next;
+  blk_size /= 4U;
+  end = (box_size / 4U) - blk_size;
+  ofs = sizeof_bm / 4U;
+  blk = (U32 *)box_mem + ofs;
+  while ((ofs + blk_size) <= end) {
+    ofs += blk_size;
+    *blk = ofs;
+    blk += blk_size;
   }
   /* end marker */
-  *((void **)blk) = 0U;
+  *blk = 0U;
   return (0U);
 }
 
@@ -93,23 +147,57 @@ U32 _init_box  (void *box_mem, U32 box_size, U32 blk_size) {
 
 void *rt_alloc_box (void *box_mem) {
   /* Allocate a memory block and return start address. */
-  void **free;
-#ifndef __USE_EXCLUSIVE_ACCESS
+  P_BM bm = (P_BM) box_mem;
+  U32 *free;
+  U32  head;
+#ifndef __USE_EXCLUSIVE_BOX
   U32  irq_mask;
+#else
+  U32  next;
+#endif
 
+#ifndef __USE_EXCLUSIVE_BOX
   irq_mask = (U32)__disable_irq ();
-  free = ((P_BM) box_mem)->free;
-  if (free) {
-    ((P_BM) box_mem)->free = *free;
+  head = bm->free;
+  if ((head & BOX_OFS_MASK) != 0U) {
+    free = (U32 *)box_mem + (head & BOX_OFS_MASK);
+    bm->free = ((head & ~BOX_OFS_MASK) + BOX_TAG_INC) | *free;
+    if (++bm->used > bm->max_used) {
+      bm->max_used = bm->used;
+    }
+  }
+  else {
+    free = NULL;
+    bm->failed++;
   }
   if (irq_mask == 0U) { __enable_irq (); }
 #else
-  do {
-    if ((free = (void **)__ldrex(&((P_BM) box_mem)->free)) == 0U) {
-      __clrex();
+  /* Read the head and the link of the first block, then store the new head
+     only if the head is unchanged. Nothing but the head is accessed between
+     LDREX and STREX. */
+  while (1) {
+    head = *(volatile U32 *)&bm->free;
+    if ((head & BOX_OFS_MASK) == 0U) {
+      free = NULL;
       break;
     }
-  } while (__strex((U32)*free, &((P_BM) box_mem)->free));
+    free = (U32 *)box_mem + (head & BOX_OFS_MASK);
+    next = *(volatile U32 *)free;
+    __DMB();
+    if (rt_ldrexw(&bm->free) != head) {
+      rt_clrex();
+      continue;
+    }
+    if (rt_strexw(((head & ~BOX_OFS_MASK) + BOX_TAG_INC) | next, &bm->free) == 0U) {
+      break;
+    }
+  }
+  if (free != NULL) {
+    rt_box_max(&bm->max_used, rt_box_add(&bm->used, 1U));
+  }
+  else {
+    rt_box_add(&bm->failed, 1U);
+  }
 #endif
   return (free);
 }
@@ -139,30 +227,46 @@ void *_calloc_box (void *box_mem)  {
 
 U32 rt_free_box (void *box_mem, void *box) {
   /* Free a memory block, returns 0 if OK, 1 if box does not belong to box_mem */
-#ifndef __USE_EXCLUSIVE_ACCESS
-  U32 irq_mask;
+  P_BM bm = (P_BM) box_mem;
+  U32  head, ofs;
+#ifndef __USE_EXCLUSIVE_BOX
+  U32  irq_mask;
 #endif
 
-  if ((box < box_mem) || (box >= ((P_BM) box_mem)->end)) {
+  if ((box < box_mem) || (box >= bm->end)) {
     return (1U);
   }
+  ofs = (U32)((U32 *)box - (U32 *)box_mem);
 
-#ifndef __USE_EXCLUSIVE_ACCESS
+#ifndef __USE_EXCLUSIVE_BOX
   irq_mask = (U32)__disable_irq ();
-  *((void **)box) = ((P_BM) box_mem)->free;
-  ((P_BM) box_mem)->free = box;
+  head = bm->free;
+  *((U32 *)box) = head & BOX_OFS_MASK;
+  bm->free = ((head & ~BOX_OFS_MASK) + BOX_TAG_INC) | ofs;
+  bm->used--;
   if (irq_mask == 0U) { __enable_irq (); }
 #else
   do {
     do {
-      *((void **)box) = ((P_BM) box_mem)->free;
+      head = *(volatile U32 *)&bm->free;
+      *((U32 *)box) = head & BOX_OFS_MASK;
       __DMB();
-    } while (*(void**)box != (void *)__ldrex(&((P_BM) box_mem)->free));
-  } while (__strex ((U32)box, &((P_BM) box_mem)->free));
+    } while (head != rt_ldrexw(&bm->free));
+  } while (rt_strexw(((head & ~BOX_OFS_MASK) + BOX_TAG_INC) | ofs, &bm->free));
+  rt_box_add(&bm->used, 0xFFFFFFFFU);
 #endif
   return (0U);
 }
 
+/*--------------------------- rt_box_stats ----------------------------------*/
+
+void rt_box_stats (void *box_mem, U32 *used, U32 *max_used, U32 *failed) {
+  /* Return the usage statistics of a memory pool. */
+  *used     = ((P_BM) box_mem)->used;
+  *max_used = ((P_BM) box_mem)->max_used;
+  *failed   = ((P_BM) box_mem)->failed;
+}
+
 /*----------------------------------------------------------------------------
  * end of file
  *---------------------------------------------------------------------------*/
@@ -39,6 +39,7 @@ extern U32     _init_box   (void *box_mem, U32 box_size, U32 blk_size);
 extern void *rt_alloc_box  (void *box_mem);
 extern void *  _calloc_box (void *box_mem);
 extern U32   rt_free_box   (void *box_mem, void *box);
+extern void  rt_box_stats  (void *box_mem, U32 *used, U32 *max_used, U32 *failed);
 
 /*----------------------------------------------------------------------------
  * end of file
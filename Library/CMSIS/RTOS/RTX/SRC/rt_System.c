@@ -82,16 +82,14 @@ extern U32 sysUserTimerWakeupTime(void);
 
 U32 rt_suspend (void) {
   /* Suspend OS scheduler */
-  U32 delta = 0xFFFFU;
+  U32 delta;
 #ifdef __CMSIS_RTOS
   U32 sleep;
 #endif
 
   rt_tsk_lock();
   
-  if (os_dly.p_dlnk) {
-    delta = os_dly.delta_time;
-  }
+  delta = rt_dly_next();
 #ifdef __CMSIS_RTOS
   sleep = sysUserTimerWakeupTime();
   if (sleep < delta) { delta = sleep; }
@@ -112,33 +110,23 @@ extern void sysUserTimerUpdate (U32 sleep_time);
 void rt_resume (U32 sleep_time) {
   /* Resume OS scheduler after suspend */
   P_TCB next;
-  U32   delta;
+  U32   delta, dly;
 
   os_tsk.run->state = READY;
   rt_put_rdy_first (os_tsk.run);
 
   os_robin.task = NULL;
 
-  /* Update delays. */
-  if (os_dly.p_dlnk) {
-    delta = sleep_time;
-    if (delta >= os_dly.delta_time) {
-      delta   -= os_dly.delta_time;
-      os_time += os_dly.delta_time;
-      os_dly.delta_time = 1U;
-      while (os_dly.p_dlnk) {
-        rt_dec_dly();
-        if (delta == 0U) { break; }
-        delta--;
-        os_time++;
-      }
-    } else {
-      os_time           +=      delta;
-      os_dly.delta_time -= (U16)delta;
-    }
-  } else {
-    os_time += sleep_time;
+  /* Update delays: step from one time-out to the next. */
+  delta = sleep_time;
+  while (delta != 0U) {
+    dly = rt_dly_next();
+    if (dly > delta) { break; }
+    delta   -= dly;
+    os_time += dly;
+    rt_dec_dly();
   }
+  os_time += delta;
 
   /* Check the user timers. */
 #ifdef __CMSIS_RTOS
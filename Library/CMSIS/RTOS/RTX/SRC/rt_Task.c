@@ -387,11 +387,14 @@ void rt_sys_init (FUNCP first_task, U32 prio_stksz, void *stk) {
   /* Set up ready list: initially empty */
   os_rdy.cb_type = HCB;
   os_rdy.p_lnk   = NULL;
-  /* Set up delay list: initially empty */
-  os_dly.cb_type = HCB;
-  os_dly.p_dlnk  = NULL;
-  os_dly.p_blnk  = NULL;
-  os_dly.delta_time = 0U;
+  os_rdy_map     = 0U;
+  /* Set up timer wheel: initially empty */
+  for (i = 0U; i < OS_DLY_SLOTS; i++) {
+    os_dly[i].cb_type = HCB;
+    os_dly[i].p_dlnk  = NULL;
+    os_dly[i].p_blnk  = NULL;
+  }
+  os_dly_cnt = 0U;
 
   /* Fix SP and system variables to assume idle task is running */
   /* Transform main program into idle task by assuming idle TCB */
@@ -76,6 +76,8 @@ typedef struct OS_TCB {
 
   /* Task entry point used for uVision debugger                              */
   FUNCP  ptask;                   /* Task entry address                      */
+
+  U8     rdy_lvl;                 /* Ready list level, see rt_List.h         */
 } *P_TCB;
 #define TCB_STACKF      37        /* 'stack_frame' offset                    */
 #define TCB_TSTACK      40        /* 'tsk_stack' offset                      */
@@ -152,9 +154,12 @@ typedef struct OS_TMR {
 } *P_TMR;
 
 typedef struct OS_BM {
-  void *free;                     /* Pointer to first free memory block      */
+  U32  free;                      /* Tag and word offset of first free block */
   void *end;                      /* Pointer to memory block end             */
   U32  blk_size;                  /* Memory block size                       */
+  U32  used;                      /* Number of allocated blocks              */
+  U32  max_used;                  /* Peak number of allocated blocks         */
+  U32  failed;                    /* Number of failed allocations            */
 } *P_BM;
 
 /* Definitions */
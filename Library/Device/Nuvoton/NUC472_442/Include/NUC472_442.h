@@ -29105,6 +29105,7 @@ typedef volatile unsigned long  vu32;       ///< Define 32-bit unsigned volatile
 #include "sd.h"
 #include "ps2.h"
 #include "crc.h"
+#include "adc_stream.h"
 
 #ifdef __cplusplus
 }
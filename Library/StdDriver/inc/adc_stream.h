@@ -0,0 +1,133 @@
+/**************************************************************************//**
+ * @file     adc_stream.h
+ * @version  V1.00
+ * @brief    NUC472/NUC442 ADC to PDMA block streaming driver header file
+ *
+ * @note
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+ *****************************************************************************/
+#ifndef __ADC_STREAM_H__
+#define __ADC_STREAM_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/** @addtogroup NUC472_442_Device_Driver NUC472/NUC442 Device Driver
+  @{
+*/
+
+/** @addtogroup NUC472_442_ADC_STREAM_Driver ADC Stream Driver
+  @{
+*/
+
+/** @addtogroup NUC472_442_ADC_STREAM_EXPORTED_CONSTANTS ADC Stream Exported Constants
+  @{
+*/
+
+#define ADC_STREAM_MAX_STAGES       4       /*!< Maximum number of processing stages of a stream  \hideinitializer */
+#define ADC_STREAM_MAX_BLOCK_SIZE   16384   /*!< Maximum samples per block, the PDMA transfer count limit  \hideinitializer */
+
+/*@}*/ /* end of group NUC472_442_ADC_STREAM_EXPORTED_CONSTANTS */
+
+/** @addtogroup NUC472_442_ADC_STREAM_EXPORTED_STRUCTS ADC Stream Exported Structs
+  @{
+*/
+
+/**
+  * @brief PDMA scatter-gather descriptor, one per block of the ring
+  */
+typedef struct
+{
+    uint32_t ctl;           /*!< Copied to DSCT_CTL */
+    uint32_t endsrc;        /*!< Copied to DSCT_ENDSA */
+    uint32_t enddest;       /*!< Copied to DSCT_ENDDA */
+    uint32_t offset;        /*!< Next descriptor, offset from PDMA_SCATBA */
+} ADC_STREAM_DESC_T;
+
+/**
+  * @brief Processing stage, called in thread context with each block converted to q15
+  * @param[in] pvContext    Context registered with the stage, e.g. an arm_fir_instance_q15
+  * @param[in] pi16Block    Block of samples in q15 format. A stage may modify it in place
+  *                         to pass its output to the next stage.
+  * @param[in] u32Count     Number of samples in the block
+  */
+typedef void (*ADC_STREAM_FUNC_T)(void *pvContext, int16_t *pi16Block, uint32_t u32Count);
+
+/**
+  * @brief Stream state. All members are private to the driver.
+  */
+typedef struct
+{
+    uint32_t u32Ch;                             /*!< PDMA channel */
+    uint32_t *pu32Buffer;                       /*!< Ring of u32BlockCount blocks, written by PDMA */
+    ADC_STREAM_DESC_T *pDesc;                   /*!< One descriptor per block, linked in a ring */
+    int16_t *pi16Work;                          /*!< Block converted to q15 for the stages */
+    uint32_t u32BlockSize;                      /*!< Samples per block */
+    uint32_t u32BlockCount;                     /*!< Number of blocks in the ring */
+    uint32_t u32Signed;                         /*!< ADC results are 2's complement (DMOF) */
+    ADC_STREAM_FUNC_T apfnStage[ADC_STREAM_MAX_STAGES];
+    void *apvStageContext[ADC_STREAM_MAX_STAGES];
+    uint32_t u32StageCount;
+    void (*pfnNotify)(void *pvContext);         /*!< Called from the PDMA interrupt for each block */
+    void *pvNotifyContext;
+    volatile uint32_t u32Produced;              /*!< Blocks completed by PDMA */
+    uint32_t u32Consumed;                       /*!< Blocks processed by ADC_STREAM_Process() */
+    volatile uint32_t u32Overruns;              /*!< Blocks overwritten before they were processed */
+    volatile uint32_t u32Aborts;                /*!< PDMA target aborts */
+} ADC_STREAM_T;
+
+/*@}*/ /* end of group NUC472_442_ADC_STREAM_EXPORTED_STRUCTS */
+
+/** @addtogroup NUC472_442_ADC_STREAM_EXPORTED_FUNCTIONS ADC Stream Exported Functions
+  @{
+*/
+
+/**
+  * @brief Get the number of blocks lost because ADC_STREAM_Process() was not called often enough
+  * @param[in] stream The stream
+  * @return Number of blocks lost since the stream was started
+  * \hideinitializer
+  */
+#define ADC_STREAM_GET_OVERRUNS(stream) ((stream)->u32Overruns)
+
+/**
+  * @brief Get the number of blocks waiting to be processed
+  * @param[in] stream The stream
+  * @return Number of completed blocks not processed yet
+  * \hideinitializer
+  */
+#define ADC_STREAM_GET_PENDING(stream) ((stream)->u32Produced - (stream)->u32Consumed)
+
+int32_t ADC_STREAM_Open(ADC_STREAM_T *stream,
+                        uint32_t u32Ch,
+                        uint32_t *pu32Buffer,
+                        ADC_STREAM_DESC_T *pDesc,
+                        int16_t *pi16Work,
+                        uint32_t u32BlockSize,
+                        uint32_t u32BlockCount);
+int32_t ADC_STREAM_AddStage(ADC_STREAM_T *stream, ADC_STREAM_FUNC_T pfnStage, void *pvContext);
+void ADC_STREAM_SetNotify(ADC_STREAM_T *stream, void (*pfnNotify)(void *pvContext), void *pvContext);
+void ADC_STREAM_Start(ADC_STREAM_T *stream);
+void ADC_STREAM_Stop(ADC_STREAM_T *stream);
+uint32_t ADC_STREAM_IRQHandler(ADC_STREAM_T *stream);
+uint32_t ADC_STREAM_Process(ADC_STREAM_T *stream);
+
+
+
+/*@}*/ /* end of group NUC472_442_ADC_STREAM_EXPORTED_FUNCTIONS */
+
+/*@}*/ /* end of group NUC472_442_ADC_STREAM_Driver */
+
+/*@}*/ /* end of group NUC472_442_Device_Driver */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__ADC_STREAM_H__
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -32,14 +32,33 @@ extern "C"
 
 #define EMAC_PHY_ADDR     1    ///< PHY address, this address is board dependent
 
+#ifndef EMAC_RX_DESC_SIZE
 #define EMAC_RX_DESC_SIZE 4    ///< Number of Rx Descriptors, should be 2 at least
+#endif
+#ifndef EMAC_TX_DESC_SIZE
 #define EMAC_TX_DESC_SIZE 4    ///< Number of Tx Descriptors, should be 2 at least
+#endif
+
+#define EMAC_FRAME_SIZE   1520 ///< Size of the buffer attached to each Tx/Rx descriptor
 
 #define EMAC_TIMEOUT_ERR  (-1L)  /*!<  Ethernet operation abort due to timeout error \hideinitializer */
 #define EMAC_BUS_ERR      (-2L)  /*!<  Ethernet operation abort due to bus error \hideinitializer */
 
 /*@}*/ /* end of group NUC472_442_EMAC_EXPORTED_CONSTANTS */
 
+/** @addtogroup NUC472_442_EMAC_EXPORTED_TYPEDEF EMAC Exported Type Defines
+  @{
+*/
+
+/** Packet entry used by \ref EMAC_RecvBurst and \ref EMAC_SendBurst */
+typedef struct
+{
+    uint8_t *pu8Data;      ///< Word aligned buffer of \ref EMAC_FRAME_SIZE bytes
+    uint32_t u32Size;      ///< Packet size (without 4 byte CRC)
+} EMAC_PKT_T;
+
+/*@}*/ /* end of group NUC472_442_EMAC_EXPORTED_TYPEDEF */
+
 extern int32_t g_EMAC_i32ErrCode;
 
 /** @addtogroup NUC472_442_EMAC_EXPORTED_FUNCTIONS EMAC Exported Functions
@@ -168,8 +187,14 @@ void EMAC_DisableCamEntry(uint32_t u32Entry);
 uint32_t EMAC_RecvPkt(uint8_t *pu8Data, uint32_t *pu32Size);
 uint32_t EMAC_RecvPktTS(uint8_t *pu8Data, uint32_t *pu32Size, uint32_t *pu32Sec, uint32_t *pu32Nsec);
 void EMAC_RecvPktDone(void);
+uint32_t EMAC_RecvPktInPlace(uint8_t **ppu8Data, uint32_t *pu32Size);
+uint32_t EMAC_RecvBurst(EMAC_PKT_T *psPkt, uint32_t u32Max);
 
 uint32_t EMAC_SendPkt(uint8_t *pu8Data, uint32_t u32Size);
+uint8_t *EMAC_GetTxBuf(void);
+uint32_t EMAC_SendPktInPlace(uint32_t u32Size);
+uint32_t EMAC_SendRxPkt(uint32_t u32Size);
+uint32_t EMAC_SendBurst(EMAC_PKT_T *psPkt, uint32_t u32Cnt);
 uint32_t EMAC_SendPktDone(void);
 uint32_t EMAC_SendPktDoneTS(uint32_t *pu32Sec, uint32_t *pu32Nsec);
 
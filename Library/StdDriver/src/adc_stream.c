@@ -0,0 +1,278 @@
+/**************************************************************************//**
+ * @file     adc_stream.c
+ * @version  V1.00
+ * @brief    NUC472/NUC442 ADC to PDMA block streaming driver source file
+ *
+ *           The ADC results are moved by one PDMA channel in scatter-gather
+ *           mode. The descriptors are linked in a ring, one per block, so the
+ *           PDMA never stops and no sample is lost between blocks. The PDMA
+ *           interrupt only counts the completed blocks. ADC_STREAM_Process()
+ *           converts each completed block to q15 and runs the registered
+ *           processing stages in thread context.
+ *
+ * @note
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include "NUC472_442.h"
+
+/** @addtogroup NUC472_442_Device_Driver NUC472/NUC442 Device Driver
+  @{
+*/
+
+/** @addtogroup NUC472_442_ADC_STREAM_Driver ADC Stream Driver
+  @{
+*/
+
+/// @cond HIDDEN_SYMBOLS
+
+/* Control word of every descriptor. Each block is a separate table, so the
+   transfer done flag is set at the end of each block. */
+#define ADC_STREAM_DESC_CTL(u32BlockSize) \
+    ((((u32BlockSize) - 1) << PDMA_DSCT_CTL_TXCNT_Pos) | PDMA_WIDTH_32 | PDMA_SAR_FIX | PDMA_DAR_INC | \
+     PDMA_REQ_SINGLE | PDMA_BURST_1 | PDMA_OP_SCATTER)
+
+/// @endcond HIDDEN_SYMBOLS
+
+/** @addtogroup NUC472_442_ADC_STREAM_EXPORTED_FUNCTIONS ADC Stream Exported Functions
+  @{
+*/
+
+/**
+  * @brief Initialize a stream
+  * @param[in] stream The stream to initialize
+  * @param[in] u32Ch PDMA channel used by the stream, 0 ~ 15
+  * @param[in] pu32Buffer Ring buffer written by PDMA, u32BlockSize * u32BlockCount words
+  * @param[in] pDesc Descriptor table, u32BlockCount entries. It must be in SRAM, in the
+  *                  64 KB region of the other scatter-gather tables.
+  * @param[in] pi16Work Work buffer passed to the stages, u32BlockSize samples
+  * @param[in] u32BlockSize Number of samples per block, 1 ~ \ref ADC_STREAM_MAX_BLOCK_SIZE
+  * @param[in] u32BlockCount Number of blocks in the ring, at least 2. With N blocks, the
+  *                          processing of a block may lag behind PDMA by up to N - 1 blocks.
+  * @retval 0 Success
+  * @retval -1 Invalid parameter
+  * @details When several ADC channels are enabled, the blocks hold the results interleaved
+  *          in the scan order.
+  */
+int32_t ADC_STREAM_Open(ADC_STREAM_T *stream,
+                        uint32_t u32Ch,
+                        uint32_t *pu32Buffer,
+                        ADC_STREAM_DESC_T *pDesc,
+                        int16_t *pi16Work,
+                        uint32_t u32BlockSize,
+                        uint32_t u32BlockCount)
+{
+    if((u32Ch >= PDMA_CH_MAX) || (pu32Buffer == NULL) || (pDesc == NULL) || (pi16Work == NULL) ||
+       (u32BlockSize == 0) || (u32BlockSize > ADC_STREAM_MAX_BLOCK_SIZE) || (u32BlockCount < 2))
+        return -1;
+
+    stream->u32Ch = u32Ch;
+    stream->pu32Buffer = pu32Buffer;
+    stream->pDesc = pDesc;
+    stream->pi16Work = pi16Work;
+    stream->u32BlockSize = u32BlockSize;
+    stream->u32BlockCount = u32BlockCount;
+    stream->u32Signed = 0;
+    stream->u32StageCount = 0;
+    stream->pfnNotify = NULL;
+    stream->pvNotifyContext = NULL;
+    stream->u32Produced = 0;
+    stream->u32Consumed = 0;
+    stream->u32Overruns = 0;
+    stream->u32Aborts = 0;
+    return 0;
+}
+
+/**
+  * @brief Append a processing stage to a stream
+  * @param[in] stream The stream
+  * @param[in] pfnStage Function called with each block, in the order the stages were added
+  * @param[in] pvContext Passed to pfnStage, e.g. the CMSIS-DSP filter instance
+  * @retval 0 Success
+  * @retval -1 \ref ADC_STREAM_MAX_STAGES stages are registered already
+  */
+int32_t ADC_STREAM_AddStage(ADC_STREAM_T *stream, ADC_STREAM_FUNC_T pfnStage, void *pvContext)
+{
+    if(stream->u32StageCount >= ADC_STREAM_MAX_STAGES)
+        return -1;
+
+    stream->apfnStage[stream->u32StageCount] = pfnStage;
+    stream->apvStageContext[stream->u32StageCount] = pvContext;
+    stream->u32StageCount++;
+    return 0;
+}
+
+/**
+  * @brief Set the function called from the PDMA interrupt each time a block is complete
+  * @param[in] stream The stream
+  * @param[in] pfnNotify Notification function, e.g. one that wakes the processing task. NULL to disable.
+  * @param[in] pvContext Passed to pfnNotify
+  * @return None
+  */
+void ADC_STREAM_SetNotify(ADC_STREAM_T *stream, void (*pfnNotify)(void *pvContext), void *pvContext)
+{
+    stream->pfnNotify = pfnNotify;
+    stream->pvNotifyContext = pvContext;
+}
+
+/**
+  * @brief Start streaming
+  * @param[in] stream The stream
+  * @return None
+  * @details The ADC must be opened and powered on before. In continuous scan mode the
+  *          conversion is started by this function and the sample rate is set by the ADC
+  *          clock. In single-cycle scan mode with a hardware trigger each PWM or STADC
+  *          trigger adds one scan to the stream. The PDMA clock must be enabled and
+  *          PDMA_IRQn enabled in NVIC, with ADC_STREAM_IRQHandler() called from
+  *          PDMA_IRQHandler().
+  */
+void ADC_STREAM_Start(ADC_STREAM_T *stream)
+{
+    uint32_t u32Ch = stream->u32Ch;
+    uint32_t i, u32Next;
+
+    stream->u32Produced = 0;
+    stream->u32Consumed = 0;
+    stream->u32Overruns = 0;
+    stream->u32Aborts = 0;
+    stream->u32Signed = (ADC->CTL & ADC_CTL_DMOF_Msk) ? 1 : 0;
+
+    /* Link one descriptor per block in a ring */
+    PDMA->SCATBA = (uint32_t)stream->pDesc & PDMA_SCATBA_SCATBA_Msk;
+    for(i = 0; i < stream->u32BlockCount; i++)
+    {
+        u32Next = (i + 1 == stream->u32BlockCount) ? 0 : i + 1;
+        stream->pDesc[i].ctl = ADC_STREAM_DESC_CTL(stream->u32BlockSize);
+        stream->pDesc[i].endsrc = (uint32_t)&ADC->CURDAT;
+        stream->pDesc[i].enddest = (uint32_t)&stream->pu32Buffer[(i + 1) * stream->u32BlockSize];
+        stream->pDesc[i].offset = (uint32_t)&stream->pDesc[u32Next] - (PDMA->SCATBA);
+    }
+
+    /* PDMA_Open() would reset the other channels, enable this one only */
+    PDMA->CHCTL |= (1 << u32Ch);
+    PDMA->DSCT[u32Ch].CTL = 0;
+    PDMA_SetTransferMode(u32Ch, PDMA_ADC, 1, (uint32_t)&stream->pDesc[0]);
+    PDMA_CLR_TD_FLAG(1 << u32Ch);
+    PDMA_CLR_ABORT_FLAG(1 << u32Ch);
+    PDMA_EnableInt(u32Ch, 0);
+
+    /* ADC interrupt must be disabled when PDMA is enabled */
+    ADC->CTL &= ~ADC_CTL_ADCIEN_Msk;
+    ADC_ENABLE_PDMA(ADC);
+    if((ADC->CTL & ADC_CTL_HWTRGEN_Msk) == 0)
+        ADC_START_CONV(ADC);
+}
+
+/**
+  * @brief Stop streaming
+  * @param[in] stream The stream
+  * @return None
+  * @details Blocks already completed can still be processed by ADC_STREAM_Process().
+  */
+void ADC_STREAM_Stop(ADC_STREAM_T *stream)
+{
+    uint32_t u32Ch = stream->u32Ch;
+
+    ADC->CTL &= ~ADC_CTL_SWTRG_Msk;
+    ADC_DISABLE_PDMA(ADC);
+
+    PDMA_DisableInt(u32Ch, 0);
+    PDMA_STOP(u32Ch);
+    PDMA->CHCTL &= ~(1 << u32Ch);
+    PDMA_CLR_TD_FLAG(1 << u32Ch);
+}
+
+/**
+  * @brief Handle the PDMA interrupt of a stream
+  * @param[in] stream The stream
+  * @return 1 if a block was completed, otherwise 0
+  * @details Call from PDMA_IRQHandler(). Only the flags of the stream channel are
+  *          cleared, so the other channels can be handled in the same handler.
+  */
+uint32_t ADC_STREAM_IRQHandler(ADC_STREAM_T *stream)
+{
+    uint32_t u32Mask = 1 << stream->u32Ch;
+
+    if(PDMA_GET_ABORT_STS() & u32Mask)
+    {
+        PDMA_CLR_ABORT_FLAG(u32Mask);
+        stream->u32Aborts++;
+    }
+
+    if((PDMA_GET_TD_STS() & u32Mask) == 0)
+        return 0;
+
+    PDMA_CLR_TD_FLAG(u32Mask);
+
+    /* Rearm the descriptor just finished for the next lap of the ring */
+    stream->pDesc[stream->u32Produced % stream->u32BlockCount].ctl = ADC_STREAM_DESC_CTL(stream->u32BlockSize);
+    stream->u32Produced++;
+
+    if(stream->pfnNotify != NULL)
+        stream->pfnNotify(stream->pvNotifyContext);
+
+    return 1;
+}
+
+/**
+  * @brief Process the completed blocks
+  * @param[in] stream The stream
+  * @return Number of blocks processed
+  * @details Each block is converted to q15 in the work buffer, which releases it to PDMA,
+  *          then passed to every stage. Call from a task or the main loop, not from an
+  *          interrupt. Blocks that PDMA has overwritten before they were processed are
+  *          skipped and counted by \ref ADC_STREAM_GET_OVERRUNS.
+  */
+uint32_t ADC_STREAM_Process(ADC_STREAM_T *stream)
+{
+    const uint32_t *pu32Src;
+    int16_t *pi16Dst;
+    uint32_t u32Pending, u32Lost, u32Processed = 0;
+    uint32_t u32Xor, i;
+
+    while((u32Pending = stream->u32Produced - stream->u32Consumed) != 0)
+    {
+        /* PDMA is writing the block after the last completed one. With a full
+           ring that is the oldest block, skip to the oldest one still intact. */
+        if(u32Pending >= stream->u32BlockCount)
+        {
+            u32Lost = u32Pending - (stream->u32BlockCount - 1);
+            stream->u32Consumed += u32Lost;
+            stream->u32Overruns += u32Lost;
+            continue;
+        }
+
+        /* 12-bit results to q15, offset binary unless DMOF is set */
+        pu32Src = &stream->pu32Buffer[(stream->u32Consumed % stream->u32BlockCount) * stream->u32BlockSize];
+        pi16Dst = stream->pi16Work;
+        u32Xor = stream->u32Signed ? 0 : 0x8000;
+        for(i = 0; i < stream->u32BlockSize; i++)
+            pi16Dst[i] = (int16_t)(((pu32Src[i] & 0xFFF) << 4) ^ u32Xor);
+
+        /* Overwritten while it was converted */
+        if(stream->u32Produced - stream->u32Consumed >= stream->u32BlockCount)
+        {
+            stream->u32Consumed++;
+            stream->u32Overruns++;
+            continue;
+        }
+        stream->u32Consumed++;
+
+        for(i = 0; i < stream->u32StageCount; i++)
+            stream->apfnStage[i](stream->apvStageContext[i], stream->pi16Work, stream->u32BlockSize);
+
+        u32Processed++;
+    }
+
+    return u32Processed;
+}
+
+
+/*@}*/ /* end of group NUC472_442_ADC_STREAM_EXPORTED_FUNCTIONS */
+
+/*@}*/ /* end of group NUC472_442_ADC_STREAM_Driver */
+
+/*@}*/ /* end of group NUC472_442_Device_Driver */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -121,7 +121,7 @@ typedef struct
 /** Tx/Rx buffer structure */
 typedef struct
 {
-    uint8_t au8Buf[1520];
+    uint8_t au8Buf[EMAC_FRAME_SIZE];
 } EMAC_FRAME_T;
 
 /*@}*/ /* end of group NUC472_442_EMAC_EXPORTED_TYPEDEF */
@@ -603,7 +603,7 @@ uint32_t EMAC_RecvPktTS(uint8_t *pu8Data, uint32_t *pu32Size, uint32_t *pu32Sec,
         // If we reach last recv Rx descriptor, leave the loop
         if(EMAC->CRXDSA == (uint32_t)desc)
             return(0);
-        if ((desc->u32Status1 | EMAC_DESC_OWN_EMAC) != EMAC_DESC_OWN_EMAC)   // ownership=CPU
+        if ((desc->u32Status1 & EMAC_DESC_OWN_EMAC) != EMAC_DESC_OWN_EMAC)   // ownership=CPU
         {
 
             status = desc->u32Status1 >> 16;
@@ -662,6 +662,126 @@ void EMAC_RecvPktDone(void)
     EMAC_TRIGGER_RX();
 }
 
+/**
+  * @brief Get a received Ethernet packet in place, without copying it out of the Rx descriptor buffer
+  * @param[out] ppu8Data Pointer to the Rx descriptor buffer holds the received packet (4 byte CRC removed)
+  * @param[out] pu32Size Received packet size (without 4 byte CRC).
+  * @return Packet receive success or not
+  * @retval 0 No packet available for receive
+  * @retval 1 A packet is received
+  * @retval EMAC_BUS_ERR Bus error
+  * @details Packets with receive error are released and skipped by this API.
+  * @note The buffer is owned by the application until \ref EMAC_RecvPktDone is called. The application can
+  *       build a response in the same buffer and transmit it with \ref EMAC_SendRxPkt.
+  */
+uint32_t EMAC_RecvPktInPlace(uint8_t **ppu8Data, uint32_t *pu32Size)
+{
+    EMAC_DESCRIPTOR_T *desc;
+    uint32_t status, reg;
+
+    // Clear Rx interrupt flags
+    reg = EMAC->INTSTS;
+    EMAC->INTSTS = reg & 0xFFFF;  // Clear all RX related interrupt status
+
+    if (reg & EMAC_INTSTS_RXBEIF_Msk)
+    {
+        // Bus error occurred, this is usually a bad sign about software bug and will occur again...
+        printf("RX bus error\n");
+        return (uint32_t)EMAC_BUS_ERR;
+    }
+
+    // Get Rx Frame Descriptor
+    desc = (EMAC_DESCRIPTOR_T *)u32CurrentRxDesc;
+
+    while ((desc->u32Status1 & EMAC_DESC_OWN_EMAC) != EMAC_DESC_OWN_EMAC)   // ownership=CPU
+    {
+        status = desc->u32Status1 >> 16;
+
+        // If Rx frame is good, pass the descriptor buffer to application
+        if(status & EMAC_RXFD_RXGD)
+        {
+            // lower 16 bit in descriptor status1 stores the Rx packet length
+            *pu32Size = desc->u32Status1 & 0xffff;
+            // Data field may be overwritten by time stamp, buffer address is kept in backup field
+            *ppu8Data = (uint8_t *)desc->u32Backup1;
+            return(1);
+        }
+
+        // Drop the bad frame and check next descriptor
+        EMAC_RecvPktDone();
+        desc = (EMAC_DESCRIPTOR_T *)u32CurrentRxDesc;
+    }
+    return(0);
+}
+
+/**
+  * @brief Receive a burst of Ethernet packets by exchanging Rx descriptor buffers
+  * @param[in,out] psPkt Array of packet entries. On entry, pu8Data of each entry points to a free buffer owned
+  *                by application. On return, the first entries hold the received packets and their size.
+  * @param[in] u32Max Number of entries in psPkt
+  * @return Number of packets received
+  * @retval EMAC_BUS_ERR Bus error
+  * @details Every ready descriptor up to u32Max good packets is processed in one call. The buffer of a good
+  *          packet is handed to application, and the free buffer of the same entry is attached to the
+  *          descriptor in its place, so no data is copied. Packets with receive error are dropped. All
+  *          processed descriptors are returned to EMAC with a single Rx trigger.
+  * @note Buffers given to this API must be word aligned and \ref EMAC_FRAME_SIZE bytes. Entries beyond the
+  *       returned count are left unchanged.
+  */
+uint32_t EMAC_RecvBurst(EMAC_PKT_T *psPkt, uint32_t u32Max)
+{
+    EMAC_DESCRIPTOR_T *desc;
+    uint32_t status, reg;
+    uint32_t u32Buf;
+    uint32_t u32Count = 0;
+
+    // Clear Rx interrupt flags
+    reg = EMAC->INTSTS;
+    EMAC->INTSTS = reg & 0xFFFF;  // Clear all RX related interrupt status
+
+    if (reg & EMAC_INTSTS_RXBEIF_Msk)
+    {
+        // Bus error occurred, this is usually a bad sign about software bug and will occur again...
+        printf("RX bus error\n");
+        return (uint32_t)EMAC_BUS_ERR;
+    }
+
+    // Get Rx Frame Descriptor
+    desc = (EMAC_DESCRIPTOR_T *)u32CurrentRxDesc;
+
+    while ((u32Count < u32Max) && ((desc->u32Status1 & EMAC_DESC_OWN_EMAC) != EMAC_DESC_OWN_EMAC))
+    {
+        status = desc->u32Status1 >> 16;
+
+        // If Rx frame is good, exchange its buffer with the free one from application
+        if(status & EMAC_RXFD_RXGD)
+        {
+            u32Buf = (uint32_t)psPkt[u32Count].pu8Data;
+            psPkt[u32Count].pu8Data = (uint8_t *)desc->u32Backup1;
+            // lower 16 bit in descriptor status1 stores the Rx packet length
+            psPkt[u32Count].u32Size = desc->u32Status1 & 0xffff;
+            desc->u32Backup1 = u32Buf;
+            u32Count++;
+        }
+
+        // restore descriptor link list and data pointer they will be overwrite if time stamp enabled
+        desc->u32Data = desc->u32Backup1;
+        desc->u32Next = desc->u32Backup2;
+
+        // Change ownership to DMA for next use
+        desc->u32Status1 |= EMAC_DESC_OWN_EMAC;
+
+        desc = (EMAC_DESCRIPTOR_T *)desc->u32Next;
+    }
+
+    // Save last processed Rx descriptor
+    u32CurrentRxDesc = (uint32_t)desc;
+
+    EMAC_TRIGGER_RX();
+
+    return(u32Count);
+}
+
 // Transmit functions
 
 /**
@@ -704,6 +824,145 @@ uint32_t EMAC_SendPkt(uint8_t *pu8Data, uint32_t u32Size)
     return(1);
 }
 
+/**
+  * @brief Get the buffer of next Tx descriptor, so a packet can be built in place
+  * @param None
+  * @return Pointer to the Tx descriptor buffer, or NULL if the descriptor is still used by EMAC
+  * @note The buffer is \ref EMAC_FRAME_SIZE bytes. Transmit it with \ref EMAC_SendPktInPlace.
+  */
+uint8_t *EMAC_GetTxBuf(void)
+{
+    EMAC_DESCRIPTOR_T *desc;
+
+    desc = (EMAC_DESCRIPTOR_T *)u32NextTxDesc;
+
+    // Check descriptor ownership
+    if(desc->u32Status1 & EMAC_DESC_OWN_EMAC)
+        return(NULL);
+
+    return((uint8_t *)desc->u32Backup1);
+}
+
+/**
+  * @brief Send the packet built in the buffer returned by \ref EMAC_GetTxBuf
+  * @param[in] u32Size Packet size (without 4 byte CRC).
+  * @return Packet transmit success or not
+  * @retval 0 Transmit failed due to descriptor unavailable.
+  * @retval 1 Packet is triggered to transmit.
+  * @note Return 1 doesn't guarantee the packet will be sent and received successfully.
+  */
+uint32_t EMAC_SendPktInPlace(uint32_t u32Size)
+{
+    EMAC_DESCRIPTOR_T *desc;
+
+    // Get Tx frame descriptor
+    desc = (EMAC_DESCRIPTOR_T *)u32NextTxDesc;
+
+    // Check descriptor ownership
+    if(desc->u32Status1 & EMAC_DESC_OWN_EMAC)
+        return(0);
+
+    // Data and next fields may be overwritten by time stamp of previous packet
+    desc->u32Data = desc->u32Backup1;
+
+    // Set Tx descriptor transmit byte count
+    desc->u32Status2 = u32Size;
+
+    // Change descriptor ownership to EMAC
+    desc->u32Status1 |= EMAC_DESC_OWN_EMAC;
+
+    // Get next Tx descriptor
+    u32NextTxDesc = desc->u32Backup2;
+
+    // Trigger EMAC to send the packet
+    EMAC_TRIGGER_TX();
+
+    return(1);
+}
+
+/**
+  * @brief Send the packet held in the buffer returned by \ref EMAC_RecvPktInPlace
+  * @param[in] u32Size Packet size (without 4 byte CRC).
+  * @return Packet transmit success or not
+  * @retval 0 Transmit failed due to descriptor unavailable.
+  * @retval 1 Packet is triggered to transmit.
+  * @details The buffer of current Rx descriptor is exchanged with the buffer of next Tx descriptor,
+  *          so the packet is sent without copy.
+  * @note Application still needs to call \ref EMAC_RecvPktDone, and must not access the buffer afterwards.
+  */
+uint32_t EMAC_SendRxPkt(uint32_t u32Size)
+{
+    EMAC_DESCRIPTOR_T *rxdesc, *txdesc;
+    uint32_t u32Buf;
+
+    rxdesc = (EMAC_DESCRIPTOR_T *)u32CurrentRxDesc;
+    txdesc = (EMAC_DESCRIPTOR_T *)u32NextTxDesc;
+
+    // Check descriptor ownership
+    if(txdesc->u32Status1 & EMAC_DESC_OWN_EMAC)
+        return(0);
+
+    // Exchange buffers. Rx data field is restored from backup field by EMAC_RecvPktDone()
+    u32Buf = txdesc->u32Backup1;
+    txdesc->u32Backup1 = rxdesc->u32Backup1;
+    rxdesc->u32Backup1 = u32Buf;
+
+    return(EMAC_SendPktInPlace(u32Size));
+}
+
+/**
+  * @brief Send a burst of Ethernet packets from application buffers
+  * @param[in,out] psPkt Array of packets to send. On return, pu8Data of each queued entry points to a free
+  *                buffer the application can reuse.
+  * @param[in] u32Cnt Number of packets in psPkt
+  * @return Number of packets queued for transmit, the remaining entries are left unchanged
+  * @details The application buffer of each packet is attached to a free Tx descriptor, and the buffer
+  *          previously attached to that descriptor is handed back in exchange, so no data is copied.
+  *          EMAC is triggered once after all packets are queued. Completed descriptors are reclaimed
+  *          in bulk by \ref EMAC_SendPktDone.
+  * @note Buffers given to this API must be word aligned and \ref EMAC_FRAME_SIZE bytes, and must not be
+  *       accessed by application until they are returned by a later call.
+  */
+uint32_t EMAC_SendBurst(EMAC_PKT_T *psPkt, uint32_t u32Cnt)
+{
+    EMAC_DESCRIPTOR_T *desc;
+    uint32_t u32Buf;
+    uint32_t i;
+
+    // Get Tx frame descriptor
+    desc = (EMAC_DESCRIPTOR_T *)u32NextTxDesc;
+
+    for(i = 0; i < u32Cnt; i++)
+    {
+        // Check descriptor ownership
+        if(desc->u32Status1 & EMAC_DESC_OWN_EMAC)
+            break;
+
+        // Exchange descriptor buffer with the application buffer
+        u32Buf = desc->u32Backup1;
+        desc->u32Backup1 = (uint32_t)psPkt[i].pu8Data;
+        desc->u32Data = desc->u32Backup1;
+        psPkt[i].pu8Data = (uint8_t *)u32Buf;
+
+        // Set Tx descriptor transmit byte count
+        desc->u32Status2 = psPkt[i].u32Size;
+
+        // Change descriptor ownership to EMAC
+        desc->u32Status1 |= EMAC_DESC_OWN_EMAC;
+
+        // Get next Tx descriptor
+        desc = (EMAC_DESCRIPTOR_T *)desc->u32Backup2;
+    }
+
+    u32NextTxDesc = (uint32_t)desc;
+
+    // Trigger EMAC to send the packets
+    if(i > 0)
+        EMAC_TRIGGER_TX();
+
+    return(i);
+}
+
 
 /**
   * @brief Clean up process after packet(s) are sent
@@ -67,14 +67,37 @@ static void stackDump(uint32_t stack[])
     printf("psr = 0x%x\n", stack[psr]);
 }
 
+#if defined ( __GNUC__ ) && !(__CC_ARM) && !(__ICCARM__)
+#define WEAK_FUNC   __attribute__((weak))
+#else
+#define WEAK_FUNC   __weak
+#endif
+
+/**
+ * @brief       Hook called by the hard fault handler before the registers are dumped
+ * @param[in]   stack pointer points to the dumped registers in SRAM
+ * @param[in]   lr EXC_RETURN value of the hard fault exception
+ * @return      None
+ * @details     The default hook does nothing. The application can provide its own,
+ *              e.g. to save a crash dump to flash before the chip is reset.
+ */
+WEAK_FUNC void HardFault_Hook(uint32_t stack[], uint32_t lr)
+{
+    (void)stack;
+    (void)lr;
+}
+
 /**
  * @brief       Hard fault handler
  * @param[in]   stack pointer points to the dumped registers in SRAM
+ * @param[in]   lr EXC_RETURN value of the hard fault exception
  * @return      None
  * @note        Replace while(1) at the end of this function with chip reset if WDT is not enabled for end product
  */
-void Hard_Fault_Handler(uint32_t stack[])
+void Hard_Fault_Handler(uint32_t stack[], uint32_t lr)
 {
+    HardFault_Hook(stack, lr);
+
     printf("In Hard Fault Handler\n");
 
     stackDump(stack);
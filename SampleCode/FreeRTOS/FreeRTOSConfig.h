@@ -120,6 +120,12 @@ extern uint32_t SystemCoreClock;
 #define configGENERATE_RUN_TIME_STATS   0
 #define configUSE_QUEUE_SETS            1
 
+/* Tickless idle with the NUC472 Power-down mode, see
+low_power_tick_management.c. TIMER0 is clocked by the 32.768 kHz LXT and wakes
+the CPU up. */
+#define configUSE_TICKLESS_IDLE         2
+#define configLPTMR_CLOCK_HZ            32768UL
+
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES       0
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
@@ -130,6 +136,11 @@ extern uint32_t SystemCoreClock;
 #define configTIMER_QUEUE_LENGTH        10
 #define configTIMER_TASK_STACK_DEPTH    ( configMINIMAL_STACK_SIZE * 2 )
 
+/* Keep the active timers in a timing wheel, see timers_wheel.c. Timer commands
+are passed to the timer service task without going through the timer queue. */
+#define configUSE_TIMER_WHEEL           1
+#define configTIMER_WHEEL_LEVELS        4
+
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
 #define INCLUDE_vTaskPrioritySet        1
@@ -175,5 +186,27 @@ standard names. */
 #define xPortPendSVHandler PendSV_Handler
 #define xPortSysTickHandler SysTick_Handler
 
+/* Kernel trace recorder. Events are kept in xTraceBuffer, decode a memory
+dump of it with host/trace_decode.c. */
+#define configUSE_TRACE_RECORDER        1
+#define configTRACE_BUFFER_EVENTS       1024
+
+/* Crash dump saved to the end of the Data Flash on a hard fault, decode it
+with host/crash_decode.c. It includes the last trace recorder events. */
+#define configUSE_CRASH_DUMP            1
+#define configCRASH_DUMP_TRACE_EVENTS   128
+
+/* The crash dump and trace recorder hooks are C only, keep them from the
+assembler. */
+#if defined( __ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+#if ( configUSE_CRASH_DUMP == 1 )
+#include "crash_dump.h"
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+#include "trace_recorder.h"
+#endif
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
 
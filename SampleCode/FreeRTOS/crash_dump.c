@@ -0,0 +1,573 @@
+/**************************************************************************//**
+ * @file     crash_dump.c
+ * @version  V1.00
+ * @brief    Post-mortem crash dump for FreeRTOS, see crash_dump.h.
+ *
+ *           The dump is written by the hard fault handler with the FMC ISP
+ *           commands, so it does not rely on the heap, the kernel or on any
+ *           interrupt. Every pointer taken from the TCBs is checked against
+ *           the RAM range before it is read. The records are written first
+ *           and the header last, with the magic word as the very last word,
+ *           so a dump interrupted by a second fault or a reset is never
+ *           reported as valid.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "NUC472_442.h"
+#include "crash_dump.h"
+#if ( configUSE_TRACE_RECORDER == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+#include "trace_recorder.h"
+#endif
+
+#if ( configUSE_CRASH_DUMP == 1 )
+
+#if ( configCRASH_DUMP_SIZE % FMC_FLASH_PAGE_SIZE ) != 0
+#error configCRASH_DUMP_SIZE must be a multiple of FMC_FLASH_PAGE_SIZE
+#endif
+
+typedef struct
+{
+    void *pvTcb;                        /* NULL for a free entry */
+    uint32_t *pulTopOfStack;            /* &pxTCB->pxTopOfStack, holds the saved stack pointer */
+    uint32_t ulStackBase;
+    uint32_t ulStackTop;
+    const char *pcName;
+    uint32_t ulTcbNumber;
+} CrashTask_t;
+
+/* Sequential writer to the dump area */
+typedef struct
+{
+    uint32_t ulAddr;                    /* Next word to program */
+    uint32_t ulEnd;
+    uint32_t ulWord;                    /* Bytes not programmed yet */
+    uint32_t ulBytes;                   /* Number of bytes in ulWord */
+    uint32_t ulCrc;
+} CrashWriter_t;
+
+static CrashTask_t xCrashTasks[ configCRASH_DUMP_MAX_TASKS ];
+
+/* Start of the dump area, 0 until xCrashDumpInit() succeeds */
+static uint32_t ulCrashDumpBase = 0;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvCrc32( uint32_t ulCrc, uint8_t ucByte )
+{
+    int i;
+
+    ulCrc ^= ucByte;
+    for( i = 0; i < 8; i++ )
+    {
+        ulCrc = ( ulCrc >> 1 ) ^ ( 0xEDB88320UL & ( 0UL - ( ulCrc & 1UL ) ) );
+    }
+    return ulCrc;
+}
+/*-----------------------------------------------------------*/
+
+static int prvIsRam( uint32_t ulAddr, uint32_t ulLength )
+{
+    return ( ulAddr >= configCRASH_DUMP_RAM_BASE ) &&
+           ( ulLength <= configCRASH_DUMP_RAM_SIZE ) &&
+           ( ( ulAddr - configCRASH_DUMP_RAM_BASE ) <= ( configCRASH_DUMP_RAM_SIZE - ulLength ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteBytes( CrashWriter_t *pxWriter, const void *pvData, uint32_t ulLength )
+{
+    const uint8_t *pucData = ( const uint8_t * ) pvData;
+
+    while( ulLength-- > 0 )
+    {
+        pxWriter->ulCrc = prvCrc32( pxWriter->ulCrc, *pucData );
+        pxWriter->ulWord |= ( uint32_t ) *pucData++ << ( pxWriter->ulBytes * 8 );
+
+        if( ++pxWriter->ulBytes == 4 )
+        {
+            if( pxWriter->ulAddr < pxWriter->ulEnd )
+            {
+                FMC_Write( pxWriter->ulAddr, pxWriter->ulWord );
+                pxWriter->ulAddr += 4;
+            }
+            pxWriter->ulWord = 0;
+            pxWriter->ulBytes = 0;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Start a record, or return 0 if it does not fit in the area any more */
+static int prvWriteRecord( CrashWriter_t *pxWriter, uint16_t usType, uint32_t ulLength )
+{
+    CrashRecord_t xRecord;
+
+    ulLength = ( ulLength + 3 ) & ~3UL;
+    if( ( pxWriter->ulEnd - pxWriter->ulAddr ) < ( sizeof( xRecord ) + ulLength ) )
+    {
+        return 0;
+    }
+
+    xRecord.usType = usType;
+    xRecord.usLength = ( uint16_t ) ulLength;
+    prvWriteBytes( pxWriter, &xRecord, sizeof( xRecord ) );
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWritePadding( CrashWriter_t *pxWriter )
+{
+    static const uint8_t ucZero[ 3 ] = { 0, 0, 0 };
+
+    if( pxWriter->ulBytes != 0 )
+    {
+        prvWriteBytes( pxWriter, ucZero, 4 - pxWriter->ulBytes );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteStack( CrashWriter_t *pxWriter, const CrashTask_t *pxTask, uint32_t ulSp, uint32_t ulFlags )
+{
+    CrashStack_t xStack;
+    uint32_t ulLength = 0;
+    uint32_t i;
+
+    memset( &xStack, 0, sizeof( xStack ) );
+    xStack.ulSp = ulSp;
+    xStack.ulFlags = ulFlags;
+
+    if( pxTask != NULL )
+    {
+        xStack.ulTcb = ( uint32_t ) pxTask->pvTcb;
+        xStack.ulTcbNumber = pxTask->ulTcbNumber;
+        xStack.ulStackBase = pxTask->ulStackBase;
+        xStack.ulStackTop = pxTask->ulStackTop;
+
+        if( prvIsRam( ( uint32_t ) pxTask->pcName, sizeof( xStack.cName ) ) )
+        {
+            for( i = 0; ( i < sizeof( xStack.cName ) - 1 ) && ( pxTask->pcName[ i ] != '\0' ); i++ )
+            {
+                xStack.cName[ i ] = pxTask->pcName[ i ];
+            }
+        }
+    }
+    else
+    {
+        /* Main stack, up to the initial MSP in the vector table */
+        xStack.ulStackTop = *( uint32_t * ) SCB->VTOR;
+        xStack.ulStackBase = configCRASH_DUMP_RAM_BASE;
+        strcpy( xStack.cName, "MSP" );
+    }
+
+    /* Save from the stack pointer up to the top of the stack */
+    if( ( ulSp >= xStack.ulStackBase ) && ( ulSp < xStack.ulStackTop ) )
+    {
+        ulLength = xStack.ulStackTop - ulSp;
+        if( ulLength > configCRASH_DUMP_STACK_BYTES )
+        {
+            ulLength = configCRASH_DUMP_STACK_BYTES;
+        }
+    }
+    if( !prvIsRam( ulSp, ulLength ) )
+    {
+        ulLength = 0;
+    }
+    if( ulLength == 0 )
+    {
+        xStack.ulFlags |= cdSTACK_INVALID;
+    }
+
+    if( prvWriteRecord( pxWriter, cdREC_STACK, sizeof( xStack ) + ulLength ) )
+    {
+        prvWriteBytes( pxWriter, &xStack, sizeof( xStack ) );
+        prvWriteBytes( pxWriter, ( const void * ) ulSp, ulLength );
+        prvWritePadding( pxWriter );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_RECORDER == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+
+static void prvWriteTrace( CrashWriter_t *pxWriter )
+{
+    CrashTrace_t xTrace;
+    uint32_t ulFirst, i;
+
+    /* Freeze the ring so the events leading up to the fault are kept */
+    vTraceStop();
+
+    if( xTraceBuffer.ulMagic != trcMAGIC )
+    {
+        return;
+    }
+
+    xTrace.ulCpuClockHz = xTraceBuffer.ulCpuClockHz;
+    xTrace.ulHead = xTraceBuffer.ulHead;
+    xTrace.ulCount = xTrace.ulHead;
+    if( xTrace.ulCount > configTRACE_BUFFER_EVENTS )
+    {
+        xTrace.ulCount = configTRACE_BUFFER_EVENTS;
+    }
+    if( xTrace.ulCount > configCRASH_DUMP_TRACE_EVENTS )
+    {
+        xTrace.ulCount = configCRASH_DUMP_TRACE_EVENTS;
+    }
+    xTrace.ulReserved = 0;
+
+    if( prvWriteRecord( pxWriter, cdREC_TRACE, sizeof( xTrace ) + xTrace.ulCount * sizeof( TraceEvent_t ) ) )
+    {
+        prvWriteBytes( pxWriter, &xTrace, sizeof( xTrace ) );
+
+        ulFirst = xTrace.ulHead - xTrace.ulCount;
+        for( i = 0; i < xTrace.ulCount; i++ )
+        {
+            prvWriteBytes( pxWriter, &xTraceBuffer.xEvents[ ( ulFirst + i ) & ( configTRACE_BUFFER_EVENTS - 1 ) ], sizeof( TraceEvent_t ) );
+        }
+    }
+}
+
+#endif /* configUSE_TRACE_RECORDER */
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Locate the dump area at the end of the Data Flash
+  * @param  None
+  * @retval 0   Success
+  * @retval -1  The Data Flash is disabled or smaller than configCRASH_DUMP_SIZE
+  * @details Must be called before the first task is created.
+  */
+int32_t xCrashDumpInit( void )
+{
+    uint32_t ulDataFlashBase;
+
+    memset( xCrashTasks, 0, sizeof( xCrashTasks ) );
+
+    SYS_UnlockReg();
+    FMC_Open();
+    ulDataFlashBase = FMC_ReadDataFlashBaseAddr();
+    FMC_Close();
+    SYS_LockReg();
+
+    if( ( ulDataFlashBase >= FMC_APROM_END ) || ( ( FMC_APROM_END - ulDataFlashBase ) < configCRASH_DUMP_SIZE ) )
+    {
+        ulCrashDumpBase = 0;
+        return -1;
+    }
+
+    ulCrashDumpBase = FMC_APROM_END - configCRASH_DUMP_SIZE;
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Save the crash dump to flash
+  * @param  pulStack    Exception stack frame of the fault, r0 first
+  * @param  ulExcReturn EXC_RETURN value of the hard fault
+  * @retval None
+  * @details Runs in the hard fault handler. r4 to r11 are read on entry, they
+  *          hold the values of the faulting code as long as the compiler has
+  *          not used them in Hard_Fault_Handler() before the hook is called.
+  */
+void vCrashDumpSave( uint32_t *pulStack, uint32_t ulExcReturn )
+{
+    CrashDumpHeader_t *pxHeader;
+    CrashWriter_t xWriter;
+    CrashFault_t xFault;
+    void *pvRunning = NULL;
+    uint32_t ulPage, ulSp, i;
+
+#if defined ( __CC_ARM )
+    {
+        register uint32_t r4 __asm( "r4" ), r5 __asm( "r5" ), r6 __asm( "r6" ), r7 __asm( "r7" );
+        register uint32_t r8 __asm( "r8" ), r9 __asm( "r9" ), r10 __asm( "r10" ), r11 __asm( "r11" );
+
+        xFault.ulR4_R11[ 0 ] = r4;
+        xFault.ulR4_R11[ 1 ] = r5;
+        xFault.ulR4_R11[ 2 ] = r6;
+        xFault.ulR4_R11[ 3 ] = r7;
+        xFault.ulR4_R11[ 4 ] = r8;
+        xFault.ulR4_R11[ 5 ] = r9;
+        xFault.ulR4_R11[ 6 ] = r10;
+        xFault.ulR4_R11[ 7 ] = r11;
+    }
+#else
+    __asm volatile( "stm %0, {r4-r11}" : : "r" ( xFault.ulR4_R11 ) : "memory" );
+#endif
+
+    if( ulCrashDumpBase == 0 )
+    {
+        return;
+    }
+    pxHeader = ( CrashDumpHeader_t * ) ulCrashDumpBase;
+
+    SYS_UnlockReg();
+    FMC_Open();
+    FMC_ENABLE_AP_UPDATE();
+
+    if( pxHeader->ulMagic == cdMAGIC )
+    {
+        /* Keep the dump of the first fault until it has been read, just count
+           this one */
+        for( i = 0; i < cdTALLY_WORDS; i++ )
+        {
+            if( pxHeader->ulTally[ i ] == 0xFFFFFFFFUL )
+            {
+                FMC_Write( ( uint32_t ) &pxHeader->ulTally[ i ], 0 );
+                break;
+            }
+        }
+    }
+    else
+    {
+        for( ulPage = ulCrashDumpBase; ulPage < ulCrashDumpBase + configCRASH_DUMP_SIZE; ulPage += FMC_FLASH_PAGE_SIZE )
+        {
+            FMC_Erase( ulPage );
+        }
+
+        xWriter.ulAddr = ulCrashDumpBase + sizeof( CrashDumpHeader_t );
+        xWriter.ulEnd = ulCrashDumpBase + configCRASH_DUMP_SIZE;
+        xWriter.ulWord = 0;
+        xWriter.ulBytes = 0;
+        xWriter.ulCrc = 0xFFFFFFFFUL;
+
+        /* Faulting context */
+        for( i = 0; i < 8; i++ )
+        {
+            xFault.ulStacked[ i ] = prvIsRam( ( uint32_t ) &pulStack[ i ], 4 ) ? pulStack[ i ] : 0;
+        }
+        xFault.ulExcReturn = ulExcReturn;
+        xFault.ulMsp = __get_MSP();
+        xFault.ulPsp = __get_PSP();
+        xFault.ulCfsr = SCB->CFSR;
+        xFault.ulHfsr = SCB->HFSR;
+        xFault.ulMmfar = SCB->MMFAR;
+        xFault.ulBfar = SCB->BFAR;
+        xFault.ulAfsr = SCB->AFSR;
+        xFault.ulShcsr = SCB->SHCSR;
+        xFault.ulTickCount = xTaskGetTickCountFromISR();
+        xFault.ulRunningTask = 0;
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 )
+        if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+        {
+            pvRunning = xTaskGetCurrentTaskHandle();
+        }
+#endif
+        for( i = 0; i < configCRASH_DUMP_MAX_TASKS; i++ )
+        {
+            if( ( pvRunning != NULL ) && ( xCrashTasks[ i ].pvTcb == pvRunning ) )
+            {
+                xFault.ulRunningTask = xCrashTasks[ i ].ulTcbNumber;
+            }
+        }
+
+        if( prvWriteRecord( &xWriter, cdREC_FAULT, sizeof( xFault ) ) )
+        {
+            prvWriteBytes( &xWriter, &xFault, sizeof( xFault ) );
+        }
+
+        /* The stack the exception frame was pushed to. A fault in a handler
+           or before the scheduler started is on the main stack. */
+        if( ( ulExcReturn & 4 ) == 0 )
+        {
+            prvWriteStack( &xWriter, NULL, ( uint32_t ) pulStack, cdSTACK_EXCEPTION );
+        }
+
+        /* Every task. The running task was interrupted with its stack pointer
+           in PSP, the others were saved in their TCB. */
+        for( i = 0; i < configCRASH_DUMP_MAX_TASKS; i++ )
+        {
+            if( xCrashTasks[ i ].pvTcb == NULL )
+            {
+                continue;
+            }
+
+            if( xCrashTasks[ i ].pvTcb == pvRunning )
+            {
+                prvWriteStack( &xWriter, &xCrashTasks[ i ], xFault.ulPsp, cdSTACK_RUNNING );
+            }
+            else
+            {
+                ulSp = prvIsRam( ( uint32_t ) xCrashTasks[ i ].pulTopOfStack, 4 ) ? *xCrashTasks[ i ].pulTopOfStack : 0;
+                prvWriteStack( &xWriter, &xCrashTasks[ i ], ulSp, 0 );
+            }
+        }
+
+#if ( configUSE_TRACE_RECORDER == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+        prvWriteTrace( &xWriter );
+#endif
+        prvWritePadding( &xWriter );
+
+        /* Header, magic word last */
+        FMC_Write( ( uint32_t ) &pxHeader->usVersion, ( ( uint32_t ) sizeof( CrashDumpHeader_t ) << 16 ) | cdVERSION );
+        FMC_Write( ( uint32_t ) &pxHeader->ulLength, xWriter.ulAddr - ( ulCrashDumpBase + sizeof( CrashDumpHeader_t ) ) );
+        FMC_Write( ( uint32_t ) &pxHeader->ulCrc, ~xWriter.ulCrc );
+        FMC_Write( ( uint32_t ) &pxHeader->ulMagic, cdMAGIC );
+    }
+
+    FMC_DISABLE_AP_UPDATE();
+    FMC_Close();
+
+#if ( configCRASH_DUMP_RESET == 1 )
+    NVIC_SystemReset();
+#else
+    SYS_LockReg();
+#endif
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Get the dump saved before the reset
+  * @param  None
+  * @return The dump header, followed by the records, or NULL if there is no
+  *         valid dump
+  */
+const CrashDumpHeader_t *pxCrashDumpGet( void )
+{
+    const CrashDumpHeader_t *pxHeader = ( const CrashDumpHeader_t * ) ulCrashDumpBase;
+    const uint8_t *pucData;
+    uint32_t ulCrc, i;
+
+    if( ( pxHeader == NULL ) || ( pxHeader->ulMagic != cdMAGIC ) || ( pxHeader->usVersion != cdVERSION ) ||
+        ( pxHeader->ulLength > configCRASH_DUMP_SIZE - sizeof( CrashDumpHeader_t ) ) )
+    {
+        return NULL;
+    }
+
+    pucData = ( const uint8_t * ) ( pxHeader + 1 );
+    ulCrc = 0xFFFFFFFFUL;
+    for( i = 0; i < pxHeader->ulLength; i++ )
+    {
+        ulCrc = prvCrc32( ulCrc, pucData[ i ] );
+    }
+
+    return ( ~ulCrc == pxHeader->ulCrc ) ? pxHeader : NULL;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulCrashDumpLostFaults( void )
+{
+    const CrashDumpHeader_t *pxHeader = pxCrashDumpGet();
+    uint32_t ulCount = 0, i;
+
+    if( pxHeader != NULL )
+    {
+        for( i = 0; i < cdTALLY_WORDS; i++ )
+        {
+            if( pxHeader->ulTally[ i ] == 0 )
+            {
+                ulCount++;
+            }
+        }
+    }
+    return ulCount;
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Print the dump for upload
+  * @param  None
+  * @retval None
+  * @details Prints the header and the records as hex, 32 bytes per line,
+  *          each line prefixed with "CDMP" and the offset of its first byte.
+  */
+void vCrashDumpPrint( void )
+{
+    const CrashDumpHeader_t *pxHeader = pxCrashDumpGet();
+    const uint8_t *pucData = ( const uint8_t * ) pxHeader;
+    uint32_t ulLength, i;
+
+    if( pxHeader == NULL )
+    {
+        return;
+    }
+
+    ulLength = sizeof( CrashDumpHeader_t ) + pxHeader->ulLength;
+    for( i = 0; i < ulLength; i++ )
+    {
+        if( ( i & 31 ) == 0 )
+        {
+            printf( "%sCDMP %04x ", ( i == 0 ) ? "" : "\n", ( unsigned int ) i );
+        }
+        printf( "%02x", pucData[ i ] );
+    }
+    printf( "\n" );
+}
+/*-----------------------------------------------------------*/
+
+void vCrashDumpClear( void )
+{
+    uint32_t ulPage;
+
+    if( ulCrashDumpBase == 0 )
+    {
+        return;
+    }
+
+    SYS_UnlockReg();
+    FMC_Open();
+    FMC_ENABLE_AP_UPDATE();
+    for( ulPage = ulCrashDumpBase; ulPage < ulCrashDumpBase + configCRASH_DUMP_SIZE; ulPage += FMC_FLASH_PAGE_SIZE )
+    {
+        FMC_Erase( ulPage );
+    }
+    FMC_DISABLE_AP_UPDATE();
+    FMC_Close();
+    SYS_LockReg();
+}
+/*-----------------------------------------------------------*/
+
+void vCrashDumpAddTask( void *pvTcb, void *pvTopOfStack, void *pvStack, uint32_t ulStackDepth, const char *pcName, uint32_t ulTcbNumber )
+{
+    int i;
+
+    /* Called from a critical section of the kernel */
+    for( i = 0; i < configCRASH_DUMP_MAX_TASKS; i++ )
+    {
+        if( xCrashTasks[ i ].pvTcb == NULL )
+        {
+            xCrashTasks[ i ].pulTopOfStack = ( uint32_t * ) pvTopOfStack;
+            xCrashTasks[ i ].ulStackBase = ( uint32_t ) pvStack;
+            xCrashTasks[ i ].ulStackTop = ( uint32_t ) pvStack + ulStackDepth * sizeof( StackType_t );
+            xCrashTasks[ i ].pcName = pcName;
+            xCrashTasks[ i ].ulTcbNumber = ulTcbNumber;
+            xCrashTasks[ i ].pvTcb = pvTcb;
+            break;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vCrashDumpRemoveTask( void *pvTcb )
+{
+    int i;
+
+    for( i = 0; i < configCRASH_DUMP_MAX_TASKS; i++ )
+    {
+        if( xCrashTasks[ i ].pvTcb == pvTcb )
+        {
+            xCrashTasks[ i ].pvTcb = NULL;
+            break;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Called by Hard_Fault_Handler() in retarget.c
+  * @param  stack   Exception stack frame of the fault
+  * @param  lr      EXC_RETURN value of the hard fault
+  * @retval None
+  */
+void HardFault_Hook( uint32_t stack[], uint32_t lr )
+{
+    vCrashDumpSave( stack, lr );
+}
+
+#endif /* configUSE_CRASH_DUMP */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
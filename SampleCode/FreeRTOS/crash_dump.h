@@ -0,0 +1,176 @@
+/**************************************************************************//**
+ * @file     crash_dump.h
+ * @version  V1.00
+ * @brief    Post-mortem crash dump for FreeRTOS. On a hard fault the
+ *           faulting registers, the fault status registers, the stack of
+ *           every task and the last events of the trace recorder are
+ *           written to a reserved area at the end of the Data Flash. After
+ *           the reset the dump can be read back, printed for upload and
+ *           cleared. host/crash_decode.c decodes it.
+ *
+ *           Include this file at the end of FreeRTOSConfig.h, before
+ *           trace_recorder.h, and call xCrashDumpInit() before the first
+ *           task is created. The Data Flash must be enabled in CONFIG0 and
+ *           be at least configCRASH_DUMP_SIZE bytes long.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __CRASH_DUMP_H__
+#define __CRASH_DUMP_H__
+
+#include <stdint.h>
+
+/* Size of the dump area, a multiple of the 2 KB flash page. It is placed at
+   the end of APROM, which is the end of the Data Flash. */
+#ifndef configCRASH_DUMP_SIZE
+#define configCRASH_DUMP_SIZE           ( 4 * 0x800 )
+#endif
+
+/* Maximum number of tasks whose stack is saved */
+#ifndef configCRASH_DUMP_MAX_TASKS
+#define configCRASH_DUMP_MAX_TASKS      16
+#endif
+
+/* Bytes saved from the top of each stack, from the saved stack pointer up */
+#ifndef configCRASH_DUMP_STACK_BYTES
+#define configCRASH_DUMP_STACK_BYTES    256
+#endif
+
+/* Number of the most recent trace recorder events saved */
+#ifndef configCRASH_DUMP_TRACE_EVENTS
+#define configCRASH_DUMP_TRACE_EVENTS   128
+#endif
+
+/* Stacks are only read inside this range, so a corrupted TCB cannot cause a
+   second fault while the dump is written */
+#ifndef configCRASH_DUMP_RAM_BASE
+#define configCRASH_DUMP_RAM_BASE       0x20000000UL
+#define configCRASH_DUMP_RAM_SIZE       0x00010000UL
+#endif
+
+/* Set to 0 to return to Hard_Fault_Handler() after the dump is saved
+   instead of resetting the chip */
+#ifndef configCRASH_DUMP_RESET
+#define configCRASH_DUMP_RESET          1
+#endif
+
+#define cdMAGIC                         0x504D4443UL    /* "CDMP" */
+#define cdVERSION                       1
+
+/* Further faults while a dump is waiting to be read each program one word of
+   this tally, so the dump of the first fault is kept */
+#define cdTALLY_WORDS                   8
+
+/* Record types. Each record starts with a CrashRecord_t, the payload is
+   padded to a multiple of 4 bytes. */
+#define cdREC_FAULT                     1       /* CrashFault_t */
+#define cdREC_STACK                     2       /* CrashStack_t followed by the stack contents */
+#define cdREC_TRACE                     3       /* CrashTrace_t followed by TraceEvent_t events */
+
+/* Flags of CrashStack_t */
+#define cdSTACK_RUNNING                 0x01    /* Task that was running when the fault occurred */
+#define cdSTACK_EXCEPTION               0x02    /* Main stack of the faulting handler, not a task */
+#define cdSTACK_INVALID                 0x04    /* Stack pointer outside RAM, no contents saved */
+
+typedef struct
+{
+    uint32_t ulMagic;                   /* cdMAGIC, programmed last */
+    uint16_t usVersion;                 /* cdVERSION */
+    uint16_t usHeaderSize;              /* sizeof( CrashDumpHeader_t ) */
+    uint32_t ulLength;                  /* Bytes of records following the header */
+    uint32_t ulCrc;                     /* CRC-32 of the records */
+    uint32_t ulTally[ cdTALLY_WORDS ];  /* 0 for each fault that was not saved */
+} CrashDumpHeader_t;
+
+typedef struct
+{
+    uint16_t usType;                    /* cdREC_xxx */
+    uint16_t usLength;                  /* Payload length in bytes */
+} CrashRecord_t;
+
+typedef struct
+{
+    uint32_t ulStacked[ 8 ];            /* r0, r1, r2, r3, r12, lr, pc, xpsr */
+    uint32_t ulR4_R11[ 8 ];             /* r4 to r11 */
+    uint32_t ulExcReturn;               /* EXC_RETURN of the hard fault */
+    uint32_t ulMsp;
+    uint32_t ulPsp;
+    uint32_t ulCfsr;                    /* SCB registers */
+    uint32_t ulHfsr;
+    uint32_t ulMmfar;
+    uint32_t ulBfar;
+    uint32_t ulAfsr;
+    uint32_t ulShcsr;
+    uint32_t ulTickCount;               /* xTaskGetTickCount() */
+    uint32_t ulRunningTask;             /* TCB number of the running task */
+} CrashFault_t;
+
+typedef struct
+{
+    uint32_t ulTcb;                     /* TCB address, 0 for the main stack */
+    uint32_t ulTcbNumber;
+    uint32_t ulSp;                      /* Saved stack pointer, address of the first byte saved */
+    uint32_t ulStackBase;               /* Lowest address of the stack */
+    uint32_t ulStackTop;                /* Address after the highest word of the stack */
+    uint32_t ulFlags;                   /* cdSTACK_xxx */
+    char cName[ 16 ];
+} CrashStack_t;
+
+typedef struct
+{
+    uint32_t ulCpuClockHz;              /* Timestamp frequency */
+    uint32_t ulHead;                    /* Events recorded since vTraceEnable() */
+    uint32_t ulCount;                   /* Events saved, oldest first */
+    uint32_t ulReserved;
+} CrashTrace_t;
+
+/* Locate the dump area. Returns 0, or -1 if the Data Flash is too small. */
+int32_t xCrashDumpInit( void );
+
+/* Save the dump, called by Hard_Fault_Handler() through HardFault_Hook() */
+void vCrashDumpSave( uint32_t *pulStack, uint32_t ulExcReturn );
+
+/* The dump saved before the reset, or NULL if there is none or it is
+   corrupted */
+const CrashDumpHeader_t *pxCrashDumpGet( void );
+
+/* Number of faults that occurred while the dump was waiting to be read */
+uint32_t ulCrashDumpLostFaults( void );
+
+/* Print the dump as "CDMP <offset> <hex bytes>" lines for upload over the
+   console. host/crash_decode.c reads the captured log. */
+void vCrashDumpPrint( void );
+
+/* Erase the dump once it has been uploaded */
+void vCrashDumpClear( void );
+
+/* Task registry, kept up to date by the kernel hooks below */
+void vCrashDumpAddTask( void *pvTcb, void *pvTopOfStack, void *pvStack, uint32_t ulStackDepth, const char *pcName, uint32_t ulTcbNumber );
+void vCrashDumpRemoveTask( void *pvTcb );
+
+/*-----------------------------------------------------------
+ * Kernel hooks. They are expanded inside xTaskGenericCreate() and
+ * vTaskDelete(), so the TCB members and the stack depth are in scope.
+ * trace_recorder.h calls them from its own task hooks.
+ *----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+#define cdTCB_NUMBER( pxTCB )           ( ( pxTCB )->uxTCBNumber )
+#else
+#define cdTCB_NUMBER( pxTCB )           0
+#endif
+
+#define traceCRASH_TASK_CREATE( pxNewTCB ) \
+    vCrashDumpAddTask( ( pxNewTCB ), ( void * ) &( ( pxNewTCB )->pxTopOfStack ), ( pxNewTCB )->pxStack, \
+                       usStackDepth, ( const char * ) ( pxNewTCB )->pcTaskName, cdTCB_NUMBER( pxNewTCB ) )
+#define traceCRASH_TASK_DELETE( pxTCB )         vCrashDumpRemoveTask( pxTCB )
+
+#if ( configUSE_TRACE_RECORDER != 1 ) || ( configUSE_TRACE_FACILITY != 1 )
+#define traceTASK_CREATE( pxNewTCB )            traceCRASH_TASK_CREATE( pxNewTCB )
+#define traceTASK_DELETE( pxTCB )               traceCRASH_TASK_DELETE( pxTCB )
+#endif
+
+#endif /* __CRASH_DUMP_H__ */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
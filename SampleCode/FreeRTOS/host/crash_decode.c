@@ -0,0 +1,360 @@
+/**************************************************************************//**
+ * @file     crash_decode.c
+ * @version  V1.00
+ * @brief    Host side decoder for the FreeRTOS crash dump (crash_dump.c).
+ *           Prints the faulting registers with the decoded fault status,
+ *           the stack of every task with the words that look like return
+ *           addresses, and the trace recorder events leading up to the
+ *           fault.
+ *
+ *           Build: gcc -O2 -o crash_decode crash_decode.c
+ *           Usage: crash_decode dump.bin
+ *                  crash_decode console.log
+ *
+ *           The input is either a binary copy of the dump area, e.g. read
+ *           with the ICP tool or with GDB, or a console log containing the
+ *           "CDMP" lines printed by vCrashDumpPrint(). Resolve the addresses
+ *           with addr2line -e <image.elf> or the map file.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Must match crash_dump.h */
+#define cdMAGIC             0x504D4443UL
+#define cdVERSION           1
+#define cdHEADER_SIZE       48
+#define cdREC_FAULT         1
+#define cdREC_STACK         2
+#define cdREC_TRACE         3
+#define cdSTACK_RUNNING     0x01
+#define cdSTACK_EXCEPTION   0x02
+#define cdSTACK_INVALID     0x04
+#define cdFAULT_SIZE        108
+#define cdSTACK_HDR_SIZE    40
+#define cdTRACE_HDR_SIZE    16
+
+/* Code is in APROM, below this address */
+#define CODE_END            0x00080000UL
+
+#define MAX_DUMP            0x10000
+
+static uint8_t g_au8Dump[MAX_DUMP];
+
+static uint32_t rd32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t rd16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t crc32(const uint8_t *p, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+    int i;
+
+    while (len--)
+    {
+        crc ^= *p++;
+        for (i = 0; i < 8; i++)
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+    }
+    return ~crc;
+}
+
+static int hexval(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/* Read a binary dump, or the CDMP lines of a console log */
+static long load(const char *path)
+{
+    FILE *fp;
+    char line[512], *p;
+    long size, max = 0;
+    unsigned int ofs;
+    int hi, lo;
+
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    size = (long)fread(g_au8Dump, 1, sizeof(g_au8Dump), fp);
+    if (size >= 4 && rd32(g_au8Dump) == cdMAGIC)
+    {
+        fclose(fp);
+        return size;
+    }
+
+    memset(g_au8Dump, 0, sizeof(g_au8Dump));
+    rewind(fp);
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        p = strstr(line, "CDMP ");
+        if (p == NULL || sscanf(p + 5, "%x", &ofs) != 1)
+            continue;
+        p = strchr(p + 5, ' ');
+        if (p == NULL)
+            continue;
+        p++;
+        while ((hi = hexval(p[0])) >= 0 && (lo = hexval(p[1])) >= 0 && ofs < MAX_DUMP)
+        {
+            g_au8Dump[ofs++] = (uint8_t)((hi << 4) | lo);
+            p += 2;
+        }
+        if ((long)ofs > max)
+            max = ofs;
+    }
+    fclose(fp);
+    return max;
+}
+
+static void print_cfsr(uint32_t cfsr, uint32_t hfsr, uint32_t mmfar, uint32_t bfar)
+{
+    static const char *const apcBits[32] =
+    {
+        /* MMFSR */
+        "IACCVIOL: instruction access violation", "DACCVIOL: data access violation", NULL,
+        "MUNSTKERR: MemManage fault on unstacking", "MSTKERR: MemManage fault on stacking",
+        "MLSPERR: MemManage fault on FP lazy state preservation", NULL, "MMARVALID",
+        /* BFSR */
+        "IBUSERR: instruction bus error", "PRECISERR: precise data bus error",
+        "IMPRECISERR: imprecise data bus error", "UNSTKERR: bus fault on unstacking",
+        "STKERR: bus fault on stacking", "LSPERR: bus fault on FP lazy state preservation", NULL, "BFARVALID",
+        /* UFSR */
+        "UNDEFINSTR: undefined instruction", "INVSTATE: invalid EPSR state (Thumb bit)",
+        "INVPC: invalid EXC_RETURN", "NOCP: no coprocessor", NULL, NULL, NULL, NULL,
+        "UNALIGNED: unaligned access", "DIVBYZERO: divide by zero", NULL, NULL, NULL, NULL, NULL, NULL
+    };
+    int i;
+
+    if (hfsr & (1UL << 1))
+        printf("  HFSR.VECTTBL: bus fault on vector table read\n");
+    if (hfsr & (1UL << 30))
+        printf("  HFSR.FORCED: escalated configurable fault\n");
+    if (hfsr & (1UL << 31))
+        printf("  HFSR.DEBUGEVT: debug event\n");
+
+    for (i = 0; i < 32; i++)
+    {
+        if ((cfsr & (1UL << i)) && apcBits[i] != NULL && i != 7 && i != 15)
+            printf("  %s\n", apcBits[i]);
+    }
+    if (cfsr & (1UL << 7))
+        printf("  MMFAR = 0x%08x (faulting data address)\n", mmfar);
+    if (cfsr & (1UL << 15))
+        printf("  BFAR  = 0x%08x (faulting data address)\n", bfar);
+}
+
+static void decode_fault(const uint8_t *p)
+{
+    static const char *const apcStacked[8] = { "r0", "r1", "r2", "r3", "r12", "lr", "pc", "xpsr" };
+    uint32_t exc_return = rd32(p + 64);
+    uint32_t cfsr = rd32(p + 76);
+    int i;
+
+    printf("Fault\n");
+    printf("  pc   = 0x%08x   <- faulting instruction\n", rd32(p + 24));
+    printf("  lr   = 0x%08x   <- caller\n", rd32(p + 20));
+    for (i = 0; i < 8; i++)
+    {
+        if (i != 5 && i != 6)
+            printf("  %-4s = 0x%08x\n", apcStacked[i], rd32(p + i * 4));
+    }
+    for (i = 0; i < 8; i++)
+        printf("  r%-3d = 0x%08x\n", i + 4, rd32(p + 32 + i * 4));
+    printf("  exception number %u at the fault (0 = thread mode)\n", rd32(p + 28) & 0x1FF);
+    printf("  EXC_RETURN = 0x%08x: %s, %s stack frame\n", exc_return,
+           (exc_return & 4) ? "task (PSP)" : "handler or main (MSP)",
+           (exc_return & 0x10) ? "basic" : "FPU");
+    printf("  MSP = 0x%08x  PSP = 0x%08x\n", rd32(p + 68), rd32(p + 72));
+    printf("  CFSR = 0x%08x  HFSR = 0x%08x  AFSR = 0x%08x  SHCSR = 0x%08x\n",
+           cfsr, rd32(p + 80), rd32(p + 92), rd32(p + 96));
+    print_cfsr(cfsr, rd32(p + 80), rd32(p + 84), rd32(p + 88));
+    printf("  tick count %u, running task #%u\n\n", rd32(p + 100), rd32(p + 104));
+}
+
+static void decode_stack(const uint8_t *p, uint32_t len)
+{
+    uint32_t sp = rd32(p + 8), base = rd32(p + 12), top = rd32(p + 16), flags = rd32(p + 20);
+    uint32_t n = len - cdSTACK_HDR_SIZE, i, w;
+    char name[17];
+
+    memcpy(name, p + 24, 16);
+    name[16] = '\0';
+
+    if (flags & cdSTACK_EXCEPTION)
+        printf("Main stack");
+    else
+        printf("Task #%u \"%s\" (TCB 0x%08x)%s", rd32(p + 4), name, rd32(p), (flags & cdSTACK_RUNNING) ? " RUNNING" : "");
+    printf("\n  stack 0x%08x-0x%08x, sp 0x%08x", base, top, sp);
+    if (!(flags & cdSTACK_EXCEPTION) && sp >= base && sp < top)
+        printf(", %u bytes used", top - sp);
+    printf("\n");
+
+    if (flags & cdSTACK_INVALID)
+    {
+        printf("  stack pointer out of range, stack overflow or corrupted TCB\n\n");
+        return;
+    }
+
+    p += cdSTACK_HDR_SIZE;
+    for (i = 0; i + 4 <= n && sp + i < top; i += 4)
+    {
+        w = rd32(p + i);
+        printf("  0x%08x: 0x%08x", sp + i, w);
+        /* Thumb code addresses have bit 0 set */
+        if ((w & 1) && w < CODE_END && w > 0x100)
+            printf("   <- code 0x%08x", w & ~1U);
+        printf("\n");
+    }
+    printf("\n");
+}
+
+static const char *event_name(uint32_t code)
+{
+    switch (code)
+    {
+    case 0x01: return "task create";
+    case 0x02: return "name";
+    case 0x03: return "task delete";
+    case 0x04: return "task switched in";
+    case 0x05: return "task ready";
+    case 0x06: return "task priority set";
+    case 0x07: return "task delay";
+    case 0x10: return "queue create";
+    case 0x11: return "queue name";
+    case 0x12: return "queue delete";
+    case 0x13: return "queue send";
+    case 0x14: return "queue send failed";
+    case 0x15: return "queue receive";
+    case 0x16: return "queue receive failed";
+    case 0x17: return "queue peek";
+    case 0x18: return "queue send from ISR";
+    case 0x19: return "queue send from ISR failed";
+    case 0x1A: return "queue receive from ISR";
+    case 0x1B: return "queue receive from ISR failed";
+    case 0x1C: return "blocked on queue send";
+    case 0x1D: return "blocked on queue receive";
+    case 0x20: return "ISR enter";
+    case 0x21: return "ISR exit";
+    case 0x30: return "malloc";
+    case 0x31: return "malloc failed";
+    case 0x32: return "free";
+    case 0x40: return "low power begin";
+    case 0x41: return "low power end";
+    case 0x50: return "user";
+    default:   return "?";
+    }
+}
+
+static void decode_trace(const uint8_t *p, uint32_t len)
+{
+    uint32_t hz = rd32(p), head = rd32(p + 4), count = rd32(p + 8), i;
+    uint32_t t0, t, evt;
+    double us;
+
+    if (cdTRACE_HDR_SIZE + count * 8 > len)
+        count = (len - cdTRACE_HDR_SIZE) / 8;
+    printf("Last %u of %u trace events, time relative to the fault\n", count, head);
+    if (count == 0 || hz == 0)
+        return;
+
+    p += cdTRACE_HDR_SIZE;
+    t0 = rd32(p + (count - 1) * 8);
+    for (i = 0; i < count; i++)
+    {
+        t = rd32(p + i * 8);
+        evt = rd32(p + i * 8 + 4);
+        us = (double)(uint32_t)(t0 - t) * 1e6 / hz;
+        printf("  %10.1f us  %-28s 0x%06x\n", us > 0 ? -us : 0.0, event_name(evt >> 24), evt & 0xFFFFFF);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    long size;
+    uint32_t length, ofs, type, len, lost, i;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s dump.bin|console.log\n", argv[0]);
+        return 1;
+    }
+
+    size = load(argv[1]);
+    if (size < cdHEADER_SIZE || rd32(g_au8Dump) != cdMAGIC)
+    {
+        fprintf(stderr, "%s: no crash dump found\n", argv[1]);
+        return 1;
+    }
+    if (rd16(g_au8Dump + 4) != cdVERSION || rd16(g_au8Dump + 6) != cdHEADER_SIZE)
+    {
+        fprintf(stderr, "unsupported dump version %u\n", rd16(g_au8Dump + 4));
+        return 1;
+    }
+
+    length = rd32(g_au8Dump + 8);
+    if (cdHEADER_SIZE + (long)length > size)
+    {
+        fprintf(stderr, "dump truncated, %ld of %u bytes\n", size, cdHEADER_SIZE + length);
+        return 1;
+    }
+    if (crc32(g_au8Dump + cdHEADER_SIZE, length) != rd32(g_au8Dump + 12))
+        printf("WARNING: CRC mismatch, the dump is corrupted\n");
+
+    lost = 0;
+    for (i = 0; i < 8; i++)
+    {
+        if (rd32(g_au8Dump + 16 + i * 4) == 0)
+            lost++;
+    }
+    if (lost)
+        printf("%u%s later faults were not saved\n", lost, lost == 8 ? " or more" : "");
+    printf("\n");
+
+    for (ofs = cdHEADER_SIZE; ofs + 4 <= cdHEADER_SIZE + length; ofs += 4 + len)
+    {
+        type = rd16(g_au8Dump + ofs);
+        len = rd16(g_au8Dump + ofs + 2);
+        if (ofs + 4 + len > cdHEADER_SIZE + length)
+            break;
+
+        switch (type)
+        {
+        case cdREC_FAULT:
+            if (len >= cdFAULT_SIZE)
+                decode_fault(g_au8Dump + ofs + 4);
+            break;
+        case cdREC_STACK:
+            if (len >= cdSTACK_HDR_SIZE)
+                decode_stack(g_au8Dump + ofs + 4, len);
+            break;
+        case cdREC_TRACE:
+            if (len >= cdTRACE_HDR_SIZE)
+                decode_trace(g_au8Dump + ofs + 4, len);
+            break;
+        default:
+            printf("unknown record type %u, %u bytes\n\n", type, len);
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
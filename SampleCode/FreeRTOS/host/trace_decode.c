@@ -0,0 +1,741 @@
+/**************************************************************************//**
+ * @file     trace_decode.c
+ * @version  V1.00
+ * @brief    Host side decoder for the FreeRTOS trace recorder
+ *           (trace_recorder.c). Reads a binary memory dump of xTraceBuffer
+ *           and prints per task CPU usage, ISR duration and ISR to task
+ *           latency histograms, task wake-up latencies, queue and heap
+ *           statistics. Optionally writes a Chrome trace JSON file that can
+ *           be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+ *
+ *           Build: gcc -O2 -o trace_decode trace_decode.c
+ *           Usage: trace_decode [-j trace.json] [-c cpu_hz] dump.bin
+ *
+ *           The dump can be taken with any debugger, e.g. in GDB:
+ *           dump binary value dump.bin xTraceBuffer
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Must match trace_recorder.h */
+#define trcMAGIC                        0x4352544EUL
+#define trcVERSION                      1
+#define trcHEADER_SIZE                  24
+
+#define trcEVT_TASK_CREATE              0x01
+#define trcEVT_NAME                     0x02
+#define trcEVT_TASK_DELETE              0x03
+#define trcEVT_TASK_SWITCHED_IN         0x04
+#define trcEVT_TASK_READY               0x05
+#define trcEVT_TASK_PRIORITY_SET        0x06
+#define trcEVT_TASK_DELAY               0x07
+#define trcEVT_QUEUE_CREATE             0x10
+#define trcEVT_QUEUE_NAME               0x11
+#define trcEVT_QUEUE_DELETE             0x12
+#define trcEVT_QUEUE_SEND               0x13
+#define trcEVT_QUEUE_SEND_FAILED        0x14
+#define trcEVT_QUEUE_RECEIVE            0x15
+#define trcEVT_QUEUE_RECEIVE_FAILED     0x16
+#define trcEVT_QUEUE_PEEK               0x17
+#define trcEVT_QUEUE_SEND_ISR           0x18
+#define trcEVT_QUEUE_SEND_ISR_FAILED    0x19
+#define trcEVT_QUEUE_RECEIVE_ISR        0x1A
+#define trcEVT_QUEUE_RECEIVE_ISR_FAILED 0x1B
+#define trcEVT_QUEUE_BLOCK_SEND         0x1C
+#define trcEVT_QUEUE_BLOCK_RECEIVE      0x1D
+#define trcEVT_ISR_ENTER                0x20
+#define trcEVT_ISR_EXIT                 0x21
+#define trcEVT_MALLOC                   0x30
+#define trcEVT_MALLOC_FAILED            0x31
+#define trcEVT_FREE                     0x32
+#define trcEVT_LOW_POWER_BEGIN          0x40
+#define trcEVT_LOW_POWER_END            0x41
+#define trcEVT_USER                     0x50
+
+#define MAX_TASKS       64
+#define MAX_QUEUES      128
+#define MAX_EXCEPTIONS  256
+#define MAX_NESTING     16
+#define NAME_LEN        32
+#define HIST_BUCKETS    16
+
+/* Chrome trace thread ids for contexts that are not tasks */
+#define TID_LOW_POWER   999
+#define TID_ISR_BASE    1000
+
+typedef struct
+{
+    uint32_t u32Count;
+    uint64_t u64Sum;
+    uint64_t u64Max;
+    uint32_t au32Bucket[HIST_BUCKETS];  /* [0] < 1 us, [k] < 2^k us */
+} HIST_T;
+
+typedef struct
+{
+    uint32_t u32Number;
+    char szName[NAME_LEN];
+    uint32_t u32Priority;
+    uint64_t u64RunCycles;
+    uint32_t u32Switches;
+    int bReady;                 /* Made ready and not yet switched in */
+    uint64_t u64ReadyTime;
+    int i32ReadyIsr;            /* Exception that made it ready, or -1 */
+    uint64_t u64ReadyIsrTime;   /* Entry time of that exception */
+    HIST_T sWake;               /* Ready to running */
+} TASK_T;
+
+typedef struct
+{
+    uint32_t u32Number;
+    uint32_t u32Type;
+    char szName[NAME_LEN];
+    uint32_t u32Send, u32SendFailed, u32Receive, u32ReceiveFailed, u32Block;
+    uint32_t u32MaxWaiting;
+} QUEUE_T;
+
+static TASK_T s_asTask[MAX_TASKS];
+static int s_i32Tasks;
+static QUEUE_T s_asQueue[MAX_QUEUES];
+static int s_i32Queues;
+static HIST_T s_asIsr[MAX_EXCEPTIONS];
+static uint64_t s_au64IsrCycles[MAX_EXCEPTIONS];
+static HIST_T s_sIsrToTask;
+
+static double s_dCpuHz;
+static FILE *s_pJson;
+static int s_bJsonFirst = 1;
+
+static const char *s_apcQueueType[] =
+{
+    "queue", "mutex", "counting semaphore", "binary semaphore", "recursive mutex"
+};
+
+/*-----------------------------------------------------------------------------------*/
+static uint32_t rd32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static double to_us(uint64_t u64Cycles)
+{
+    return (double)u64Cycles * 1e6 / s_dCpuHz;
+}
+
+static void hist_add(HIST_T *h, uint64_t u64Cycles)
+{
+    double us = to_us(u64Cycles);
+    int k = 0;
+
+    while((k < HIST_BUCKETS - 1) && (us >= (double)(1UL << k)))
+    {
+        k++;
+    }
+    h->au32Bucket[k]++;
+    h->u32Count++;
+    h->u64Sum += u64Cycles;
+    if(u64Cycles > h->u64Max)
+    {
+        h->u64Max = u64Cycles;
+    }
+}
+
+static void hist_print(const char *pcTitle, const HIST_T *h)
+{
+    uint32_t u32Peak = 0;
+    int k, n;
+
+    printf("%s: %u samples, avg %.2f us, max %.2f us\n", pcTitle, h->u32Count,
+           h->u32Count ? to_us(h->u64Sum) / h->u32Count : 0.0, to_us(h->u64Max));
+    for(k = 0; k < HIST_BUCKETS; k++)
+    {
+        if(h->au32Bucket[k] > u32Peak)
+        {
+            u32Peak = h->au32Bucket[k];
+        }
+    }
+    for(k = 0; k < HIST_BUCKETS; k++)
+    {
+        if(h->au32Bucket[k] == 0)
+        {
+            continue;
+        }
+        if(k == HIST_BUCKETS - 1)
+        {
+            printf("  >= %6lu us %8u ", 1UL << (k - 1), h->au32Bucket[k]);
+        }
+        else
+        {
+            printf("  < %7lu us %8u ", 1UL << k, h->au32Bucket[k]);
+        }
+        for(n = (int)((h->au32Bucket[k] * 40ULL + u32Peak - 1) / u32Peak); n > 0; n--)
+        {
+            putchar('#');
+        }
+        putchar('\n');
+    }
+}
+
+/*-----------------------------------------------------------------------------------*/
+static TASK_T *task_get(uint32_t u32Number)
+{
+    int i;
+
+    for(i = 0; i < s_i32Tasks; i++)
+    {
+        if(s_asTask[i].u32Number == u32Number)
+        {
+            return &s_asTask[i];
+        }
+    }
+    if(s_i32Tasks == MAX_TASKS)
+    {
+        return &s_asTask[MAX_TASKS - 1];
+    }
+    memset(&s_asTask[s_i32Tasks], 0, sizeof(TASK_T));
+    s_asTask[s_i32Tasks].u32Number = u32Number;
+    s_asTask[s_i32Tasks].i32ReadyIsr = -1;
+    sprintf(s_asTask[s_i32Tasks].szName, "Task %u", u32Number);
+    return &s_asTask[s_i32Tasks++];
+}
+
+static QUEUE_T *queue_get(uint32_t u32Number)
+{
+    int i;
+
+    for(i = 0; i < s_i32Queues; i++)
+    {
+        if(s_asQueue[i].u32Number == u32Number)
+        {
+            return &s_asQueue[i];
+        }
+    }
+    if(s_i32Queues == MAX_QUEUES)
+    {
+        return &s_asQueue[MAX_QUEUES - 1];
+    }
+    memset(&s_asQueue[s_i32Queues], 0, sizeof(QUEUE_T));
+    s_asQueue[s_i32Queues].u32Number = u32Number;
+    sprintf(s_asQueue[s_i32Queues].szName, "Queue %u", u32Number);
+    return &s_asQueue[s_i32Queues++];
+}
+
+static void exception_name(char *pcBuf, uint32_t u32Exception)
+{
+    static const char *apcSys[16] =
+    {
+        "Thread", "Reset", "NMI", "HardFault", "MemManage", "BusFault", "UsageFault", "Exc 7",
+        "Exc 8", "Exc 9", "Exc 10", "SVCall", "DebugMon", "Exc 13", "PendSV", "SysTick"
+    };
+
+    if(u32Exception < 16)
+    {
+        strcpy(pcBuf, apcSys[u32Exception]);
+    }
+    else
+    {
+        sprintf(pcBuf, "IRQ %u", u32Exception - 16);
+    }
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Chrome trace output */
+
+static void json_sep(void)
+{
+    fputs(s_bJsonFirst ? "\n" : ",\n", s_pJson);
+    s_bJsonFirst = 0;
+}
+
+static void json_name(const char *pcName)
+{
+    fputc('"', s_pJson);
+    for(; *pcName; pcName++)
+    {
+        if((*pcName == '"') || (*pcName == '\\'))
+        {
+            fputc('\\', s_pJson);
+        }
+        if((unsigned char)*pcName >= 0x20)
+        {
+            fputc(*pcName, s_pJson);
+        }
+    }
+    fputc('"', s_pJson);
+}
+
+static void json_thread(int i32Tid, const char *pcName)
+{
+    if(s_pJson == NULL)
+    {
+        return;
+    }
+    json_sep();
+    fprintf(s_pJson, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", i32Tid);
+    json_name(pcName);
+    fputs("}}", s_pJson);
+}
+
+static void json_slice(int i32Tid, const char *pcName, uint64_t u64Start, uint64_t u64End)
+{
+    if(s_pJson == NULL)
+    {
+        return;
+    }
+    json_sep();
+    fprintf(s_pJson, "{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":",
+            i32Tid, to_us(u64Start), to_us(u64End - u64Start));
+    json_name(pcName);
+    fputc('}', s_pJson);
+}
+
+static void json_instant(int i32Tid, const char *pcName, uint64_t u64Time)
+{
+    if(s_pJson == NULL)
+    {
+        return;
+    }
+    json_sep();
+    fprintf(s_pJson, "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":", i32Tid, to_us(u64Time));
+    json_name(pcName);
+    fputc('}', s_pJson);
+}
+
+static void json_counter(const char *pcName, uint64_t u64Time, long i32Value)
+{
+    if(s_pJson == NULL)
+    {
+        return;
+    }
+    json_sep();
+    fprintf(s_pJson, "{\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"name\":\"%s\",\"args\":{\"bytes\":%ld}}",
+            to_us(u64Time), pcName, i32Value);
+}
+
+/*-----------------------------------------------------------------------------------*/
+static void usage(void)
+{
+    fprintf(stderr, "Usage: trace_decode [-j trace.json] [-c cpu_hz] dump.bin\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pcDump = NULL, *pcJson = NULL;
+    uint8_t *pu8Buf, *pu8Hdr = NULL;
+    long i32Size, i32Off;
+    FILE *fp;
+    uint32_t u32Events, u32Head, u32First, u32Idx, u32Ev, u32Code, u32Arg, u32Last = 0;
+    uint64_t u64Now = 0, u64Prev = 0, u64Start = 0, u64SliceStart = 0, u64LowPower = 0;
+    uint64_t u64TotalCycles, u64IsrTotal = 0, u64LowPowerCycles = 0;
+    uint32_t au32Stack[MAX_NESTING];
+    uint64_t au64StackTime[MAX_NESTING];
+    int i32Depth = 0, bFirst = 1, bLowPower = 0, i;
+    TASK_T *psCur = NULL, *psTask;
+    QUEUE_T *psQueue;
+    char *pcNameTarget = NULL;
+    int i32NameLen = 0;
+    long i32Heap = 0, i32HeapPeak = 0;
+    uint32_t u32MallocFailed = 0;
+    char szName[64], szExc[16];
+    double dCpuHz = 0;
+
+    for(i = 1; i < argc; i++)
+    {
+        if((strcmp(argv[i], "-j") == 0) && (i + 1 < argc))
+        {
+            pcJson = argv[++i];
+        }
+        else if((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            dCpuHz = atof(argv[++i]);
+        }
+        else if(argv[i][0] == '-')
+        {
+            usage();
+        }
+        else
+        {
+            pcDump = argv[i];
+        }
+    }
+    if(pcDump == NULL)
+    {
+        usage();
+    }
+
+    fp = fopen(pcDump, "rb");
+    if(fp == NULL)
+    {
+        perror(pcDump);
+        return 1;
+    }
+    fseek(fp, 0, SEEK_END);
+    i32Size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    pu8Buf = malloc(i32Size);
+    if((pu8Buf == NULL) || (fread(pu8Buf, 1, i32Size, fp) != (size_t)i32Size))
+    {
+        fprintf(stderr, "%s: read error\n", pcDump);
+        return 1;
+    }
+    fclose(fp);
+
+    /* The dump may contain more than the trace buffer */
+    for(i32Off = 0; i32Off + trcHEADER_SIZE <= i32Size; i32Off += 4)
+    {
+        if((rd32(pu8Buf + i32Off) == trcMAGIC) && ((rd32(pu8Buf + i32Off + 4) & 0xFFFF) == trcVERSION))
+        {
+            pu8Hdr = pu8Buf + i32Off;
+            break;
+        }
+    }
+    if(pu8Hdr == NULL)
+    {
+        fprintf(stderr, "%s: no trace buffer found\n", pcDump);
+        return 1;
+    }
+
+    s_dCpuHz = (dCpuHz > 0) ? dCpuHz : (double)rd32(pu8Hdr + 8);
+    u32Events = rd32(pu8Hdr + 12);
+    u32Head = rd32(pu8Hdr + 16);
+    if((rd32(pu8Hdr + 4) >> 16 != 8) || (u32Events == 0) || (u32Events & (u32Events - 1)) ||
+            (i32Off + trcHEADER_SIZE + (long)u32Events * 8 > i32Size))
+    {
+        fprintf(stderr, "%s: truncated or corrupted trace buffer\n", pcDump);
+        return 1;
+    }
+    u32First = (u32Head > u32Events) ? u32Head - u32Events : 0;
+    printf("CPU clock %.0f Hz, %u events recorded, decoding the last %u%s\n",
+           s_dCpuHz, u32Head, u32Head - u32First, rd32(pu8Hdr + 20) ? "" : " (stopped)");
+    if(u32First != 0)
+    {
+        printf("Older events were overwritten, names of objects created before may be missing\n");
+    }
+
+    if(pcJson != NULL)
+    {
+        s_pJson = fopen(pcJson, "w");
+        if(s_pJson == NULL)
+        {
+            perror(pcJson);
+            return 1;
+        }
+        fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", s_pJson);
+        json_thread(TID_LOW_POWER, "Low power");
+    }
+
+    for(u32Idx = u32First; u32Idx != u32Head; u32Idx++)
+    {
+        const uint8_t *p = pu8Hdr + trcHEADER_SIZE + (u32Idx & (u32Events - 1)) * 8;
+        uint32_t u32Ts = rd32(p);
+
+        u32Ev = rd32(p + 4);
+        u32Code = u32Ev >> 24;
+        u32Arg = u32Ev & 0xFFFFFF;
+
+        /* Extend the 32-bit cycle counter, gaps must be shorter than one wrap */
+        if(bFirst)
+        {
+            u64Now = 0;
+            u64Start = 0;
+            bFirst = 0;
+        }
+        else
+        {
+            u64Now += (uint32_t)(u32Ts - u32Last);
+        }
+        u32Last = u32Ts;
+
+        /* Charge the time since the previous event to the running context */
+        if(i32Depth > 0)
+        {
+            s_au64IsrCycles[au32Stack[i32Depth - 1]] += u64Now - u64Prev;
+            u64IsrTotal += u64Now - u64Prev;
+        }
+        else if(psCur != NULL)
+        {
+            psCur->u64RunCycles += u64Now - u64Prev;
+        }
+        u64Prev = u64Now;
+
+        if(u32Code != trcEVT_NAME)
+        {
+            pcNameTarget = NULL;
+        }
+
+        switch(u32Code)
+        {
+        case trcEVT_TASK_CREATE:
+            psTask = task_get(u32Arg & 0xFFFF);
+            psTask->u32Priority = u32Arg >> 16;
+            pcNameTarget = psTask->szName;
+            i32NameLen = 0;
+            break;
+
+        case trcEVT_QUEUE_NAME:
+            pcNameTarget = queue_get(u32Arg & 0xFFFF)->szName;
+            i32NameLen = 0;
+            break;
+
+        case trcEVT_NAME:
+            if(pcNameTarget == NULL)
+            {
+                break;
+            }
+            for(i = 0; i < 3; i++)
+            {
+                char c = (char)(u32Arg >> (i * 8));
+                if((c == '\0') || (i32NameLen == NAME_LEN - 1))
+                {
+                    pcNameTarget[i32NameLen] = '\0';
+                    pcNameTarget = NULL;
+                    break;
+                }
+                pcNameTarget[i32NameLen++] = c;
+            }
+            break;
+
+        case trcEVT_TASK_DELETE:
+            sprintf(szName, "delete %s", task_get(u32Arg & 0xFFFF)->szName);
+            json_instant(psCur ? (int)psCur->u32Number : 0, szName, u64Now);
+            break;
+
+        case trcEVT_TASK_PRIORITY_SET:
+            task_get(u32Arg & 0xFFFF)->u32Priority = u32Arg >> 16;
+            break;
+
+        case trcEVT_TASK_READY:
+            psTask = task_get(u32Arg & 0xFFFF);
+            if(!psTask->bReady && (psTask != psCur))
+            {
+                psTask->bReady = 1;
+                psTask->u64ReadyTime = u64Now;
+                psTask->i32ReadyIsr = (i32Depth > 0) ? (int)au32Stack[i32Depth - 1] : -1;
+                psTask->u64ReadyIsrTime = (i32Depth > 0) ? au64StackTime[i32Depth - 1] : 0;
+            }
+            break;
+
+        case trcEVT_TASK_SWITCHED_IN:
+            psTask = task_get(u32Arg & 0xFFFF);
+            if(psTask == psCur)
+            {
+                break;
+            }
+            if(psCur != NULL)
+            {
+                json_slice((int)psCur->u32Number, psCur->szName, u64SliceStart, u64Now);
+            }
+            if(psTask->bReady)
+            {
+                hist_add(&psTask->sWake, u64Now - psTask->u64ReadyTime);
+                if(psTask->i32ReadyIsr >= 0)
+                {
+                    hist_add(&s_sIsrToTask, u64Now - psTask->u64ReadyIsrTime);
+                }
+                psTask->bReady = 0;
+            }
+            psTask->u32Switches++;
+            psCur = psTask;
+            u64SliceStart = u64Now;
+            break;
+
+        case trcEVT_ISR_ENTER:
+            if(i32Depth < MAX_NESTING)
+            {
+                au32Stack[i32Depth] = u32Arg & (MAX_EXCEPTIONS - 1);
+                au64StackTime[i32Depth] = u64Now;
+                i32Depth++;
+            }
+            break;
+
+        case trcEVT_ISR_EXIT:
+            /* Unwind to the matching entry, an entry may have been overwritten */
+            while(i32Depth > 0)
+            {
+                i32Depth--;
+                if(au32Stack[i32Depth] == (u32Arg & (MAX_EXCEPTIONS - 1)))
+                {
+                    hist_add(&s_asIsr[au32Stack[i32Depth]], u64Now - au64StackTime[i32Depth]);
+                    exception_name(szExc, au32Stack[i32Depth]);
+                    json_slice(TID_ISR_BASE + (int)au32Stack[i32Depth], szExc, au64StackTime[i32Depth], u64Now);
+                    break;
+                }
+            }
+            break;
+
+        case trcEVT_QUEUE_CREATE:
+            psQueue = queue_get(u32Arg & 0xFFFF);
+            psQueue->u32Type = u32Arg >> 16;
+            break;
+
+        case trcEVT_QUEUE_DELETE:
+            break;
+
+        case trcEVT_QUEUE_SEND:
+        case trcEVT_QUEUE_SEND_ISR:
+        case trcEVT_QUEUE_SEND_FAILED:
+        case trcEVT_QUEUE_SEND_ISR_FAILED:
+        case trcEVT_QUEUE_RECEIVE:
+        case trcEVT_QUEUE_RECEIVE_ISR:
+        case trcEVT_QUEUE_RECEIVE_FAILED:
+        case trcEVT_QUEUE_RECEIVE_ISR_FAILED:
+        case trcEVT_QUEUE_PEEK:
+        case trcEVT_QUEUE_BLOCK_SEND:
+        case trcEVT_QUEUE_BLOCK_RECEIVE:
+        {
+            static const char *apcOp[] =
+            {
+                "send", "send failed", "receive", "receive failed", "peek", "send from ISR",
+                "send from ISR failed", "receive from ISR", "receive from ISR failed", "block on send", "block on receive"
+            };
+
+            psQueue = queue_get(u32Arg & 0xFFFF);
+            if((u32Arg >> 16) > psQueue->u32MaxWaiting)
+            {
+                psQueue->u32MaxWaiting = u32Arg >> 16;
+            }
+            if((u32Code == trcEVT_QUEUE_SEND) || (u32Code == trcEVT_QUEUE_SEND_ISR))
+            {
+                psQueue->u32Send++;
+            }
+            else if((u32Code == trcEVT_QUEUE_SEND_FAILED) || (u32Code == trcEVT_QUEUE_SEND_ISR_FAILED))
+            {
+                psQueue->u32SendFailed++;
+            }
+            else if((u32Code == trcEVT_QUEUE_RECEIVE) || (u32Code == trcEVT_QUEUE_RECEIVE_ISR))
+            {
+                psQueue->u32Receive++;
+            }
+            else if((u32Code == trcEVT_QUEUE_RECEIVE_FAILED) || (u32Code == trcEVT_QUEUE_RECEIVE_ISR_FAILED))
+            {
+                psQueue->u32ReceiveFailed++;
+            }
+            else if(u32Code != trcEVT_QUEUE_PEEK)
+            {
+                psQueue->u32Block++;
+            }
+            sprintf(szName, "%s %s", apcOp[u32Code - trcEVT_QUEUE_SEND], psQueue->szName);
+            json_instant((i32Depth > 0) ? TID_ISR_BASE + (int)au32Stack[i32Depth - 1] :
+                         (psCur ? (int)psCur->u32Number : 0), szName, u64Now);
+            break;
+        }
+
+        case trcEVT_MALLOC:
+        case trcEVT_FREE:
+            i32Heap += (u32Code == trcEVT_MALLOC) ? (long)u32Arg : -(long)u32Arg;
+            if(i32Heap > i32HeapPeak)
+            {
+                i32HeapPeak = i32Heap;
+            }
+            json_counter("heap", u64Now, i32Heap);
+            break;
+
+        case trcEVT_MALLOC_FAILED:
+            u32MallocFailed++;
+            sprintf(szName, "malloc(%u) failed", u32Arg);
+            json_instant(psCur ? (int)psCur->u32Number : 0, szName, u64Now);
+            break;
+
+        case trcEVT_LOW_POWER_BEGIN:
+            bLowPower = 1;
+            u64LowPower = u64Now;
+            break;
+
+        case trcEVT_LOW_POWER_END:
+            if(bLowPower)
+            {
+                u64LowPowerCycles += u64Now - u64LowPower;
+                json_slice(TID_LOW_POWER, "sleep", u64LowPower, u64Now);
+                bLowPower = 0;
+            }
+            break;
+
+        case trcEVT_USER:
+            sprintf(szName, "user 0x%06X", u32Arg);
+            json_instant((i32Depth > 0) ? TID_ISR_BASE + (int)au32Stack[i32Depth - 1] :
+                         (psCur ? (int)psCur->u32Number : 0), szName, u64Now);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if(psCur != NULL)
+    {
+        json_slice((int)psCur->u32Number, psCur->szName, u64SliceStart, u64Now);
+    }
+    u64TotalCycles = u64Now - u64Start;
+
+    printf("Trace length %.3f ms\n\n", to_us(u64TotalCycles) / 1000.0);
+
+    printf("%-16s %4s %12s %7s %9s %12s %12s\n", "Task", "Prio", "Run (us)", "CPU %", "Switches", "Wake avg us", "Wake max us");
+    for(i = 0; i < s_i32Tasks; i++)
+    {
+        psTask = &s_asTask[i];
+        printf("%-16s %4u %12.1f %7.2f %9u %12.2f %12.2f\n", psTask->szName, psTask->u32Priority,
+               to_us(psTask->u64RunCycles), u64TotalCycles ? 100.0 * psTask->u64RunCycles / u64TotalCycles : 0.0,
+               psTask->u32Switches, psTask->sWake.u32Count ? to_us(psTask->sWake.u64Sum) / psTask->sWake.u32Count : 0.0,
+               to_us(psTask->sWake.u64Max));
+        json_thread((int)psTask->u32Number, psTask->szName);
+    }
+    printf("%-16s %4s %12.1f %7.2f\n", "(ISRs)", "", to_us(u64IsrTotal),
+           u64TotalCycles ? 100.0 * u64IsrTotal / u64TotalCycles : 0.0);
+    if(u64LowPowerCycles)
+    {
+        printf("%-16s %4s %12.1f %7.2f\n", "(low power)", "", to_us(u64LowPowerCycles),
+               u64TotalCycles ? 100.0 * u64LowPowerCycles / u64TotalCycles : 0.0);
+    }
+    printf("\n");
+
+    for(i = 0; i < MAX_EXCEPTIONS; i++)
+    {
+        if(s_asIsr[i].u32Count == 0)
+        {
+            continue;
+        }
+        exception_name(szExc, i);
+        sprintf(szName, "%s duration (%.2f%% CPU)", szExc,
+                u64TotalCycles ? 100.0 * s_au64IsrCycles[i] / u64TotalCycles : 0.0);
+        hist_print(szName, &s_asIsr[i]);
+        json_thread(TID_ISR_BASE + i, szExc);
+    }
+    if(s_sIsrToTask.u32Count)
+    {
+        hist_print("ISR entry to woken task running", &s_sIsrToTask);
+    }
+    printf("\n");
+
+    if(s_i32Queues)
+    {
+        printf("%-20s %-18s %8s %8s %8s %8s %8s %8s\n", "Queue", "Type", "Send", "Failed", "Receive", "Failed", "Blocked", "Max");
+        for(i = 0; i < s_i32Queues; i++)
+        {
+            psQueue = &s_asQueue[i];
+            printf("%-20s %-18s %8u %8u %8u %8u %8u %8u\n", psQueue->szName,
+                   psQueue->u32Type < 5 ? s_apcQueueType[psQueue->u32Type] : "?",
+                   psQueue->u32Send, psQueue->u32SendFailed, psQueue->u32Receive,
+                   psQueue->u32ReceiveFailed, psQueue->u32Block, psQueue->u32MaxWaiting);
+        }
+        printf("\n");
+    }
+
+    printf("Heap: %ld bytes allocated at the end, peak %ld, %u failed allocations\n"
+           "      (relative to the start of the decoded events)\n", i32Heap, i32HeapPeak, u32MallocFailed);
+
+    if(s_pJson != NULL)
+    {
+        fputs("\n]}\n", s_pJson);
+        fclose(s_pJson);
+    }
+    free(pu8Buf);
+    return 0;
+}
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -0,0 +1,254 @@
+/**************************************************************************//**
+ * @file     low_power_tick_management.c
+ * @version  V1.00
+ * @brief    NUC472 tickless idle for FreeRTOS. Suppresses the SysTick while
+ *           the idle task runs and wakes the CPU from Power-down mode with a
+ *           TIMER clocked by the 32.768 kHz LXT (or the 10 kHz LIRC).
+ *
+ *           SysTick stops in Power-down mode, so the default ARM_CM4F
+ *           implementation (configUSE_TICKLESS_IDLE == 1) can only use the
+ *           sleep mode. With configUSE_TICKLESS_IDLE set to 2 the port uses
+ *           vPortSuppressTicksAndSleep() below instead.
+ *
+ *           The wake-up timer runs in continuous counting mode and is never
+ *           stopped, so the time spent asleep, including the HXT/PLL
+ *           start-up after Power-down, is read back from its counter. The
+ *           kernel tick count is stepped by the complete tick periods that
+ *           passed and SysTick restarts with the remainder of the current
+ *           period, so the error per sleep is below one timer clock.
+ *
+ *           The timer clock source must be selected by the application
+ *           before the scheduler starts, e.g.
+ *           CLK_SetModuleClock(TMR0_MODULE, CLK_CLKSEL1_TMR0SEL_LXT, 0).
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "NUC472_442.h"
+
+#if configUSE_TICKLESS_IDLE == 2
+
+/* Timer used to wake up from Power-down mode */
+#ifndef configLPTMR
+#define configLPTMR                     TIMER0
+#define configLPTMR_IRQn                TMR0_IRQn
+#define configLPTMR_IRQHandler          TMR0_IRQHandler
+#endif
+
+/* Frequency of the timer clock source: 32768 for LXT, 10000 for LIRC */
+#ifndef configLPTMR_CLOCK_HZ
+#define configLPTMR_CLOCK_HZ            32768UL
+#endif
+
+/* Idle periods shorter than this are spent in Idle mode instead, where HXT
+   and PLL keep running and the CPU wakes up immediately */
+#ifndef configPOWER_DOWN_MIN_TICKS
+#define configPOWER_DOWN_MIN_TICKS      5
+#endif
+
+/* Timer clocks the CPU needs to wake from Power-down mode (HXT stable
+   delay and PLL lock). The compare point is moved forward by this amount
+   so the kernel is not woken late. */
+#ifndef configPOWER_DOWN_WAKEUP_COUNTS
+#define configPOWER_DOWN_WAKEUP_COUNTS  ( ( configLPTMR_CLOCK_HZ / 1000UL ) + 1UL )
+#endif
+
+#ifndef configSYSTICK_CLOCK_HZ
+#define configSYSTICK_CLOCK_HZ          configCPU_CLOCK_HZ
+#endif
+
+#define lpTIMER_MAX_COUNT               0xFFFFFFUL
+
+/* A compare value this close to the counter may be missed because the
+   timer registers are synchronised to the slow clock domain */
+#define lpTIMER_MIN_COUNTS              4UL
+
+/*-----------------------------------------------------------*/
+
+static uint32_t ulTimerCountsForOneTick = 0;
+static uint32_t ulSysTickClockHz;
+static TickType_t xMaximumPossibleSuppressedTicks;
+
+/*-----------------------------------------------------------*/
+
+void configLPTMR_IRQHandler( void )
+{
+#ifdef traceISR_ENTER
+    traceISR_ENTER();
+#endif
+
+    configLPTMR->INTSTS = TIMER_INTSTS_TIF_Msk | TIMER_INTSTS_TWKF_Msk;
+
+#ifdef traceISR_EXIT
+    traceISR_EXIT();
+#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupLowPowerTimer( void )
+{
+    ulSysTickClockHz = configSYSTICK_CLOCK_HZ;
+    ulTimerCountsForOneTick = ulSysTickClockHz / configTICK_RATE_HZ;
+
+    /* The sleep is measured with the 24-bit timer counter */
+    xMaximumPossibleSuppressedTicks = ( TickType_t ) ( ( ( lpTIMER_MAX_COUNT / 2UL ) / configLPTMR_CLOCK_HZ ) * configTICK_RATE_HZ );
+
+    /* Free running, the compare match only interrupts and wakes up the CPU */
+    configLPTMR->CTL = TIMER_CTL_RSTCNT_Msk;
+    configLPTMR->CMP = lpTIMER_MAX_COUNT;
+    configLPTMR->INTSTS = TIMER_INTSTS_TIF_Msk | TIMER_INTSTS_TWKF_Msk;
+    configLPTMR->CTL = TIMER_CONTINUOUS_MODE | TIMER_CTL_CNTDATEN_Msk | TIMER_CTL_WKEN_Msk |
+                       TIMER_CTL_INTEN_Msk | TIMER_CTL_CNTEN_Msk;
+
+    NVIC_SetPriority( configLPTMR_IRQn, configLIBRARY_LOWEST_INTERRUPT_PRIORITY );
+    NVIC_EnableIRQ( configLPTMR_IRQn );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+    uint32_t ulSysTickRemain, ulSleepCounts, ulStart, ulCmp, ulElapsed, ulReloadValue, ulLocked;
+    uint64_t ullElapsed;
+    TickType_t xModifiableIdleTime, xCompleteTickPeriods;
+
+    if( ulTimerCountsForOneTick == 0 )
+    {
+        prvSetupLowPowerTimer();
+    }
+
+    if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+    {
+        xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+    }
+
+    /* Stop the SysTick. It is restarted with whatever remains of the
+       current tick period once the CPU has woken up. */
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    /* Mask interrupts with PRIMASK rather than taskENTER_CRITICAL(), a
+       pending interrupt must still be able to end WFI */
+    __disable_irq();
+
+    ulSysTickRemain = SysTick->VAL;
+    if( ulSysTickRemain == 0 )
+    {
+        /* The tick interrupt is already pending for this period */
+        ulSysTickRemain = ulTimerCountsForOneTick;
+    }
+
+    /* Timer clocks until the expected wake-up tick, rounded down so the
+       final part of the period is timed by the SysTick again */
+    ulSleepCounts = ( uint32_t ) ( ( ( ( uint64_t ) ( xExpectedIdleTime - 1UL ) * ulTimerCountsForOneTick + ulSysTickRemain ) *
+                                     configLPTMR_CLOCK_HZ ) / ulSysTickClockHz );
+    if( ( xExpectedIdleTime >= configPOWER_DOWN_MIN_TICKS ) && ( ulSleepCounts > configPOWER_DOWN_WAKEUP_COUNTS ) )
+    {
+        ulSleepCounts -= configPOWER_DOWN_WAKEUP_COUNTS;
+    }
+
+    if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) || ( ulSleepCounts < lpTIMER_MIN_COUNTS ) )
+    {
+        /* Restart from whatever is left in the count register to complete
+           this tick period. */
+        SysTick->LOAD = ulSysTickRemain;
+        SysTick->VAL = 0UL;
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        SysTick->LOAD = ulTimerCountsForOneTick - 1UL;
+
+        __enable_irq();
+        return;
+    }
+
+    /* Arm the compare match. CMP must be larger than 1. */
+    ulStart = configLPTMR->CNT;
+    ulCmp = ( ulStart + ulSleepCounts ) & lpTIMER_MAX_COUNT;
+    if( ulCmp < 2UL )
+    {
+        ulCmp = 2UL;
+    }
+    configLPTMR->CMP = ulCmp;
+    configLPTMR->INTSTS = TIMER_INTSTS_TIF_Msk | TIMER_INTSTS_TWKF_Msk;
+    NVIC_ClearPendingIRQ( configLPTMR_IRQn );
+
+    /* configPRE_SLEEP_PROCESSING() can set its parameter to 0 to indicate
+       that it has already waited for an interrupt itself */
+    xModifiableIdleTime = xExpectedIdleTime;
+    configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+    if( xModifiableIdleTime > 0 )
+    {
+        ulLocked = SYS_IsRegLocked();
+        SYS_UnlockReg();
+
+        __DSB();
+        if( xExpectedIdleTime >= configPOWER_DOWN_MIN_TICKS )
+        {
+            CLK_PowerDown();
+        }
+        else
+        {
+            CLK_Idle();
+        }
+        __ISB();
+
+        /* CLK_PowerDown() leaves SLEEPDEEP and PDEN set */
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+        CLK->PWRCTL &= ~CLK_PWRCTL_PDEN_Msk;
+
+        if( ulLocked )
+        {
+            SYS_LockReg();
+        }
+    }
+    configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+    /* Let the interrupt that woke the CPU run */
+    __enable_irq();
+
+    portENTER_CRITICAL();
+    {
+        /* Time asleep, converted to SysTick counts */
+        ulElapsed = ( configLPTMR->CNT - ulStart ) & lpTIMER_MAX_COUNT;
+        ullElapsed = ( ( uint64_t ) ulElapsed * ulSysTickClockHz ) / configLPTMR_CLOCK_HZ;
+
+        if( ullElapsed < ulSysTickRemain )
+        {
+            /* Woken within the tick period sleep started in */
+            xCompleteTickPeriods = 0;
+            ulReloadValue = ulSysTickRemain - ( uint32_t ) ullElapsed;
+        }
+        else
+        {
+            ullElapsed -= ulSysTickRemain;
+            xCompleteTickPeriods = ( TickType_t ) ( ullElapsed / ulTimerCountsForOneTick ) + 1;
+            ulReloadValue = ulTimerCountsForOneTick - ( uint32_t ) ( ullElapsed % ulTimerCountsForOneTick );
+        }
+
+        if( xCompleteTickPeriods >= xExpectedIdleTime )
+        {
+            /* The tick count may not be stepped past the next unblock time.
+               Step to one tick before it and pend the tick interrupt, which
+               also unblocks the waiting task. Time beyond the expected idle
+               time can only be lost if waking up takes longer than a tick
+               period. */
+            vTaskStepTick( xExpectedIdleTime - 1UL );
+            SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+        }
+        else
+        {
+            vTaskStepTick( xCompleteTickPeriods );
+        }
+
+        /* Restart SysTick so it runs from ulReloadValue, then set the
+           reload register back to its standard value */
+        SysTick->LOAD = ulReloadValue;
+        SysTick->VAL = 0UL;
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        SysTick->LOAD = ulTimerCountsForOneTick - 1UL;
+    }
+    portEXIT_CRITICAL();
+}
+
+#endif /* configUSE_TICKLESS_IDLE == 2 */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
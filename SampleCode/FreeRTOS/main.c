@@ -232,6 +232,30 @@ int main(void)
     /* Configure the hardware ready to run the test. */
     prvSetupHardware();
 
+#if ( configUSE_CRASH_DUMP == 1 )
+    /* Locate the dump area before any task is created, and upload the dump
+    of the previous run if there is one. It is printed to the console here,
+    capture it and decode it with host/crash_decode.c. */
+    if( xCrashDumpInit() == 0 )
+    {
+        if( pxCrashDumpGet() != NULL )
+        {
+            printf( "Crash dump found, %u later faults lost\n", ( unsigned int ) ulCrashDumpLostFaults() );
+            vCrashDumpPrint();
+            vCrashDumpClear();
+        }
+    }
+    else
+    {
+        printf( "Crash dump disabled, enable %u bytes of Data Flash in CONFIG0\n", ( unsigned int ) configCRASH_DUMP_SIZE );
+    }
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+    /* Start recording before any task is created */
+    vTraceEnable();
+#endif
+
 
 #ifdef CHECK_TEST
     xTaskCreate( vCheckTask, "Check", mainCHECK_TASK_STACK_SIZE, NULL, mainCHECK_TASK_PRIORITY, NULL );
@@ -277,6 +301,10 @@ static void prvSetupHardware( void )
     /* Waiting for 12MHz clock ready */
     CLK_WaitClockReady( CLK_STATUS_HXTSTB_Msk);
 
+    /* Enable LXT (32.768 kHz) for the tickless idle wake-up timer */
+    CLK_EnableXtalRC(CLK_PWRCTL_LXTEN_Msk);
+    CLK_WaitClockReady( CLK_STATUS_LXTSTB_Msk);
+
     /* Switch HCLK clock source to HXT */
     CLK_SetHCLK(CLK_CLKSEL0_HCLKSEL_HXT,CLK_CLKDIV0_HCLK(1));
 
@@ -298,7 +326,7 @@ static void prvSetupHardware( void )
 
     /* Select IP clock source */
     CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL1_UARTSEL_HXT, CLK_CLKDIV0_UART(1));
-    CLK_SetModuleClock(TMR0_MODULE, CLK_CLKSEL1_TMR0SEL_HXT, 0);
+    CLK_SetModuleClock(TMR0_MODULE, CLK_CLKSEL1_TMR0SEL_LXT, 0);
 
     /* Update System Core Clock */
     /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock. */
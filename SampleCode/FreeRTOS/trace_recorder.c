@@ -0,0 +1,124 @@
+/**************************************************************************//**
+ * @file     trace_recorder.c
+ * @version  V1.00
+ * @brief    Binary kernel trace recorder for FreeRTOS, see trace_recorder.h.
+ *
+ *           Events are written by tasks, the kernel and nested interrupts
+ *           without masking interrupts. A slot is reserved by incrementing
+ *           ulHead with LDREX/STREX, and the timestamp is sampled inside the
+ *           same exclusive sequence, so the slot order is also the time
+ *           order. The oldest events are overwritten once the ring is full.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "NUC472_442.h"
+#include "trace_recorder.h"
+
+#if ( configUSE_TRACE_RECORDER == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+
+#if ( configTRACE_BUFFER_EVENTS & ( configTRACE_BUFFER_EVENTS - 1 ) ) != 0
+#error configTRACE_BUFFER_EVENTS must be a power of 2
+#endif
+
+TraceBuffer_t xTraceBuffer;
+
+/* Assigned to queues and semaphores as they are created */
+uint32_t ulTraceNextQueueNumber = 0;
+
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Start the DWT cycle counter and clear the trace buffer
+  * @param  None
+  * @retval None
+  * @details Must be called before the first task or queue is created,
+  *          otherwise their names are missing from the trace.
+  */
+void vTraceEnable( void )
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    xTraceBuffer.ulMagic = trcMAGIC;
+    xTraceBuffer.usVersion = trcVERSION;
+    xTraceBuffer.usEventSize = sizeof( TraceEvent_t );
+    xTraceBuffer.ulCpuClockHz = SystemCoreClock;
+    xTraceBuffer.ulBufferEvents = configTRACE_BUFFER_EVENTS;
+    xTraceBuffer.ulHead = 0;
+    xTraceBuffer.ulEnabled = 1;
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Freeze the trace buffer
+  * @param  None
+  * @retval None
+  * @details Call when a fault or a latency violation is detected so the
+  *          events leading up to it are not overwritten.
+  */
+void vTraceStop( void )
+{
+    xTraceBuffer.ulEnabled = 0;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceStoreEvent( uint32_t ulEvent )
+{
+    uint32_t ulHead, ulTimestamp;
+    TraceEvent_t *pxEvent;
+
+    if( xTraceBuffer.ulEnabled == 0 )
+    {
+        return;
+    }
+
+    /* An interrupt between LDREX and STREX clears the exclusive monitor,
+       so the timestamp is sampled again together with the new index */
+    do
+    {
+        ulHead = __LDREXW( ( uint32_t * ) &xTraceBuffer.ulHead );
+        ulTimestamp = DWT->CYCCNT;
+    } while( __STREXW( ulHead + 1, ( uint32_t * ) &xTraceBuffer.ulHead ) != 0 );
+
+    pxEvent = &xTraceBuffer.xEvents[ ulHead & ( configTRACE_BUFFER_EVENTS - 1 ) ];
+    pxEvent->ulTimestamp = ulTimestamp;
+    pxEvent->ulEvent = ulEvent;
+}
+/*-----------------------------------------------------------*/
+
+/* Store ulEvent followed by a name, packed 3 characters per event */
+void vTraceStoreName( uint32_t ulEvent, const char *pcName )
+{
+    uint32_t ulChars, ulShift;
+    int i;
+
+    ulChars = 0;
+    ulShift = 0;
+    for( i = 0; i < configMAX_TASK_NAME_LEN; i++ )
+    {
+        if( pcName[ i ] == '\0' )
+        {
+            break;
+        }
+
+        ulChars |= ( uint32_t ) ( uint8_t ) pcName[ i ] << ulShift;
+        ulShift += 8;
+        if( ulShift == 24 )
+        {
+            vTraceStoreEvent( ulEvent | ulChars );
+            ulChars = 0;
+            ulShift = 0;
+        }
+    }
+
+    /* Terminated by an event with at least one zero character */
+    vTraceStoreEvent( ulEvent | ulChars );
+}
+
+#endif /* configUSE_TRACE_RECORDER */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -0,0 +1,166 @@
+/**************************************************************************//**
+ * @file     trace_recorder.h
+ * @version  V1.00
+ * @brief    Binary kernel trace recorder for FreeRTOS. Context switches,
+ *           ISR entry/exit, queue/semaphore operations and heap operations
+ *           are timestamped with the DWT cycle counter and stored in a RAM
+ *           ring buffer. host/trace_decode.c decodes a memory dump of
+ *           xTraceBuffer.
+ *
+ *           Include this file at the end of FreeRTOSConfig.h with
+ *           configUSE_TRACE_FACILITY set to 1, call vTraceEnable() before
+ *           the first task is created, and put traceISR_ENTER() and
+ *           traceISR_EXIT() at the start and end of the ISRs to trace.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __TRACE_RECORDER_H__
+#define __TRACE_RECORDER_H__
+
+#include <stdint.h>
+
+/* Number of events in the ring buffer, must be a power of 2. Each event
+   takes 8 bytes. */
+#ifndef configTRACE_BUFFER_EVENTS
+#define configTRACE_BUFFER_EVENTS       1024
+#endif
+
+#define trcMAGIC                        0x4352544EUL    /* "NTRC" */
+#define trcVERSION                      1
+
+/* Event codes, stored in bits [31:24] of the event word. Bits [23:0] hold
+   the argument given in the comment. */
+#define trcEVT_TASK_CREATE              0x01    /* TCB number, priority << 16 */
+#define trcEVT_NAME                     0x02    /* Next 3 characters of the name of the object created or named before */
+#define trcEVT_TASK_DELETE              0x03    /* TCB number */
+#define trcEVT_TASK_SWITCHED_IN         0x04    /* TCB number */
+#define trcEVT_TASK_READY               0x05    /* TCB number */
+#define trcEVT_TASK_PRIORITY_SET        0x06    /* TCB number, new priority << 16 */
+#define trcEVT_TASK_DELAY               0x07    /* 0 */
+#define trcEVT_QUEUE_CREATE             0x10    /* Queue number, queue type << 16 */
+#define trcEVT_QUEUE_NAME               0x11    /* Queue number, name follows */
+#define trcEVT_QUEUE_DELETE             0x12    /* Queue number */
+#define trcEVT_QUEUE_SEND               0x13    /* Queue number, items waiting before the operation << 16 */
+#define trcEVT_QUEUE_SEND_FAILED        0x14
+#define trcEVT_QUEUE_RECEIVE            0x15
+#define trcEVT_QUEUE_RECEIVE_FAILED     0x16
+#define trcEVT_QUEUE_PEEK               0x17
+#define trcEVT_QUEUE_SEND_ISR           0x18
+#define trcEVT_QUEUE_SEND_ISR_FAILED    0x19
+#define trcEVT_QUEUE_RECEIVE_ISR        0x1A
+#define trcEVT_QUEUE_RECEIVE_ISR_FAILED 0x1B
+#define trcEVT_QUEUE_BLOCK_SEND         0x1C
+#define trcEVT_QUEUE_BLOCK_RECEIVE      0x1D
+#define trcEVT_ISR_ENTER                0x20    /* Exception number */
+#define trcEVT_ISR_EXIT                 0x21    /* Exception number */
+#define trcEVT_MALLOC                   0x30    /* Requested size */
+#define trcEVT_MALLOC_FAILED            0x31    /* Requested size */
+#define trcEVT_FREE                     0x32    /* Block size */
+#define trcEVT_LOW_POWER_BEGIN          0x40    /* Expected idle ticks */
+#define trcEVT_LOW_POWER_END            0x41    /* 0 */
+#define trcEVT_USER                     0x50    /* User defined */
+
+#define trcEVENT( evt, arg )            ( ( ( uint32_t ) ( evt ) << 24 ) | ( ( uint32_t ) ( arg ) & 0xFFFFFFUL ) )
+
+typedef struct
+{
+    uint32_t ulTimestamp;               /* DWT->CYCCNT */
+    uint32_t ulEvent;                   /* Event code and argument */
+} TraceEvent_t;
+
+typedef struct
+{
+    uint32_t ulMagic;                   /* trcMAGIC */
+    uint16_t usVersion;                 /* trcVERSION */
+    uint16_t usEventSize;               /* sizeof( TraceEvent_t ) */
+    uint32_t ulCpuClockHz;              /* DWT->CYCCNT frequency */
+    uint32_t ulBufferEvents;            /* configTRACE_BUFFER_EVENTS */
+    volatile uint32_t ulHead;           /* Number of events stored so far */
+    volatile uint32_t ulEnabled;        /* Cleared by vTraceStop() */
+    TraceEvent_t xEvents[ configTRACE_BUFFER_EVENTS ];
+} TraceBuffer_t;
+
+extern TraceBuffer_t xTraceBuffer;
+
+void vTraceEnable( void );
+void vTraceStop( void );
+void vTraceStoreEvent( uint32_t ulEvent );
+void vTraceStoreName( uint32_t ulEvent, const char *pcName );
+
+/* Call at the start and at the end of traced ISRs */
+#define traceISR_ENTER()        vTraceStoreEvent( trcEVENT( trcEVT_ISR_ENTER, __get_IPSR() ) )
+#define traceISR_EXIT()         vTraceStoreEvent( trcEVENT( trcEVT_ISR_EXIT, __get_IPSR() ) )
+
+/* Application markers, shown as instant events by the decoder */
+#define traceUSER_EVENT( x )    vTraceStoreEvent( trcEVENT( trcEVT_USER, ( x ) ) )
+
+/*-----------------------------------------------------------
+ * Kernel hooks. These are expanded inside tasks.c, queue.c and the heap
+ * implementations, so the TCB and queue members can be accessed directly.
+ *----------------------------------------------------------*/
+
+#define trcQUEUE( evt, pxQueue ) \
+    vTraceStoreEvent( trcEVENT( ( evt ), ( ( pxQueue )->uxQueueNumber & 0xFFFFUL ) | \
+                      ( ( ( pxQueue )->uxMessagesWaiting > 0xFFUL ? 0xFFUL : ( pxQueue )->uxMessagesWaiting ) << 16 ) ) )
+
+extern uint32_t ulTraceNextQueueNumber;
+
+/* Task hooks of the crash dump, see crash_dump.h */
+#ifndef traceCRASH_TASK_CREATE
+#define traceCRASH_TASK_CREATE( pxNewTCB )
+#define traceCRASH_TASK_DELETE( pxTCB )
+#endif
+
+#define traceTASK_SWITCHED_IN()                 vTraceStoreEvent( trcEVENT( trcEVT_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber ) )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB ) vTraceStoreEvent( trcEVENT( trcEVT_TASK_READY, ( pxTCB )->uxTCBNumber ) )
+#define traceTASK_CREATE( pxNewTCB ) \
+    do { \
+        vTraceStoreEvent( trcEVENT( trcEVT_TASK_CREATE, ( pxNewTCB )->uxTCBNumber | ( ( pxNewTCB )->uxPriority << 16 ) ) ); \
+        vTraceStoreName( trcEVENT( trcEVT_NAME, 0 ), ( const char * ) ( pxNewTCB )->pcTaskName ); \
+        traceCRASH_TASK_CREATE( pxNewTCB ); \
+    } while( 0 )
+#define traceTASK_DELETE( pxTCB ) \
+    do { \
+        vTraceStoreEvent( trcEVENT( trcEVT_TASK_DELETE, ( pxTCB )->uxTCBNumber ) ); \
+        traceCRASH_TASK_DELETE( pxTCB ); \
+    } while( 0 )
+#define traceTASK_PRIORITY_SET( pxTCB, uxNewPriority ) \
+    vTraceStoreEvent( trcEVENT( trcEVT_TASK_PRIORITY_SET, ( pxTCB )->uxTCBNumber | ( ( uxNewPriority ) << 16 ) ) )
+#define traceTASK_DELAY()                       vTraceStoreEvent( trcEVENT( trcEVT_TASK_DELAY, 0 ) )
+#define traceTASK_DELAY_UNTIL()                 vTraceStoreEvent( trcEVENT( trcEVT_TASK_DELAY, 0 ) )
+
+#define traceQUEUE_CREATE( pxNewQueue ) \
+    do { \
+        ( pxNewQueue )->uxQueueNumber = ++ulTraceNextQueueNumber; \
+        vTraceStoreEvent( trcEVENT( trcEVT_QUEUE_CREATE, ( pxNewQueue )->uxQueueNumber | ( ( pxNewQueue )->ucQueueType << 16 ) ) ); \
+    } while( 0 )
+#define traceCREATE_MUTEX( pxNewQueue )         traceQUEUE_CREATE( pxNewQueue )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName ) \
+    do { \
+        vTraceStoreEvent( trcEVENT( trcEVT_QUEUE_NAME, ( ( Queue_t * ) ( xQueue ) )->uxQueueNumber ) ); \
+        vTraceStoreName( trcEVENT( trcEVT_NAME, 0 ), ( const char * ) ( pcQueueName ) ); \
+    } while( 0 )
+#define traceQUEUE_DELETE( pxQueue )                    trcQUEUE( trcEVT_QUEUE_DELETE, pxQueue )
+#define traceQUEUE_SEND( pxQueue )                      trcQUEUE( trcEVT_QUEUE_SEND, pxQueue )
+#define traceQUEUE_SEND_FAILED( pxQueue )               trcQUEUE( trcEVT_QUEUE_SEND_FAILED, pxQueue )
+#define traceQUEUE_RECEIVE( pxQueue )                   trcQUEUE( trcEVT_QUEUE_RECEIVE, pxQueue )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )            trcQUEUE( trcEVT_QUEUE_RECEIVE_FAILED, pxQueue )
+#define traceQUEUE_PEEK( pxQueue )                      trcQUEUE( trcEVT_QUEUE_PEEK, pxQueue )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )             trcQUEUE( trcEVT_QUEUE_SEND_ISR, pxQueue )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )      trcQUEUE( trcEVT_QUEUE_SEND_ISR_FAILED, pxQueue )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )          trcQUEUE( trcEVT_QUEUE_RECEIVE_ISR, pxQueue )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )   trcQUEUE( trcEVT_QUEUE_RECEIVE_ISR_FAILED, pxQueue )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )          trcQUEUE( trcEVT_QUEUE_BLOCK_SEND, pxQueue )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )       trcQUEUE( trcEVT_QUEUE_BLOCK_RECEIVE, pxQueue )
+
+#define traceMALLOC( pvAddress, uiSize ) \
+    vTraceStoreEvent( trcEVENT( ( pvAddress ) != NULL ? trcEVT_MALLOC : trcEVT_MALLOC_FAILED, ( uiSize ) ) )
+#define traceFREE( pvAddress, uiSize )          vTraceStoreEvent( trcEVENT( trcEVT_FREE, ( uiSize ) ) )
+
+#define traceLOW_POWER_IDLE_BEGIN()             vTraceStoreEvent( trcEVENT( trcEVT_LOW_POWER_BEGIN, xExpectedIdleTime ) )
+#define traceLOW_POWER_IDLE_END()               vTraceStoreEvent( trcEVENT( trcEVT_LOW_POWER_END, 0 ) )
+
+#endif /* __TRACE_RECORDER_H__ */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
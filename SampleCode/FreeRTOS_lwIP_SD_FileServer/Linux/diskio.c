@@ -0,0 +1,169 @@
+/*-----------------------------------------------------------------------*/
+/* Low level disk I/O module skeleton for FatFs     (C)ChaN, 2013        */
+/*-----------------------------------------------------------------------*/
+/* Linux host build: drive 0 is a FAT image file, e.g. one created with  */
+/* "mkfs.vfat -C sd.img 65536". Sectors are read and written with        */
+/* pread() and pwrite(), which do not move a shared file offset.         */
+/*-----------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "diskio.h"     /* FatFs lower layer API */
+
+
+/* Definitions of physical drive number for each media */
+
+#define DRV_SD0     0
+
+#define SECTOR_SIZE 512
+
+/* Image file used as drive 0, set by main() */
+const char *disk_image = "sd.img";
+
+static int disk_fd = -1;
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Inidialize a Drive                                                    */
+/*-----------------------------------------------------------------------*/
+
+DSTATUS disk_initialize (
+    BYTE pdrv               /* Physical drive nmuber (0..) */
+)
+{
+    if (pdrv != DRV_SD0)
+        return STA_NOINIT;
+
+    if (disk_fd < 0)
+    {
+        disk_fd = open(disk_image, O_RDWR);
+        if (disk_fd < 0)
+        {
+            perror(disk_image);
+            return STA_NOINIT;
+        }
+    }
+
+    return 0;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Get Disk Status                                                       */
+/*-----------------------------------------------------------------------*/
+
+DSTATUS disk_status (
+    BYTE pdrv       /* Physical drive nmuber (0..) */
+)
+{
+    if ((pdrv != DRV_SD0) || (disk_fd < 0))
+        return STA_NOINIT;
+
+    return 0;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Read Sector(s)                                                        */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_read (
+    BYTE pdrv,      /* Physical drive nmuber (0..) */
+    BYTE *buff,     /* Data buffer to store read data */
+    DWORD sector,   /* Sector address (LBA) */
+    UINT count      /* Number of sectors to read (1..128) */
+)
+{
+    size_t size = (size_t)count * SECTOR_SIZE;
+
+    if ((pdrv != DRV_SD0) || (count == 0))
+        return RES_PARERR;
+
+    if (disk_fd < 0)
+        return RES_NOTRDY;
+
+    if (pread(disk_fd, buff, size, (off_t)sector * SECTOR_SIZE) != (ssize_t)size)
+        return RES_ERROR;
+
+    return RES_OK;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Write Sector(s)                                                       */
+/*-----------------------------------------------------------------------*/
+
+#if _USE_WRITE
+DRESULT disk_write (
+    BYTE pdrv,          /* Physical drive nmuber (0..) */
+    const BYTE *buff,   /* Data to be written */
+    DWORD sector,       /* Sector address (LBA) */
+    UINT count          /* Number of sectors to write (1..128) */
+)
+{
+    size_t size = (size_t)count * SECTOR_SIZE;
+
+    if ((pdrv != DRV_SD0) || (count == 0))
+        return RES_PARERR;
+
+    if (disk_fd < 0)
+        return RES_NOTRDY;
+
+    if (pwrite(disk_fd, buff, size, (off_t)sector * SECTOR_SIZE) != (ssize_t)size)
+        return RES_ERROR;
+
+    return RES_OK;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/* Miscellaneous Functions                                               */
+/*-----------------------------------------------------------------------*/
+
+#if _USE_IOCTL
+DRESULT disk_ioctl (
+    BYTE pdrv,      /* Physical drive nmuber (0..) */
+    BYTE cmd,       /* Control code */
+    void *buff      /* Buffer to send/receive control data */
+)
+{
+    struct stat st;
+
+    if (pdrv != DRV_SD0)
+        return RES_PARERR;
+
+    if (disk_fd < 0)
+        return RES_NOTRDY;
+
+    switch(cmd)
+    {
+    case CTRL_SYNC:
+        if (fsync(disk_fd) != 0)
+            return RES_ERROR;
+        break;
+    case GET_SECTOR_COUNT:
+        if (fstat(disk_fd, &st) != 0)
+            return RES_ERROR;
+        *(DWORD*)buff = (DWORD)(st.st_size / SECTOR_SIZE);
+        break;
+    case GET_SECTOR_SIZE:
+        *(WORD*)buff = SECTOR_SIZE;
+        break;
+    case GET_BLOCK_SIZE:
+        *(DWORD*)buff = 1;
+        break;
+
+    default:
+        return RES_PARERR;
+    }
+
+    return RES_OK;
+}
+#endif
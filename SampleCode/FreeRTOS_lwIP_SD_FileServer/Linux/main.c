@@ -0,0 +1,166 @@
+/******************************************************************************
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Linux host build of the SD card file server. The kernel runs on
+ *           the POSIX port, the Ethernet controller is replaced by a TAP
+ *           device and the SD card by a FAT image file, so the server and the
+ *           lwIP throughput can be measured without a board.
+ *
+ *           Usage: freertos_lwip_sd_fileserver [tap device] [disk image]
+ *           The defaults are tap0 and sd.img. Prepare them with e.g.
+ *             sudo ip tuntap add dev tap0 mode tap user $USER
+ *             sudo ip addr add 192.168.1.1/24 dev tap0
+ *             sudo ip link set tap0 up
+ *             mkfs.vfat -C sd.img 65536
+ *             mcopy -i sd.img data.txt ::
+ *           then fetch a file with "wget http://192.168.1.2/data.txt".
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "lwip/netif.h"
+#include "lwip/tcpip.h"
+#include "netif/tapif.h"
+#include "ff.h"
+#include "fileserver.h"
+
+#define mainWEB_TASK_PRIORITY              ( tskIDLE_PRIORITY + 3UL )
+
+//#define USE_DHCP
+
+#ifdef USE_DHCP
+#include "lwip/dhcp.h"
+#endif
+/*-----------------------------------------------------------*/
+
+static void vWebTask( void *pvParameters );
+/*-----------------------------------------------------------*/
+
+/* Image file used as drive 0, see diskio.c */
+extern const char *disk_image;
+
+unsigned char my_mac_addr[6] = {0x00, 0x00, 0x00, 0x55, 0x66, 0x77};
+struct netif netif;
+FATFS FatFs;
+
+int main(int argc, char *argv[])
+{
+    if(argc > 1)
+        tapif_name = argv[1];
+    if(argc > 2)
+        disk_image = argv[2];
+
+    xTaskCreate( vWebTask, "Web", TCPIP_THREAD_STACKSIZE, NULL, mainWEB_TASK_PRIORITY, NULL );
+
+    printf("FreeRTOS is starting ...\n");
+
+    /* Start the scheduler. */
+    vTaskStartScheduler();
+
+    /* Only returns if there was insufficient FreeRTOS heap memory to create
+    the idle and/or timer tasks, or vTaskEndScheduler() was called. */
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+/*---------------------------------------------------------*/
+/* User Provided RTC Function for FatFs module             */
+/*---------------------------------------------------------*/
+DWORD get_fattime (void)
+{
+    time_t now = time(NULL);
+    struct tm tm;
+
+    /* The C library takes a lock, a task must not be switched out while
+       holding it */
+    taskENTER_CRITICAL();
+    localtime_r(&now, &tm);
+    taskEXIT_CRITICAL();
+
+    return ((DWORD)(tm.tm_year - 80) << 25) |
+           ((DWORD)(tm.tm_mon + 1) << 21) |
+           ((DWORD)tm.tm_mday << 16) |
+           ((DWORD)tm.tm_hour << 11) |
+           ((DWORD)tm.tm_min << 5) |
+           ((DWORD)tm.tm_sec >> 1);
+}
+
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+    taskDISABLE_INTERRUPTS();
+    printf("Assertion failed at %s:%lu\n", pcFile, ulLine);
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+    taskDISABLE_INTERRUPTS();
+    printf("FreeRTOS heap exhausted, increase configTOTAL_HEAP_SIZE\n");
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+    /* Give the CPU back to the host until the next tick or interrupt */
+    pause();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+static void vWebTask( void *pvParameters )
+{
+    struct ip_addr ipaddr;
+    struct ip_addr netmask;
+    struct ip_addr gw;
+    TCHAR sd_path[] = { '0', ':', 0 }; /* SD drive started from 0 */
+
+    if(f_mount(&FatFs, sd_path, 1) != FR_OK)
+    {
+        printf("Cannot mount %s\n", disk_image);
+        vTaskSuspend( NULL );
+    }
+
+    IP4_ADDR(&gw, 192,168,1,1);
+    IP4_ADDR(&ipaddr, 192,168,1,2);
+    IP4_ADDR(&netmask, 255,255,255,0);
+
+    printf("Local IP:192.168.1.2 on %s\n", tapif_name);
+
+    tcpip_init(NULL, NULL);
+
+    if(netif_add(&netif, &ipaddr, &netmask, &gw, NULL, tapif_init, tcpip_input) == NULL)
+    {
+        printf("Cannot open %s\n", tapif_name);
+        vTaskSuspend( NULL );
+    }
+
+    netif_set_default(&netif);
+#ifdef USE_DHCP
+    dhcp_start(&netif);
+#else
+    netif_set_up(&netif);
+#endif
+
+    /* The server uses the raw API, it has to be started in the tcpip thread */
+    tcpip_callback(fileserver_init, NULL);
+
+    vTaskSuspend( NULL );
+
+}
@@ -0,0 +1,200 @@
+/**************************************************************************//**
+ * @file     fileserver.c
+ * @version  V1.00
+ * @brief    Minimal HTTP/1.0 server on the lwIP raw API that streams files
+ *           from the SD card with tcp_sendfile().
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "lwip/opt.h"
+#include "lwip/tcp.h"
+#include "ff.h"
+#include "tcp_sendfile.h"
+#include "fileserver.h"
+
+#define FILESERVER_PORT         80
+#define FILESERVER_MAX_NAME_LEN 64
+
+struct fileserver_conn
+{
+    FIL fil;
+    u8_t inuse;
+};
+
+static struct fileserver_conn fileserver_conns[SENDFILE_MAX_STREAMS];
+
+static const char http_404[] = "HTTP/1.0 404 File not found\r\nContent-type: text/plain\r\n\r\nFile not found\r\n";
+
+/*-----------------------------------------------------------------------------------*/
+/* Returns ERR_ABRT if the pcb had to be aborted, the caller must pass it on to lwIP */
+static err_t
+fileserver_close(struct tcp_pcb *pcb)
+{
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, NULL);
+    if(tcp_close(pcb) != ERR_OK)
+    {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+fileserver_done(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+    struct fileserver_conn *c = (struct fileserver_conn *)arg;
+
+    if(err != ERR_OK)
+    {
+        printf("sendfile error %d\n", err);
+    }
+    f_close(&c->fil);
+    c->inuse = 0;
+
+    if(pcb != NULL)
+    {
+        return fileserver_close(pcb);
+    }
+    return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+fileserver_get(struct tcp_pcb *pcb, const char *name)
+{
+    struct fileserver_conn *c = NULL;
+    char hdr[80];
+    err_t err;
+    int i;
+
+    for(i = 0; i < SENDFILE_MAX_STREAMS; i++)
+    {
+        if(fileserver_conns[i].inuse == 0)
+        {
+            c = &fileserver_conns[i];
+            break;
+        }
+    }
+
+    if((c == NULL) || (f_open(&c->fil, name, FA_READ) != FR_OK))
+    {
+        tcp_write(pcb, http_404, sizeof(http_404) - 1, 0);
+        return fileserver_close(pcb);
+    }
+    c->inuse = 1;
+
+    sprintf(hdr, "HTTP/1.0 200 OK\r\nContent-Length: %lu\r\n\r\n", (unsigned long)f_size(&c->fil));
+    err = tcp_write(pcb, hdr, strlen(hdr), TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+    if(err == ERR_OK)
+    {
+        /* Once started, fileserver_done() closes the file and the connection */
+        err = tcp_sendfile(pcb, &c->fil, f_size(&c->fil), fileserver_done, c);
+        if(err != ERR_MEM)
+        {
+            return err;
+        }
+    }
+
+    f_close(&c->fil);
+    c->inuse = 0;
+    return fileserver_close(pcb);
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+fileserver_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+    char req[FILESERVER_MAX_NAME_LEN + 5];
+    char name[FILESERVER_MAX_NAME_LEN + 2];
+    u16_t len;
+    int i;
+
+    LWIP_UNUSED_ARG(err);
+
+    if(p == NULL)
+    {
+        /* Remote side closed. A transfer in progress notices it by itself. */
+        if(arg == NULL)
+        {
+            return fileserver_close(pcb);
+        }
+        return ERR_OK;
+    }
+
+    tcp_recved(pcb, p->tot_len);
+    if(arg != NULL)
+    {
+        /* Already serving this connection, ignore the rest of the request */
+        pbuf_free(p);
+        return ERR_OK;
+    }
+
+    len = pbuf_copy_partial(p, req, sizeof(req) - 1, 0);
+    req[len] = 0;
+    pbuf_free(p);
+
+    if(strncmp(req, "GET /", 5) != 0)
+    {
+        return fileserver_close(pcb);
+    }
+
+    /* "GET /dir/file.txt HTTP/1.0" -> "0:/dir/file.txt" */
+    name[0] = '0';
+    name[1] = ':';
+    for(i = 0; (req[i + 4] != 0) && (req[i + 4] != ' ') && (req[i + 4] != '\r') &&
+            (i < FILESERVER_MAX_NAME_LEN - 1); i++)
+    {
+        name[i + 2] = req[i + 4];
+    }
+    name[i + 2] = 0;
+
+    return fileserver_get(pcb, name);
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+fileserver_accept(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+    LWIP_UNUSED_ARG(arg);
+    LWIP_UNUSED_ARG(err);
+
+    tcp_setprio(pcb, TCP_PRIO_MIN);
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, fileserver_recv);
+    return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/**
+  * @brief  Start the file server. Runs in the lwIP core context, so call it
+  *         through tcpip_callback().
+  * @param  arg: not used
+  * @retval None
+  */
+void
+fileserver_init(void *arg)
+{
+    struct tcp_pcb *pcb;
+
+    LWIP_UNUSED_ARG(arg);
+
+    pcb = tcp_new();
+    if(pcb == NULL)
+    {
+        printf("can not create pcb");
+        return;
+    }
+    if(tcp_bind(pcb, IP_ADDR_ANY, FILESERVER_PORT) != ERR_OK)
+    {
+        printf("can not bind pcb");
+        tcp_close(pcb);
+        return;
+    }
+    pcb = tcp_listen(pcb);
+    tcp_accept(pcb, fileserver_accept);
+}
@@ -0,0 +1,6 @@
+#ifndef __FILESERVER_H__
+#define __FILESERVER_H__
+
+void fileserver_init(void *arg);
+
+#endif /* __FILESERVER_H__ */
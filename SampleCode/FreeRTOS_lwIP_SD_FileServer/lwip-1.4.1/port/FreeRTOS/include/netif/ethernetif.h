@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2013 Nuvoton Technology Corp.
+ *
+ * See file CREDITS for list of people who contributed to this
+ * project.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA 02111-1307 USA
+ *
+ * Description:  EMAC driver header file
+ */
+#ifndef __ETHERNETIF_H__
+#define __ETHERNETIF_H__
+
+
+#include "lwip/err.h"
+#include "lwip/netif.h"
+
+//extern sys_sem_t tx_sem;
+extern sys_sem_t rx_sem;
+
+err_t ethernetif_init(struct netif *netif);
+err_t ethernetif_input(struct netif *netif);
+struct netif *ethernetif_register(void);
+int ethernetif_poll(void);
+void Set_MAC_Address(unsigned char* macadd);
+void Rx_Thread(void *arg);
+
+#ifdef SERVER
+
+#define MAC_ADDR0 0x00
+#define MAC_ADDR1 0x00
+#define MAC_ADDR2 0x00
+#define MAC_ADDR3 0x00
+#define MAC_ADDR4 0x00
+#define MAC_ADDR5 0x01
+
+#else
+
+#define MAC_ADDR0 0x00
+#define MAC_ADDR1 0x00
+#define MAC_ADDR2 0x00
+#define MAC_ADDR3 0x00
+#define MAC_ADDR4 0x00
+//#define MAC_ADDR5 0x02
+#define MAC_ADDR5 0x03
+//#define MAC_ADDR5 0x04
+
+#endif
+
+#endif
@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) 2013 Nuvoton Technology Corp.
+ *
+ * See file CREDITS for list of people who contributed to this
+ * project.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA 02111-1307 USA
+ *
+ * Description:   NUC472 MAC driver source file
+ */
+#include "netif/nuc472_eth.h"
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/sys.h"
+#include "arch/sys_arch.h"
+#include <string.h>
+
+#define ETH_TRIGGER_RX()    do{EMAC->RXST = 0;}while(0)
+#define ETH_TRIGGER_TX()    do{EMAC->TXST = 0;}while(0)
+#define ETH_ENABLE_TX()     do{EMAC->CTL |= EMAC_CTL_TXON;}while(0)
+#define ETH_ENABLE_RX()     do{EMAC->CTL |= EMAC_CTL_RXON;}while(0)
+#define ETH_DISABLE_TX()    do{EMAC->CTL &= ~EMAC_CTL_TXON;}while(0)
+#define ETH_DISABLE_RX()    do{EMAC->CTL &= ~EMAC_CTL_RXON;}while(0)
+
+#ifdef __ICCARM__
+#pragma data_alignment=4
+struct eth_descriptor rx_desc[RX_DESCRIPTOR_NUM];
+struct eth_descriptor tx_desc[TX_DESCRIPTOR_NUM];
+#else
+struct eth_descriptor rx_desc[RX_DESCRIPTOR_NUM] __attribute__ ((aligned(4)));
+struct eth_descriptor tx_desc[TX_DESCRIPTOR_NUM] __attribute__ ((aligned(4)));
+#endif
+struct eth_descriptor volatile *cur_tx_desc_ptr, *cur_rx_desc_ptr, *fin_tx_desc_ptr;
+
+u8_t rx_buf[RX_DESCRIPTOR_NUM][PACKET_BUFFER_SIZE];
+u8_t tx_buf[TX_DESCRIPTOR_NUM][PACKET_BUFFER_SIZE];
+
+extern void ethernetif_input(u16_t len, u8_t *buf, u32_t s, u32_t ns);
+extern void ethernetif_loopback_input(struct pbuf *p);
+
+// PTP source clock is 84MHz (Real chip using PLL). Each tick is 11.90ns
+// Assume we want to set each tick to 100ns.
+// Increase register = (100 * 2^31) / (10^9) = 214.71 =~ 215 = 0xD7
+// Addend register = 2^32 * tick_freq / (84MHz), where tick_freq = (2^31 / 215) MHz
+// From above equation, addend register = 2^63 / (84M * 215) ~= 510707200 = 0x1E70C600
+
+#ifdef TIME_STAMPING
+#define DEFAULT_ADDNED    0x1E70C600
+#define DEFAULT_INC    0xD7
+#endif
+
+extern portBASE_TYPE xInsideISR;
+
+// CAM entry 0 holds our MAC address, and entry 13~15 are used by PAUSE control frame
+#define MCAST_CAM_FIRST     1
+#define MCAST_CAM_LAST      12
+
+struct mcast_entry
+{
+    u8_t addr[6];
+    u8_t ref;           // Number of groups mapped to this address, 0 if entry is free
+};
+
+static struct mcast_entry mcast_tbl[ETH_MCAST_MAX];
+static u8_t mcast_overflow;     // More addresses than CAM entries, filter the rest by software
+static u8_t mcast_untracked;    // Joins that did not fit in mcast_tbl, accept all multicast
+static struct eth_mcast_stats mcast_stats;
+
+static void mdio_write(u8_t addr, u8_t reg, u16_t val)
+{
+
+    EMAC->MIIMDAT = val;
+    EMAC->MIIMCTL = (addr << EMAC_MIIMCTL_PHYADDR_Pos) | reg | EMAC_MIIMCTL_BUSY_Msk | EMAC_MIIMCTL_WRITE_Msk | EMAC_MIIMCTL_MDCON_Msk;
+
+    while (EMAC->MIIMCTL & EMAC_MIIMCTL_BUSY_Msk);
+
+}
+
+
+static u16_t mdio_read(u8_t addr, u8_t reg)
+{
+    EMAC->MIIMCTL = (addr << EMAC_MIIMCTL_PHYADDR_Pos) | reg | EMAC_MIIMCTL_BUSY_Msk | EMAC_MIIMCTL_MDCON_Msk;
+    while (EMAC->MIIMCTL & EMAC_MIIMCTL_BUSY_Msk);
+
+    return(EMAC->MIIMDAT);
+}
+
+static int reset_phy(void)
+{
+
+    u16_t reg;
+    u32_t delay;
+
+
+    mdio_write(CONFIG_PHY_ADDR, MII_BMCR, BMCR_RESET);
+
+    delay = 2000;
+    while(delay-- > 0)
+    {
+        if((mdio_read(CONFIG_PHY_ADDR, MII_BMCR) & BMCR_RESET) == 0)
+            break;
+
+    }
+
+    if(delay == 0)
+    {
+        printf("Reset phy failed\n");
+        return(-1);
+    }
+
+    mdio_write(CONFIG_PHY_ADDR, MII_ADVERTISE, ADVERTISE_CSMA |
+               ADVERTISE_10HALF |
+               ADVERTISE_10FULL |
+               ADVERTISE_100HALF |
+               ADVERTISE_100FULL);
+
+    reg = mdio_read(CONFIG_PHY_ADDR, MII_BMCR);
+    mdio_write(CONFIG_PHY_ADDR, MII_BMCR, reg | BMCR_ANRESTART);
+
+    delay = 200000;
+    while(delay-- > 0)
+    {
+        if((mdio_read(CONFIG_PHY_ADDR, MII_BMSR) & (BMSR_ANEGCOMPLETE | BMSR_LSTATUS))
+                == (BMSR_ANEGCOMPLETE | BMSR_LSTATUS))
+            break;
+    }
+
+    if(delay == 0)
+    {
+        printf("AN failed. Set to 100 FULL\n");
+        EMAC->CTL |= (EMAC_CTL_OPMODE_Msk | EMAC_CTL_FUDUP_Msk);
+        return(-1);
+    }
+    else
+    {
+        reg = mdio_read(CONFIG_PHY_ADDR, MII_LPA);
+
+        if(reg & ADVERTISE_100FULL)
+        {
+            printf("100 full\n");
+            EMAC->CTL |= (EMAC_CTL_OPMODE_Msk | EMAC_CTL_FUDUP_Msk);
+        }
+        else if(reg & ADVERTISE_100HALF)
+        {
+            printf("100 half\n");
+            EMAC->CTL = (EMAC->CTL & ~EMAC_CTL_FUDUP_Msk) | EMAC_CTL_OPMODE_Msk;
+        }
+        else if(reg & ADVERTISE_10FULL)
+        {
+            printf("10 full\n");
+            EMAC->CTL = (EMAC->CTL & ~EMAC_CTL_OPMODE_Msk) | EMAC_CTL_FUDUP_Msk;
+        }
+        else
+        {
+            printf("10 half\n");
+            EMAC->CTL &= ~(EMAC_CTL_OPMODE_Msk | EMAC_CTL_FUDUP_Msk);
+        }
+    }
+
+    return(0);
+}
+
+
+static void init_tx_desc(void)
+{
+    u32_t i;
+
+
+    cur_tx_desc_ptr = fin_tx_desc_ptr = &tx_desc[0];
+
+    for(i = 0; i < TX_DESCRIPTOR_NUM; i++)
+    {
+        tx_desc[i].status1 = TXFD_PADEN | TXFD_CRCAPP | TXFD_INTEN;
+        tx_desc[i].buf = &tx_buf[i][0];
+        tx_desc[i].status2 = 0;
+        tx_desc[i].next = &tx_desc[(i + 1) % TX_DESCRIPTOR_NUM];
+#ifdef    TIME_STAMPING
+        tx_desc[i].backup1 = (u32_t)tx_desc[i].buf;
+        tx_desc[i].backup2 = (u32_t)tx_desc[i].next;
+#endif
+    }
+    EMAC->TXDSA = (unsigned int)&tx_desc[0];
+    return;
+}
+
+static void init_rx_desc(void)
+{
+    u32_t i;
+
+
+    cur_rx_desc_ptr = &rx_desc[0];
+
+    for(i = 0; i < RX_DESCRIPTOR_NUM; i++)
+    {
+        rx_desc[i].status1 = OWNERSHIP_EMAC;
+        rx_desc[i].buf = &rx_buf[i][0];
+        rx_desc[i].status2 = 0;
+        rx_desc[i].next = &rx_desc[(i + 1) % RX_DESCRIPTOR_NUM];
+#ifdef    TIME_STAMPING
+        rx_desc[i].backup1 = (u32_t)rx_desc[i].buf;
+        rx_desc[i].backup2 = (u32_t)rx_desc[i].next;
+#endif
+    }
+    EMAC->RXDSA = (unsigned int)&rx_desc[0];
+    return;
+}
+
+// Load the multicast table into CAM. Accept all multicast if it does not fit.
+static void mcast_update_cam(void)
+{
+    u32_t i, entry = MCAST_CAM_FIRST;
+    u32_t camen = EMAC->CAMEN & ~(((1 << (MCAST_CAM_LAST + 1)) - 1) & ~((1 << MCAST_CAM_FIRST) - 1));
+    u8_t *addr;
+
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref == 0)
+            continue;
+        if(entry > MCAST_CAM_LAST)
+            break;
+
+        addr = mcast_tbl[i].addr;
+        *(&EMAC->CAM0M + entry * 2) = (addr[0] << 24) | (addr[1] << 16) | (addr[2] << 8) | addr[3];
+        *(&EMAC->CAM0L + entry * 2) = (addr[4] << 24) | (addr[5] << 16);
+        camen |= (1 << entry);
+        entry++;
+    }
+    EMAC->CAMEN = camen;
+
+    mcast_overflow = (i < ETH_MCAST_MAX) ? 1 : 0;
+    if(mcast_overflow || mcast_untracked)
+        EMAC->CAMCTL |= EMAC_CAMCTL_AMP_Msk;
+    else
+        EMAC->CAMCTL &= ~EMAC_CAMCTL_AMP_Msk;
+}
+
+// Called in Rx interrupt. Drop multicast frames EMAC accepted only because CAM is full.
+static int mcast_accept(u8_t *buf)
+{
+    u32_t i;
+
+    // Unicast and broadcast frames are filtered by EMAC
+    if(!mcast_overflow || mcast_untracked || !(buf[0] & 1) || (buf[0] == 0xFF))
+        return(1);
+
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref && (memcmp(mcast_tbl[i].addr, buf, 6) == 0))
+            return(1);
+    }
+    mcast_stats.sw_drop++;
+    return(0);
+}
+
+static void set_mac_addr(u8_t *addr)
+{
+
+    EMAC->CAM0M = (addr[0] << 24) |
+                  (addr[1] << 16) |
+                  (addr[2] << 8) |
+                  addr[3];
+
+    EMAC->CAM0L = (addr[4] << 24) |
+                  (addr[5] << 16);
+
+#if LWIP_IGMP
+    // Multicast addresses are added to CAM by ETH_add_mcast()
+    EMAC->CAMCTL = EMAC_CAMCTL_CMPEN_Msk | EMAC_CAMCTL_ABP_Msk;
+    EMAC->CAMEN = 1;    // Enable CAM entry 0
+    mcast_update_cam();
+#else
+    EMAC->CAMCTL = EMAC_CAMCTL_CMPEN_Msk | EMAC_CAMCTL_AMP_Msk | EMAC_CAMCTL_ABP_Msk;
+    EMAC->CAMEN = 1;    // Enable CAM entry 0
+#endif
+
+}
+
+
+void ETH_init(u8_t *mac_addr)
+{
+
+
+    // Reset MAC
+    EMAC->CTL = EMAC_CTL_RST_Msk;
+
+    init_tx_desc();
+    init_rx_desc();
+
+    set_mac_addr(mac_addr);  // need to reconfigure hardware address 'cos we just RESET emc...
+    reset_phy();
+
+    EMAC->CTL |= EMAC_CTL_STRIPCRC_Msk | EMAC_CTL_RXON_Msk | EMAC_CTL_TXON_Msk | EMAC_CTL_RMIIEN_Msk | EMAC_CTL_RMIIRXCTL_Msk;
+    EMAC->INTEN |= EMAC_INTEN_RXIEN_Msk |
+                   EMAC_INTEN_RXGDIEN_Msk |
+                   EMAC_INTEN_RDUIEN_Msk |
+                   EMAC_INTEN_RXBEIEN_Msk |
+                   EMAC_INTEN_TXIEN_Msk |
+                   EMAC_INTEN_TXABTIEN_Msk |
+                   EMAC_INTEN_TXCPIEN_Msk |
+                   EMAC_INTEN_TXBEIEN_Msk;
+    EMAC->RXST = 0;  // trigger Rx
+}
+
+
+
+void  ETH_halt(void)
+{
+
+    EMAC->CTL &= ~(EMAC_CTL_RXON_Msk | EMAC_CTL_TXON_Msk);
+}
+
+void EMAC_RX_IRQHandler(void)
+{
+    unsigned int status;
+
+    xInsideISR = pdTRUE;
+    status = EMAC->INTSTS & 0xFFFF;
+    EMAC->INTSTS = status;
+    if (status & EMAC_INTSTS_RXBEIF_Msk)
+    {
+        // Shouldn't goes here, unless descriptor corrupted
+    }
+
+    do
+    {
+
+        //cur_entry = EMAC->CRXDSA;
+
+        //if ((cur_entry == (u32_t)cur_rx_desc_ptr) && (!(status & EMAC_INTSTS_RDUIF_Msk)))  // cur_entry may equal to cur_rx_desc_ptr if RDU occures
+        //    break;
+        status = cur_rx_desc_ptr->status1;
+
+        if(status & OWNERSHIP_EMAC)
+            break;
+
+        if (status & RXFD_RXGD)
+        {
+
+#ifdef    TIME_STAMPING
+            if(status & RXFD_RTSAS)
+            {
+                cur_rx_desc_ptr->buf = (uint8_t *)fin_tx_desc_ptr->backup1;
+                cur_rx_desc_ptr->next = (struct eth_descriptor *)fin_tx_desc_ptr->backup2;
+            }
+#endif
+            if(mcast_accept(cur_rx_desc_ptr->buf))
+                ethernetif_input(status & 0xFFFF, cur_rx_desc_ptr->buf, cur_rx_desc_ptr->status2, (u32_t)cur_rx_desc_ptr->next);
+
+
+        }
+
+        cur_rx_desc_ptr->status1 = OWNERSHIP_EMAC;
+        cur_rx_desc_ptr = cur_rx_desc_ptr->next;
+
+    }
+    while (1);
+
+    ETH_TRIGGER_RX();
+    xInsideISR = pdFALSE;
+}
+
+void EMAC_TX_IRQHandler(void)
+{
+    unsigned int cur_entry, status;
+
+
+    xInsideISR = pdTRUE;
+    status = EMAC->INTSTS & 0xFFFF0000;
+    EMAC->INTSTS = status;
+#ifdef    TIME_STAMPING
+    if(status & EMAC_INTSTS_TSALMIF_Msk)
+    {
+        // TODO: time stamp alarm. write me!!
+    }
+#endif
+    if(status & EMAC_INTSTS_TXBEIF_Msk)
+    {
+        // Shouldn't goes here, unless descriptor corrupted
+        return;
+    }
+
+    cur_entry = EMAC->CTXDSA;
+
+    while (cur_entry != (u32_t)fin_tx_desc_ptr)
+    {
+#ifdef  TIME_STAMPING
+        if(fin_tx_desc_ptr->status2 & TXFD_TTSAS)
+        {
+            if((struct pbuf *)fin_tx_desc_ptr->reserved1 != NULL)
+            {
+                ((struct pbuf *)(fin_tx_desc_ptr->reserved1))->ts_nsec = (u32_t)(fin_tx_desc_ptr->buf);
+                ((struct pbuf *)(fin_tx_desc_ptr->reserved1))->ts_sec = (u32_t)(fin_tx_desc_ptr->next);
+                ethernetif_loopback_input((struct pbuf *)fin_tx_desc_ptr->reserved1);
+            }
+            fin_tx_desc_ptr->buf = (u8_t *)fin_tx_desc_ptr->backup1;
+            fin_tx_desc_ptr->next = (struct eth_descriptor *)fin_tx_desc_ptr->backup2;
+        }
+        else
+        {
+            if((struct pbuf *)fin_tx_desc_ptr->reserved1 != NULL)
+                pbuf_free((struct pbuf *)fin_tx_desc_ptr->reserved1);
+        }
+        fin_tx_desc_ptr->reserved1 = (u32_t)NULL;
+#endif
+        fin_tx_desc_ptr = fin_tx_desc_ptr->next;
+    }
+    xInsideISR = pdFALSE;
+}
+
+u8_t *ETH_get_tx_buf(void)
+{
+    if(cur_tx_desc_ptr->status1 & OWNERSHIP_EMAC)
+        return(NULL);
+    else
+        return(cur_tx_desc_ptr->buf);
+}
+
+void ETH_trigger_tx(u16_t length, struct pbuf *p)
+{
+    struct eth_descriptor volatile *desc;
+    cur_tx_desc_ptr->status2 = (unsigned int)length;
+    desc = cur_tx_desc_ptr->next;    // in case TX is transmitting and overwrite next pointer before we can update cur_tx_desc_ptr
+    cur_tx_desc_ptr->status1 |= OWNERSHIP_EMAC;
+    cur_tx_desc_ptr = desc;
+#ifdef TIME_STAMPING
+    cur_tx_desc_ptr->reserved1 = (u32_t)p;
+#endif
+    ETH_TRIGGER_TX();
+
+}
+
+/*
+ * Add a multicast MAC address to the receive filter. Addresses are reference
+ * counted since several IP groups map to the same MAC address.
+ * Returns 0 on success, -1 if the table is full. Multicast is then accepted
+ * unfiltered until the address is deleted again.
+ */
+s32_t ETH_add_mcast(u8_t *addr)
+{
+    s32_t i, free = -1;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref == 0)
+        {
+            if(free < 0)
+                free = i;
+        }
+        else if(memcmp(mcast_tbl[i].addr, addr, 6) == 0)
+        {
+            mcast_tbl[i].ref++;
+            SYS_ARCH_UNPROTECT(lev);
+            return(0);
+        }
+    }
+
+    if(free < 0)
+    {
+        mcast_stats.table_full++;
+        mcast_untracked++;
+    }
+    else
+    {
+        memcpy(mcast_tbl[free].addr, addr, 6);
+        mcast_tbl[free].ref = 1;
+    }
+    mcast_update_cam();
+    SYS_ARCH_UNPROTECT(lev);
+
+    return(free < 0 ? -1 : 0);
+}
+
+void ETH_del_mcast(u8_t *addr)
+{
+    u32_t i;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref && (memcmp(mcast_tbl[i].addr, addr, 6) == 0))
+        {
+            mcast_tbl[i].ref--;
+            break;
+        }
+    }
+    // Not in table, must be one of the joins that did not fit
+    if((i == ETH_MCAST_MAX) && mcast_untracked)
+        mcast_untracked--;
+    mcast_update_cam();
+    SYS_ARCH_UNPROTECT(lev);
+}
+
+void ETH_get_mcast_stats(struct eth_mcast_stats *stats)
+{
+    u32_t i;
+
+    *stats = mcast_stats;
+    stats->groups = 0;
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref)
+            stats->groups++;
+    }
+    stats->rx_missed = EMAC->MPCNT & EMAC_MPCNT_MPCNT_Msk;
+    stats->accept_all = (EMAC->CAMCTL & EMAC_CAMCTL_AMP_Msk) ? 1 : 0;
+}
+
+
+#ifdef TIME_STAMPING
+
+
+static u32_t subsec2nsec(u32_t subsec)
+{
+    // 2^31 subsec == 10^9 ns
+    uint64_t i;
+    i = 1000000000ll * subsec;
+    i >>= 31;
+    return(i);
+}
+
+static u32_t nsec2subsec(u32_t nsec)
+{
+    // 10^9 ns =  2^31 subsec
+    uint64_t i;
+    i = (1ll << 31) * nsec;
+    i /= 1000000000;
+    return(i);
+}
+
+s32_t ETH_settime(u32_t sec, u32_t nsec)
+{
+    // Disable time stamp counter before update time value
+    EMAC->TSCTL = EMAC_TSCTL_TSEN_Msk;
+    EMAC->UPDSEC = sec;
+    EMAC->UPDSUBSEC = nsec2subsec(nsec);
+    EMAC->TSCTL |= (EMAC_TSCTL_TSMODE_Msk | EMAC_TSCTL_TSIEN_Msk);
+
+    return ERR_OK;
+}
+
+s32_t ETH_gettime(u32_t *sec, u32_t *nsec)
+{
+
+    // Must read TSLSR firstly. Hardware will preserve TSMSR value at the time TSLSR read.
+    *nsec = subsec2nsec(EMAC->TSSUBSEC);
+    *sec = EMAC->TSSEC;
+
+    return ERR_OK;
+}
+
+s32_t ETH_updatetime(u32_t neg, u32_t sec, u32_t nsec)
+{
+
+    EMAC->UPDSEC = sec;
+    EMAC->UPDSUBSEC = nsec2subsec(nsec);
+    if(neg)
+        EMAC->UPDSUBSEC |= BIT31;   // Set bit 31 indicates this is a negative value
+
+    EMAC->TSCTL |= EMAC_TSCTL_TSUPDATE_Msk;
+    return ERR_OK;
+
+}
+
+s32_t ETH_adjtimex(int ppb)
+{
+    int64_t addend = EMAC->TSADDEND;
+
+
+    addend = (ppb * DEFAULT_ADDNED) / 1000000000 + DEFAULT_ADDNED;
+    if(addend > 0xFFFFFFFF)
+        addend = 0xFFFFFFFF;
+
+    EMAC->TSADDEND = addend;
+
+    return ERR_OK;
+}
+
+void ETH_setinc(void)
+{
+    EMAC->TSINC = DEFAULT_INC;
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2001-2003 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ * Author: Adam Dunkels <adam@sics.se>
+ *
+ */
+#ifndef __CC_H__
+#define __CC_H__
+
+#include "cpu.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <sys/time.h>
+
+/*-------------data type------------------------------------------------------*/
+
+/* Fixed width types, the Linux host is LP64 */
+typedef uint8_t     u8_t;           /* Unsigned 8 bit quantity         */
+typedef int8_t      s8_t;           /* Signed    8 bit quantity        */
+typedef uint16_t    u16_t;          /* Unsigned 16 bit quantity        */
+typedef int16_t     s16_t;          /* Signed   16 bit quantity        */
+typedef uint32_t    u32_t;          /* Unsigned 32 bit quantity        */
+typedef int32_t     s32_t;          /* Signed   32 bit quantity        */
+typedef uintptr_t   mem_ptr_t;      /* Holds a pointer                 */
+typedef u32_t sys_prot_t;
+
+/*----------------------------------------------------------------------------*/
+
+#define PACK_STRUCT_BEGIN
+#define PACK_STRUCT_STRUCT __attribute__ ((__packed__))
+#define PACK_STRUCT_END
+#define PACK_STRUCT_FIELD(x) x
+
+/*---define (sn)printf formatters for these lwip types, for lwip DEBUG/STATS--*/
+
+#define U16_F "4hu"
+#define S16_F "4hd"
+#define X16_F "4hx"
+#define U32_F "8u"
+#define S32_F "8d"
+#define X32_F "8x"
+#define SZT_F "zu"
+
+/*--------------macros--------------------------------------------------------*/
+#ifndef LWIP_PLATFORM_ASSERT
+#define LWIP_PLATFORM_ASSERT(x) \
+    do \
+    {   printf("Assertion \"%s\" failed at line %d in %s\n", x, __LINE__, __FILE__); \
+        fflush(NULL); \
+        abort(); \
+    } while(0)
+#endif
+
+#ifndef LWIP_PLATFORM_DIAG
+#define LWIP_PLATFORM_DIAG(x) do {printf x;} while(0)
+#endif
+
+/* Error codes come from the host C library */
+#define LWIP_ERRNO_INCLUDE  <errno.h>
+u32_t _LWIP_RAND(void);
+
+/* Same segment size as the target so throughput numbers compare */
+#define TCP_MSS                         1000
+#endif /* __CC_H__ */
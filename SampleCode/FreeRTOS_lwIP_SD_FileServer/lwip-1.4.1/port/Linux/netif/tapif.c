@@ -0,0 +1,344 @@
+/**
+ * @file
+ * Ethernet interface on a Linux TAP device, so the sample runs on a host
+ * with the POSIX FreeRTOS port. Modelled on uip-0.9/unix/tapdev.c.
+ *
+ * A peripheral thread waits until the device is readable and raises
+ * TAPIF_INTERRUPT, as the EMAC raises its RX interrupt. The interrupt
+ * handler wakes the tapif task, which reads every queued frame into a pbuf,
+ * passes it to tcpip_thread and then lets the peripheral thread wait again.
+ */
+
+/*
+ * Copyright (c) 2001-2003 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ * Author: Adam Dunkels <adam@sics.se>
+ *
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+
+#include "lwip/opt.h"
+
+#include "lwip/def.h"
+#include "lwip/mem.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include <lwip/stats.h>
+#include <lwip/snmp.h>
+#include "netif/etharp.h"
+#include "netif/tapif.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#define DEVTAP  "/dev/net/tun"
+
+/* Define those to better describe your network interface. */
+#define IFNAME0 't'
+#define IFNAME1 'p'
+
+#define TAPIF_MAX_FRAME         1536
+#define TAPIF_TX_SEGMENTS       16
+#define TAPIF_TASK_PRIORITY     (TCPIP_THREAD_PRIO + 1)
+#define TAPIF_TASK_STACKSIZE    (configMINIMAL_STACK_SIZE * 2)
+
+const char *tapif_name = "tap0";
+extern u8_t my_mac_addr[6];
+
+struct tapif
+{
+    int fd;
+    struct netif *netif;
+    xSemaphoreHandle rx_sem;    /* Given by the interrupt handler */
+    sem_t rearm;                /* Posted by the tapif task once the device is drained */
+};
+
+/* The simulated interrupt handler has no argument */
+static struct tapif *tapif_irq;
+
+/*
+ * Peripheral thread. Runs with the simulated interrupts blocked and must not
+ * call FreeRTOS functions.
+ */
+static void *
+tapif_thread(void *arg)
+{
+    struct tapif *tapif = (struct tapif *)arg;
+    struct pollfd pfd;
+
+    pfd.fd = tapif->fd;
+    pfd.events = POLLIN;
+
+    for(;;)
+    {
+        if(poll(&pfd, 1, -1) <= 0)
+            continue;
+
+        vPortGenerateSimulatedInterrupt(TAPIF_INTERRUPT);
+
+        /* Like a level triggered interrupt, not raised again until the frames
+           have been read */
+        while(sem_wait(&tapif->rearm) != 0);
+    }
+
+    return NULL;
+}
+
+static uint32_t
+tapif_irq_handler(void)
+{
+    portBASE_TYPE woken = pdFALSE;
+
+    xSemaphoreGiveFromISR(tapif_irq->rx_sem, &woken);
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * Allocate a pbuf for a received frame and pass it to tcpip_thread.
+ *
+ * @param netif the lwip network interface structure for this tapif
+ * @param buf the frame read from the TAP device
+ * @param len length of the frame
+ */
+static void
+tapif_input(struct netif *netif, u8_t *buf, u16_t len)
+{
+    struct eth_hdr *ethhdr;
+    struct pbuf *p;
+
+    p = pbuf_alloc(PBUF_RAW, len + ETH_PAD_SIZE, PBUF_POOL);
+    if(p == NULL)
+    {
+        LINK_STATS_INC(link.memerr);
+        LINK_STATS_INC(link.drop);
+        return;
+    }
+
+#if ETH_PAD_SIZE
+    pbuf_header(p, -ETH_PAD_SIZE); /* drop the padding word */
+#endif
+    pbuf_take(p, buf, len);
+#if ETH_PAD_SIZE
+    pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
+#endif
+
+    LINK_STATS_INC(link.recv);
+
+    /* points to packet payload, which starts with an Ethernet header */
+    ethhdr = p->payload;
+
+    switch (htons(ethhdr->type))
+    {
+    /* IP or ARP packet? */
+    case ETHTYPE_IP:
+    case ETHTYPE_ARP:
+        /* full packet send to tcpip_thread to process */
+        if(netif->input(p, netif) != ERR_OK)
+        {
+            LWIP_DEBUGF(NETIF_DEBUG, ("tapif_input: IP input error\n"));
+            pbuf_free(p);
+        }
+        break;
+
+    default:
+        pbuf_free(p);
+        break;
+    }
+}
+
+/*
+ * Read all frames queued on the device each time the interrupt handler
+ * gives rx_sem.
+ */
+static void
+tapif_task(void *arg)
+{
+    struct tapif *tapif = (struct tapif *)arg;
+    static u8_t buf[TAPIF_MAX_FRAME];
+    ssize_t len;
+
+    for(;;)
+    {
+        xSemaphoreTake(tapif->rx_sem, portMAX_DELAY);
+
+        while((len = read(tapif->fd, buf, sizeof(buf))) > 0)
+            tapif_input(tapif->netif, buf, (u16_t)len);
+
+        sem_post(&tapif->rearm);
+    }
+}
+
+/**
+ * Send a frame. Each pbuf of the chain is passed to writev() as is, the
+ * TAP device takes one frame per call.
+ *
+ * @param netif the lwip network interface structure for this tapif
+ * @param p the MAC packet to send (e.g. IP packet including MAC addresses and type)
+ * @return ERR_OK if the packet could be sent
+ *         an err_t value if the packet couldn't be sent
+ */
+static err_t
+low_level_output(struct netif *netif, struct pbuf *p)
+{
+    struct tapif *tapif = (struct tapif *)netif->state;
+    static u8_t buf[TAPIF_MAX_FRAME];
+    struct iovec iov[TAPIF_TX_SEGMENTS];
+    struct pbuf *q;
+    int n = 0;
+    ssize_t ret;
+
+#if ETH_PAD_SIZE
+    pbuf_header(p, -ETH_PAD_SIZE); /* drop the padding word */
+#endif
+
+    for(q = p; (q != NULL) && (n < TAPIF_TX_SEGMENTS); q = q->next)
+    {
+        iov[n].iov_base = q->payload;
+        iov[n].iov_len = q->len;
+        n++;
+    }
+
+    if(q != NULL)
+    {
+        /* Chain too long, copy it */
+        iov[0].iov_base = buf;
+        iov[0].iov_len = pbuf_copy_partial(p, buf, sizeof(buf), 0);
+        n = 1;
+    }
+
+    ret = writev(tapif->fd, iov, n);
+
+#if ETH_PAD_SIZE
+    pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
+#endif
+
+    if(ret < 0)
+    {
+        LINK_STATS_INC(link.drop);
+        return ERR_IF;
+    }
+
+    LINK_STATS_INC(link.xmit);
+
+    return ERR_OK;
+}
+
+/**
+ * Should be called at the beginning of the program to set up the
+ * network interface. Opens the TAP device named by tapif_name and starts
+ * the tapif task and the peripheral thread.
+ *
+ * This function should be passed as a parameter to netif_add().
+ *
+ * @param netif the lwip network interface structure for this tapif
+ * @return ERR_OK if the interface is initialized
+ *         ERR_MEM if private data couldn't be allocated
+ *         ERR_IF if the TAP device couldn't be opened
+ */
+err_t
+tapif_init(struct netif *netif)
+{
+    struct tapif *tapif;
+    struct ifreq ifr;
+
+    LWIP_ASSERT("netif != NULL", (netif != NULL));
+
+    tapif = mem_malloc(sizeof(struct tapif));
+    if (tapif == NULL)
+    {
+        LWIP_DEBUGF(NETIF_DEBUG, ("tapif_init: out of memory\n"));
+        return ERR_MEM;
+    }
+
+    tapif->fd = open(DEVTAP, O_RDWR);
+    if(tapif->fd == -1)
+    {
+        perror("tapif_init: open");
+        mem_free(tapif);
+        return ERR_IF;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    strncpy(ifr.ifr_name, tapif_name, IFNAMSIZ - 1);
+    if(ioctl(tapif->fd, TUNSETIFF, (void *)&ifr) < 0)
+    {
+        perror("tapif_init: TUNSETIFF");
+        close(tapif->fd);
+        mem_free(tapif);
+        return ERR_IF;
+    }
+
+    /* The tapif task reads until the device is empty */
+    fcntl(tapif->fd, F_SETFL, O_NONBLOCK);
+
+    /* set MAC hardware address */
+    netif->hwaddr_len = ETHARP_HWADDR_LEN;
+    memcpy(netif->hwaddr, my_mac_addr, ETHARP_HWADDR_LEN);
+
+    /* maximum transfer unit */
+    netif->mtu = 1500;
+
+    /* device capabilities, the TAP device passes every multicast frame */
+    netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP;
+#if LWIP_IGMP
+    netif->flags |= NETIF_FLAG_IGMP;
+#endif
+
+    NETIF_INIT_SNMP(netif, snmp_ifType_ethernet_csmacd, 100000000);
+
+    netif->state = tapif;
+    netif->name[0] = IFNAME0;
+    netif->name[1] = IFNAME1;
+    netif->output = etharp_output;
+    netif->linkoutput = low_level_output;
+
+    tapif->netif = netif;
+    tapif->rx_sem = xSemaphoreCreateBinary();
+    sem_init(&tapif->rearm, 0, 0);
+
+    tapif_irq = tapif;
+    vPortSetInterruptHandler(TAPIF_INTERRUPT, tapif_irq_handler);
+
+    xTaskCreate(tapif_task, "tapif", TAPIF_TASK_STACKSIZE, tapif, TAPIF_TASK_PRIORITY, NULL);
+    xPortStartPeripheralThread(tapif_thread, tapif);
+
+    return ERR_OK;
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Serve files from a FAT formatted SD card over HTTP with lwIP
+ *           under FreeRTOS. The file data is streamed from the card to TCP
+ *           by tcp_sendfile() without being copied into the lwIP heap.
+ *
+ *           The server listens to port 80, IP address is configured
+ *           statically to 192.168.1.2 or assigned by a DHCP server.
+ *           Fetch a file with e.g. "wget http://192.168.1.2/log/data.txt".
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Hardware and starter kit includes. */
+#include "NUC472_442.h"
+
+#include "lwip/netif.h"
+#include "lwip/tcpip.h"
+#include "ethernetif.h"
+#include "ff.h"
+#include "fileserver.h"
+
+#define mainWEB_TASK_PRIORITY              ( tskIDLE_PRIORITY + 3UL )
+
+//#define USE_DHCP
+
+#ifdef USE_DHCP
+#include "lwip/dhcp.h"
+#endif
+/*-----------------------------------------------------------*/
+
+/*
+ * Set up the hardware ready to run this demo.
+ */
+static void prvSetupHardware( void );
+static void vWebTask( void *pvParameters );
+/*-----------------------------------------------------------*/
+
+unsigned char my_mac_addr[6] = {0x00, 0x00, 0x00, 0x55, 0x66, 0x77};
+struct netif netif;
+FATFS FatFs;
+
+int main(void)
+{
+    /* Configure the hardware ready to run the test. */
+    prvSetupHardware();
+
+    xTaskCreate( vWebTask, "Web", TCPIP_THREAD_STACKSIZE, NULL, mainWEB_TASK_PRIORITY, NULL );
+
+    printf("FreeRTOS is starting ...\n");
+
+    /* Start the scheduler. */
+    vTaskStartScheduler();
+
+    /* If all is well, the scheduler will now be running, and the following line
+    will never be reached.  If the following line does execute, then there was
+    insufficient FreeRTOS heap memory available for the idle and/or timer tasks
+    to be created.  See the memory management section on the FreeRTOS web site
+    for more details. */
+    for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupHardware( void )
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable External XTAL (4~24 MHz) */
+    CLK_EnableXtalRC(CLK_PWRCTL_HXTEN_Msk);
+
+    /* Waiting for 12MHz clock ready */
+    CLK_WaitClockReady( CLK_STATUS_HXTSTB_Msk);
+
+    /* Switch HCLK clock source to HXT */
+    CLK_SetHCLK(CLK_CLKSEL0_HCLKSEL_HXT,CLK_CLKDIV0_HCLK(1));
+
+    /* Set PLL to power down mode and PLL_STB bit in CLKSTATUS register will be cleared by hardware.*/
+    CLK->PLLCTL |= CLK_PLLCTL_PD_Msk;
+
+    /* Set PLL frequency */
+    CLK->PLLCTL = CLK_PLLCTL_84MHz_HXT;
+
+    /* Waiting for clock ready */
+    CLK_WaitClockReady(CLK_STATUS_PLLSTB_Msk);
+
+    /* Switch HCLK clock source to PLL */
+    CLK_SetHCLK(CLK_CLKSEL0_HCLKSEL_PLL,CLK_CLKDIV0_HCLK(1));
+
+    /* Enable IP clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(EMAC_MODULE);
+    CLK_EnableModuleClock(SDH_MODULE);
+
+    /* Select IP clock source */
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL1_UARTSEL_HXT, CLK_CLKDIV0_UART(1));
+
+    /* SD clock from XTL(12MHz) */
+    CLK->CLKSEL0 = (CLK->CLKSEL0 & ~(CLK_CLKSEL0_SDHSEL_Msk));
+
+    // Configure MDC clock rate to HCLK / (127 + 1) = 656 kHz if system is running at 84 MHz
+    CLK_SetModuleClock(EMAC_MODULE, 0, CLK_CLKDIV3_EMAC(127));
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock. */
+    SystemCoreClockUpdate();
+
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                                                                 */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Set GPG multi-function pins for UART0 RXD and TXD */
+    SYS->GPG_MFPL |= SYS_GPG_MFPL_PG1MFP_UART0_RXD | SYS_GPG_MFPL_PG2MFP_UART0_TXD ;
+    // Configure RMII pins
+    SYS->GPC_MFPL |= SYS_GPC_MFPL_PC0MFP_EMAC_REFCLK |
+                     SYS_GPC_MFPL_PC1MFP_EMAC_MII_RXERR |
+                     SYS_GPC_MFPL_PC2MFP_EMAC_MII_RXDV |
+                     SYS_GPC_MFPL_PC3MFP_EMAC_MII_RXD1 |
+                     SYS_GPC_MFPL_PC4MFP_EMAC_MII_RXD0 |
+                     SYS_GPC_MFPL_PC6MFP_EMAC_MII_TXD0 |
+                     SYS_GPC_MFPL_PC7MFP_EMAC_MII_TXD1;
+
+
+    SYS->GPC_MFPH |= SYS_GPC_MFPH_PC8MFP_EMAC_MII_TXEN;
+    // Enable high slew rate on all RMII pins
+    PC->SLEWCTL |= 0x1DF;
+
+    // Configure MDC, MDIO at PB14 & PB15
+    SYS->GPB_MFPH |= SYS_GPB_MFPH_PB14MFP_EMAC_MII_MDC | SYS_GPB_MFPH_PB15MFP_EMAC_MII_MDIO;
+
+    /* Configure SD0 pins */
+    SYS->GPF_MFPL = (SYS->GPF_MFPL & ~(SYS_GPF_MFPL_PF2MFP_Msk)) | (0x4 << SYS_GPF_MFPL_PF2MFP_Pos); // SD0_DAT3: GPF_2
+    SYS->GPF_MFPL = (SYS->GPF_MFPL & ~(SYS_GPF_MFPL_PF3MFP_Msk)) | (0x4 << SYS_GPF_MFPL_PF3MFP_Pos); // SD0_DAT2: GPF_3
+    SYS->GPF_MFPL = (SYS->GPF_MFPL & ~(SYS_GPF_MFPL_PF4MFP_Msk)) | (0x4 << SYS_GPF_MFPL_PF4MFP_Pos); // SD0_DAT1: GPF_4
+    SYS->GPF_MFPL = (SYS->GPF_MFPL & ~(SYS_GPF_MFPL_PF5MFP_Msk)) | (0x4 << SYS_GPF_MFPL_PF5MFP_Pos); // SD0_DAT0: GPF_5
+    SYS->GPF_MFPL = (SYS->GPF_MFPL & ~(SYS_GPF_MFPL_PF6MFP_Msk)) | (0x4 << SYS_GPF_MFPL_PF6MFP_Pos); // SD0_CDn : GPF_6
+    SYS->GPF_MFPL = (SYS->GPF_MFPL & ~(SYS_GPF_MFPL_PF7MFP_Msk)) | (0x4 << SYS_GPF_MFPL_PF7MFP_Pos); // SD0_CMD : GPF_7
+    SYS->GPF_MFPH = (SYS->GPF_MFPH & ~(SYS_GPF_MFPH_PF8MFP_Msk)) | (0x4 << SYS_GPF_MFPH_PF8MFP_Pos); // SD0_CLK : GPF_8
+
+    /* Lock protected registers */
+    SYS_LockReg();
+
+    /* Init UART to 115200-8n1 for print message */
+    UART_Open(UART0, 115200);
+}
+
+/*---------------------------------------------------------*/
+/* User Provided RTC Function for FatFs module             */
+/*---------------------------------------------------------*/
+unsigned long get_fattime (void)
+{
+    return 0;
+}
+
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+    taskDISABLE_INTERRUPTS();
+    for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationStackOverflowHook( xTaskHandle pxTask, signed char *pcTaskName )
+{
+    ( void ) pcTaskName;
+    ( void ) pxTask;
+
+    taskDISABLE_INTERRUPTS();
+    for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+static void vWebTask( void *pvParameters )
+{
+    struct ip_addr ipaddr;
+    struct ip_addr netmask;
+    struct ip_addr gw;
+    TCHAR sd_path[] = { '0', ':', 0 }; /* SD drive started from 0 */
+
+    if(f_mount(&FatFs, sd_path, 1) != FR_OK)
+    {
+        printf("Cannot mount SD card\n");
+        vTaskSuspend( NULL );
+    }
+
+    IP4_ADDR(&gw, 192,168,1,1);
+    IP4_ADDR(&ipaddr, 192,168,1,2);
+    IP4_ADDR(&netmask, 255,255,255,0);
+
+    printf("Local IP:192.168.1.2\n");
+
+    tcpip_init(NULL, NULL);
+
+    netif_add(&netif, &ipaddr, &netmask, &gw, NULL, ethernetif_init, tcpip_input);
+
+    netif_set_default(&netif);
+#ifdef USE_DHCP
+    dhcp_start(&netif);
+#else
+    netif_set_up(&netif);
+#endif
+    NVIC_SetPriority(EMAC_TX_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1);
+    NVIC_EnableIRQ(EMAC_TX_IRQn);
+    NVIC_SetPriority(EMAC_RX_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1);
+    NVIC_EnableIRQ(EMAC_RX_IRQn);
+
+    /* The server uses the raw API, it has to be started in the tcpip thread */
+    tcpip_callback(fileserver_init, NULL);
+
+    vTaskSuspend( NULL );
+
+}
@@ -0,0 +1,276 @@
+/**************************************************************************//**
+ * @file     tcp_sendfile.c
+ * @version  V1.00
+ * @brief    Stream a FatFs file to a lwIP raw API TCP connection without
+ *           copying the file data into the lwIP heap.
+ *
+ *           Each transfer owns a small ring of sector aligned buffers.
+ *           f_read() fills a buffer with whole sectors (the SD driver DMAs
+ *           them straight in), and the buffer is handed to tcp_write()
+ *           without TCP_WRITE_FLAG_COPY, so lwIP only references it. The
+ *           buffer is refilled once the peer has acknowledged all of its
+ *           bytes. tcp_sndbuf() and the segment queue length throttle how
+ *           much is enqueued, and the sent/poll callbacks resume the
+ *           transfer.
+ *
+ *           All functions run in the lwIP core context (raw API callbacks),
+ *           so FatFs must not be used from another task at the same time.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include "lwip/opt.h"
+#include "lwip/tcp.h"
+#include "tcp_sendfile.h"
+
+/* Poll interval (in TCP coarse timer ticks of 500 ms) to retry after ERR_MEM */
+#define SENDFILE_POLL_INTERVAL  2
+
+struct sendfile_state
+{
+    /* First member, so every buffer is word aligned for the SD DMA */
+    u8_t buf[SENDFILE_NUM_BUFS][SENDFILE_BUF_SIZE];
+    struct tcp_pcb *pcb;
+    FIL *fp;
+    u32_t remain;           /* File bytes not yet read */
+    u32_t skip;             /* Bytes queued by the caller before us */
+    tcp_sendfile_fn done;
+    void *arg;
+    u16_t len[SENDFILE_NUM_BUFS];
+    u8_t head;              /* Next buffer to fill */
+    u8_t tail;              /* Oldest buffer waiting for ACK */
+    u8_t send;              /* Buffer being handed to tcp_write() */
+    u8_t used;              /* Number of filled buffers */
+    u8_t unsent;            /* Filled buffers not completely enqueued */
+    u16_t send_off;         /* Bytes of buf[send] already enqueued */
+    u16_t ack_off;          /* Bytes of buf[tail] already acknowledged */
+    u8_t inuse;
+};
+
+static struct sendfile_state sendfile_states[SENDFILE_MAX_STREAMS];
+
+/*-----------------------------------------------------------------------------------*/
+/* Returns ERR_ABRT if the pcb has been aborted, here or by the done callback */
+static err_t
+sendfile_finish(struct sendfile_state *s, struct tcp_pcb *pcb, err_t err)
+{
+    tcp_sendfile_fn done = s->done;
+    void *arg = s->arg;
+    err_t ret = ERR_OK;
+
+    if(pcb != NULL)
+    {
+        tcp_arg(pcb, arg);
+        tcp_sent(pcb, NULL);
+        tcp_poll(pcb, NULL, 0);
+        tcp_err(pcb, NULL);
+
+        /* Unacknowledged segments still point into s->buf. Abort, so that lwIP
+           drops them before the buffers can be reused by another transfer. */
+        if(err != ERR_OK)
+        {
+            tcp_abort(pcb);
+            pcb = NULL;
+            ret = ERR_ABRT;
+        }
+    }
+    s->inuse = 0;
+
+    if((done != NULL) && (done(arg, pcb, err) == ERR_ABRT))
+    {
+        ret = ERR_ABRT;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Refill free buffers from the file and enqueue as much as the send window allows */
+static err_t
+sendfile_pump(struct sendfile_state *s)
+{
+    struct tcp_pcb *pcb = s->pcb;
+    UINT br;
+    u16_t n;
+    u8_t flags;
+    err_t err;
+
+    while((s->used < SENDFILE_NUM_BUFS) && (s->remain > 0))
+    {
+        n = (s->remain > SENDFILE_BUF_SIZE) ? SENDFILE_BUF_SIZE : (u16_t)s->remain;
+        if((f_read(s->fp, s->buf[s->head], n, &br) != FR_OK) || (br == 0))
+        {
+            return ERR_VAL;
+        }
+        s->len[s->head] = (u16_t)br;
+        s->remain -= br;
+        s->head = (s->head + 1) % SENDFILE_NUM_BUFS;
+        s->used++;
+        s->unsent++;
+    }
+
+    while(s->unsent > 0)
+    {
+        n = s->len[s->send] - s->send_off;
+        if(n > tcp_sndbuf(pcb))
+        {
+            n = tcp_sndbuf(pcb);
+        }
+        if((n == 0) || (tcp_sndqueuelen(pcb) >= TCP_SND_QUEUELEN - 1))
+        {
+            break;
+        }
+
+        flags = 0;
+        if((s->send_off + n < s->len[s->send]) || (s->unsent > 1) || (s->remain > 0))
+        {
+            flags |= TCP_WRITE_FLAG_MORE;
+        }
+
+        /* No TCP_WRITE_FLAG_COPY: lwIP references the buffer until ACKed */
+        err = tcp_write(pcb, &s->buf[s->send][s->send_off], n, flags);
+        if(err == ERR_MEM)
+        {
+            /* Out of segments; sent or poll callback will retry */
+            break;
+        }
+        if(err != ERR_OK)
+        {
+            return err;
+        }
+
+        s->send_off += n;
+        if(s->send_off == s->len[s->send])
+        {
+            s->send_off = 0;
+            s->send = (s->send + 1) % SENDFILE_NUM_BUFS;
+            s->unsent--;
+        }
+    }
+
+    return tcp_output(pcb);
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+sendfile_resume(struct sendfile_state *s)
+{
+    err_t err;
+
+    if((s->remain == 0) && (s->used == 0))
+    {
+        return sendfile_finish(s, s->pcb, ERR_OK);
+    }
+
+    err = sendfile_pump(s);
+    if(err != ERR_OK)
+    {
+        return sendfile_finish(s, s->pcb, err);
+    }
+
+    return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+sendfile_sent(void *arg, struct tcp_pcb *pcb, u16_t len)
+{
+    struct sendfile_state *s = (struct sendfile_state *)arg;
+    u16_t n;
+
+    LWIP_UNUSED_ARG(pcb);
+
+    /* Acknowledgements for data the caller queued before the file */
+    n = (len > s->skip) ? (u16_t)s->skip : len;
+    s->skip -= n;
+    len -= n;
+
+    /* Release fully acknowledged buffers */
+    while((len > 0) && (s->used > 0))
+    {
+        n = s->len[s->tail] - s->ack_off;
+        if(n > len)
+        {
+            n = len;
+        }
+        s->ack_off += n;
+        len -= n;
+        if(s->ack_off == s->len[s->tail])
+        {
+            s->ack_off = 0;
+            s->tail = (s->tail + 1) % SENDFILE_NUM_BUFS;
+            s->used--;
+        }
+    }
+
+    return sendfile_resume(s);
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+sendfile_poll(void *arg, struct tcp_pcb *pcb)
+{
+    LWIP_UNUSED_ARG(pcb);
+
+    return sendfile_resume((struct sendfile_state *)arg);
+}
+
+/*-----------------------------------------------------------------------------------*/
+static void
+sendfile_err(void *arg, err_t err)
+{
+    /* The pcb has already been freed */
+    sendfile_finish((struct sendfile_state *)arg, NULL, err);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/**
+  * @brief  Send len bytes of an open file, starting at its current position
+  * @param  pcb: connection in ESTABLISHED state
+  * @param  fp: open file object, must stay valid until done is called
+  * @param  len: number of bytes to send
+  * @param  done: completion callback, see tcp_sendfile_fn
+  * @param  arg: argument for done, restored as the pcb argument on completion
+  * @retval ERR_OK if the transfer was started, ERR_ABRT if it was started
+  *         and pcb has already been aborted, ERR_MEM if all streams are busy
+  * @details While the transfer is in progress it owns the sent, poll and err
+  *          callbacks and the argument of the pcb. They are cleared again
+  *          before done is called. done may be called before this function
+  *          returns. Unless ERR_MEM is returned, done is always called.
+  */
+err_t
+tcp_sendfile(struct tcp_pcb *pcb, FIL *fp, u32_t len, tcp_sendfile_fn done, void *arg)
+{
+    struct sendfile_state *s = NULL;
+    int i;
+
+    for(i = 0; i < SENDFILE_MAX_STREAMS; i++)
+    {
+        if(sendfile_states[i].inuse == 0)
+        {
+            s = &sendfile_states[i];
+            break;
+        }
+    }
+    if(s == NULL)
+    {
+        return ERR_MEM;
+    }
+
+    s->inuse = 1;
+    s->pcb = pcb;
+    s->fp = fp;
+    s->remain = len;
+    s->skip = pcb->snd_lbb - pcb->lastack;
+    s->done = done;
+    s->arg = arg;
+    s->head = s->tail = s->send = s->used = s->unsent = 0;
+    s->send_off = s->ack_off = 0;
+
+    tcp_arg(pcb, s);
+    tcp_sent(pcb, sendfile_sent);
+    tcp_poll(pcb, sendfile_poll, SENDFILE_POLL_INTERVAL);
+    tcp_err(pcb, sendfile_err);
+
+    return sendfile_resume(s);
+}
@@ -0,0 +1,47 @@
+/**************************************************************************//**
+ * @file     tcp_sendfile.h
+ * @version  V1.00
+ * @brief    Stream a FatFs file to a lwIP raw API TCP connection without
+ *           copying the file data into the lwIP heap.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __TCP_SENDFILE_H__
+#define __TCP_SENDFILE_H__
+
+#include "lwip/tcp.h"
+#include "ff.h"
+
+/** Number of transfers that can be in progress at the same time */
+#ifndef SENDFILE_MAX_STREAMS
+#define SENDFILE_MAX_STREAMS    2
+#endif
+
+/** Number of read buffers per transfer. A buffer is refilled from the file
+    once all of its bytes have been acknowledged by the peer. */
+#ifndef SENDFILE_NUM_BUFS
+#define SENDFILE_NUM_BUFS       4
+#endif
+
+/** Size of each read buffer. Must be a multiple of the sector size so that
+    f_read() transfers whole sectors straight into the buffer. */
+#ifndef SENDFILE_BUF_SIZE
+#define SENDFILE_BUF_SIZE       (2 * _MAX_SS)
+#endif
+
+/**
+  * @brief  Called once a transfer has finished
+  * @param  arg: the argument given to tcp_sendfile()
+  * @param  pcb: the connection, or NULL if it has been aborted or freed
+  * @param  err: ERR_OK when every byte has been acknowledged,
+  *              ERR_VAL on a file read error, otherwise the lwIP error.
+  *              On an error the connection has been aborted, because lwIP
+  *              may still hold references to the file buffers.
+  * @retval ERR_ABRT if the callback aborted pcb, otherwise ERR_OK
+  */
+typedef err_t (*tcp_sendfile_fn)(void *arg, struct tcp_pcb *pcb, err_t err);
+
+err_t tcp_sendfile(struct tcp_pcb *pcb, FIL *fp, u32_t len, tcp_sendfile_fn done, void *arg);
+
+#endif /* __TCP_SENDFILE_H__ */
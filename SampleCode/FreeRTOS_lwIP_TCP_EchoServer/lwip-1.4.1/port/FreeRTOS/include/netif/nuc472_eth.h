@@ -94,6 +94,10 @@
 
 #define CONFIG_PHY_ADDR     1
 
+// Number of multicast groups tracked by the multicast filter. The first 12
+// go to CAM entry 1~12, the rest are filtered by software in Rx interrupt.
+#define ETH_MCAST_MAX       16
+
 
 // Frame Descriptor's Owner bit
 #define OWNERSHIP_EMAC 0x80000000  // 1 = EMAC
@@ -144,8 +148,21 @@ void ETH_setinc(void);
 
 #endif
 
+// Multicast filter statistics
+struct eth_mcast_stats
+{
+    u32_t sw_drop;      // Multicast frames dropped by software, while CAM is full
+    u32_t table_full;   // Joins not tracked because multicast table is full
+    u16_t rx_missed;    // EMAC missed packet count (MPCNT)
+    u8_t groups;        // Multicast addresses in the filter
+    u8_t accept_all;    // 1 if EMAC accepts all multicast frames
+};
+
 extern void ETH_init(u8_t *mac_addr);
 extern u8_t *ETH_get_tx_buf(void);
 extern void ETH_trigger_tx(u16_t length, struct pbuf *p);
+extern s32_t ETH_add_mcast(u8_t *addr);
+extern void ETH_del_mcast(u8_t *addr);
+extern void ETH_get_mcast_stats(struct eth_mcast_stats *stats);
 
 #endif  /* _NUC472_ETH_ */
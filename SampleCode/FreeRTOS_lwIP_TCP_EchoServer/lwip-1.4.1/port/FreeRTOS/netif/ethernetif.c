@@ -51,6 +51,7 @@
 #include "lwip/sys.h"
 #include <lwip/stats.h>
 #include <lwip/snmp.h>
+#include "lwip/igmp.h"
 #include "netif/etharp.h"
 #include "netif/ppp_oe.h"
 #include "netif/nuc472_eth.h"
@@ -77,6 +78,32 @@ struct ethernetif
 };
 
 
+#if LWIP_IGMP
+/*
+ * lwIP IGMP callback. Map the IP group address to its Ethernet multicast
+ * address (01:00:5e + lower 23 bits) and update the EMAC receive filter.
+ */
+static err_t
+ethernetif_igmp_mac_filter(struct netif *netif, ip_addr_t *group, u8_t action)
+{
+    u8_t mac[6];
+    u32_t addr = ntohl(ip4_addr_get_u32(group));
+
+    mac[0] = 0x01;
+    mac[1] = 0x00;
+    mac[2] = 0x5e;
+    mac[3] = (addr >> 16) & 0x7f;
+    mac[4] = (addr >> 8) & 0xff;
+    mac[5] = addr & 0xff;
+
+    if(action == IGMP_ADD_MAC_FILTER)
+        return (ETH_add_mcast(mac) == 0) ? ERR_OK : ERR_MEM;
+
+    ETH_del_mcast(mac);
+    return ERR_OK;
+}
+#endif
+
 /**
  * In this function, the hardware should be initialized.
  * Called from ethernetif_init().
@@ -104,8 +131,9 @@ low_level_init(struct netif *netif)
 
     /* device capabilities */
     netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP;
-#ifdef LWIP_IGMP
+#if LWIP_IGMP
     netif->flags |= NETIF_FLAG_IGMP;
+    netif_set_igmp_mac_filter(netif, ethernetif_igmp_mac_filter);
 #endif
     // TODO: enable clock & configure GPIO function
     ETH_init(netif->hwaddr);
@@ -24,7 +24,9 @@
 #include "netif/nuc472_eth.h"
 #include "lwip/opt.h"
 #include "lwip/def.h"
+#include "lwip/sys.h"
 #include "arch/sys_arch.h"
+#include <string.h>
 
 #define ETH_TRIGGER_RX()    do{EMAC->RXST = 0;}while(0)
 #define ETH_TRIGGER_TX()    do{EMAC->TXST = 0;}while(0)
@@ -62,6 +64,21 @@ extern void ethernetif_loopback_input(struct pbuf *p);
 
 extern portBASE_TYPE xInsideISR;
 
+// CAM entry 0 holds our MAC address, and entry 13~15 are used by PAUSE control frame
+#define MCAST_CAM_FIRST     1
+#define MCAST_CAM_LAST      12
+
+struct mcast_entry
+{
+    u8_t addr[6];
+    u8_t ref;           // Number of groups mapped to this address, 0 if entry is free
+};
+
+static struct mcast_entry mcast_tbl[ETH_MCAST_MAX];
+static u8_t mcast_overflow;     // More addresses than CAM entries, filter the rest by software
+static u8_t mcast_untracked;    // Joins that did not fit in mcast_tbl, accept all multicast
+static struct eth_mcast_stats mcast_stats;
+
 static void mdio_write(u8_t addr, u8_t reg, u16_t val)
 {
 
@@ -201,6 +218,53 @@ static void init_rx_desc(void)
     return;
 }
 
+// Load the multicast table into CAM. Accept all multicast if it does not fit.
+static void mcast_update_cam(void)
+{
+    u32_t i, entry = MCAST_CAM_FIRST;
+    u32_t camen = EMAC->CAMEN & ~(((1 << (MCAST_CAM_LAST + 1)) - 1) & ~((1 << MCAST_CAM_FIRST) - 1));
+    u8_t *addr;
+
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref == 0)
+            continue;
+        if(entry > MCAST_CAM_LAST)
+            break;
+
+        addr = mcast_tbl[i].addr;
+        *(&EMAC->CAM0M + entry * 2) = (addr[0] << 24) | (addr[1] << 16) | (addr[2] << 8) | addr[3];
+        *(&EMAC->CAM0L + entry * 2) = (addr[4] << 24) | (addr[5] << 16);
+        camen |= (1 << entry);
+        entry++;
+    }
+    EMAC->CAMEN = camen;
+
+    mcast_overflow = (i < ETH_MCAST_MAX) ? 1 : 0;
+    if(mcast_overflow || mcast_untracked)
+        EMAC->CAMCTL |= EMAC_CAMCTL_AMP_Msk;
+    else
+        EMAC->CAMCTL &= ~EMAC_CAMCTL_AMP_Msk;
+}
+
+// Called in Rx interrupt. Drop multicast frames EMAC accepted only because CAM is full.
+static int mcast_accept(u8_t *buf)
+{
+    u32_t i;
+
+    // Unicast and broadcast frames are filtered by EMAC
+    if(!mcast_overflow || mcast_untracked || !(buf[0] & 1) || (buf[0] == 0xFF))
+        return(1);
+
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref && (memcmp(mcast_tbl[i].addr, buf, 6) == 0))
+            return(1);
+    }
+    mcast_stats.sw_drop++;
+    return(0);
+}
+
 static void set_mac_addr(u8_t *addr)
 {
 
@@ -212,8 +276,15 @@ static void set_mac_addr(u8_t *addr)
     EMAC->CAM0L = (addr[4] << 24) |
                   (addr[5] << 16);
 
+#if LWIP_IGMP
+    // Multicast addresses are added to CAM by ETH_add_mcast()
+    EMAC->CAMCTL = EMAC_CAMCTL_CMPEN_Msk | EMAC_CAMCTL_ABP_Msk;
+    EMAC->CAMEN = 1;    // Enable CAM entry 0
+    mcast_update_cam();
+#else
     EMAC->CAMCTL = EMAC_CAMCTL_CMPEN_Msk | EMAC_CAMCTL_AMP_Msk | EMAC_CAMCTL_ABP_Msk;
     EMAC->CAMEN = 1;    // Enable CAM entry 0
+#endif
 
 }
 
@@ -285,7 +356,8 @@ void EMAC_RX_IRQHandler(void)
                 cur_rx_desc_ptr->next = (struct eth_descriptor *)fin_tx_desc_ptr->backup2;
             }
 #endif
-            ethernetif_input(status & 0xFFFF, cur_rx_desc_ptr->buf, cur_rx_desc_ptr->status2, (u32_t)cur_rx_desc_ptr->next);
+            if(mcast_accept(cur_rx_desc_ptr->buf))
+                ethernetif_input(status & 0xFFFF, cur_rx_desc_ptr->buf, cur_rx_desc_ptr->status2, (u32_t)cur_rx_desc_ptr->next);
 
 
         }
@@ -370,6 +442,85 @@ void ETH_trigger_tx(u16_t length, struct pbuf *p)
 
 }
 
+/*
+ * Add a multicast MAC address to the receive filter. Addresses are reference
+ * counted since several IP groups map to the same MAC address.
+ * Returns 0 on success, -1 if the table is full. Multicast is then accepted
+ * unfiltered until the address is deleted again.
+ */
+s32_t ETH_add_mcast(u8_t *addr)
+{
+    s32_t i, free = -1;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref == 0)
+        {
+            if(free < 0)
+                free = i;
+        }
+        else if(memcmp(mcast_tbl[i].addr, addr, 6) == 0)
+        {
+            mcast_tbl[i].ref++;
+            SYS_ARCH_UNPROTECT(lev);
+            return(0);
+        }
+    }
+
+    if(free < 0)
+    {
+        mcast_stats.table_full++;
+        mcast_untracked++;
+    }
+    else
+    {
+        memcpy(mcast_tbl[free].addr, addr, 6);
+        mcast_tbl[free].ref = 1;
+    }
+    mcast_update_cam();
+    SYS_ARCH_UNPROTECT(lev);
+
+    return(free < 0 ? -1 : 0);
+}
+
+void ETH_del_mcast(u8_t *addr)
+{
+    u32_t i;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref && (memcmp(mcast_tbl[i].addr, addr, 6) == 0))
+        {
+            mcast_tbl[i].ref--;
+            break;
+        }
+    }
+    // Not in table, must be one of the joins that did not fit
+    if((i == ETH_MCAST_MAX) && mcast_untracked)
+        mcast_untracked--;
+    mcast_update_cam();
+    SYS_ARCH_UNPROTECT(lev);
+}
+
+void ETH_get_mcast_stats(struct eth_mcast_stats *stats)
+{
+    u32_t i;
+
+    *stats = mcast_stats;
+    stats->groups = 0;
+    for(i = 0; i < ETH_MCAST_MAX; i++)
+    {
+        if(mcast_tbl[i].ref)
+            stats->groups++;
+    }
+    stats->rx_missed = EMAC->MPCNT & EMAC_MPCNT_MPCNT_Msk;
+    stats->accept_all = (EMAC->CAMCTL & EMAC_CAMCTL_AMP_Msk) ? 1 : 0;
+}
+
 
 #ifdef TIME_STAMPING
 
@@ -92,6 +92,8 @@
 #if defined( __ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
 #include <stdint.h>
 extern uint32_t SystemCoreClock;
+extern void vRunTimeStatsInit( void );
+extern uint32_t ulRunTimeStatsGetCounter( void );
 #endif
 
 #define configUSE_PREEMPTION            1
@@ -101,7 +103,7 @@ extern uint32_t SystemCoreClock;
 #define configTICK_RATE_HZ              ( ( portTickType ) 1000 )
 #define configMAX_PRIORITIES            ( 5 )
 #define configMINIMAL_STACK_SIZE        ( ( unsigned short ) 120)
-#define configTOTAL_HEAP_SIZE           ( ( size_t ) (16 * 1024 ) )
+#define configTOTAL_HEAP_SIZE           ( ( size_t ) (32 * 1024 ) )    // Includes lwIP MEM_SIZE, see MEM_LIBC_MALLOC
 #define configMAX_TASK_NAME_LEN         ( 16 )
 #define configUSE_TRACE_FACILITY        1
 #define configUSE_16_BIT_TICKS          0
@@ -117,7 +119,7 @@ extern uint32_t SystemCoreClock;
 #define configUSE_MALLOC_FAILED_HOOK    1
 #define configUSE_APPLICATION_TASK_TAG  0
 #define configUSE_COUNTING_SEMAPHORES   1
-#define configGENERATE_RUN_TIME_STATS   0
+#define configGENERATE_RUN_TIME_STATS   1
 #define configUSE_QUEUE_SETS            1
 
 /* Co-routine definitions. */
@@ -139,6 +141,11 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend            1
 #define INCLUDE_vTaskDelayUntil         1
 #define INCLUDE_vTaskDelay              1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+
+/* Run time statistics clock, see run_time_stats.c */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    vRunTimeStatsInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()            ulRunTimeStatsGetCounter()
 
 /* Cortex-M specific definitions. */
 #ifdef __NVIC_PRIO_BITS
@@ -100,12 +100,31 @@ fs_free(struct fs_file *file)
     return;
 }
 
+/*-----------------------------------------------------------------------------------*/
+/* Look up "name" followed by "suffix" without building the full path. */
+static const struct fsdata_file *
+fs_find(const char *name, const char *suffix)
+{
+    const struct fsdata_file *f;
+    size_t len = strlen(name);
+
+    for(f = FS_ROOT; f != NULL; f = f->next)
+    {
+        if (!strncmp(name, (const char *)f->name, len) &&
+                !strcmp((const char *)f->name + len, suffix))
+        {
+            return f;
+        }
+    }
+    return NULL;
+}
+
 /*-----------------------------------------------------------------------------------*/
 struct fs_file *
-fs_open(const char *name)
+fs_open_gzip(const char *name, int accept_gzip)
 {
     struct fs_file *file;
-    const struct fsdata_file *f;
+    const struct fsdata_file *f = NULL;
 
     file = fs_malloc();
     if(file == NULL)
@@ -122,29 +141,48 @@ fs_open(const char *name)
     file->is_custom_file = 0;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
-    for(f = FS_ROOT; f != NULL; f = f->next)
+    /* Prefer the precompressed variant if the client can decode it. Without
+       a plain copy (makefsdata -gzonly) the variant is the only choice. */
+    if(accept_gzip)
     {
-        if (!strcmp(name, (char *)f->name))
-        {
-            file->data = (const char *)f->data;
-            file->len = f->len;
-            file->index = f->len;
-            file->pextension = NULL;
-            file->http_header_included = f->http_header_included;
+        f = fs_find(name, FS_GZIP_SUFFIX);
+    }
+    if(f == NULL)
+    {
+        f = fs_find(name, "");
+    }
+    if(f == NULL)
+    {
+        f = fs_find(name, FS_GZIP_SUFFIX);
+    }
+
+    if(f != NULL)
+    {
+        file->data = (const char *)f->data;
+        file->len = f->len;
+        file->index = f->len;
+        file->pextension = NULL;
+        file->http_header_included = f->http_header_included;
 #if HTTPD_PRECALCULATED_CHECKSUM
-            file->chksum_count = f->chksum_count;
-            file->chksum = f->chksum;
+        file->chksum_count = f->chksum_count;
+        file->chksum = f->chksum;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 #if LWIP_HTTPD_FILE_STATE
-            file->state = fs_state_init(file, name);
+        file->state = fs_state_init(file, name);
 #endif /* #if LWIP_HTTPD_FILE_STATE */
-            return file;
-        }
+        return file;
     }
     fs_free(file);
     return NULL;
 }
 
+/*-----------------------------------------------------------------------------------*/
+struct fs_file *
+fs_open(const char *name)
+{
+    return fs_open_gzip(name, 0);
+}
+
 /*-----------------------------------------------------------------------------------*/
 void
 fs_close(struct fs_file *file)
@@ -59,6 +59,9 @@
 #define HTTPD_PRECALCULATED_CHECKSUM  0
 #endif
 
+/** Name suffix of the gzip encoded variants generated by makefsdata. */
+#define FS_GZIP_SUFFIX                ".gz"
+
 #if HTTPD_PRECALCULATED_CHECKSUM
 struct fsdata_chksum
 {
@@ -88,6 +91,8 @@ struct fs_file
 };
 
 struct fs_file *fs_open(const char *name);
+/** Open a file, preferring its gzip encoded variant if accept_gzip is set. */
+struct fs_file *fs_open_gzip(const char *name, int accept_gzip);
 void fs_close(struct fs_file *file);
 int fs_read(struct fs_file *file, char *buffer, int count);
 int fs_bytes_left(struct fs_file *file);
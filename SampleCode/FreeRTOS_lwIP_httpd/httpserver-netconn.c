@@ -4,15 +4,19 @@
 #include "lwip/opt.h"
 #include "lwip/arch.h"
 #include "lwip/api.h"
+#include "lwip/mem.h"
 #include "fs.h"
 #include "string.h"
 #include "httpserver-netconn.h"
+#include "run_time_stats.h"
 
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 #define WEBSERVER_THREAD_PRIO    ( tskIDLE_PRIORITY + 2UL )
-#define WEBSERVER_THREAD_STACKSIZE  200
+#define WEBSERVER_THREAD_STACKSIZE  400
+#define HTTP_MAX_NAME_LEN        64
+#define HTTP_STATS_REPORT_SIZE   4096
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 u32_t nPageHits = 0;
@@ -21,6 +25,62 @@ u32_t nPageHits = 0;
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
+/**
+  * @brief  Check whether the request headers allow a gzip encoded response
+  * @param  buf: request data
+  * @param  buflen: length of the request data
+  * @retval 1 if "Accept-Encoding:" lists gzip, 0 otherwise
+  */
+static int http_accept_gzip(const char *buf, u16_t buflen)
+{
+    static const char hdr[] = "\r\nAccept-Encoding:";
+    const char *end = buf + buflen;
+    const char *p;
+
+    for(p = buf; p + sizeof(hdr) - 1 <= end; p++)
+    {
+        if(strncmp(p, hdr, sizeof(hdr) - 1) == 0)
+        {
+            /* Scan the header value up to the end of line */
+            for(p += sizeof(hdr) - 1; p + 4 <= end && *p != '\r'; p++)
+            {
+                if(strncmp(p, "gzip", 4) == 0)
+                    return 1;
+            }
+            return 0;
+        }
+    }
+    return 0;
+}
+
+/**
+  * @brief  Send the run time statistics report as JSON
+  * @param  conn: pointer on connection structure
+  * @retval None
+  */
+static void http_server_send_stats(struct netconn *conn)
+{
+    static const char hdr[] = "HTTP/1.0 200 OK\r\n"
+                              "Content-Type: application/json\r\n"
+                              "Cache-Control: no-cache\r\n\r\n";
+    static const char busy[] = "HTTP/1.0 503 Service Unavailable\r\n\r\n";
+    char *report;
+    size_t len;
+
+    report = mem_malloc(HTTP_STATS_REPORT_SIZE);
+    if(report == NULL)
+    {
+        netconn_write(conn, busy, sizeof(busy) - 1, NETCONN_NOCOPY);
+        return;
+    }
+
+    len = xRunTimeStatsReport(report, HTTP_STATS_REPORT_SIZE);
+    netconn_write(conn, hdr, sizeof(hdr) - 1, NETCONN_NOCOPY);
+    /* The report is freed before the data is acknowledged, so copy it */
+    netconn_write(conn, report, len, NETCONN_COPY);
+    mem_free(report);
+}
+
 /**
   * @brief serve tcp connection
   * @param conn: pointer on connection structure
@@ -32,6 +92,8 @@ void http_server_serve(struct netconn *conn)
     char* buf;
     u16_t buflen;
     struct fs_file * file;
+    char name[HTTP_MAX_NAME_LEN];
+    int i;
 
     /* Read the data from the port, blocking if nothing yet there.
      We assume the request (the part we care about) is in one netbuf */
@@ -47,27 +109,38 @@ void http_server_serve(struct netconn *conn)
             there are other formats for GET, and we're keeping it very simple )*/
             if ((buflen >=5) && (strncmp(buf, "GET /", 5) == 0))
             {
-                /* Check if request to get m4.jpg */
-                if (strncmp((char const *)buf,"GET /img/m4.jpg", 15) == 0)
+                /* Pick out the requested path */
+                for(i = 0; (i + 4 < buflen) && (i < HTTP_MAX_NAME_LEN - 1); i++)
                 {
-                    /* Check if request to get M4 banner */
-                    file = fs_open("/img/m4.jpg");
-                    netconn_write(conn, (const unsigned char*)(file->data), (size_t)file->len, NETCONN_NOCOPY);
-                    fs_close(file);
+                    if((buf[i + 4] == ' ') || (buf[i + 4] == '?') ||
+                            (buf[i + 4] == '\r') || (buf[i + 4] == '\n'))
+                        break;
+                    name[i] = buf[i + 4];
                 }
-                else if((strncmp(buf, "GET /index.html", 15) == 0)||(strncmp(buf, "GET / ", 6) == 0))
+                name[i] = 0;
+
+                /* Load index page for the root */
+                if(strcmp(name, "/") == 0)
+                    strcpy(name, "/index.html");
+
+                /* Task load, stack, heap and lwIP counters */
+                if(strcmp(name, "/stats") == 0)
                 {
-                    /* Load index page */
-                    file = fs_open("/index.html");
-                    netconn_write(conn, (const unsigned char*)(file->data), (size_t)file->len, NETCONN_NOCOPY);
-                    fs_close(file);
+                    http_server_send_stats(conn);
                 }
                 else
                 {
-                    /* Load Error page */
-                    file = fs_open("/404.html");
-                    netconn_write(conn, (const unsigned char*)(file->data), (size_t)file->len, NETCONN_NOCOPY);
-                    fs_close(file);
+                    /* Send the precompressed copy if the browser accepts it,
+                       otherwise the Error page */
+                    file = fs_open_gzip(name, http_accept_gzip(buf, buflen));
+                    if(file == NULL)
+                        file = fs_open("/404.html");
+
+                    if(file != NULL)
+                    {
+                        netconn_write(conn, (const unsigned char*)(file->data), (size_t)file->len, NETCONN_NOCOPY);
+                        fs_close(file);
+                    }
                 }
             }
         }
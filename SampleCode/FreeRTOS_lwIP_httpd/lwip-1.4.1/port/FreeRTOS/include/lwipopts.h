@@ -83,6 +83,21 @@
  */
 #define MEM_SIZE                        (16 * 1024)
 
+/**
+ * MEM_LIBC_MALLOC==1: Allocate from the FreeRTOS heap (heap_tlsf.c) instead of
+ * the lwIP heap. Allocation time does not depend on fragmentation, and lwIP
+ * shares the memory with the kernel, so MEM_SIZE is unused and is part of
+ * configTOTAL_HEAP_SIZE instead. mem_malloc() must not be called from an ISR.
+ */
+#define MEM_LIBC_MALLOC                 1
+#if MEM_LIBC_MALLOC
+#include <stddef.h>
+void *pvPortMalloc(size_t xWantedSize);
+void vPortFree(void *pv);
+#define mem_malloc                      pvPortMalloc
+#define mem_free                        vPortFree
+#endif
+
 /*
    ------------------------------------------------
    ---------- Internal Memory Pool Sizes ----------
@@ -401,8 +416,14 @@
 */
 /**
  * LWIP_STATS==1: Enable statistics collection in lwip_stats.
+ * The counters are reported by GET /stats, see run_time_stats.c.
+ */
+#define LWIP_STATS                      1
+
+/**
+ * LWIP_STATS_LARGE==1: Use 32 bits counters.
  */
-#define LWIP_STATS                      0
+#define LWIP_STATS_LARGE                1
 /*
    ---------------------------------
    ---------- PPP options ----------
@@ -268,10 +268,14 @@ static void prvSetupHardware( void )
     /* Enable IP clock */
     CLK_EnableModuleClock(UART0_MODULE);
     CLK_EnableModuleClock(EMAC_MODULE);
+    CLK_EnableModuleClock(TMR1_MODULE);
 
     /* Select IP clock source */
     CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL1_UARTSEL_HXT, CLK_CLKDIV0_UART(1));
 
+    /* TIMER1 is the run time statistics clock, see run_time_stats.c */
+    CLK_SetModuleClock(TMR1_MODULE, CLK_CLKSEL1_TMR1SEL_HXT, 0);
+
     // Configure MDC clock rate to HCLK / (127 + 1) = 656 kHz if system is running at 84 MHz
     CLK_SetModuleClock(EMAC_MODULE, 0, CLK_CLKDIV3_EMAC(127));
 
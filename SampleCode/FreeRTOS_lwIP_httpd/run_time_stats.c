@@ -0,0 +1,332 @@
+/**************************************************************************//**
+ * @file     run_time_stats.c
+ * @version  V1.00
+ * @brief    FreeRTOS run time statistics clock and system status report,
+ *           see run_time_stats.h.
+ *
+ *           The TIMER counter is only 24 bits wide. It is extended to the
+ *           32-bit run time counter each time the kernel reads it, and by
+ *           the compare match interrupt once per counter period, so the
+ *           counter never wraps unnoticed when no task switch happens.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdarg.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "NUC472_442.h"
+#include "lwip/opt.h"
+#include "lwip/stats.h"
+#include "lwip/memp.h"
+#include "run_time_stats.h"
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/* Timer used as run time counter */
+#ifndef configRUN_TIME_STATS_TIMER
+#define configRUN_TIME_STATS_TIMER          TIMER1
+#define configRUN_TIME_STATS_IRQn           TMR1_IRQn
+#define configRUN_TIME_STATS_IRQHandler     TMR1_IRQHandler
+#endif
+
+/* Number of tasks whose run time is kept between two reports. Tasks beyond
+   this number are reported with their load since they were created. */
+#ifndef configRUN_TIME_STATS_MAX_TASKS
+#define configRUN_TIME_STATS_MAX_TASKS      24
+#endif
+
+/* Set to 1 when heap_tlsf.c is linked, to add its statistics to the report */
+#ifndef configRUN_TIME_STATS_TLSF
+#define configRUN_TIME_STATS_TLSF           1
+#endif
+
+#define rtsTIMER_MAX_COUNT                  0xFFFFFFUL
+
+/*-----------------------------------------------------------*/
+
+static uint32_t ulRunTimeHz;
+static uint32_t ulLastCount;
+static uint32_t ulRunTimeCounter;
+
+/* Run time of each task at the previous report */
+static TaskHandle_t xPrevTask[ configRUN_TIME_STATS_MAX_TASKS ];
+static uint32_t ulPrevRunTime[ configRUN_TIME_STATS_MAX_TASKS ];
+static uint32_t ulPrevTotalRunTime;
+
+static const char * const pcTaskStates[] =
+{
+    "running", "ready", "blocked", "suspended", "deleted"
+};
+
+#if MEMP_STATS
+static const char * const pcMempNames[ MEMP_MAX ] =
+{
+#define LWIP_MEMPOOL( name, num, size, desc )   desc,
+#include "lwip/memp_std.h"
+};
+#endif
+
+/*-----------------------------------------------------------*/
+
+void configRUN_TIME_STATS_IRQHandler( void )
+{
+    configRUN_TIME_STATS_TIMER->INTSTS = TIMER_INTSTS_TIF_Msk;
+
+    /* Fold the elapsed counts into the run time counter before the timer
+       counter wraps */
+    ( void ) ulRunTimeStatsGetCounter();
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Start the run time counter
+  * @param  None
+  * @retval None
+  * @details Called by vTaskStartScheduler() through
+  *          portCONFIGURE_TIMER_FOR_RUN_TIME_STATS().
+  */
+void vRunTimeStatsInit( void )
+{
+    uint32_t ulClock, ulPrescale;
+
+    ulClock = TIMER_GetModuleClock( configRUN_TIME_STATS_TIMER );
+    ulPrescale = ulClock / configRUN_TIME_STATS_HZ;
+    if( ulPrescale == 0 )
+    {
+        ulPrescale = 1;
+    }
+    else if( ulPrescale > 256 )
+    {
+        ulPrescale = 256;
+    }
+    ulRunTimeHz = ulClock / ulPrescale;
+
+    /* Free running, the compare match at the end of the counter range only
+       interrupts */
+    configRUN_TIME_STATS_TIMER->CTL = TIMER_CTL_RSTCNT_Msk;
+    configRUN_TIME_STATS_TIMER->CMP = rtsTIMER_MAX_COUNT;
+    configRUN_TIME_STATS_TIMER->INTSTS = TIMER_INTSTS_TIF_Msk;
+    configRUN_TIME_STATS_TIMER->CTL = TIMER_CONTINUOUS_MODE | TIMER_CTL_CNTDATEN_Msk | TIMER_CTL_INTEN_Msk |
+                                      TIMER_CTL_CNTEN_Msk | ( ulPrescale - 1 );
+
+    ulLastCount = 0;
+    ulRunTimeCounter = 0;
+
+    NVIC_SetPriority( configRUN_TIME_STATS_IRQn, configLIBRARY_LOWEST_INTERRUPT_PRIORITY );
+    NVIC_EnableIRQ( configRUN_TIME_STATS_IRQn );
+}
+/*-----------------------------------------------------------*/
+
+/**
+  * @brief  Read the run time counter
+  * @param  None
+  * @return Run time counter in 1 / configRUN_TIME_STATS_HZ units
+  * @details Called by the kernel on every task switch through
+  *          portGET_RUN_TIME_COUNTER_VALUE(), from tasks and from the timer
+  *          interrupt.
+  */
+uint32_t ulRunTimeStatsGetCounter( void )
+{
+    UBaseType_t uxSavedInterruptStatus;
+    uint32_t ulCount, ulCounter;
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        ulCount = configRUN_TIME_STATS_TIMER->CNT & rtsTIMER_MAX_COUNT;
+        ulRunTimeCounter += ( ulCount - ulLastCount ) & rtsTIMER_MAX_COUNT;
+        ulLastCount = ulCount;
+        ulCounter = ulRunTimeCounter;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return ulCounter;
+}
+/*-----------------------------------------------------------*/
+
+/* snprintf() to the end of the report, returns the new report length */
+static size_t prvAppend( char *pcBuffer, size_t xBufferLength, size_t xLength, const char *pcFormat, ... )
+{
+    va_list xArgs;
+    int iWritten;
+
+    if( xLength + 1 >= xBufferLength )
+    {
+        return xLength;
+    }
+
+    va_start( xArgs, pcFormat );
+    iWritten = vsnprintf( pcBuffer + xLength, xBufferLength - xLength, pcFormat, xArgs );
+    va_end( xArgs );
+
+    if( iWritten > 0 )
+    {
+        xLength += ( size_t ) iWritten;
+        if( xLength >= xBufferLength )
+        {
+            xLength = xBufferLength - 1;
+        }
+    }
+
+    return xLength;
+}
+/*-----------------------------------------------------------*/
+
+#if LWIP_STATS
+static size_t prvAppendProto( char *pcBuffer, size_t xBufferLength, size_t xLength, const char *pcName,
+                              const struct stats_proto *pxProto )
+{
+    return prvAppend( pcBuffer, xBufferLength, xLength,
+                      "\"%s\":{\"xmit\":%lu,\"recv\":%lu,\"drop\":%lu,\"chkerr\":%lu,\"memerr\":%lu,\"err\":%lu},",
+                      pcName,
+                      ( unsigned long ) pxProto->xmit, ( unsigned long ) pxProto->recv,
+                      ( unsigned long ) pxProto->drop, ( unsigned long ) pxProto->chkerr,
+                      ( unsigned long ) pxProto->memerr, ( unsigned long ) pxProto->err );
+}
+#endif
+/*-----------------------------------------------------------*/
+
+size_t xRunTimeStatsReport( char *pcBuffer, size_t xBufferLength )
+{
+    TaskStatus_t *pxTaskStatus;
+    UBaseType_t uxTasks, x, y;
+    uint32_t ulTotalRunTime, ulInterval, ulRunTime, ulPermille;
+    size_t xLength = 0;
+#if configRUN_TIME_STATS_TLSF == 1
+    TLSFHeapStats_t xHeapStats;
+#endif
+
+    if( xBufferLength == 0 )
+    {
+        return 0;
+    }
+    pcBuffer[ 0 ] = '\0';
+
+    uxTasks = uxTaskGetNumberOfTasks();
+    pxTaskStatus = pvPortMalloc( uxTasks * sizeof( TaskStatus_t ) );
+    if( pxTaskStatus == NULL )
+    {
+        return prvAppend( pcBuffer, xBufferLength, 0, "{\"error\":\"out of memory\"}" );
+    }
+    uxTasks = uxTaskGetSystemState( pxTaskStatus, uxTasks, &ulTotalRunTime );
+    ulInterval = ulTotalRunTime - ulPrevTotalRunTime;
+
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength,
+                         "{\"ticks\":%lu,\"tick_hz\":%lu,\"run_time\":%lu,\"run_time_hz\":%lu,\"interval\":%lu,\"tasks\":[",
+                         ( unsigned long ) xTaskGetTickCount(), ( unsigned long ) configTICK_RATE_HZ,
+                         ( unsigned long ) ulTotalRunTime, ( unsigned long ) ulRunTimeHz,
+                         ( unsigned long ) ulInterval );
+
+    for( x = 0; x < uxTasks; x++ )
+    {
+        /* Run time since the previous report, or since the task was
+           created */
+        ulRunTime = pxTaskStatus[ x ].ulRunTimeCounter;
+        for( y = 0; y < configRUN_TIME_STATS_MAX_TASKS; y++ )
+        {
+            if( xPrevTask[ y ] == pxTaskStatus[ x ].xHandle )
+            {
+                ulRunTime -= ulPrevRunTime[ y ];
+                break;
+            }
+        }
+
+        ulPermille = 0;
+        if( ulInterval != 0 )
+        {
+            ulPermille = ( uint32_t ) ( ( ( uint64_t ) ulRunTime * 1000UL ) / ulInterval );
+        }
+
+        xLength = prvAppend( pcBuffer, xBufferLength, xLength,
+                             "%s{\"name\":\"%s\",\"num\":%lu,\"prio\":%lu,\"state\":\"%s\",\"run_time\":%lu,"
+                             "\"cpu\":%lu.%lu,\"stack_free\":%lu}",
+                             ( x == 0 ) ? "" : ",",
+                             pxTaskStatus[ x ].pcTaskName,
+                             ( unsigned long ) pxTaskStatus[ x ].xTaskNumber,
+                             ( unsigned long ) pxTaskStatus[ x ].uxCurrentPriority,
+                             pcTaskStates[ pxTaskStatus[ x ].eCurrentState <= eDeleted ? pxTaskStatus[ x ].eCurrentState : eDeleted ],
+                             ( unsigned long ) pxTaskStatus[ x ].ulRunTimeCounter,
+                             ( unsigned long ) ( ulPermille / 10 ), ( unsigned long ) ( ulPermille % 10 ),
+                             ( unsigned long ) ( pxTaskStatus[ x ].usStackHighWaterMark * sizeof( StackType_t ) ) );
+    }
+
+    /* Remember the counters for the next report. Deleted tasks drop out. */
+    for( y = 0; y < configRUN_TIME_STATS_MAX_TASKS; y++ )
+    {
+        if( y < uxTasks )
+        {
+            xPrevTask[ y ] = pxTaskStatus[ y ].xHandle;
+            ulPrevRunTime[ y ] = pxTaskStatus[ y ].ulRunTimeCounter;
+        }
+        else
+        {
+            xPrevTask[ y ] = NULL;
+        }
+    }
+    ulPrevTotalRunTime = ulTotalRunTime;
+    vPortFree( pxTaskStatus );
+
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength, "],\"heap\":{\"free\":%lu,\"min_free\":%lu",
+                         ( unsigned long ) xPortGetFreeHeapSize(), ( unsigned long ) xPortGetMinimumEverFreeHeapSize() );
+#if configRUN_TIME_STATS_TLSF == 1
+    vPortGetTLSFHeapStats( &xHeapStats );
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength,
+                         ",\"size\":%lu,\"largest\":%lu,\"max_alloc\":%lu,\"blocks\":%lu,\"frag\":%lu,\"failed\":%lu",
+                         ( unsigned long ) xHeapStats.xTotalHeapSize, ( unsigned long ) xHeapStats.xLargestFreeBlock,
+                         ( unsigned long ) xHeapStats.xLargestAllocation,
+                         ( unsigned long ) xHeapStats.xNumberOfFreeBlocks, ( unsigned long ) xHeapStats.ulFragmentation,
+                         ( unsigned long ) xHeapStats.ulFailedAllocations );
+#endif
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength, "}" );
+
+#if LWIP_STATS
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength, ",\"lwip\":{" );
+#if LINK_STATS
+    xLength = prvAppendProto( pcBuffer, xBufferLength, xLength, "link", &lwip_stats.link );
+#endif
+#if ETHARP_STATS
+    xLength = prvAppendProto( pcBuffer, xBufferLength, xLength, "etharp", &lwip_stats.etharp );
+#endif
+#if IP_STATS
+    xLength = prvAppendProto( pcBuffer, xBufferLength, xLength, "ip", &lwip_stats.ip );
+#endif
+#if ICMP_STATS
+    xLength = prvAppendProto( pcBuffer, xBufferLength, xLength, "icmp", &lwip_stats.icmp );
+#endif
+#if UDP_STATS
+    xLength = prvAppendProto( pcBuffer, xBufferLength, xLength, "udp", &lwip_stats.udp );
+#endif
+#if TCP_STATS
+    xLength = prvAppendProto( pcBuffer, xBufferLength, xLength, "tcp", &lwip_stats.tcp );
+#endif
+#if SYS_STATS
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength,
+                         "\"sys\":{\"sem\":[%lu,%lu,%lu],\"mutex\":[%lu,%lu,%lu],\"mbox\":[%lu,%lu,%lu]},",
+                         ( unsigned long ) lwip_stats.sys.sem.used, ( unsigned long ) lwip_stats.sys.sem.max,
+                         ( unsigned long ) lwip_stats.sys.sem.err,
+                         ( unsigned long ) lwip_stats.sys.mutex.used, ( unsigned long ) lwip_stats.sys.mutex.max,
+                         ( unsigned long ) lwip_stats.sys.mutex.err,
+                         ( unsigned long ) lwip_stats.sys.mbox.used, ( unsigned long ) lwip_stats.sys.mbox.max,
+                         ( unsigned long ) lwip_stats.sys.mbox.err );
+#endif
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength, "\"memp\":[" );
+#if MEMP_STATS
+    for( x = 0; x < MEMP_MAX; x++ )
+    {
+        xLength = prvAppend( pcBuffer, xBufferLength, xLength,
+                             "%s{\"name\":\"%s\",\"avail\":%lu,\"used\":%lu,\"max\":%lu,\"err\":%lu}",
+                             ( x == 0 ) ? "" : ",", pcMempNames[ x ],
+                             ( unsigned long ) lwip_stats.memp[ x ].avail, ( unsigned long ) lwip_stats.memp[ x ].used,
+                             ( unsigned long ) lwip_stats.memp[ x ].max, ( unsigned long ) lwip_stats.memp[ x ].err );
+    }
+#endif
+    xLength = prvAppend( pcBuffer, xBufferLength, xLength, "]}" );
+#endif /* LWIP_STATS */
+
+    return prvAppend( pcBuffer, xBufferLength, xLength, "}\n" );
+}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -0,0 +1,41 @@
+/**************************************************************************//**
+ * @file     run_time_stats.h
+ * @version  V1.00
+ * @brief    FreeRTOS run time statistics clock and system status report.
+ *           The run time counter is a TIMER in continuous counting mode,
+ *           the report lists the CPU load and stack high water mark of
+ *           each task, the heap usage and the lwIP statistics counters.
+ *
+ *           The timer clock source must be selected by the application
+ *           before the scheduler starts, e.g.
+ *           CLK_SetModuleClock(TMR1_MODULE, CLK_CLKSEL1_TMR1SEL_HXT, 0).
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __RUN_TIME_STATS_H__
+#define __RUN_TIME_STATS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Frequency of the run time counter. The 32-bit counter wraps after about
+   12 hours at 100 kHz, poll the report more often than that when the
+   counters are differenced by a collector. */
+#ifndef configRUN_TIME_STATS_HZ
+#define configRUN_TIME_STATS_HZ         100000UL
+#endif
+
+/* Called through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() and
+   portGET_RUN_TIME_COUNTER_VALUE() */
+void vRunTimeStatsInit( void );
+uint32_t ulRunTimeStatsGetCounter( void );
+
+/* Write the status report as a JSON object to pcBuffer. The CPU load of
+   each task is measured over the time since the previous report. Returns
+   the length of the report, which is truncated to xBufferLength - 1. */
+size_t xRunTimeStatsReport( char *pcBuffer, size_t xBufferLength );
+
+#endif /* __RUN_TIME_STATS_H__ */
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -0,0 +1,229 @@
+/**************************************************************************//**
+ * @file     SchedBench.c
+ * @version  V1.00
+ * @brief    Measure the RTX context switch latency against the number of
+ *           threads. The kernel is compiled from Library/CMSIS/RTOS/RTX/SRC,
+ *           replace the RTX sources in the project by RTX_CM4.lib to compare
+ *           with the prebuilt library.
+ *
+ *           yield: N threads of the same priority pass the CPU around with
+ *                  osThreadYield(). The yielding thread is put behind the
+ *                  other N-1 ready threads.
+ *           block: a thread blocks with a time-out that expires after those
+ *                  of N delayed threads, a lower priority thread takes over.
+ *
+ *           Latencies are in CPU cycles, measured with the DWT cycle counter
+ *           from the last instruction of the old thread to the first one of
+ *           the new thread.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include "cmsis_os.h"
+#include "NUC472_442.h"
+
+#define MAX_THREADS     24      /* Largest thread count measured */
+#define RUN_TICKS       200     /* Duration of each measurement */
+
+/* Thread counts measured */
+static const uint32_t au32Counts[] = {1, 2, 4, 8, 16, MAX_THREADS};
+
+/* Cycle counter sampled just before the switch, 0 when no switch is timed */
+static volatile uint32_t g_u32Mark;
+
+static volatile uint32_t g_u32Min, g_u32Max, g_u32Samples;
+static volatile uint64_t g_u64Sum;
+
+static osThreadId g_tProbe;
+
+void yield_thread (void const *argument);
+void sleep_thread (void const *argument);
+void probe_thread (void const *argument);
+void spin_thread  (void const *argument);
+
+osThreadDef(yield_thread, osPriorityNormal, MAX_THREADS, 0);
+osThreadDef(sleep_thread, osPriorityNormal, MAX_THREADS, 0);
+osThreadDef(probe_thread, osPriorityAboveNormal, 1, 0);
+osThreadDef(spin_thread, osPriorityLow, 1, 0);
+
+/*----------------------------------------------------------------------------
+  Record the cycles since g_u32Mark
+ *---------------------------------------------------------------------------*/
+static void Sample(void)
+{
+    uint32_t u32Cycles;
+
+    if(g_u32Mark == 0)
+        return;
+
+    u32Cycles = DWT->CYCCNT - g_u32Mark;
+    g_u32Mark = 0;
+
+    if(u32Cycles < g_u32Min)
+        g_u32Min = u32Cycles;
+    if(u32Cycles > g_u32Max)
+        g_u32Max = u32Cycles;
+    g_u64Sum += u32Cycles;
+    g_u32Samples++;
+}
+
+static void ResetStats(void)
+{
+    g_u32Mark = 0;
+    g_u32Min = 0xFFFFFFFF;
+    g_u32Max = 0;
+    g_u64Sum = 0;
+    g_u32Samples = 0;
+}
+
+static void PrintStats(void)
+{
+    if(g_u32Samples == 0)
+    {
+        printf("       -      -      -");
+        return;
+    }
+    printf("  %6d %6d %6d", g_u32Min, (uint32_t)(g_u64Sum / g_u32Samples), g_u32Max);
+}
+
+/*----------------------------------------------------------------------------
+  yield: round robin between threads of the same priority
+ *---------------------------------------------------------------------------*/
+void yield_thread (void const *argument)
+{
+    for (;;)
+    {
+        Sample();
+        g_u32Mark = DWT->CYCCNT;
+        osThreadYield();
+    }
+}
+
+/*----------------------------------------------------------------------------
+  block: the probe waits with a time-out behind the sleeping threads, the
+  spinning thread takes over and wakes the probe up again
+ *---------------------------------------------------------------------------*/
+void sleep_thread (void const *argument)
+{
+    for (;;)
+    {
+        osDelay(60000);
+    }
+}
+
+void probe_thread (void const *argument)
+{
+    for (;;)
+    {
+        g_u32Mark = DWT->CYCCNT;
+        osSignalWait(0x0001, 65000);
+    }
+}
+
+void spin_thread (void const *argument)
+{
+    for (;;)
+    {
+        if(g_u32Mark != 0)
+        {
+            Sample();
+            osSignalSet(g_tProbe, 0x0001);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------
+  Run both measurements with u32Count threads
+ *---------------------------------------------------------------------------*/
+static void Measure(uint32_t u32Count)
+{
+    osThreadId atThreads[MAX_THREADS];
+    osThreadId tSpin;
+    uint32_t i;
+
+    printf("%7d", u32Count);
+
+    /* yield */
+    for(i = 0; i < u32Count; i++)
+        atThreads[i] = osThreadCreate(osThread(yield_thread), NULL);
+    ResetStats();
+    osDelay(RUN_TICKS);
+    for(i = 0; i < u32Count; i++)
+        osThreadTerminate(atThreads[i]);
+    PrintStats();
+
+    /* block */
+    for(i = 0; i < u32Count; i++)
+        atThreads[i] = osThreadCreate(osThread(sleep_thread), NULL);
+    /* Let them block before the measurement starts */
+    osDelay(1);
+    tSpin = osThreadCreate(osThread(spin_thread), NULL);
+    g_tProbe = osThreadCreate(osThread(probe_thread), NULL);
+    ResetStats();
+    osDelay(RUN_TICKS);
+    osThreadTerminate(g_tProbe);
+    osThreadTerminate(tSpin);
+    for(i = 0; i < u32Count; i++)
+        osThreadTerminate(atThreads[i]);
+    PrintStats();
+
+    printf("\n");
+}
+
+void SYS_Init(void)
+{
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable External XTAL (4~24 MHz) */
+    CLK_EnableXtalRC(CLK_PWRCTL_HXTEN_Msk);
+
+    /* Waiting for 12MHz clock ready */
+    CLK_WaitClockReady( CLK_STATUS_HXTSTB_Msk);
+
+    /* Set core clock to 84 MHz from the PLL */
+    CLK_SetCoreClock(84000000);
+
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_SetModuleClock(UART0_MODULE, CLK_CLKSEL1_UARTSEL_HXT, CLK_CLKDIV0_UART(1));
+    /* Set GPG multi-function pins for UART0 RXD and TXD */
+    SYS->GPG_MFPL |= SYS_GPG_MFPL_PG1MFP_UART0_RXD | SYS_GPG_MFPL_PG2MFP_UART0_TXD ;
+
+    /* Lock protected registers */
+    SYS_LockReg();
+
+    /* Init UART to 115200-8n1 for print message */
+    UART_Open(UART0, 115200);
+}
+
+/*----------------------------------------------------------------------------
+  Main: Initialize and start RTX Kernel
+ *---------------------------------------------------------------------------*/
+int main (void)
+{
+    uint32_t i;
+
+    SYS_Init();
+
+    /* Start the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    osKernelInitialize ();
+    osKernelStart ();
+
+    /* main runs above all measured threads */
+    osThreadSetPriority(osThreadGetId(), osPriorityHigh);
+
+    printf("\nRTX scheduler latency, CPU cycles at %d Hz\n", SystemCoreClock);
+    printf("threads   yield min    avg    max   block min    avg    max\n");
+    for(i = 0; i < sizeof(au32Counts) / sizeof(au32Counts[0]); i++)
+        Measure(au32Counts[i]);
+    printf("Done\n");
+
+    osSignalWait(0x0001, osWaitForever);
+}
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
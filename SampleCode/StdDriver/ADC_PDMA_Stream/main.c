@@ -0,0 +1,253 @@
+/**************************************************************************//**
+ * @file     main.c
+ * @version  V1.00
+ * @brief    Stream ADC channel 0 through a PDMA scatter-gather ring and
+ *           process each block with CMSIS-DSP: a q15 FIR low-pass filter,
+ *           the RMS level and the spectrum peak of the filtered signal.
+ *
+ * @note
+ * Copyright (C) 2015 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <math.h>
+#include "NUC472_442.h"
+#include "arm_math.h"
+
+#define PLLCON_SETTING      CLK_PLLCTL_84MHz_HXT
+#define PLL_CLOCK           84000000
+
+#define BLOCK_SIZE          256     /* Samples per block, also the FFT size */
+#define BLOCK_COUNT         4       /* Depth of the PDMA ring */
+#define PDMA_CH             2
+#define FIR_TAPS            32
+#define FIR_CUTOFF          0.1f    /* Fraction of the sample rate */
+
+/* Written by PDMA */
+uint32_t g_au32AdcRing[BLOCK_COUNT * BLOCK_SIZE];
+ADC_STREAM_DESC_T g_asAdcDesc[BLOCK_COUNT];
+int16_t g_ai16AdcWork[BLOCK_SIZE];
+ADC_STREAM_T g_sAdcStream;
+
+/* FIR stage */
+typedef struct
+{
+    arm_fir_instance_q15 sFir;
+    q15_t aq15State[BLOCK_SIZE + FIR_TAPS - 1];
+    q15_t aq15Coeff[FIR_TAPS];
+    q15_t aq15Out[BLOCK_SIZE];
+} FIR_STAGE_T;
+
+FIR_STAGE_T g_sFirStage;
+
+/* Level and spectrum stage */
+typedef struct
+{
+    arm_rfft_fast_instance_f32 sFft;
+    float32_t af32In[BLOCK_SIZE];
+    float32_t af32Out[BLOCK_SIZE];
+    float32_t af32Mag[BLOCK_SIZE / 2];
+    volatile q15_t q15Rms;
+    volatile uint32_t u32PeakBin;
+} SPECTRUM_STAGE_T;
+
+SPECTRUM_STAGE_T g_sSpectrumStage;
+
+volatile uint32_t g_u32Ticks;
+
+void SysTick_Handler(void)
+{
+    g_u32Ticks++;
+}
+
+void PDMA_IRQHandler(void)
+{
+    ADC_STREAM_IRQHandler(&g_sAdcStream);
+}
+
+/* Filter the block in place, so the next stage sees the filtered signal */
+void FirStage(void *pvContext, int16_t *pi16Block, uint32_t u32Count)
+{
+    FIR_STAGE_T *pStage = (FIR_STAGE_T *)pvContext;
+
+    arm_fir_q15(&pStage->sFir, pi16Block, pStage->aq15Out, u32Count);
+    arm_copy_q15(pStage->aq15Out, pi16Block, u32Count);
+}
+
+void SpectrumStage(void *pvContext, int16_t *pi16Block, uint32_t u32Count)
+{
+    SPECTRUM_STAGE_T *pStage = (SPECTRUM_STAGE_T *)pvContext;
+    float32_t f32Max;
+    uint32_t u32Index;
+    q15_t q15Rms;
+
+    arm_rms_q15(pi16Block, u32Count, &q15Rms);
+    pStage->q15Rms = q15Rms;
+
+    arm_q15_to_float(pi16Block, pStage->af32In, u32Count);
+    arm_rfft_fast_f32(&pStage->sFft, pStage->af32In, pStage->af32Out, 0);
+    arm_cmplx_mag_f32(pStage->af32Out, pStage->af32Mag, u32Count / 2);
+
+    /* The first bin packs DC and Nyquist, skip it */
+    arm_max_f32(&pStage->af32Mag[1], u32Count / 2 - 1, &f32Max, &u32Index);
+    pStage->u32PeakBin = u32Index + 1;
+}
+
+void DSP_Init(void)
+{
+    float32_t af32Coeff[FIR_TAPS];
+    float32_t f32Sum = 0, x;
+    int32_t i;
+
+    /* Hamming windowed sinc low-pass */
+    for(i = 0; i < FIR_TAPS; i++)
+    {
+        x = (float32_t)i - (FIR_TAPS - 1) / 2.0f;
+        af32Coeff[i] = (x == 0) ? 2 * FIR_CUTOFF : sinf(2 * PI * FIR_CUTOFF * x) / (PI * x);
+        af32Coeff[i] *= 0.54f - 0.46f * cosf(2 * PI * i / (FIR_TAPS - 1));
+        f32Sum += af32Coeff[i];
+    }
+    for(i = 0; i < FIR_TAPS; i++)
+        af32Coeff[i] /= f32Sum;
+    arm_float_to_q15(af32Coeff, g_sFirStage.aq15Coeff, FIR_TAPS);
+
+    arm_fir_init_q15(&g_sFirStage.sFir, FIR_TAPS, g_sFirStage.aq15Coeff, g_sFirStage.aq15State, BLOCK_SIZE);
+    arm_rfft_fast_init_f32(&g_sSpectrumStage.sFft, BLOCK_SIZE);
+}
+
+void SYS_Init(void)
+{
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init System Clock                                                                                       */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Unlock protected registers */
+    SYS_UnlockReg();
+
+    /* Enable External XTAL (4~24 MHz) */
+    CLK_EnableXtalRC(CLK_PWRCTL_HXTEN_Msk);
+
+    /* Waiting for 12MHz clock ready */
+    CLK_WaitClockReady( CLK_STATUS_HXTSTB_Msk);
+
+    /* Switch HCLK clock source to HXT */
+    CLK_SetHCLK(CLK_CLKSEL0_HCLKSEL_HXT,CLK_CLKDIV0_HCLK(1));
+
+    /* Set PLL to power down mode and PLL_STB bit in CLKSTATUS register will be cleared by hardware.*/
+    CLK->PLLCTL|= CLK_PLLCTL_PD_Msk;
+
+    /* Set PLL frequency */
+    CLK->PLLCTL = PLLCON_SETTING;
+
+    /* Waiting for clock ready */
+    CLK_WaitClockReady(CLK_STATUS_PLLSTB_Msk);
+
+    /* Switch HCLK clock source to PLL */
+    CLK_SetHCLK(CLK_CLKSEL0_HCLKSEL_PLL,CLK_CLKDIV0_HCLK(1));
+
+    /* Enable IP clock */
+    CLK_EnableModuleClock(UART0_MODULE);
+    CLK_EnableModuleClock(ADC_MODULE);
+    CLK_EnableModuleClock(PDMA_MODULE);
+
+    /* Select IP clock source */
+    CLK_SetModuleClock(UART0_MODULE,CLK_CLKSEL1_UARTSEL_HXT,CLK_CLKDIV0_UART(1));
+    CLK_SetModuleClock(ADC_MODULE,CLK_CLKSEL1_ADCSEL_PCLK,CLK_CLKDIV0_ADC(5));
+
+    /* Update System Core Clock */
+    /* User can use SystemCoreClockUpdate() to calculate SystemCoreClock. */
+    SystemCoreClockUpdate();
+
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init I/O Multi-function                                                                                 */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Set GPG multi-function pins for UART0 RXD and TXD */
+    SYS->GPG_MFPL |= SYS_GPG_MFPL_PG1MFP_UART0_RXD | SYS_GPG_MFPL_PG2MFP_UART0_TXD ;
+
+    /* Configure analog input pins ADC0(GPE0) */
+    SYS->GPE_MFPL |= (SYS->GPE_MFPL & ~SYS_GPE_MFPL_PE0MFP_Msk) | SYS_GPE_MFPL_PE0MFP_ADC0_0;
+
+    /* Disable the digital input path */
+    PE->DINOFF = PE->DINOFF | GPIO_DINOFF_DINOFF0_Msk;
+
+    /* Reset ADC */
+    SYS_ResetModule(ADC_RST);
+
+    /* Reset PDMA */
+    SYS_ResetModule(PDMA_RST);
+
+    /* Vref connect to AVDD */
+    SYS->VREFCTL |= SYS_VREFCTL_VREF_AVDD;
+
+    /* Lock protected registers */
+    SYS_LockReg();
+}
+
+
+void UART0_Init(void)
+{
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Init UART                                                                                               */
+    /*---------------------------------------------------------------------------------------------------------*/
+    /* Reset IP */
+    SYS_ResetModule(UART0_RST);
+
+    /* Configure UART0 and set UART0 Baudrate */
+    UART0->LINE |=0x07;
+    UART0->BAUD = 0x30000066;   /* 12MHz reference clock input, for 115200 */
+}
+
+int32_t main (void)
+{
+    uint32_t u32Blocks = 0, u32LastTick, u32Rate;
+
+    /* Init System, IP clock and multi-function I/O
+       In the end of SYS_Init() will issue SYS_LockReg()
+       to lock protected register. If user want to write
+       protected register, please issue SYS_UnlockReg()
+       to unlock protected register if necessary */
+    SYS_Init();
+
+    /* Init UART0 for printf */
+    UART0_Init();
+
+    printf("\n\nCPU @ %dHz\n", SystemCoreClock);
+
+    printf("\nThis sample code streams ADC channel 0 to memory with PDMA in blocks of %d samples.\n", BLOCK_SIZE);
+    printf("Each block is low-pass filtered with arm_fir_q15(), then its RMS level and the\n");
+    printf("spectrum peak are computed with arm_rms_q15() and arm_rfft_fast_f32().\n\n");
+
+    DSP_Init();
+
+    /* Continuous scan of channel 0, the sample rate is set by the ADC clock */
+    ADC_Open(ADC, ADC_INPUT_MODE_SINGLE_END, ADC_OPERATION_MODE_CONTINUOUS, ADC_CH_0_MASK);
+    ADC_POWER_ON(ADC);
+
+    ADC_STREAM_Open(&g_sAdcStream, PDMA_CH, g_au32AdcRing, g_asAdcDesc, g_ai16AdcWork, BLOCK_SIZE, BLOCK_COUNT);
+    ADC_STREAM_AddStage(&g_sAdcStream, FirStage, &g_sFirStage);
+    ADC_STREAM_AddStage(&g_sAdcStream, SpectrumStage, &g_sSpectrumStage);
+
+    SysTick_Config(SystemCoreClock / 1000);
+    NVIC_EnableIRQ(PDMA_IRQn);
+    ADC_STREAM_Start(&g_sAdcStream);
+
+    u32LastTick = g_u32Ticks;
+    while(1)
+    {
+        /* Sleep until the next block or tick */
+        if(ADC_STREAM_GET_PENDING(&g_sAdcStream) == 0)
+            __WFI();
+
+        u32Blocks += ADC_STREAM_Process(&g_sAdcStream);
+
+        if(g_u32Ticks - u32LastTick >= 1000)
+        {
+            u32LastTick += 1000;
+            u32Rate = u32Blocks * BLOCK_SIZE;
+            printf("%u samples/s, %u blocks lost, RMS %d, peak %u Hz\n",
+                   u32Rate, ADC_STREAM_GET_OVERRUNS(&g_sAdcStream), g_sSpectrumStage.q15Rms,
+                   g_sSpectrumStage.u32PeakBin * u32Rate / BLOCK_SIZE);
+            u32Blocks = 0;
+        }
+    }
+}
+
+/*** (C) COPYRIGHT 2015 Nuvoton Technology Corp. ***/
@@ -121,6 +121,36 @@ fs_open(const char *name, struct fs_file *file)
     return 0;
 }
 /*-----------------------------------------------------------------------------------*/
+int
+fs_open_gzip(const char *name, struct fs_file *file)
+{
+    struct fsdata_file_noconst *f;
+    const char *suffix;
+    u8_t i, j;
+
+    for(f = (struct fsdata_file_noconst *)FS_ROOT;
+            f != NULL;
+            f = (struct fsdata_file_noconst *)f->next)
+    {
+
+        for(i = 0; name[i] != 0 && name[i] == f->name[i]; ++i);
+        if(name[i] != 0)
+        {
+            continue;
+        }
+
+        suffix = FS_GZIP_SUFFIX;
+        for(j = 0; suffix[j] != 0 && suffix[j] == f->name[i + j]; ++j);
+        if(suffix[j] == 0 && f->name[i + j] == 0)
+        {
+            file->data = f->data;
+            file->len = f->len;
+            return 1;
+        }
+    }
+    return 0;
+}
+/*-----------------------------------------------------------------------------------*/
 void
 fs_init(void)
 {
@@ -67,6 +67,22 @@ struct fs_file
  */
 int fs_open(const char *name, struct fs_file *file);
 
+/**
+ * Suffix of the gzip encoded file variants generated by makefsdata.
+ */
+#define FS_GZIP_SUFFIX ".gz"
+
+/**
+ * Open the gzip encoded variant ("name.gz") of a file in the read-only
+ * file system.
+ *
+ * \param name The name of the file, without the ".gz" suffix.
+ *
+ * \param file The file pointer, which must be allocated by caller and
+ * will be filled in by the function.
+ */
+int fs_open_gzip(const char *name, struct fs_file *file);
+
 #ifdef FS_STATISTICS
 #if FS_STATISTICS == 1
 u16_t fs_count(char *name);
@@ -110,11 +110,12 @@ i /footer.plain
 
 struct httpd_state *hs;
 
-extern const struct fsdata_file file_index_html;
-extern const struct fsdata_file file_404_html;
+static const char index_name[] = "/index.html";
+static const char notfound_name[] = "/404.html";
 
 static void next_scriptline(void);
 static void next_scriptstate(void);
+static u8_t accept_gzip(void);
 
 #define ISO_G        0x47
 #define ISO_E        0x45
@@ -152,6 +153,8 @@ void
 httpd_appcall(void)
 {
     struct fs_file fsfile;
+    const char *name;
+    u8_t gzip;
 
     u8_t i;
 
@@ -209,6 +212,10 @@ httpd_appcall(void)
                 return;
             }
 
+            /* Look for "Accept-Encoding: gzip" before the request line
+               gets cut into a file name below. */
+            gzip = accept_gzip();
+
             /* Find the file we are looking for. */
             for(i = 4; i < 40; ++i)
             {
@@ -228,14 +235,23 @@ httpd_appcall(void)
             if(uip_appdata[4] == ISO_slash &&
                     uip_appdata[5] == 0)
             {
-                fs_open(file_index_html.name, &fsfile);
+                name = index_name;
             }
             else
             {
-                if(!fs_open((const char *)&uip_appdata[4], &fsfile))
+                name = (const char *)&uip_appdata[4];
+            }
+
+            /* Serve the precompressed variant if the client accepts it. A
+               file packed with makefsdata -gzonly has no plain copy. */
+            if(!(gzip && fs_open_gzip(name, &fsfile)) &&
+                    !fs_open(name, &fsfile) &&
+                    !fs_open_gzip(name, &fsfile))
+            {
+                PRINTLN("couldn't open file");
+                if(!fs_open(notfound_name, &fsfile))
                 {
-                    PRINTLN("couldn't open file");
-                    fs_open(file_404_html.name, &fsfile);
+                    fs_open_gzip(notfound_name, &fsfile);
                 }
             }
 
@@ -329,6 +345,41 @@ httpd_appcall(void)
     }
 }
 /*-----------------------------------------------------------------------------------*/
+/* accept_gzip():
+ *
+ * Returns non-zero if the request headers in uip_appdata contain an
+ * "Accept-Encoding:" line that lists gzip.
+ */
+static u8_t
+accept_gzip(void)
+{
+    static const char hdr[] = "Accept-Encoding:";
+    u16_t i, j;
+
+    for(i = 0; i + sizeof(hdr) - 1 < uip_len; ++i)
+    {
+        for(j = 0; hdr[j] != 0 && uip_appdata[i + j] == hdr[j]; ++j);
+        if(hdr[j] != 0)
+        {
+            continue;
+        }
+
+        /* Scan the header value up to the end of the line. */
+        for(i += j; i + 4 <= uip_len && uip_appdata[i] != ISO_cr; ++i)
+        {
+            if(uip_appdata[i] == ISO_g &&
+                    uip_appdata[i + 1] == 'z' &&
+                    uip_appdata[i + 2] == ISO_i &&
+                    uip_appdata[i + 3] == 'p')
+            {
+                return 1;
+            }
+        }
+        return 0;
+    }
+    return 0;
+}
+/*-----------------------------------------------------------------------------------*/
 /* next_scriptline():
  *
  * Reads the script until it finds a newline. */
@@ -22,9 +22,14 @@
 // Our MAC address
 struct uip_eth_addr ethaddr = {{0x00, 0x00, 0x00, 0x59, 0x16, 0x88}};
 
+#if UIP_EXTERNAL_BUFFER
+// uip_buf points to an EMAC descriptor buffer, set if it is the buffer of current Rx descriptor
+static uint8_t u8RxInPlace = 0;
+#else
 static uint8_t rxbuf[1514];
 static uint8_t txbuf[1514];
 uint32_t volatile u32PktLen;
+#endif
 
 // Descriptor pointers holds current Tx and Rx used by IRQ handler here.
 uint32_t u32CurrentTxDesc, u32CurrentRxDesc;
@@ -43,6 +48,7 @@ void EMAC_TX_IRQHandler(void)
     EMAC_SendPktDone();
 }
 
+#if !UIP_EXTERNAL_BUFFER
 
 /**
   * @brief  EMAC Rx interrupt handler.
@@ -62,6 +68,7 @@ void EMAC_RX_IRQHandler(void)
 
 
 }
+#endif
 
 void TMR0_IRQHandler(void)
 {
@@ -145,6 +152,70 @@ void SYS_Init(void)
 }
 
 
+#if UIP_EXTERNAL_BUFFER
+/**
+  * @brief  Point uip_buf to the buffer of next free Tx descriptor
+  * @param  None
+  * @return None
+  */
+static void uip_set_txbuf(void)
+{
+    uint8_t *pu8Buf;
+
+    // EMAC releases the Tx descriptor as soon as its packet is sent
+    while((pu8Buf = EMAC_GetTxBuf()) == NULL);
+    uip_buf = pu8Buf;
+}
+
+uint32_t uip_read(void)
+{
+    uint8_t *pu8Data;
+    uint32_t u32Len;
+
+    // Give previous received packet back to EMAC
+    if(u8RxInPlace)
+    {
+        EMAC_RecvPktDone();
+        u8RxInPlace = 0;
+        uip_set_txbuf();
+    }
+
+    while(curTime == prevTime)
+    {
+        if(EMAC_RecvPktInPlace(&pu8Data, &u32Len) == 1)
+        {
+            // Process the packet inside Rx descriptor buffer
+            uip_buf = pu8Data;
+            u8RxInPlace = 1;
+            return u32Len;
+        }
+    }
+    prevTime++;
+    return 0;
+}
+
+
+uint32_t uip_write(void)
+{
+    uint32_t u32Ret;
+
+    // Application data not placed right after the headers are gathered into the frame
+    if((uip_len > (40 + UIP_LLH_LEN)) && (uip_appdata != &uip_buf[40 + UIP_LLH_LEN]))
+        memcpy(&uip_buf[40 + UIP_LLH_LEN], (const void *)uip_appdata, uip_len - 40 - UIP_LLH_LEN);
+
+    if(u8RxInPlace)
+    {
+        // Swap Rx buffer to a Tx descriptor. Rx descriptor is released by uip_read() later
+        while(EMAC_GetTxBuf() == NULL);
+        return EMAC_SendRxPkt(uip_len);
+    }
+
+    u32Ret = EMAC_SendPktInPlace(uip_len);
+    // Next packet is built in next Tx descriptor buffer
+    uip_set_txbuf();
+    return u32Ret;
+}
+#else
 
 uint32_t uip_read(void)
 {
@@ -181,6 +252,7 @@ uint32_t uip_write(void)
 
 
 }
+#endif
 
 
 // This sample application can response to ICMP ECHO packets (ping)
@@ -198,7 +270,12 @@ int main(void)
     // Select RMII interface by default
     EMAC_Open(ethaddr.addr);
     NVIC_EnableIRQ(EMAC_TX_IRQn);
+#if UIP_EXTERNAL_BUFFER
+    // Rx descriptors are polled by uip_read(), and released after uIP processed the packet
+    uip_set_txbuf();
+#else
     NVIC_EnableIRQ(EMAC_RX_IRQn);
+#endif
     EMAC_ENABLE_RX();
     EMAC_ENABLE_TX();
 
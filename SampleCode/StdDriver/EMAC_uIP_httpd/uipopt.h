@@ -425,6 +425,18 @@ typedef unsigned short uip_stats_t;
  */
 #define UIP_BUFSIZE     1514//1500
 
+/**
+ * Determines if the uIP packet buffer is provided by the device driver.
+ *
+ * If set to 1, uip_buf is a pointer instead of an array. The device
+ * driver points it to the packet buffer of an EMAC DMA descriptor, so
+ * packets are processed in place and neither copied in on receive nor
+ * copied out on transmit. The buffer must hold UIP_BUFSIZE + 2 bytes.
+ *
+ * \hideinitializer
+ */
+#define UIP_EXTERNAL_BUFFER 1
+
 
 /**
  * Determines if statistics support should be compiled in.
@@ -219,6 +219,10 @@ extern "C" {
 	#define configUSE_TIMERS 0
 #endif
 
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
 #ifndef configUSE_COUNTING_SEMAPHORES
 	#define configUSE_COUNTING_SEMAPHORES 0
 #endif
@@ -0,0 +1,121 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef MESSAGE_BUFFER_H
+#define MESSAGE_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include message_buffer.h"
+#endif
+
+#include "stream_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A message buffer passes variable length messages from a single writer to a
+ * single reader.  It is a stream buffer in which each message is stored
+ * after a 4 byte length header and padded to a multiple of 4 bytes, so
+ * messages are word aligned and can be written in place with
+ * xMessageBufferReserve() / vMessageBufferCommit().  A message that does not
+ * fit before the end of the storage is placed at the start, so every message
+ * is contiguous.  See stream_buffer.h for the behaviour of the functions.
+ *
+ * \defgroup MessageBuffer
+ */
+typedef StreamBufferHandle_t MessageBufferHandle_t;
+
+/* Space a message of xLength bytes takes in the buffer */
+#define sbMESSAGE_SPACE( xLength )	( sizeof( uint32_t ) + ( ( ( xLength ) + 3U ) & ~( size_t ) 3U ) )
+
+#define xMessageBufferCreate( xBufferSizeBytes ) xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( size_t ) 0, pdTRUE )
+#define xMessageBufferSend( xMessageBuffer, pvTxData, xDataLengthBytes, xTicksToWait ) xStreamBufferSend( ( xMessageBuffer ), ( pvTxData ), ( xDataLengthBytes ), ( xTicksToWait ) )
+#define xMessageBufferSendFromISR( xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferSendFromISR( ( xMessageBuffer ), ( pvTxData ), ( xDataLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+#define xMessageBufferReceive( xMessageBuffer, pvRxData, xBufferLengthBytes, xTicksToWait ) xStreamBufferReceive( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( xTicksToWait ) )
+#define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+#define xMessageBufferReserve( xMessageBuffer, ppvData, xLengthBytes ) xStreamBufferReserve( ( xMessageBuffer ), ( ppvData ), ( xLengthBytes ) )
+#define vMessageBufferCommit( xMessageBuffer, xLengthBytes ) vStreamBufferCommit( ( xMessageBuffer ), ( xLengthBytes ) )
+#define vMessageBufferCommitFromISR( xMessageBuffer, xLengthBytes, pxHigherPriorityTaskWoken ) vStreamBufferCommitFromISR( ( xMessageBuffer ), ( xLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+#define xMessageBufferPeek( xMessageBuffer, ppvData ) xStreamBufferPeek( ( xMessageBuffer ), ( ppvData ) )
+#define vMessageBufferConsume( xMessageBuffer ) vStreamBufferConsume( ( xMessageBuffer ), ( size_t ) 0 )
+#define vMessageBufferConsumeFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) vStreamBufferConsumeFromISR( ( xMessageBuffer ), ( size_t ) 0, ( pxHigherPriorityTaskWoken ) )
+#define vMessageBufferDelete( xMessageBuffer ) vStreamBufferDelete( xMessageBuffer )
+#define xMessageBufferReset( xMessageBuffer ) xStreamBufferReset( xMessageBuffer )
+#define xMessageBufferSpacesAvailable( xMessageBuffer ) xStreamBufferSpacesAvailable( xMessageBuffer )
+#define xMessageBufferIsEmpty( xMessageBuffer ) xStreamBufferIsEmpty( xMessageBuffer )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESSAGE_BUFFER_H */
+
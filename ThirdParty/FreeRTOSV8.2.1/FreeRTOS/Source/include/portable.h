@@ -156,6 +156,34 @@ typedef struct HeapRegion
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions );
 
+/* Used by heap_tlsf.c.  Log2 of the largest block the heap can manage. */
+#ifndef configTLSF_FL_INDEX_MAX
+	#define configTLSF_FL_INDEX_MAX	20
+#endif
+
+/* Used by heap_tlsf.c.  Blocks are counted per power of two size class, class
+0 holding all blocks below 64 bytes. */
+#define portTLSF_SIZE_CLASSES	( configTLSF_FL_INDEX_MAX - 5 )
+
+typedef struct xTLSF_HEAP_STATS
+{
+	size_t xTotalHeapSize;			/*<< Bytes available for allocation after region setup. */
+	size_t xFreeBytesRemaining;
+	size_t xMinimumEverFreeBytesRemaining;
+	size_t xLargestFreeBlock;		/*<< Size of the largest free block. */
+	size_t xLargestAllocation;		/*<< Largest pvPortMalloc() size that can currently succeed.  Requests are rounded up to a size class, so this can be below xLargestFreeBlock. */
+	size_t xNumberOfFreeBlocks;
+	uint32_t ulFragmentation;		/*<< 0 to 100, 100 - ( largest free block * 100 / free bytes ). */
+	uint32_t ulFailedAllocations;
+	uint32_t ulAllocations[ portTLSF_SIZE_CLASSES ];	/*<< Successful allocations per size class. */
+	uint32_t ulBlocksInUse[ portTLSF_SIZE_CLASSES ];	/*<< Allocated blocks per size class. */
+} TLSFHeapStats_t;
+
+/*
+ * Fills *pxStats with the allocator statistics of heap_tlsf.c.
+ */
+void vPortGetTLSFHeapStats( TLSFHeapStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
 
 /*
  * Map to the memory management routines required for the port.
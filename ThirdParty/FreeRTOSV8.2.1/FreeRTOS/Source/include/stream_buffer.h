@@ -0,0 +1,322 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include stream_buffer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A stream buffer passes a stream of bytes from a single writer (a task or an
+ * interrupt) to a single reader (a task or an interrupt) without copying the
+ * data one item at a time, as a queue would.  A message buffer (see
+ * message_buffer.h) is a stream buffer that passes variable length messages
+ * instead.
+ *
+ * The writer only updates the head index and the reader only updates the tail
+ * index, so data is written and read without a critical section.  A critical
+ * section is only used to publish the new index and to decide whether the
+ * task on the other side has to be unblocked.  Blocked tasks are unblocked
+ * with a direct to task notification, so a task must not block on a stream
+ * buffer while it also uses its notification value for another purpose.
+ *
+ * xStreamBufferReserve() and vStreamBufferCommit() let the writer place data
+ * directly into the buffer (for example from a DMA or FIFO drain loop) and
+ * make all of it visible with one call.  xStreamBufferPeek() and
+ * vStreamBufferConsume() do the same on the reading side.
+ *
+ * The reading task is only unblocked once the number of bytes in the buffer
+ * reaches the trigger level, so an interrupt producing single samples does not
+ * cause a context switch for each of them.
+ *
+ * There must only ever be one writer and one reader.  If several tasks or
+ * interrupts write to (or read from) the same stream buffer, the calls must be
+ * serialised by the application.
+ *
+ * \defgroup StreamBuffer
+ */
+struct xSTREAM_BUFFER;
+typedef struct xSTREAM_BUFFER * StreamBufferHandle_t;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );</pre>
+ *
+ * Create a stream buffer.  One byte of the buffer is always left unused, so
+ * xBufferSizeBytes - 1 bytes can be held at a time.
+ *
+ * @param xBufferSizeBytes The size of the buffer in bytes.
+ *
+ * @param xTriggerLevelBytes The number of bytes that must be in the buffer
+ * before a task blocked in xStreamBufferReceive() is unblocked.  0 is treated
+ * as 1.
+ *
+ * @return The handle of the stream buffer, or NULL if there was not enough heap
+ * memory to create it.
+ *
+ * \defgroup xStreamBufferCreate xStreamBufferCreate
+ * \ingroup StreamBuffer
+ */
+#define xStreamBufferCreate( xBufferSizeBytes, xTriggerLevelBytes ) xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), pdFALSE )
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait );</pre>
+ *
+ * Copy data into a stream buffer from a task.  As many bytes as fit are
+ * written.  If the buffer is full the calling task blocks for up to
+ * xTicksToWait ticks until there is room for all of xDataLengthBytes.
+ *
+ * @return The number of bytes written.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of xStreamBufferSend() that can be called from an interrupt.  It
+ * never blocks.  *pxHigherPriorityTaskWoken is set to pdTRUE if the reading
+ * task was unblocked and has a higher priority than the interrupted task, in
+ * which case a context switch should be requested before the interrupt exits.
+ *
+ * @return The number of bytes written.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait );</pre>
+ *
+ * Copy data out of a stream buffer from a task.  If the buffer is empty the
+ * calling task blocks for up to xTicksToWait ticks until the trigger level is
+ * reached.  Whatever data is available is then returned, up to
+ * xBufferLengthBytes bytes.
+ *
+ * For a message buffer one complete message is returned.  A message that is
+ * larger than xBufferLengthBytes is left in the buffer and 0 is returned.
+ *
+ * @return The number of bytes read.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of xStreamBufferReceive() that can be called from an interrupt.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer, void **ppvData, size_t xLengthBytes );</pre>
+ *
+ * Reserve space in the buffer for the writer to fill in place.  Can be called
+ * from a task or an interrupt and never blocks.  Nothing becomes visible to the
+ * reader until vStreamBufferCommit() or vStreamBufferCommitFromISR() is
+ * called.  Calling xStreamBufferReserve() again before committing replaces the
+ * previous reservation.
+ *
+ * For a stream buffer the reserved space is contiguous and may be shorter than
+ * requested when it reaches the end of the buffer storage.  Commit what has
+ * been written and reserve again to continue at the start of the storage.
+ *
+ * For a message buffer the space for the whole message is reserved or nothing
+ * is reserved.
+ *
+ * @param ppvData Set to where the data has to be written.
+ *
+ * @return The number of bytes that can be written at *ppvData, 0 if the
+ * buffer is full.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer, void **ppvData, size_t xLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ void vStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes );
+ void vStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * Make xLengthBytes bytes written to the space returned by the last
+ * xStreamBufferReserve() call visible to the reader, and unblock the reader if
+ * the trigger level has been reached.  xLengthBytes must not be larger than
+ * the reserved length.  For a message buffer it is the length of the message,
+ * and 0 cancels the reservation.
+ *
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes ) PRIVILEGED_FUNCTION;
+void vStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer, void **ppvData );</pre>
+ *
+ * Get the oldest data in the buffer without copying it.  Can be called from a
+ * task or an interrupt and never blocks.  For a stream buffer the returned
+ * block is contiguous and may be shorter than xStreamBufferBytesAvailable()
+ * when the data wraps around the end of the storage.  For a message buffer it
+ * is the oldest message.
+ *
+ * @return The number of bytes at *ppvData, 0 if the buffer is empty.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer, void **ppvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ void vStreamBufferConsume( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes );
+ void vStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * Release xLengthBytes bytes returned by xStreamBufferPeek() and unblock a
+ * writer waiting for space.  For a message buffer the whole oldest message is
+ * released and xLengthBytes is ignored.
+ *
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferConsume( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes ) PRIVILEGED_FUNCTION;
+void vStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * Delete a stream buffer.  No task may be blocked on it.
+ *
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * Empty a stream buffer.  Fails and returns pdFAIL if a task is blocked on it.
+ *
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * Change the trigger level.  Returns pdFAIL if xTriggerLevel is larger than
+ * the capacity of the buffer.
+ *
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * Number of bytes that can be read from, or written to, a stream buffer.  For
+ * a message buffer these include the message length headers.
+ *
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#define xStreamBufferIsEmpty( xStreamBuffer ) ( xStreamBufferBytesAvailable( xStreamBuffer ) == ( size_t ) 0 )
+
+/* Not public API functions. */
+StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_BUFFER_H */
+
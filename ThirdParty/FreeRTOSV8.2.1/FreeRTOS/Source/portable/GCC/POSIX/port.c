@@ -0,0 +1,572 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for a Linux (POSIX)
+ * host, used to run and benchmark application code without hardware.
+ *
+ * Each task runs in its own pthread.  Exactly one of those threads runs at
+ * any time, the others wait on a semaphore of their own, so the kernel sees a
+ * single CPU.  Interrupts are simulated with signals: the tick is SIGALRM
+ * from an interval timer, application interrupts raised with
+ * vPortGenerateSimulatedInterrupt() are SIGUSR1.  Only the thread of the
+ * running task ever has those signals unblocked, so blocking them is
+ * equivalent to disabling interrupts.  A context switch performed by a signal
+ * handler suspends the interrupted thread inside the handler.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define portTICK_SIGNAL					SIGALRM
+#define portINTERRUPT_SIGNAL			SIGUSR1
+#define portMAX_INTERRUPTS				( ( uint32_t ) sizeof( uint32_t ) * 8UL ) /* The number of bits in an uint32_t. */
+#define portNO_CRITICAL_NESTING 		( ( UBaseType_t ) 0 )
+
+/* The task stack is only used to hold a Thread_t structure, each thread runs
+on a stack allocated by the C library.  The structure is placed just above the
+stack pointer saved in the TCB, so the thread can be found from a task handle. */
+typedef struct THREAD_STATE
+{
+	pthread_t xThread;				/*< The thread that executes the task. */
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	volatile BaseType_t xDying;		/*< Set when the task has been deleted. */
+	sem_t xWakeUp;					/*< Posted to let the thread run. */
+} Thread_t;
+
+/*
+ * Entry point of the thread created for each task.
+ */
+static void *prvTaskThread( void *pvParameters );
+
+/*
+ * Let pxThreadToResume run and wait until pxThreadToSuspend is resumed in
+ * turn.  Called with the simulated interrupts blocked.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+
+/*
+ * Wait until the thread is resumed, or exit if its task has been deleted.
+ */
+static void prvSuspendSelf( Thread_t *pxThread );
+
+/*
+ * Select the next task and switch to its thread.  Called with the simulated
+ * interrupts blocked.
+ */
+static void prvYield( void );
+
+/*
+ * Signal handlers of the tick and of the application interrupts.
+ */
+static void prvTickSignalHandler( int iSignal );
+static void prvInterruptSignalHandler( int iSignal );
+
+/*
+ * Create the set of signals used to simulate interrupts.
+ */
+static void prvInitialiseSignals( void );
+
+/*-----------------------------------------------------------*/
+
+/* Pointer to the TCB of the currently executing task. */
+extern void * volatile pxCurrentTCB;
+
+/* The critical nesting count for the currently executing task.  Each thread
+keeps its own copy while it is suspended.  This is initialised to a non-zero
+value so the signals are not unblocked in the thread that creates the tasks
+before the scheduler is started. */
+static volatile UBaseType_t uxCriticalNesting = 9999UL;
+
+/* A yield requested inside a critical section is performed when the critical
+section is left, as the PendSV exception is on a Cortex-M. */
+static volatile BaseType_t xYieldPending = pdFALSE;
+
+/* Simulated interrupts waiting to be processed.  This is a bit mask where each
+bit represents one interrupt. */
+static volatile uint32_t ulPendingInterrupts = 0UL;
+
+/* Handlers for the application interrupts. */
+static uint32_t (*ulIsrHandler[ portMAX_INTERRUPTS ])( void ) = { 0 };
+
+/* The signals blocked by portDISABLE_INTERRUPTS(). */
+static sigset_t xInterruptSignals;
+static BaseType_t xSignalsInitialised = pdFALSE;
+
+/* Used to ensure nothing is processed during the startup sequence. */
+static volatile BaseType_t xPortRunning = pdFALSE;
+
+/* Posted by vPortEndScheduler() to return from xPortStartScheduler(). */
+static sem_t xSchedulerEnd;
+
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( void *pvTask )
+{
+StackType_t *pxTopOfStack;
+
+	/* pxTopOfStack is the first member of the TCB. */
+	pxTopOfStack = *( ( StackType_t ** ) pvTask );
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xSavedMask;
+int iResult;
+
+	prvInitialiseSignals();
+
+	/* Place the thread state at the top of the stack. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	iResult = sem_init( &( pxThread->xWakeUp ), 0, 0 );
+	configASSERT( iResult == 0 );
+
+	/* The new thread inherits the signal mask, it must not take a simulated
+	interrupt before it is scheduled.  Blocking them here also keeps this
+	thread from being switched out while the C library holds its locks. */
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xSavedMask );
+	iResult = pthread_create( &( pxThread->xThread ), NULL, prvTaskThread, ( void * ) pxThread );
+	pthread_sigmask( SIG_SETMASK, &xSavedMask, NULL );
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	return ( ( StackType_t * ) pxThread ) - 1;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTaskThread( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	/* Wait until the task is scheduled for the first time. */
+	prvSuspendSelf( pxThread );
+
+	uxCriticalNesting = portNO_CRITICAL_NESTING;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* Tasks must not return, delete the task instead. */
+	vTaskDelete( NULL );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xAction;
+struct itimerval xTimer;
+int iResult;
+
+	prvInitialiseSignals();
+
+	/* The thread that starts the scheduler never runs a task.  It waits for
+	vPortEndScheduler() with the simulated interrupts blocked. */
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+	iResult = sem_init( &xSchedulerEnd, 0, 0 );
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	/* Both handlers run with both signals blocked, so they do not nest.
+	System calls interrupted by a simulated interrupt are restarted. */
+	memset( &xAction, 0x00, sizeof( xAction ) );
+	xAction.sa_mask = xInterruptSignals;
+	xAction.sa_flags = SA_RESTART;
+	xAction.sa_handler = prvTickSignalHandler;
+	sigaction( portTICK_SIGNAL, &xAction, NULL );
+	xAction.sa_handler = prvInterruptSignalHandler;
+	sigaction( portINTERRUPT_SIGNAL, &xAction, NULL );
+
+	xYieldPending = pdFALSE;
+	xPortRunning = pdTRUE;
+
+	/* Start the tick. */
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = 1000000L / configTICK_RATE_HZ;
+	xTimer.it_value = xTimer.it_interval;
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	/* Interrupts raised before the scheduler was started are still pending. */
+	if( ulPendingInterrupts != 0UL )
+	{
+		kill( getpid(), portINTERRUPT_SIGNAL );
+	}
+
+	/* Start the first task. */
+	sem_post( &( prvGetThreadFromTask( pxCurrentTCB )->xWakeUp ) );
+
+	while( sem_wait( &xSchedulerEnd ) != 0 )
+	{
+		/* Interrupted by a signal other than the simulated interrupts. */
+	}
+
+	/* vTaskEndScheduler() was called. */
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+
+	memset( &xTimer, 0x00, sizeof( xTimer ) );
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+	xPortRunning = pdFALSE;
+
+	/* Return from xPortStartScheduler() in the thread that called
+	vTaskStartScheduler().  The task threads are left suspended and end with
+	the process. */
+	sem_post( &xSchedulerEnd );
+
+	vPortDisableInterrupts();
+	for( ;; )
+	{
+		pause();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	while( sem_wait( &( pxThread->xWakeUp ) ) != 0 )
+	{
+		/* EINTR, try again. */
+	}
+
+	if( pxThread->xDying != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		/* The nesting count is saved before the other thread can run. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		sem_post( &( pxThreadToResume->xWakeUp ) );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			/* The task deleted itself.  The thread is joined, and its state
+			freed, by vPortDeleteThread() in the idle task. */
+			pthread_exit( NULL );
+		}
+
+		prvSuspendSelf( pxThreadToSuspend );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvYield( void )
+{
+Thread_t *pxThreadToSuspend;
+
+	xYieldPending = pdFALSE;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+	vTaskSwitchContext();
+	prvSwitchThread( prvGetThreadFromTask( pxCurrentTCB ), pxThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	if( uxCriticalNesting == portNO_CRITICAL_NESTING )
+	{
+		vPortDisableInterrupts();
+		prvYield();
+		vPortEnableInterrupts();
+	}
+	else
+	{
+		/* Performed when the critical section is left. */
+		xYieldPending = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+Thread_t *pxThreadToSuspend;
+
+	( void ) iSignal;
+
+	if( xPortRunning == pdFALSE )
+	{
+		return;
+	}
+
+	/* Critical sections entered from an interrupt must not unblock the
+	signals when they are left. */
+	uxCriticalNesting++;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		vTaskSwitchContext();
+		prvSwitchThread( prvGetThreadFromTask( pxCurrentTCB ), pxThreadToSuspend );
+	}
+
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptSignalHandler( int iSignal )
+{
+Thread_t *pxThreadToSuspend;
+uint32_t ulInterrupts, ulSwitchRequired = pdFALSE, i;
+
+	( void ) iSignal;
+
+	if( xPortRunning == pdFALSE )
+	{
+		/* Raised again when the scheduler starts. */
+		return;
+	}
+
+	uxCriticalNesting++;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+
+	/* Interrupts raised while the handlers run send another signal, which is
+	taken when this handler returns. */
+	ulInterrupts = __atomic_exchange_n( &ulPendingInterrupts, 0UL, __ATOMIC_SEQ_CST );
+
+	for( i = 0; i < portMAX_INTERRUPTS; i++ )
+	{
+		if( ( ( ulInterrupts & ( 1UL << i ) ) != 0UL ) && ( ulIsrHandler[ i ] != NULL ) )
+		{
+			if( ulIsrHandler[ i ]() != pdFALSE )
+			{
+				ulSwitchRequired = pdTRUE;
+			}
+		}
+	}
+
+	if( ulSwitchRequired != pdFALSE )
+	{
+		vTaskSwitchContext();
+		prvSwitchThread( prvGetThreadFromTask( pxCurrentTCB ), pxThreadToSuspend );
+	}
+
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCloseRunningThread( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+	( void ) pxPendYield;
+
+	/* The thread exits when it is switched out by the yield that follows. */
+	prvGetThreadFromTask( pvTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDeleteThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread;
+
+	/* Called from the idle task before the stack holding the thread state is
+	freed.  A task deleted by another task is still suspended, wake it so it
+	can exit, then wait until it has. */
+	pxThread = prvGetThreadFromTask( pvTaskToDelete );
+	pxThread->xDying = pdTRUE;
+	sem_post( &( pxThread->xWakeUp ) );
+	pthread_join( pxThread->xThread, NULL );
+	sem_destroy( &( pxThread->xWakeUp ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+	configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+	if( ulInterruptNumber < portMAX_INTERRUPTS )
+	{
+		__atomic_fetch_or( &ulPendingInterrupts, ( 1UL << ulInterruptNumber ), __ATOMIC_SEQ_CST );
+
+		/* Delivered to the thread of the running task once it has interrupts
+		enabled, no other thread has the signal unblocked. */
+		kill( getpid(), portINTERRUPT_SIGNAL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t (*pvHandler)( void ) )
+{
+	configASSERT( ( ulInterruptNumber >= portFIRST_APPLICATION_INTERRUPT ) && ( ulInterruptNumber < portMAX_INTERRUPTS ) );
+
+	if( ( ulInterruptNumber >= portFIRST_APPLICATION_INTERRUPT ) && ( ulInterruptNumber < portMAX_INTERRUPTS ) )
+	{
+		ulIsrHandler[ ulInterruptNumber ] = pvHandler;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartPeripheralThread( void *( *pvThreadFunction )( void * ), void *pvParameter )
+{
+pthread_t xThread;
+pthread_attr_t xAttributes;
+sigset_t xSavedMask;
+int iResult;
+
+	prvInitialiseSignals();
+
+	pthread_attr_init( &xAttributes );
+	pthread_attr_setdetachstate( &xAttributes, PTHREAD_CREATE_DETACHED );
+
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xSavedMask );
+	iResult = pthread_create( &xThread, &xAttributes, pvThreadFunction, pvParameter );
+	pthread_sigmask( SIG_SETMASK, &xSavedMask, NULL );
+
+	pthread_attr_destroy( &xAttributes );
+
+	return ( iResult == 0 ) ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	pthread_sigmask( SIG_UNBLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	if( uxCriticalNesting > portNO_CRITICAL_NESTING )
+	{
+		uxCriticalNesting--;
+
+		if( uxCriticalNesting == portNO_CRITICAL_NESTING )
+		{
+			if( xYieldPending != pdFALSE )
+			{
+				prvYield();
+			}
+
+			vPortEnableInterrupts();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseSignals( void )
+{
+	if( xSignalsInitialised == pdFALSE )
+	{
+		sigemptyset( &xInterruptSignals );
+		sigaddset( &xInterruptSignals, portTICK_SIGNAL );
+		sigaddset( &xInterruptSignals, portINTERRUPT_SIGNAL );
+		xSignalsInitialised = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,733 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() based on the Two Level
+ * Segregated Fit (TLSF) algorithm.  Both functions execute in constant time,
+ * independent of the number of free blocks, so allocation latency does not
+ * grow as the heap fragments.  Adjacent free blocks are combined (coalesced)
+ * as they are freed.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * Free blocks are kept in size segregated lists.  The first level splits sizes
+ * into powers of two, the second level splits each power of two into eight
+ * linear ranges.  A bitmap per level records which lists are not empty, so a
+ * suitable list is found with a couple of bit scans rather than a list walk.
+ *
+ * Like heap_4.c the heap starts out as the ucHeap array of
+ * configTOTAL_HEAP_SIZE bytes (internal SRAM).  Like heap_5.c further memory,
+ * for example SRAM on the external bus interface, can be added by passing an
+ * array of HeapRegion_t structures to vPortDefineHeapRegions().  The regions
+ * need not be in address order, but must not overlap, and the function can
+ * only be called once.
+ *
+ * configTLSF_FL_INDEX_MAX sets the largest block that can be managed to
+ * 2 ^ configTLSF_FL_INDEX_MAX bytes.  Larger regions are added as several
+ * blocks.
+ *
+ * vPortGetTLSFHeapStats() reports allocations per size class, the largest free
+ * block and a fragmentation figure.
+ */
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* Blocks are aligned to, and sized in multiples of, 8 bytes. */
+#define tlsfALIGN_SIZE_LOG2		( 3 )
+#define tlsfALIGN_SIZE			( ( size_t ) 1 << tlsfALIGN_SIZE_LOG2 )
+
+/* Number of second level lists per first level, as a power of two. */
+#define tlsfSL_INDEX_COUNT_LOG2	( 3 )
+#define tlsfSL_INDEX_COUNT		( 1 << tlsfSL_INDEX_COUNT_LOG2 )
+
+/* Blocks below tlsfSMALL_BLOCK_SIZE all go to first level list 0, which is
+split linearly. */
+#define tlsfFL_INDEX_SHIFT		( tlsfSL_INDEX_COUNT_LOG2 + tlsfALIGN_SIZE_LOG2 )
+#define tlsfFL_INDEX_COUNT		( configTLSF_FL_INDEX_MAX - tlsfFL_INDEX_SHIFT + 1 )
+#define tlsfSMALL_BLOCK_SIZE	( ( size_t ) 1 << tlsfFL_INDEX_SHIFT )
+
+/* Largest payload of a single block. */
+#define tlsfMAX_BLOCK_SIZE		( ( ( size_t ) 1 << configTLSF_FL_INDEX_MAX ) - tlsfALIGN_SIZE )
+
+/* The low bit of xSize is free because sizes are multiples of tlsfALIGN_SIZE. */
+#define tlsfBLOCK_FREE_BIT		( ( size_t ) 1 )
+
+/* Each block starts with a header.  The free list pointers overlay the
+payload, so only pxPrevPhysBlock and xSize are overhead on allocated blocks. */
+typedef struct TLSF_BLOCK
+{
+	struct TLSF_BLOCK *pxPrevPhysBlock;	/*<< The block before this one in memory, NULL for the first block of a region. */
+	size_t xSize;						/*<< Size of the payload, and tlsfBLOCK_FREE_BIT. */
+	struct TLSF_BLOCK *pxNextFree;		/*<< Next block in the same free list, only valid while free. */
+	struct TLSF_BLOCK *pxPrevFree;		/*<< Previous block in the same free list, only valid while free. */
+} TLSFBlock_t;
+
+#define tlsfHEADER_SIZE			( ( size_t ) offsetof( TLSFBlock_t, pxNextFree ) )
+#define tlsfMIN_BLOCK_SIZE		( sizeof( TLSFBlock_t ) - tlsfHEADER_SIZE )
+
+#define tlsfBLOCK_SIZE( pxBlock )		( ( pxBlock )->xSize & ~tlsfBLOCK_FREE_BIT )
+#define tlsfBLOCK_IS_FREE( pxBlock )	( ( ( pxBlock )->xSize & tlsfBLOCK_FREE_BIT ) != 0 )
+#define tlsfBLOCK_PAYLOAD( pxBlock )	( ( void * ) ( ( ( uint8_t * ) ( pxBlock ) ) + tlsfHEADER_SIZE ) )
+#define tlsfBLOCK_FROM_PAYLOAD( pv )	( ( TLSFBlock_t * ) ( ( ( uint8_t * ) ( pv ) ) - tlsfHEADER_SIZE ) )
+#define tlsfNEXT_PHYS_BLOCK( pxBlock )	( ( TLSFBlock_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + tlsfHEADER_SIZE + tlsfBLOCK_SIZE( pxBlock ) ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Index of the most significant set bit of ulValue, which must not be 0.
+ */
+static BaseType_t prvFLS( uint32_t ulValue );
+
+/*
+ * Calculate the first and second level list indexes of a block of xSize
+ * bytes.
+ */
+static void prvMappingInsert( size_t xSize, BaseType_t *pxFL, BaseType_t *pxSL );
+
+/*
+ * Find a free block of at least xSize bytes in constant time, or return NULL.
+ */
+static TLSFBlock_t *prvFindSuitableBlock( size_t xSize );
+
+/*
+ * Add a block to, or remove it from, the free list matching its size.
+ */
+static void prvInsertFreeBlock( TLSFBlock_t *pxBlock );
+static void prvRemoveFreeBlock( TLSFBlock_t *pxBlock );
+
+/*
+ * Add a memory region to the heap.
+ */
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes );
+
+/*
+ * Called automatically to setup the ucHeap region on the first call to
+ * pvPortMalloc() or vPortDefineHeapRegions().
+ */
+static void prvHeapInit( void );
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Bitmap of first level lists that have a non empty second level list, and
+a bitmap per first level of the non empty second level lists. */
+static uint32_t ulFLBitmap = 0;
+static uint32_t ulSLBitmap[ tlsfFL_INDEX_COUNT ];
+
+/* Heads of the segregated free lists. */
+static TLSFBlock_t *pxFreeLists[ tlsfFL_INDEX_COUNT ][ tlsfSL_INDEX_COUNT ];
+
+static BaseType_t xHeapInitialised = pdFALSE;
+static BaseType_t xRegionsDefined = pdFALSE;
+
+/* Keeps track of the number of free bytes remaining, and the statistics
+reported by vPortGetTLSFHeapStats(). */
+static size_t xTotalHeapSize = 0;
+static size_t xFreeBytesRemaining = 0;
+static size_t xMinimumEverFreeBytesRemaining = 0;
+static size_t xNumberOfFreeBlocks = 0;
+static uint32_t ulFailedAllocations = 0;
+static uint32_t ulAllocations[ tlsfFL_INDEX_COUNT ];
+static uint32_t ulBlocksInUse[ tlsfFL_INDEX_COUNT ];
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+TLSFBlock_t *pxBlock, *pxRemainder;
+BaseType_t xFL, xSL;
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		if( xHeapInitialised == pdFALSE )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= tlsfMAX_BLOCK_SIZE ) )
+		{
+			/* Ensure that blocks are always aligned to the required number of
+			bytes, and can hold the free list pointers once freed. */
+			xWantedSize = ( xWantedSize + ( tlsfALIGN_SIZE - 1 ) ) & ~( tlsfALIGN_SIZE - 1 );
+			if( xWantedSize < tlsfMIN_BLOCK_SIZE )
+			{
+				xWantedSize = tlsfMIN_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxBlock = prvFindSuitableBlock( xWantedSize );
+
+			if( pxBlock != NULL )
+			{
+				prvRemoveFreeBlock( pxBlock );
+
+				/* If the block is larger than required it can be split into
+				two, the remainder going back to the free lists. */
+				if( tlsfBLOCK_SIZE( pxBlock ) >= ( xWantedSize + sizeof( TLSFBlock_t ) ) )
+				{
+					pxRemainder = ( TLSFBlock_t * ) ( ( ( uint8_t * ) tlsfBLOCK_PAYLOAD( pxBlock ) ) + xWantedSize );
+					pxRemainder->xSize = tlsfBLOCK_SIZE( pxBlock ) - xWantedSize - tlsfHEADER_SIZE;
+					pxRemainder->pxPrevPhysBlock = pxBlock;
+					tlsfNEXT_PHYS_BLOCK( pxRemainder )->pxPrevPhysBlock = pxRemainder;
+					pxBlock->xSize = xWantedSize;
+					xFreeBytesRemaining -= tlsfHEADER_SIZE;
+					prvInsertFreeBlock( pxRemainder );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xFreeBytesRemaining -= tlsfBLOCK_SIZE( pxBlock );
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvMappingInsert( tlsfBLOCK_SIZE( pxBlock ), &xFL, &xSL );
+				ulAllocations[ xFL ]++;
+				ulBlocksInUse[ xFL ]++;
+
+				pvReturn = tlsfBLOCK_PAYLOAD( pxBlock );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pvReturn == NULL )
+		{
+			ulFailedAllocations++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+TLSFBlock_t *pxBlock, *pxNeighbour;
+BaseType_t xFL, xSL;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a TLSFBlock_t header immediately
+		before it. */
+		pxBlock = tlsfBLOCK_FROM_PAYLOAD( pv );
+
+		/* Check the block is actually allocated. */
+		configASSERT( !tlsfBLOCK_IS_FREE( pxBlock ) );
+
+		if( !tlsfBLOCK_IS_FREE( pxBlock ) )
+		{
+			vTaskSuspendAll();
+			{
+				prvMappingInsert( tlsfBLOCK_SIZE( pxBlock ), &xFL, &xSL );
+				ulBlocksInUse[ xFL ]--;
+
+				xFreeBytesRemaining += tlsfBLOCK_SIZE( pxBlock );
+				traceFREE( pv, tlsfBLOCK_SIZE( pxBlock ) );
+
+				/* Merge with the block before it in memory if that is free. */
+				pxNeighbour = pxBlock->pxPrevPhysBlock;
+				if( ( pxNeighbour != NULL ) && tlsfBLOCK_IS_FREE( pxNeighbour ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xSize = tlsfBLOCK_SIZE( pxNeighbour ) + tlsfHEADER_SIZE + tlsfBLOCK_SIZE( pxBlock );
+					pxBlock = pxNeighbour;
+					tlsfNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+					xFreeBytesRemaining += tlsfHEADER_SIZE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Merge with the block after it in memory if that is free.  The
+				last block of a region is a zero sized end marker that is never
+				free. */
+				pxNeighbour = tlsfNEXT_PHYS_BLOCK( pxBlock );
+				if( tlsfBLOCK_IS_FREE( pxNeighbour ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxBlock->xSize = tlsfBLOCK_SIZE( pxBlock ) + tlsfHEADER_SIZE + tlsfBLOCK_SIZE( pxNeighbour );
+					tlsfNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+					xFreeBytesRemaining += tlsfHEADER_SIZE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvInsertFreeBlock( pxBlock );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+const HeapRegion_t *pxHeapRegion;
+
+	/* Can only call once! */
+	configASSERT( xRegionsDefined == pdFALSE );
+
+	vTaskSuspendAll();
+	{
+		if( xHeapInitialised == pdFALSE )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( pxHeapRegion = pxHeapRegions; pxHeapRegion->xSizeInBytes > 0; pxHeapRegion++ )
+		{
+			prvAddRegion( pxHeapRegion->pucStartAddress, pxHeapRegion->xSizeInBytes );
+		}
+
+		xRegionsDefined = pdTRUE;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetTLSFHeapStats( TLSFHeapStats_t *pxStats )
+{
+TLSFBlock_t *pxBlock;
+BaseType_t xFL, xSL;
+
+	vTaskSuspendAll();
+	{
+		pxStats->xTotalHeapSize = xTotalHeapSize;
+		pxStats->xFreeBytesRemaining = xFreeBytesRemaining;
+		pxStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+		pxStats->ulFailedAllocations = ulFailedAllocations;
+		memcpy( pxStats->ulAllocations, ulAllocations, sizeof( ulAllocations ) );
+		memcpy( pxStats->ulBlocksInUse, ulBlocksInUse, sizeof( ulBlocksInUse ) );
+
+		/* The largest free block is in the highest non empty list. */
+		pxStats->xLargestFreeBlock = 0;
+		if( ulFLBitmap != 0 )
+		{
+			xFL = prvFLS( ulFLBitmap );
+			xSL = prvFLS( ulSLBitmap[ xFL ] );
+			for( pxBlock = pxFreeLists[ xFL ][ xSL ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFree )
+			{
+				if( tlsfBLOCK_SIZE( pxBlock ) > pxStats->xLargestFreeBlock )
+				{
+					pxStats->xLargestFreeBlock = tlsfBLOCK_SIZE( pxBlock );
+				}
+			}
+		}
+
+		/* A request is rounded up to the next list boundary before the search,
+		so the largest one that succeeds is the largest free block rounded down
+		to the start of its list.  The lists below tlsfSMALL_BLOCK_SIZE hold a
+		single size each. */
+		pxStats->xLargestAllocation = pxStats->xLargestFreeBlock;
+		if( pxStats->xLargestAllocation >= tlsfSMALL_BLOCK_SIZE )
+		{
+			pxStats->xLargestAllocation &= ~( ( ( size_t ) 1 << ( prvFLS( ( uint32_t ) pxStats->xLargestAllocation ) - tlsfSL_INDEX_COUNT_LOG2 ) ) - 1 );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xFreeBytesRemaining > 0 )
+		{
+			pxStats->ulFragmentation = 100UL - ( uint32_t ) ( ( ( uint64_t ) pxStats->xLargestFreeBlock * 100ULL ) / xFreeBytesRemaining );
+		}
+		else
+		{
+			pxStats->ulFragmentation = 0;
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvFLS( uint32_t ulValue )
+{
+BaseType_t xBit = 0;
+
+	/* Binary search, so the time taken does not depend on the value. */
+	if( ( ulValue & 0xffff0000UL ) != 0 ) { ulValue >>= 16; xBit += 16; }
+	if( ( ulValue & 0x0000ff00UL ) != 0 ) { ulValue >>= 8; xBit += 8; }
+	if( ( ulValue & 0x000000f0UL ) != 0 ) { ulValue >>= 4; xBit += 4; }
+	if( ( ulValue & 0x0000000cUL ) != 0 ) { ulValue >>= 2; xBit += 2; }
+	if( ( ulValue & 0x00000002UL ) != 0 ) { xBit += 1; }
+
+	return xBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xSize, BaseType_t *pxFL, BaseType_t *pxSL )
+{
+BaseType_t xFL;
+
+	if( xSize < tlsfSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are stored in the first list, split linearly. */
+		*pxFL = 0;
+		*pxSL = ( BaseType_t ) ( xSize / ( tlsfSMALL_BLOCK_SIZE / tlsfSL_INDEX_COUNT ) );
+	}
+	else
+	{
+		xFL = prvFLS( ( uint32_t ) xSize );
+		*pxSL = ( BaseType_t ) ( ( xSize >> ( xFL - tlsfSL_INDEX_COUNT_LOG2 ) ) ^ ( 1 << tlsfSL_INDEX_COUNT_LOG2 ) );
+		*pxFL = xFL - ( tlsfFL_INDEX_SHIFT - 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TLSFBlock_t *prvFindSuitableBlock( size_t xSize )
+{
+BaseType_t xFL, xSL;
+uint32_t ulMap;
+
+	/* Round the size up to the next list boundary, so that any block in the
+	list found is large enough. */
+	if( xSize >= tlsfSMALL_BLOCK_SIZE )
+	{
+		xSize += ( ( size_t ) 1 << ( prvFLS( ( uint32_t ) xSize ) - tlsfSL_INDEX_COUNT_LOG2 ) ) - 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMappingInsert( xSize, &xFL, &xSL );
+
+	if( xFL >= tlsfFL_INDEX_COUNT )
+	{
+		return NULL;
+	}
+
+	/* Search for a list at this first level with large enough blocks. */
+	ulMap = ulSLBitmap[ xFL ] & ( ~0UL << xSL );
+	if( ulMap == 0 )
+	{
+		/* None, so take the smallest non empty first level above it.  Shifting
+		by the full width of the bitmap is undefined, and there is no level
+		above the last one anyway. */
+		if( ( xFL + 1 ) < 32 )
+		{
+			ulMap = ulFLBitmap & ( ( uint32_t ) 0xffffffffUL << ( xFL + 1 ) );
+		}
+		else
+		{
+			ulMap = 0;
+		}
+
+		if( ulMap == 0 )
+		{
+			return NULL;
+		}
+
+		xFL = prvFLS( ulMap & ( ~ulMap + 1 ) );
+		ulMap = ulSLBitmap[ xFL ];
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSL = prvFLS( ulMap & ( ~ulMap + 1 ) );
+
+	return pxFreeLists[ xFL ][ xSL ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TLSFBlock_t *pxBlock )
+{
+BaseType_t xFL, xSL;
+
+	prvMappingInsert( tlsfBLOCK_SIZE( pxBlock ), &xFL, &xSL );
+
+	pxBlock->xSize |= tlsfBLOCK_FREE_BIT;
+	pxBlock->pxPrevFree = NULL;
+	pxBlock->pxNextFree = pxFreeLists[ xFL ][ xSL ];
+	if( pxBlock->pxNextFree != NULL )
+	{
+		pxBlock->pxNextFree->pxPrevFree = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ xFL ][ xSL ] = pxBlock;
+	ulFLBitmap |= ( 1UL << xFL );
+	ulSLBitmap[ xFL ] |= ( 1UL << xSL );
+	xNumberOfFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TLSFBlock_t *pxBlock )
+{
+BaseType_t xFL, xSL;
+
+	prvMappingInsert( tlsfBLOCK_SIZE( pxBlock ), &xFL, &xSL );
+
+	if( pxBlock->pxNextFree != NULL )
+	{
+		pxBlock->pxNextFree->pxPrevFree = pxBlock->pxPrevFree;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFree != NULL )
+	{
+		pxBlock->pxPrevFree->pxNextFree = pxBlock->pxNextFree;
+	}
+	else
+	{
+		/* The block was the head of its list.  Clear the bitmap bits if the
+		list is now empty. */
+		pxFreeLists[ xFL ][ xSL ] = pxBlock->pxNextFree;
+		if( pxBlock->pxNextFree == NULL )
+		{
+			ulSLBitmap[ xFL ] &= ~( 1UL << xSL );
+			if( ulSLBitmap[ xFL ] == 0 )
+			{
+				ulFLBitmap &= ~( 1UL << xFL );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	pxBlock->xSize &= ~tlsfBLOCK_FREE_BIT;
+	xNumberOfFreeBlocks--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+TLSFBlock_t *pxBlock, *pxEnd;
+size_t xBlockSize;
+portPOINTER_SIZE_TYPE ulAddress;
+
+	/* Ensure the region starts on a correctly aligned boundary. */
+	ulAddress = ( portPOINTER_SIZE_TYPE ) pucStartAddress;
+	if( ( ulAddress & ( tlsfALIGN_SIZE - 1 ) ) != 0 )
+	{
+		ulAddress = ( ulAddress + ( tlsfALIGN_SIZE - 1 ) ) & ~( tlsfALIGN_SIZE - 1 );
+		xSizeInBytes -= ulAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	xSizeInBytes &= ~( tlsfALIGN_SIZE - 1 );
+
+	/* Each block needs its own header and each region a zero sized end
+	marker.  Regions too large for one block are added as several blocks. */
+	while( xSizeInBytes >= ( 2 * tlsfHEADER_SIZE ) + tlsfMIN_BLOCK_SIZE )
+	{
+		xBlockSize = xSizeInBytes - ( 2 * tlsfHEADER_SIZE );
+		if( xBlockSize > tlsfMAX_BLOCK_SIZE )
+		{
+			xBlockSize = tlsfMAX_BLOCK_SIZE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxBlock = ( TLSFBlock_t * ) ulAddress;
+		pxBlock->pxPrevPhysBlock = NULL;
+		pxBlock->xSize = xBlockSize;
+
+		/* The end marker is never free, so blocks are not merged across it. */
+		pxEnd = tlsfNEXT_PHYS_BLOCK( pxBlock );
+		pxEnd->pxPrevPhysBlock = pxBlock;
+		pxEnd->xSize = 0;
+
+		prvInsertFreeBlock( pxBlock );
+
+		xTotalHeapSize += xBlockSize;
+		xFreeBytesRemaining += xBlockSize;
+		xMinimumEverFreeBytesRemaining += xBlockSize;
+
+		ulAddress += xBlockSize + ( 2 * tlsfHEADER_SIZE );
+		xSizeInBytes -= xBlockSize + ( 2 * tlsfHEADER_SIZE );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+	/* The first level bitmap is a uint32_t. */
+	configASSERT( tlsfFL_INDEX_COUNT <= 32 );
+
+	prvAddRegion( ucHeap, configTOTAL_HEAP_SIZE );
+
+	xHeapInitialised = pdTRUE;
+}
@@ -0,0 +1,894 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use stream buffers.
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to use stream buffers.
+#endif
+
+/* Stops the compiler from moving accesses to the buffer storage across the
+update of the index that publishes them.  The Cortex-M core does not reorder
+them itself. */
+#ifndef sbCOMPILER_BARRIER
+	#if defined( __CC_ARM )
+		#define sbCOMPILER_BARRIER()	__memory_changed()
+	#elif defined( __GNUC__ ) || defined( __ICCARM__ )
+		#define sbCOMPILER_BARRIER()	__asm volatile( "" ::: "memory" )
+	#else
+		#define sbCOMPILER_BARRIER()
+	#endif
+#endif
+
+/* Length header value that tells the reader the rest of the storage is unused
+and the next message starts at the beginning. */
+#define sbPADDING					( ( uint32_t ) 0xffffffffUL )
+
+#define sbHEADER_SIZE				( sizeof( uint32_t ) )
+
+/* The storage follows the structure, aligned as returned by pvPortMalloc(). */
+#define sbSTRUCT_SIZE				( ( sizeof( StreamBuffer_t ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+typedef struct xSTREAM_BUFFER
+{
+	volatile size_t xTail;						/*< Next byte to read.  Only written by the reader. */
+	volatile size_t xHead;						/*< Next byte to write.  Only written by the writer. */
+	size_t xLength;								/*< Size of the storage in bytes. */
+	size_t xTriggerLevelBytes;					/*< Bytes needed to unblock the reading task. */
+	size_t xReservedStart;						/*< Offset of the last reservation. */
+	size_t xReservedLength;						/*< Length of the last reservation. */
+	volatile TaskHandle_t xTaskWaitingToReceive;	/*< Reading task blocked on the buffer, or NULL. */
+	volatile TaskHandle_t xTaskWaitingToSend;	/*< Writing task blocked on the buffer, or NULL. */
+	uint8_t *pucBuffer;							/*< Storage. */
+	BaseType_t xIsMessageBuffer;
+} StreamBuffer_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Number of bytes between the tail and the head.
+ */
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer );
+
+/*
+ * Find room for xLength bytes written in place.  For a stream buffer the
+ * contiguous space at the head, limited to xLength, is returned.  For a
+ * message buffer the space for the whole message is found, at the head or at
+ * the start of the storage, or 0 is returned.  The result is remembered for
+ * prvCommit().
+ */
+static size_t prvReserve( StreamBuffer_t * const pxStreamBuffer, size_t xLength );
+
+/*
+ * Publish xLength bytes written to the last reservation, and notify the
+ * reading task if the trigger level has been reached.  pxHigherPriorityTaskWoken
+ * is NULL when called from a task.
+ */
+static void prvCommit( StreamBuffer_t * const pxStreamBuffer, size_t xLength, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*
+ * Find the oldest data, returns its length and sets *pxStart to its offset.
+ * For a message buffer this is the payload of the oldest message.
+ */
+static size_t prvPeek( const StreamBuffer_t * const pxStreamBuffer, size_t *pxStart );
+
+/*
+ * Release xLength bytes starting at the tail (or the oldest message), and
+ * notify the writing task.  pxHigherPriorityTaskWoken is NULL when called from
+ * a task.
+ */
+static void prvConsume( StreamBuffer_t * const pxStreamBuffer, size_t xLength, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*
+ * Copy as much of pvTxData as fits into the buffer and commit it.
+ */
+static size_t prvWrite( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*
+ * Copy data out of the buffer and consume it.
+ */
+static size_t prvRead( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*-----------------------------------------------------------*/
+
+StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer )
+{
+StreamBuffer_t *pxStreamBuffer;
+
+	if( xIsMessageBuffer != pdFALSE )
+	{
+		/* Keep every message header word aligned. */
+		xBufferSizeBytes = ( xBufferSizeBytes + 3U ) & ~( size_t ) 3U;
+		configASSERT( xBufferSizeBytes > sbMESSAGE_SPACE( 1U ) );
+		xTriggerLevelBytes = 1U;
+	}
+	else
+	{
+		configASSERT( xBufferSizeBytes > 1U );
+		configASSERT( xTriggerLevelBytes < xBufferSizeBytes );
+		if( xTriggerLevelBytes == 0U )
+		{
+			xTriggerLevelBytes = 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	pxStreamBuffer = ( StreamBuffer_t * ) pvPortMalloc( sbSTRUCT_SIZE + xBufferSizeBytes );
+
+	if( pxStreamBuffer != NULL )
+	{
+		memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+		pxStreamBuffer->pucBuffer = ( ( uint8_t * ) pxStreamBuffer ) + sbSTRUCT_SIZE;
+		pxStreamBuffer->xLength = xBufferSizeBytes;
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+		pxStreamBuffer->xIsMessageBuffer = xIsMessageBuffer;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( StreamBufferHandle_t ) pxStreamBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+	configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+
+	vPortFree( ( void * ) pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxStreamBuffer );
+
+	taskENTER_CRITICAL();
+	{
+		if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+		{
+			pxStreamBuffer->xHead = 0U;
+			pxStreamBuffer->xTail = 0U;
+			pxStreamBuffer->xReservedLength = 0U;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xTriggerLevel == 0U )
+	{
+		xTriggerLevel = 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ( pxStreamBuffer->xIsMessageBuffer == pdFALSE ) && ( xTriggerLevel < pxStreamBuffer->xLength ) )
+	{
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevel;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+	configASSERT( xStreamBuffer );
+
+	return prvBytesInBuffer( ( StreamBuffer_t * ) xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	/* One byte is kept free so a full buffer can be told from an empty one. */
+	return pxStreamBuffer->xLength - prvBytesInBuffer( pxStreamBuffer ) - 1U;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+TimeOut_t xTimeOut;
+size_t xWanted;
+BaseType_t xMustWait;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvTxData );
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* A stream buffer waits until all the data fits, or until the buffer
+		is empty if the data is larger than the buffer. */
+		xWanted = xDataLengthBytes;
+		if( xWanted > pxStreamBuffer->xLength - 1U )
+		{
+			xWanted = pxStreamBuffer->xLength - 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskSetTimeOutState( &xTimeOut );
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxStreamBuffer->xIsMessageBuffer != pdFALSE )
+				{
+					xMustWait = ( prvReserve( pxStreamBuffer, xDataLengthBytes ) == 0U ) ? pdTRUE : pdFALSE;
+				}
+				else
+				{
+					xMustWait = ( xStreamBufferSpacesAvailable( xStreamBuffer ) < xWanted ) ? pdTRUE : pdFALSE;
+				}
+
+				if( xMustWait != pdFALSE )
+				{
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( ( xMustWait == pdFALSE ) || ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) )
+			{
+				break;
+			}
+
+			/* The notification count is cleared, so a notification left over
+			from an earlier wait only causes one more pass of the loop. */
+			( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+		}
+
+		pxStreamBuffer->xTaskWaitingToSend = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return prvWrite( pxStreamBuffer, pvTxData, xDataLengthBytes, NULL );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	configASSERT( xStreamBuffer );
+	configASSERT( pvTxData );
+
+	return prvWrite( ( StreamBuffer_t * ) xStreamBuffer, pvTxData, xDataLengthBytes,
+					 ( pxHigherPriorityTaskWoken != NULL ) ? pxHigherPriorityTaskWoken : &xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+TimeOut_t xTimeOut;
+BaseType_t xMustWait;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvRxData );
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( prvBytesInBuffer( pxStreamBuffer ) == 0U )
+				{
+					pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+					xMustWait = pdTRUE;
+				}
+				else
+				{
+					xMustWait = pdFALSE;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( ( xMustWait == pdFALSE ) || ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) )
+			{
+				break;
+			}
+
+			/* Notified by the writer once the trigger level is reached. */
+			( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+		}
+
+		pxStreamBuffer->xTaskWaitingToReceive = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return prvRead( pxStreamBuffer, pvRxData, xBufferLengthBytes, NULL );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	configASSERT( xStreamBuffer );
+	configASSERT( pvRxData );
+
+	return prvRead( ( StreamBuffer_t * ) xStreamBuffer, pvRxData, xBufferLengthBytes,
+					( pxHigherPriorityTaskWoken != NULL ) ? pxHigherPriorityTaskWoken : &xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer, void **ppvData, size_t xLengthBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ppvData );
+
+	xReturn = prvReserve( pxStreamBuffer, xLengthBytes );
+
+	if( pxStreamBuffer->xIsMessageBuffer != pdFALSE )
+	{
+		*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xReservedStart + sbHEADER_SIZE ] );
+	}
+	else
+	{
+		*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xReservedStart ] );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes )
+{
+	configASSERT( xStreamBuffer );
+
+	prvCommit( ( StreamBuffer_t * ) xStreamBuffer, xLengthBytes, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	configASSERT( xStreamBuffer );
+
+	prvCommit( ( StreamBuffer_t * ) xStreamBuffer, xLengthBytes,
+			   ( pxHigherPriorityTaskWoken != NULL ) ? pxHigherPriorityTaskWoken : &xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer, void **ppvData )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xStart, xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ppvData );
+
+	xReturn = prvPeek( pxStreamBuffer, &xStart );
+	*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ xStart ] );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferConsume( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes )
+{
+	configASSERT( xStreamBuffer );
+
+	prvConsume( ( StreamBuffer_t * ) xStreamBuffer, xLengthBytes, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer, size_t xLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	configASSERT( xStreamBuffer );
+
+	prvConsume( ( StreamBuffer_t * ) xStreamBuffer, xLengthBytes,
+				( pxHigherPriorityTaskWoken != NULL ) ? pxHigherPriorityTaskWoken : &xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+size_t xHead, xTail;
+
+	xHead = pxStreamBuffer->xHead;
+	xTail = pxStreamBuffer->xTail;
+
+	if( xHead >= xTail )
+	{
+		return xHead - xTail;
+	}
+	else
+	{
+		return pxStreamBuffer->xLength - xTail + xHead;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReserve( StreamBuffer_t * const pxStreamBuffer, size_t xLength )
+{
+size_t xHead, xTail, xSpace, xReturn = 0U;
+
+	xHead = pxStreamBuffer->xHead;
+	xTail = pxStreamBuffer->xTail;
+	pxStreamBuffer->xReservedStart = xHead;
+
+	if( pxStreamBuffer->xIsMessageBuffer == pdFALSE )
+	{
+		/* Contiguous space at the head.  The head may not catch up with the
+		tail. */
+		if( xHead >= xTail )
+		{
+			xSpace = pxStreamBuffer->xLength - xHead;
+			if( xTail == 0U )
+			{
+				xSpace--;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xSpace = xTail - xHead - 1U;
+		}
+
+		xReturn = ( xLength < xSpace ) ? xLength : xSpace;
+	}
+	else if( xLength > 0U )
+	{
+		/* Offsets and lengths are multiples of 4, so keeping one byte free
+		means keeping one word free. */
+		xSpace = sbMESSAGE_SPACE( xLength );
+
+		if( xHead >= xTail )
+		{
+			if( pxStreamBuffer->xLength - xHead - ( ( xTail == 0U ) ? sbHEADER_SIZE : 0U ) >= xSpace )
+			{
+				xReturn = xLength;
+			}
+			else if( ( xTail > sbHEADER_SIZE ) && ( xTail - sbHEADER_SIZE >= xSpace ) )
+			{
+				/* Wrap to the start, prvCommit() writes the padding marker. */
+				pxStreamBuffer->xReservedStart = 0U;
+				xReturn = xLength;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( xTail - xHead - sbHEADER_SIZE >= xSpace )
+		{
+			xReturn = xLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xReservedLength = xReturn;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommit( StreamBuffer_t * const pxStreamBuffer, size_t xLength, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+size_t xStart, xNewHead;
+UBaseType_t uxSavedInterruptStatus = 0;
+
+	configASSERT( xLength <= pxStreamBuffer->xReservedLength );
+
+	if( xLength == 0U )
+	{
+		pxStreamBuffer->xReservedLength = 0U;
+		return;
+	}
+
+	xStart = pxStreamBuffer->xReservedStart;
+
+	if( pxStreamBuffer->xIsMessageBuffer != pdFALSE )
+	{
+		if( xStart != pxStreamBuffer->xHead )
+		{
+			*( ( uint32_t * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] ) ) = sbPADDING;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		*( ( uint32_t * ) &( pxStreamBuffer->pucBuffer[ xStart ] ) ) = ( uint32_t ) xLength;
+		xNewHead = xStart + sbMESSAGE_SPACE( xLength );
+	}
+	else
+	{
+		xNewHead = xStart + xLength;
+	}
+
+	if( xNewHead >= pxStreamBuffer->xLength )
+	{
+		xNewHead = 0U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xReservedLength = 0U;
+
+	if( pxHigherPriorityTaskWoken == NULL )
+	{
+		taskENTER_CRITICAL();
+	}
+	else
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	}
+	{
+		sbCOMPILER_BARRIER();
+		pxStreamBuffer->xHead = xNewHead;
+
+		if( ( pxStreamBuffer->xTaskWaitingToReceive != NULL ) && ( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes ) )
+		{
+			if( pxHigherPriorityTaskWoken == NULL )
+			{
+				( void ) xTaskNotifyGive( pxStreamBuffer->xTaskWaitingToReceive );
+			}
+			else
+			{
+				vTaskNotifyGiveFromISR( pxStreamBuffer->xTaskWaitingToReceive, pxHigherPriorityTaskWoken );
+			}
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	if( pxHigherPriorityTaskWoken == NULL )
+	{
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPeek( const StreamBuffer_t * const pxStreamBuffer, size_t *pxStart )
+{
+size_t xHead, xTail;
+uint32_t ulHeader;
+
+	xHead = pxStreamBuffer->xHead;
+	xTail = pxStreamBuffer->xTail;
+	sbCOMPILER_BARRIER();
+
+	*pxStart = xTail;
+
+	if( xHead == xTail )
+	{
+		return 0U;
+	}
+
+	if( pxStreamBuffer->xIsMessageBuffer == pdFALSE )
+	{
+		return ( xHead > xTail ) ? ( xHead - xTail ) : ( pxStreamBuffer->xLength - xTail );
+	}
+
+	ulHeader = *( ( uint32_t * ) &( pxStreamBuffer->pucBuffer[ xTail ] ) );
+	if( ulHeader == sbPADDING )
+	{
+		xTail = 0U;
+		ulHeader = *( ( uint32_t * ) &( pxStreamBuffer->pucBuffer[ 0 ] ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	*pxStart = xTail + sbHEADER_SIZE;
+
+	return ( size_t ) ulHeader;
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsume( StreamBuffer_t * const pxStreamBuffer, size_t xLength, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+size_t xStart, xAvailable, xNewTail;
+UBaseType_t uxSavedInterruptStatus = 0;
+
+	xAvailable = prvPeek( pxStreamBuffer, &xStart );
+
+	if( pxStreamBuffer->xIsMessageBuffer != pdFALSE )
+	{
+		if( xAvailable == 0U )
+		{
+			return;
+		}
+
+		xNewTail = xStart - sbHEADER_SIZE + sbMESSAGE_SPACE( xAvailable );
+	}
+	else
+	{
+		configASSERT( xLength <= prvBytesInBuffer( pxStreamBuffer ) );
+
+		if( xLength == 0U )
+		{
+			return;
+		}
+
+		xNewTail = xStart + xLength;
+	}
+
+	if( xNewTail >= pxStreamBuffer->xLength )
+	{
+		xNewTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxHigherPriorityTaskWoken == NULL )
+	{
+		taskENTER_CRITICAL();
+	}
+	else
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	}
+	{
+		sbCOMPILER_BARRIER();
+		pxStreamBuffer->xTail = xNewTail;
+
+		/* The writer checks again whether enough space is free now. */
+		if( pxStreamBuffer->xTaskWaitingToSend != NULL )
+		{
+			if( pxHigherPriorityTaskWoken == NULL )
+			{
+				( void ) xTaskNotifyGive( pxStreamBuffer->xTaskWaitingToSend );
+			}
+			else
+			{
+				vTaskNotifyGiveFromISR( pxStreamBuffer->xTaskWaitingToSend, pxHigherPriorityTaskWoken );
+			}
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	if( pxHigherPriorityTaskWoken == NULL )
+	{
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWrite( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+const uint8_t *pucData = ( const uint8_t * ) pvTxData;
+size_t xCount, xTotal = 0U;
+
+	/* For a stream buffer the free space may be in two parts. */
+	do
+	{
+		xCount = prvReserve( pxStreamBuffer, xDataLengthBytes - xTotal );
+		if( xCount == 0U )
+		{
+			break;
+		}
+
+		if( pxStreamBuffer->xIsMessageBuffer != pdFALSE )
+		{
+			memcpy( ( void * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xReservedStart + sbHEADER_SIZE ] ), ( const void * ) pucData, xCount );
+		}
+		else
+		{
+			memcpy( ( void * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xReservedStart ] ), ( const void * ) &( pucData[ xTotal ] ), xCount );
+		}
+
+		prvCommit( pxStreamBuffer, xCount, pxHigherPriorityTaskWoken );
+		xTotal += xCount;
+
+	} while( ( pxStreamBuffer->xIsMessageBuffer == pdFALSE ) && ( xTotal < xDataLengthBytes ) );
+
+	return xTotal;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvRead( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+uint8_t *pucData = ( uint8_t * ) pvRxData;
+size_t xStart, xCount, xTotal = 0U;
+
+	do
+	{
+		xCount = prvPeek( pxStreamBuffer, &xStart );
+		if( xCount == 0U )
+		{
+			break;
+		}
+
+		if( pxStreamBuffer->xIsMessageBuffer != pdFALSE )
+		{
+			/* A message that does not fit is left in the buffer. */
+			if( xCount > xBufferLengthBytes )
+			{
+				break;
+			}
+		}
+		else if( xCount > xBufferLengthBytes - xTotal )
+		{
+			xCount = xBufferLengthBytes - xTotal;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		memcpy( ( void * ) &( pucData[ xTotal ] ), ( const void * ) &( pxStreamBuffer->pucBuffer[ xStart ] ), xCount );
+		prvConsume( pxStreamBuffer, xCount, pxHigherPriorityTaskWoken );
+		xTotal += xCount;
+
+	} while( ( pxStreamBuffer->xIsMessageBuffer == pdFALSE ) && ( xTotal < xBufferLengthBytes ) );
+
+	return xTotal;
+}
+
@@ -94,8 +94,9 @@ privileged Vs unprivileged linkage and placement. */
 /* This entire source file will be skipped if the application is not configured
 to include software timer functionality.  This #if is closed at the very bottom
 of this file.  If you want to include software timer functionality then ensure
-configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
-#if ( configUSE_TIMERS == 1 )
+configUSE_TIMERS is set to 1 in FreeRTOSConfig.h.  timers_wheel.c is used instead
+of this file when configUSE_TIMER_WHEEL is also set to 1. */
+#if ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 0 )
 
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
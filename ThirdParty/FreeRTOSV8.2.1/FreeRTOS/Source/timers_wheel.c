@@ -0,0 +1,1122 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Alternative implementation of the software timer service, selected by
+ * setting configUSE_TIMER_WHEEL to 1 in FreeRTOSConfig.h.  It provides the
+ * same API as timers.c, but:
+ *
+ * + Active timers are held in a hierarchical timing wheel instead of sorted
+ *   lists.  Each level of the wheel has 32 slots and a bitmap of the slots
+ *   that are in use, so starting, stopping and expiring a timer is O(1)
+ *   whatever the number of active timers, and the timer service task wakes
+ *   only when a slot is due.  Timers that expire further ahead than the
+ *   wheel can hold are kept in an overflow list that is re-examined each
+ *   time the top level of the wheel wraps.
+ *
+ * + All the timers that expire on the same tick are dispatched as one batch.
+ *
+ * + Timer commands do not go through the timer queue.  The command is stored
+ *   in the timer itself and the timer is pushed onto a list of pending
+ *   timers inside a short critical section, then the timer service task is
+ *   sent a task notification.  The command functions therefore never block
+ *   and never fail, and can be used from interrupts at the same cost as from
+ *   tasks.  If several commands are sent to a timer before the timer service
+ *   task runs, only the last one is performed, except that a delete command
+ *   is never overridden.  The timer queue is only used to pass pended
+ *   function calls, and is only created if INCLUDE_xTimerPendFunctionCall is
+ *   set to 1.
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+
+#if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
+	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
+#endif
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+
+/* This entire source file will be skipped unless the timer wheel has been
+selected.  This #if is closed at the very bottom of this file. */
+#if ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 )
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use the timer wheel.
+#endif
+
+#if ( configUSE_16_BIT_TICKS == 1 )
+	#error The timer wheel requires configUSE_16_BIT_TICKS to be set to 0.
+#endif
+
+/* The number of levels in the wheel.  The wheel holds timers that expire up
+to 32 ^ configTIMER_WHEEL_LEVELS ticks ahead, 2 ^ 20 ticks with the default of
+4 levels, which takes 4 * 33 words of RAM. */
+#ifndef configTIMER_WHEEL_LEVELS
+	#define configTIMER_WHEEL_LEVELS	4
+#endif
+
+#if ( configTIMER_WHEEL_LEVELS < 1 ) || ( configTIMER_WHEEL_LEVELS > 6 )
+	#error configTIMER_WHEEL_LEVELS must be between 1 and 6.
+#endif
+
+/* Misc definitions. */
+#define tmrNO_DELAY				( TickType_t ) 0U
+#define tmrWHEEL_BITS			( 5U )
+#define tmrWHEEL_SLOTS			( 1U << tmrWHEEL_BITS )
+#define tmrWHEEL_MASK			( tmrWHEEL_SLOTS - 1U )
+
+/* The mask of the tick bits below the block covered by one slot of level
+uxLevel + 1, i.e. of all the ticks covered by level uxLevel. */
+#define tmrLEVEL_SPAN_MASK( uxLevel )	( ( TickType_t ) ( ( ( TickType_t ) 1U << ( tmrWHEEL_BITS * ( ( uxLevel ) + 1U ) ) ) - 1U ) )
+
+/* The value of ucLevel for a timer in the overflow list. */
+#define tmrOVERFLOW_LEVEL		( ( uint8_t ) configTIMER_WHEEL_LEVELS )
+
+/* The value of xPendingCommand when no command is pending on a timer. */
+#define tmrCOMMAND_NONE			( ( BaseType_t ) -3 )
+
+/* The definition of the timers themselves. */
+typedef struct tmrTimerControl
+{
+	const char				*pcTimerName;		/*<< Text name.  This is not used by the kernel, it is included simply to make debugging easier. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	struct tmrTimerControl	*pxNext;			/*<< The next timer in the same wheel slot. */
+	struct tmrTimerControl	**ppxPrev;			/*<< The pointer that references this timer in its wheel slot, or NULL if the timer is not active. */
+	struct tmrTimerControl	*pxNextPending;		/*<< The next timer in the list of timers with a pending command. */
+	TickType_t				xExpiryTime;		/*<< The tick on which the timer expires, valid while the timer is active. */
+	TickType_t				xTimerPeriodInTicks;/*<< How quickly and often the timer expires. */
+	BaseType_t				xPendingCommand;	/*<< The command waiting to be performed by the timer service task, or tmrCOMMAND_NONE. */
+	TickType_t				xPendingValue;		/*<< The value sent with the pending command. */
+	UBaseType_t				uxAutoReload;		/*<< Set to pdTRUE if the timer should be automatically restarted once expired.  Set to pdFALSE if the timer is, in effect, a one-shot timer. */
+	void 					*pvTimerID;			/*<< An ID to identify the timer.  This allows the timer to be identified when the same callback is used for multiple timers. */
+	TimerCallbackFunction_t	pxCallbackFunction;	/*<< The function that will be called when the timer expires. */
+	uint8_t					ucLevel;			/*<< The wheel level the timer is in, or tmrOVERFLOW_LEVEL. */
+	uint8_t					ucSlot;				/*<< The slot the timer is in within its level. */
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
+	#endif
+} xTIMER;
+
+/* The old xTIMER name is maintained above then typedefed to the new Timer_t
+name below to enable the use of older kernel aware debuggers. */
+typedef xTIMER Timer_t;
+
+/* One level of the wheel.  Bit n of ulOccupied is set when pxSlots[ n ] is not
+empty. */
+typedef struct tmrWheelLevel
+{
+	Timer_t		*pxSlots[ tmrWHEEL_SLOTS ];
+	uint32_t	ulOccupied;
+} WheelLevel_t;
+
+#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+
+	/* The message sent on the timer queue to request the execution of a non-timer
+	related callback. */
+	typedef struct tmrCallbackParameters
+	{
+		PendedFunction_t	pxCallbackFunction;	/* << The callback function to execute. */
+		void *pvParameter1;						/* << The value that will be used as the callback functions first parameter. */
+		uint32_t ulParameter2;					/* << The value that will be used as the callback functions second parameter. */
+	} CallbackParameters_t;
+
+#endif /* INCLUDE_xTimerPendFunctionCall */
+
+/*lint -e956 A manual analysis and inspection has been used to determine which
+static variables must be declared volatile. */
+
+/* The timing wheel.  A timer in level n, slot s expires in the same block of
+32 ^ ( n + 1 ) ticks as xWheelTime, and bits [ 5n + 4 : 5n ] of its expiry time
+are s.  The slots of a level that are not after the slot of xWheelTime are
+always empty.  Only the timer service task is allowed to access the wheel. */
+PRIVILEGED_DATA static WheelLevel_t xWheel[ configTIMER_WHEEL_LEVELS ];
+PRIVILEGED_DATA static Timer_t *pxOverflowTimers = NULL;
+
+/* The last tick that has been processed by the timer service task. */
+PRIVILEGED_DATA static TickType_t xWheelTime = ( TickType_t ) 0U;
+
+/* The timers that have a command pending.  Accessed from critical sections
+only. */
+PRIVILEGED_DATA static Timer_t * volatile pxPendingTimers = NULL;
+
+/* The timer service task, notified when a command is pending. */
+PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+
+#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+
+	/* A queue that is used to send pended function calls to the timer service
+	task. */
+	PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
+
+#endif
+
+/*lint +e956 */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Create the queue used to send pended function calls to the timer service
+ * task if it has not been created already.  Returns pdFALSE if the queue is
+ * needed but could not be created.
+ */
+static BaseType_t prvCheckForValidQueue( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * The timer service task (daemon).  Timer functionality is controlled by this
+ * task.  Other tasks and interrupts leave commands in the timers themselves
+ * and notify this task.
+ */
+static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Store a command in a timer, and add the timer to the list of timers with a
+ * pending command if it is not in it already.  Must be called with interrupts
+ * masked.
+ */
+static void prvPendTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take the list of timers with a pending command, and perform the commands.
+ */
+static void prvProcessPendingCommands( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Perform one command on a timer.  xTimeNow must not be earlier than the time
+ * at which the command was sent, nor than xWheelTime.  The wheel may not have
+ * been advanced to xTimeNow yet.
+ */
+static void prvProcessTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, TickType_t xCommandValue, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert the timer in the wheel slot, or in the overflow list, that matches
+ * its expiry time relative to xWheelTime.  xExpiryTime must not be before
+ * xWheelTime.
+ */
+static void prvInsertTimer( Timer_t * const pxTimer, const TickType_t xExpiryTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove an active timer from the wheel.
+ */
+static void prvRemoveTimer( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove all the timers from a wheel slot, or from the overflow list, and
+ * return them as a list linked through pxNext.
+ */
+static Timer_t *prvTakeSlot( Timer_t ** const ppxHead ) PRIVILEGED_FUNCTION;
+
+/*
+ * Process all the ticks up to and including xTimeNow on which a timer expires,
+ * or on which timers have to be moved to a lower level of the wheel.
+ */
+static void prvAdvanceWheel( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * xWheelTime has reached the start of a block of one or more of the upper
+ * levels.  Move the timers of the slots that have been reached down to the
+ * lower levels.
+ */
+static void prvCascadeTimers( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Call the callbacks of all the timers that expire on tick xWheelTime, and
+ * reload the auto reload timers.
+ */
+static void prvProcessExpiredTimers( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * If the wheel contains any active timers then set *pxNextEventTime to the
+ * first tick after xWheelTime that prvAdvanceWheel() has to process, and
+ * return pdTRUE.  Otherwise return pdFALSE.
+ */
+static BaseType_t prvGetNextEventTime( TickType_t * const pxNextEventTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the index of the least significant set bit of a non zero value.
+ */
+static UBaseType_t prvLowestSetBit( const uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+
+	/*
+	 * Execute the function calls received on the timer queue.
+	 */
+	static void prvProcessPendedFunctionCalls( void ) PRIVILEGED_FUNCTION;
+
+#endif /* INCLUDE_xTimerPendFunctionCall */
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimerCreateTimerTask( void )
+{
+BaseType_t xReturn = pdFAIL;
+
+	/* This function is called when the scheduler is started if
+	configUSE_TIMERS is set to 1.  Check that the infrastructure used by the
+	timer service task has been created/initialised. */
+	if( prvCheckForValidQueue() != pdFALSE )
+	{
+		/* The handle is needed to notify the task, so it is always stored. */
+		xReturn = xTaskCreate( prvTimerTask, "Tmr Svc", ( uint16_t ) configTIMER_TASK_STACK_DEPTH, NULL, ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, &xTimerTaskHandle );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+Timer_t *pxNewTimer;
+
+	/* Allocate the timer structure. */
+	if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+	{
+		pxNewTimer = NULL;
+	}
+	else
+	{
+		pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+		if( pxNewTimer != NULL )
+		{
+			/* Ensure the infrastructure used by the timer service task has been
+			created/initialised. */
+			( void ) prvCheckForValidQueue();
+
+			/* Initialise the timer structure members using the function parameters. */
+			pxNewTimer->pcTimerName = pcTimerName;
+			pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
+			pxNewTimer->uxAutoReload = uxAutoReload;
+			pxNewTimer->pvTimerID = pvTimerID;
+			pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+			pxNewTimer->pxNext = NULL;
+			pxNewTimer->ppxPrev = NULL;
+			pxNewTimer->pxNextPending = NULL;
+			pxNewTimer->xPendingCommand = tmrCOMMAND_NONE;
+			pxNewTimer->xPendingValue = ( TickType_t ) 0U;
+			pxNewTimer->xExpiryTime = ( TickType_t ) 0U;
+			pxNewTimer->ucLevel = tmrOVERFLOW_LEVEL;
+			pxNewTimer->ucSlot = 0U;
+
+			traceTIMER_CREATE( pxNewTimer );
+		}
+		else
+		{
+			traceTIMER_CREATE_FAILED();
+		}
+	}
+
+	/* 0 is not a valid value for xTimerPeriodInTicks. */
+	configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+	return ( TimerHandle_t ) pxNewTimer;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait )
+{
+Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxTimer );
+	configASSERT( ( xCommandID >= ( BaseType_t ) 0 ) );
+
+	/* The command is stored in the timer, so there is never a need to wait for
+	space. */
+	( void ) xTicksToWait;
+
+	if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+	{
+		taskENTER_CRITICAL();
+		{
+			prvPendTimerCommand( pxTimer, xCommandID, xOptionalValue );
+		}
+		taskEXIT_CRITICAL();
+
+		/* The timer service task does not exist before the scheduler is
+		started.  It processes the pending commands when it first runs. */
+		if( xTimerTaskHandle != NULL )
+		{
+			( void ) xTaskNotifyGive( xTimerTaskHandle );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			prvPendTimerCommand( pxTimer, xCommandID, xOptionalValue );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( xTimerTaskHandle != NULL )
+		{
+			vTaskNotifyGiveFromISR( xTimerTaskHandle, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, pdPASS );
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+
+	TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
+	{
+		/* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
+		started, then xTimerTaskHandle will be NULL. */
+		configASSERT( ( xTimerTaskHandle != NULL ) );
+		return xTimerTaskHandle;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+const char * pcTimerGetTimerName( TimerHandle_t xTimer )
+{
+Timer_t *pxTimer = ( Timer_t * ) xTimer;
+
+	return pxTimer->pcTimerName;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPendTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue )
+{
+	if( pxTimer->xPendingCommand == tmrCOMMAND_NONE )
+	{
+		pxTimer->pxNextPending = pxPendingTimers;
+		pxPendingTimers = pxTimer;
+	}
+	else if( pxTimer->xPendingCommand == tmrCOMMAND_DELETE )
+	{
+		/* The timer is about to be deleted, nothing can override that. */
+		return;
+	}
+	else
+	{
+		/* A command is already pending and is replaced by this one. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxTimer->xPendingCommand = xCommandID;
+	pxTimer->xPendingValue = xOptionalValue;
+
+	/* The new period is kept even if a later command replaces this one before
+	it is processed, as it would have been had the commands been performed one
+	after the other. */
+	if( ( xCommandID == tmrCOMMAND_CHANGE_PERIOD ) || ( xCommandID == tmrCOMMAND_CHANGE_PERIOD_FROM_ISR ) )
+	{
+		configASSERT( ( xOptionalValue > 0 ) );
+		pxTimer->xTimerPeriodInTicks = xOptionalValue;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerTask( void *pvParameters )
+{
+TickType_t xNextEventTime, xTimeNow, xTicksToWait;
+
+	/* Just to avoid compiler warnings. */
+	( void ) pvParameters;
+
+	/* Nothing is in the wheel yet, so it can start at any time. */
+	xWheelTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		/* Perform the commands that were sent while this task was blocked or
+		running callbacks, then process the timers that have expired.  A
+		command sent before the expiry tick of a timer, a stop or a reset, is
+		therefore applied before the timer can fire, as it is by timers.c. */
+		prvProcessPendingCommands();
+		prvAdvanceWheel( xTaskGetTickCount() );
+
+		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+		{
+			prvProcessPendedFunctionCalls();
+		}
+		#endif
+
+		/* Block until the next tick that has to be processed, or until a
+		command is sent.  A command sent since the pending list was last taken
+		has left a notification, so ulTaskNotifyTake() returns at once. */
+		if( prvGetNextEventTime( &xNextEventTime ) != pdFALSE )
+		{
+			xTimeNow = xTaskGetTickCount();
+
+			if( ( xTimeNow - xWheelTime ) >= ( xNextEventTime - xWheelTime ) )
+			{
+				xTicksToWait = tmrNO_DELAY;
+			}
+			else
+			{
+				xTicksToWait = xNextEventTime - xTimeNow;
+			}
+		}
+		else
+		{
+			xTicksToWait = portMAX_DELAY;
+		}
+
+		( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessPendingCommands( void )
+{
+Timer_t *pxTimer, *pxNextPending;
+BaseType_t xCommandID;
+TickType_t xCommandValue, xTimeNow;
+
+	taskENTER_CRITICAL();
+	{
+		pxTimer = pxPendingTimers;
+		pxPendingTimers = NULL;
+	}
+	taskEXIT_CRITICAL();
+
+	while( pxTimer != NULL )
+	{
+		/* Take the command out of the timer.  A command sent after this point
+		adds the timer to the pending list again.  The time is sampled after
+		the command has been taken, so it cannot be earlier than the time at
+		which the command was sent. */
+		taskENTER_CRITICAL();
+		{
+			pxNextPending = pxTimer->pxNextPending;
+			xCommandID = pxTimer->xPendingCommand;
+			xCommandValue = pxTimer->xPendingValue;
+			pxTimer->xPendingCommand = tmrCOMMAND_NONE;
+			xTimeNow = xTaskGetTickCount();
+		}
+		taskEXIT_CRITICAL();
+
+		prvProcessTimerCommand( pxTimer, xCommandID, xCommandValue, xTimeNow );
+
+		pxTimer = pxNextPending;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, TickType_t xCommandValue, const TickType_t xTimeNow )
+{
+TickType_t xElapsed;
+
+	traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xCommandValue );
+
+	if( pxTimer->ppxPrev != NULL )
+	{
+		/* The timer is active, remove it from the wheel. */
+		prvRemoveTimer( pxTimer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	switch( xCommandID )
+	{
+		case tmrCOMMAND_START :
+		case tmrCOMMAND_START_FROM_ISR :
+		case tmrCOMMAND_RESET :
+		case tmrCOMMAND_RESET_FROM_ISR :
+		case tmrCOMMAND_START_DONT_TRACE :
+			/* Start or restart the timer, relative to the time the command was
+			sent. */
+			for( ;; )
+			{
+				/* The ticks between the command and xWheelTime, which have
+				already been processed.  None if the command was sent later. */
+				if( ( xTimeNow - xCommandValue ) > ( xTimeNow - xWheelTime ) )
+				{
+					xElapsed = xWheelTime - xCommandValue;
+				}
+				else
+				{
+					xElapsed = ( TickType_t ) 0U;
+				}
+
+				if( xElapsed < pxTimer->xTimerPeriodInTicks )
+				{
+					/* The expiry time is after xWheelTime.  If it is not after
+					xTimeNow either, prvAdvanceWheel() fires the timer in order
+					with the others. */
+					prvInsertTimer( pxTimer, xCommandValue + pxTimer->xTimerPeriodInTicks );
+					break;
+				}
+
+				/* The timer expired on a tick that the wheel has already
+				processed.  Process it now, once for each period that has
+				elapsed if it is an auto reload timer. */
+				traceTIMER_EXPIRED( pxTimer );
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+
+				if( pxTimer->uxAutoReload == ( UBaseType_t ) pdFALSE )
+				{
+					break;
+				}
+
+				xCommandValue += pxTimer->xTimerPeriodInTicks;
+			}
+			break;
+
+		case tmrCOMMAND_STOP :
+		case tmrCOMMAND_STOP_FROM_ISR :
+			/* The timer has already been removed from the wheel.  There is
+			nothing to do here. */
+			break;
+
+		case tmrCOMMAND_CHANGE_PERIOD :
+		case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+			/* The new period was written to the timer when the command was
+			sent.  The timer restarts from the current time. */
+			prvInsertTimer( pxTimer, xTimeNow + pxTimer->xTimerPeriodInTicks );
+			break;
+
+		case tmrCOMMAND_DELETE :
+			/* The timer has already been removed from the wheel, just free up
+			the memory. */
+			vPortFree( pxTimer );
+			break;
+
+		default	:
+			/* Don't expect to get here. */
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertTimer( Timer_t * const pxTimer, const TickType_t xExpiryTime )
+{
+UBaseType_t uxLevel, uxSlot;
+Timer_t **ppxHead;
+
+	pxTimer->xExpiryTime = xExpiryTime;
+
+	/* Find the lowest level that covers the expiry time, which is the lowest
+	level for which the expiry time is in the same block as xWheelTime. */
+	for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+	{
+		if( ( xExpiryTime & ~tmrLEVEL_SPAN_MASK( uxLevel ) ) == ( xWheelTime & ~tmrLEVEL_SPAN_MASK( uxLevel ) ) )
+		{
+			break;
+		}
+	}
+
+	if( uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+	{
+		uxSlot = ( UBaseType_t ) ( xExpiryTime >> ( tmrWHEEL_BITS * uxLevel ) ) & tmrWHEEL_MASK;
+		ppxHead = &( xWheel[ uxLevel ].pxSlots[ uxSlot ] );
+		xWheel[ uxLevel ].ulOccupied |= ( 1UL << uxSlot );
+	}
+	else
+	{
+		/* Too far ahead for the wheel. */
+		uxSlot = 0U;
+		ppxHead = &pxOverflowTimers;
+	}
+
+	pxTimer->ucLevel = ( uint8_t ) uxLevel;
+	pxTimer->ucSlot = ( uint8_t ) uxSlot;
+
+	/* Add the timer to the front of the slot. */
+	pxTimer->pxNext = *ppxHead;
+	if( pxTimer->pxNext != NULL )
+	{
+		pxTimer->pxNext->ppxPrev = &( pxTimer->pxNext );
+	}
+	pxTimer->ppxPrev = ppxHead;
+	*ppxHead = pxTimer;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveTimer( Timer_t * const pxTimer )
+{
+	*( pxTimer->ppxPrev ) = pxTimer->pxNext;
+	if( pxTimer->pxNext != NULL )
+	{
+		pxTimer->pxNext->ppxPrev = pxTimer->ppxPrev;
+	}
+	pxTimer->ppxPrev = NULL;
+
+	if( pxTimer->ucLevel != tmrOVERFLOW_LEVEL )
+	{
+		if( xWheel[ pxTimer->ucLevel ].pxSlots[ pxTimer->ucSlot ] == NULL )
+		{
+			xWheel[ pxTimer->ucLevel ].ulOccupied &= ~( 1UL << pxTimer->ucSlot );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static Timer_t *prvTakeSlot( Timer_t ** const ppxHead )
+{
+Timer_t *pxList;
+
+	/* The timers keep their ppxPrev pointers until they are processed, so they
+	are still reported as active by xTimerIsTimerActive().  Only the head
+	pointer refers to the slot, and the list is only walked forwards. */
+	pxList = *ppxHead;
+	*ppxHead = NULL;
+
+	return pxList;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAdvanceWheel( const TickType_t xTimeNow )
+{
+TickType_t xNextEventTime;
+
+	/* Jump from one event to the next, so the ticks on which nothing happens
+	cost nothing. */
+	while( prvGetNextEventTime( &xNextEventTime ) != pdFALSE )
+	{
+		if( ( xNextEventTime - xWheelTime ) > ( xTimeNow - xWheelTime ) )
+		{
+			break;
+		}
+
+		xWheelTime = xNextEventTime;
+		prvCascadeTimers();
+		prvProcessExpiredTimers();
+	}
+
+	/* There is nothing to do on the remaining ticks, including the crossing
+	of block boundaries, as the slots reached are empty. */
+	xWheelTime = xTimeNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCascadeTimers( void )
+{
+UBaseType_t uxLevel, uxSlot;
+Timer_t *pxList, *pxTimer;
+
+	/* Find how many levels have reached the start of a new block.  Level n + 1
+	reaches a new block when the low 5 * ( n + 1 ) bits of the time are 0. */
+	uxLevel = 0U;
+	while( ( uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS ) && ( ( xWheelTime & tmrLEVEL_SPAN_MASK( uxLevel ) ) == ( TickType_t ) 0U ) )
+	{
+		uxLevel++;
+	}
+
+	if( uxLevel == ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+	{
+		/* The top level has wrapped.  The timers of the overflow list that now
+		fall within the wheel move into it. */
+		pxList = prvTakeSlot( &pxOverflowTimers );
+
+		while( pxList != NULL )
+		{
+			pxTimer = pxList;
+			pxList = pxTimer->pxNext;
+			prvInsertTimer( pxTimer, pxTimer->xExpiryTime );
+		}
+
+		uxLevel--;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Move the timers down from the highest level first, as they can go to a
+	slot of a lower level that has also been reached.  Level 0 is processed by
+	prvProcessExpiredTimers(). */
+	while( uxLevel > 0U )
+	{
+		uxSlot = ( UBaseType_t ) ( xWheelTime >> ( tmrWHEEL_BITS * uxLevel ) ) & tmrWHEEL_MASK;
+
+		if( ( xWheel[ uxLevel ].ulOccupied & ( 1UL << uxSlot ) ) != 0UL )
+		{
+			xWheel[ uxLevel ].ulOccupied &= ~( 1UL << uxSlot );
+			pxList = prvTakeSlot( &( xWheel[ uxLevel ].pxSlots[ uxSlot ] ) );
+
+			while( pxList != NULL )
+			{
+				pxTimer = pxList;
+				pxList = pxTimer->pxNext;
+				prvInsertTimer( pxTimer, pxTimer->xExpiryTime );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxLevel--;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessExpiredTimers( void )
+{
+UBaseType_t uxSlot;
+Timer_t *pxList, *pxTimer;
+
+	uxSlot = ( UBaseType_t ) xWheelTime & tmrWHEEL_MASK;
+
+	if( ( xWheel[ 0 ].ulOccupied & ( 1UL << uxSlot ) ) != 0UL )
+	{
+		/* Every timer in the slot expires now.  Take them all at once so the
+		batch is not affected by the auto reload timers that are inserted
+		again. */
+		xWheel[ 0 ].ulOccupied &= ~( 1UL << uxSlot );
+		pxList = prvTakeSlot( &( xWheel[ 0 ].pxSlots[ uxSlot ] ) );
+
+		while( pxList != NULL )
+		{
+			pxTimer = pxList;
+			pxList = pxTimer->pxNext;
+			pxTimer->ppxPrev = NULL;
+			traceTIMER_EXPIRED( pxTimer );
+
+			/* If the timer is an auto reload timer then calculate the next
+			expiry time and re-insert the timer in the wheel before calling the
+			callback, as timers.c does. */
+			if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+			{
+				prvInsertTimer( pxTimer, xWheelTime + pxTimer->xTimerPeriodInTicks );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Call the timer callback.  Commands sent by the callback are
+			pending until the whole batch has been dispatched. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGetNextEventTime( TickType_t * const pxNextEventTime )
+{
+UBaseType_t uxLevel, uxIndex;
+uint32_t ulPending;
+
+	/* Any slot in use at a level is reached before any slot in use at the
+	levels above it, so the first level with a slot in use after the slot of
+	xWheelTime gives the next event. */
+	for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+	{
+		uxIndex = ( UBaseType_t ) ( xWheelTime >> ( tmrWHEEL_BITS * uxLevel ) ) & tmrWHEEL_MASK;
+		ulPending = xWheel[ uxLevel ].ulOccupied & ~( ( 2UL << uxIndex ) - 1UL );
+
+		if( ulPending != 0UL )
+		{
+			/* The first tick of the slot, in the block of xWheelTime. */
+			*pxNextEventTime = ( xWheelTime & ~tmrLEVEL_SPAN_MASK( uxLevel ) ) | ( ( TickType_t ) prvLowestSetBit( ulPending ) << ( tmrWHEEL_BITS * uxLevel ) );
+			return pdTRUE;
+		}
+	}
+
+	if( pxOverflowTimers != NULL )
+	{
+		/* The overflow list is examined again when the top level wraps. */
+		*pxNextEventTime = ( xWheelTime | tmrLEVEL_SPAN_MASK( configTIMER_WHEEL_LEVELS - 1U ) ) + ( TickType_t ) 1U;
+		return pdTRUE;
+	}
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvLowestSetBit( const uint32_t ulValue )
+{
+static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+{
+	0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+	31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+};
+
+	/* Isolate the lowest set bit and look its position up. */
+	return ( UBaseType_t ) ucDeBruijnBitPosition[ ( uint32_t ) ( ( ulValue & ( 0UL - ulValue ) ) * 0x077CB531UL ) >> 27 ];
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCheckForValidQueue( void )
+{
+BaseType_t xReturn = pdTRUE;
+
+	#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+	{
+		/* Check that the queue used to send pended function calls to the timer
+		service has been initialised. */
+		taskENTER_CRITICAL();
+		{
+			if( xTimerQueue == NULL )
+			{
+				xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( CallbackParameters_t ) );
+				configASSERT( xTimerQueue );
+
+				#if ( configQUEUE_REGISTRY_SIZE > 0 )
+				{
+					if( xTimerQueue != NULL )
+					{
+						vQueueAddToRegistry( xTimerQueue, "TmrQ" );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configQUEUE_REGISTRY_SIZE */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xTimerQueue == NULL )
+			{
+				xReturn = pdFALSE;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	#endif /* INCLUDE_xTimerPendFunctionCall */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer )
+{
+BaseType_t xTimerIsInWheel;
+Timer_t *pxTimer = ( Timer_t * ) xTimer;
+
+	/* Is the timer in the wheel? */
+	taskENTER_CRITICAL();
+	{
+		xTimerIsInWheel = ( pxTimer->ppxPrev != NULL ) ? pdTRUE : pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+
+	return xTimerIsInWheel;
+} /*lint !e818 Can't be pointer to const due to the typedef. */
+/*-----------------------------------------------------------*/
+
+void *pvTimerGetTimerID( const TimerHandle_t xTimer )
+{
+Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+void *pvReturn;
+
+	configASSERT( xTimer );
+
+	taskENTER_CRITICAL();
+	{
+		pvReturn = pxTimer->pvTimerID;
+	}
+	taskEXIT_CRITICAL();
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTimerSetTimerID( const TimerHandle_t xTimer, void *pvNewID )
+{
+Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+	configASSERT( xTimer );
+
+	taskENTER_CRITICAL();
+	{
+		pxTimer->pvTimerID = pvNewID;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTimerPendFunctionCall == 1 )
+
+	static void prvProcessPendedFunctionCalls( void )
+	{
+	CallbackParameters_t xCallback;
+
+		while( xQueueReceive( xTimerQueue, &xCallback, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xCallback does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+		{
+			/* Check the callback is not NULL, then call the function. */
+			configASSERT( xCallback.pxCallbackFunction );
+			xCallback.pxCallbackFunction( xCallback.pvParameter1, xCallback.ulParameter2 );
+		}
+	}
+
+#endif /* INCLUDE_xTimerPendFunctionCall */
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTimerPendFunctionCall == 1 )
+
+	BaseType_t xTimerPendFunctionCallFromISR( PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	CallbackParameters_t xCallback;
+	BaseType_t xReturn;
+
+		/* Complete the message with the function parameters and post it to the
+		daemon task. */
+		xCallback.pxCallbackFunction = xFunctionToPend;
+		xCallback.pvParameter1 = pvParameter1;
+		xCallback.ulParameter2 = ulParameter2;
+
+		xReturn = xQueueSendFromISR( xTimerQueue, &xCallback, pxHigherPriorityTaskWoken );
+
+		/* The timer service task blocks on its notification, not on the
+		queue. */
+		if( ( xReturn == pdPASS ) && ( xTimerTaskHandle != NULL ) )
+		{
+			vTaskNotifyGiveFromISR( xTimerTaskHandle, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
+
+		return xReturn;
+	}
+
+#endif /* INCLUDE_xTimerPendFunctionCall */
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTimerPendFunctionCall == 1 )
+
+	BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, TickType_t xTicksToWait )
+	{
+	CallbackParameters_t xCallback;
+	BaseType_t xReturn;
+
+		/* This function can only be called after a timer has been created or
+		after the scheduler has been started because, until then, the timer
+		queue does not exist. */
+		configASSERT( xTimerQueue );
+
+		/* Complete the message with the function parameters and post it to the
+		daemon task. */
+		xCallback.pxCallbackFunction = xFunctionToPend;
+		xCallback.pvParameter1 = pvParameter1;
+		xCallback.ulParameter2 = ulParameter2;
+
+		xReturn = xQueueSendToBack( xTimerQueue, &xCallback, xTicksToWait );
+
+		if( ( xReturn == pdPASS ) && ( xTimerTaskHandle != NULL ) )
+		{
+			( void ) xTaskNotifyGive( xTimerTaskHandle );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
+
+		return xReturn;
+	}
+
+#endif /* INCLUDE_xTimerPendFunctionCall */
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped unless the application has selected
+the timer wheel.  If you want to use it then ensure configUSE_TIMERS and
+configUSE_TIMER_WHEEL are both set to 1 in FreeRTOSConfig.h. */
+#endif /* ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) */
@@ -87,8 +87,13 @@ u16_t uip_hostaddr[2];
 u16_t uip_arp_draddr[2], uip_arp_netmask[2];
 #endif /* UIP_FIXEDADDR */
 
+#if UIP_EXTERNAL_BUFFER
+u8_t *uip_buf;                 /* Points to the packet buffer of the
+				  device driver. */
+#else /* UIP_EXTERNAL_BUFFER */
 u8_t uip_buf[UIP_BUFSIZE+2];   /* The packet buffer that contains
 				incoming packets. */
+#endif /* UIP_EXTERNAL_BUFFER */
 volatile u8_t *uip_appdata;  /* The uip_appdata pointer points to
 				application data. */
 volatile u8_t *uip_sappdata;  /* The uip_appdata pointer points to the
@@ -320,8 +320,16 @@ void uip_init(void);
     hwsend(uip_appdata, uip_len - 40 - UIP_LLH_LEN);
  }
  \endcode
+ *
+ * \note If UIP_EXTERNAL_BUFFER is set, uip_buf is a pointer and the
+ * device driver must point it to a buffer of at least UIP_BUFSIZE + 2
+ * bytes before calling into uIP.
  */
+#if UIP_EXTERNAL_BUFFER
+extern u8_t *uip_buf;
+#else /* UIP_EXTERNAL_BUFFER */
 extern u8_t uip_buf[UIP_BUFSIZE+2];
+#endif /* UIP_EXTERNAL_BUFFER */
 
 /** @} */
 